@@ -0,0 +1,18 @@
+# Find LZ4 dependency
+#
+# This module defines
+#  lz4_INCLUDE_DIRS
+#  lz4_LIBRARIES
+#  lz4_FOUND
+
+start_find_package(lz4)
+
+if(USE_BUNDLED_LIBRARIES)
+	set(lz4_INSTALL_DIR ${BSF_SOURCE_DIR}/../Dependencies/lz4 CACHE PATH "")
+endif()
+gen_default_lib_search_dirs(lz4)
+
+find_imported_includes(lz4 lz4.h)
+find_imported_library(lz4 lz4)
+
+end_find_package(lz4 lz4)
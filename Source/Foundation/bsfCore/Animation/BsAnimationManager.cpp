@@ -224,6 +224,25 @@ namespace bs
 			// Animate bones
 			anim->skeleton->getPose(boneDst, anim->skeletonPose, anim->skeletonMask, anim->layers, anim->numLayers);
 
+			// Keep the previous version if the pose didn't change (e.g. paused or idle animation), so the renderer can
+			// skip uploading it
+			poseInfo.version = 0;
+
+			auto iterFind = prevRenderData.infos.find(anim->id);
+			if (iterFind != prevRenderData.infos.end())
+			{
+				const EvaluatedAnimationData::PoseInfo& prevPoseInfo = iterFind->second.poseInfo;
+				if (prevPoseInfo.version != 0 && prevPoseInfo.numBones == numBones)
+				{
+					const Matrix4* prevBones = prevRenderData.transforms.data() + prevPoseInfo.startIdx;
+					if (memcmp(prevBones, boneDst, numBones * sizeof(Matrix4)) == 0)
+						poseInfo.version = prevPoseInfo.version;
+				}
+			}
+
+			if (poseInfo.version == 0)
+				poseInfo.version = mNextPoseVersion++;
+
 			curBoneIdx += numBones;
 			hasAnimInfo = true;
 		}
@@ -233,6 +252,7 @@ namespace bs
 			poseInfo.animId = anim->id;
 			poseInfo.startIdx = 0;
 			poseInfo.numBones = 0;
+			poseInfo.version = 0;
 		}
 
 		// Reset mapped SO transform
@@ -25,6 +25,12 @@ namespace bs
 			UINT64 animId;
 			UINT32 startIdx;
 			UINT32 numBones;
+
+			/** 
+			 * Identifier of the pose contents. Changes whenever any of the pose's bone transforms change, and is unique
+			 * across all animations. 0 is considered an invalid version.
+			 */
+			UINT64 version;
 		};
 
 		/** Contains data about a calculated morph shape. */
@@ -116,6 +122,7 @@ namespace bs
 
 		UINT64 mNextId = 1;
 		UnorderedMap<UINT64, Animation*> mAnimations;
+		std::atomic<UINT64> mNextPoseVersion { 1 };
 		
 		float mUpdateRate = 1.0f / 60.0f;
 		float mAnimationTime = 0.0f;
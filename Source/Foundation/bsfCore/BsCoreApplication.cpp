@@ -45,6 +45,7 @@
 #include "Renderer/BsParamBlocks.h"
 #include "Particles/BsParticleManager.h"
 #include "Particles/BsVectorField.h"
+#include "Text/BsFontManager.h"
 
 namespace bs
 {
@@ -72,6 +73,7 @@ namespace bs
 		ct::ParamBlockManager::shutDown();
 		StringTableManager::shutDown();
 		Resources::shutDown();
+		FontManager::shutDown();
 		GameObjectManager::shutDown();
 
 		// Audio manager must be released before the ResourceListenerManager, as any one-shot audio sources need to be
@@ -114,6 +116,8 @@ namespace bs
 		MessageHandler::shutDown();
 		ShaderManager::shutDown();
 
+		gDebug().getLog().stopAsync();
+
 		MemStack::endThread();
 		Platform::_shutDown();
 
@@ -127,6 +131,9 @@ namespace bs
 		Platform::_startUp();
 		MemStack::beginThread();
 
+		// Process log messages on a background thread, so logging doesn't contend on a lock
+		gDebug().getLog().startAsync();
+
 		ShaderManager::startUp(getShaderIncludeHandler());
 		MessageHandler::startUp();
 		ProfilerCPU::startUp();
@@ -169,6 +176,7 @@ namespace bs
 		AudioManager::startUp(mStartUpDesc.audio);
 		AnimationManager::startUp();
 		ParticleManager::startUp();
+		FontManager::startUp();
 
 		for (auto& importerName : mStartUpDesc.importers)
 			loadPlugin(importerName);
@@ -247,6 +255,7 @@ namespace bs
 			PROFILE_CALL(gSceneManager()._update(), "Scene update");
 			gAudio()._update();
 			gPhysics().update();
+			FontManager::instance()._update();
 
 			// Update plugins
 			for (auto& pluginUpdateFunc : mPluginUpdateFunctions)
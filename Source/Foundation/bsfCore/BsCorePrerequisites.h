@@ -345,6 +345,9 @@ namespace bs
 	class RendererFactory;
 	class HardwareBufferManager;
 	class FontManager;
+	class GlyphCache;
+	class GlyphRasterizer;
+	class GlyphRasterizerFactory;
 	class RenderStateManager;
 	class GpuParamBlock;
 	struct GpuParamDesc;
@@ -371,11 +374,13 @@ namespace bs
 	class VideoOutputInfo;
 	class VideoModeInfo;
 	struct SubMesh;
+	struct MeshLOD;
 	class IResourceListener;
 	class TextureProperties;
 	class IShaderIncludeHandler;
 	class Prefab;
 	class PrefabDiff;
+	class PrefabPool;
 	class RendererMeshData;
 	class Win32Window;
 	class RenderAPIFactory;
@@ -405,7 +410,10 @@ namespace bs
 	class Resource;
 	class Resources;
 	class ResourceManifest;
+	class ResourcePackage;
+	class SavedResourceData;
 	class MeshBase;
+	class MeshProperties;
 	class TransientMesh;
 	class MeshHeap;
 	class Font;
@@ -648,6 +656,7 @@ namespace bs
 		TID_RenderTarget = 1193,
 		TID_RenderTexture = 1194,
 		TID_RenderWindow = 1195,
+		TID_MeshLOD = 1196,
 
 		// Moved from Engine layer
 		TID_CCamera = 30000,
@@ -83,6 +83,7 @@ set(BS_CORE_INC_SCENE
 	"bsfCore/Scene/BsPrefab.h"
 	"bsfCore/Scene/BsPrefabDiff.h"
 	"bsfCore/Scene/BsPrefabUtility.h"
+	"bsfCore/Scene/BsPrefabPool.h"
 	"bsfCore/Scene/BsTransform.h"
 	"bsfCore/Scene/BsSceneActor.h"
 )
@@ -199,6 +200,7 @@ set(BS_CORE_INC_MATERIAL
 	"bsfCore/Material/BsPass.h"
 	"bsfCore/Material/BsMaterial.h"
 	"bsfCore/Material/BsMaterialParam.h"
+	"bsfCore/Material/BsMaterialParamId.h"
 	"bsfCore/Material/BsShaderManager.h"
 	"bsfCore/Material/BsMaterialParams.h"
 	"bsfCore/Material/BsGpuParamsSet.h"
@@ -209,6 +211,7 @@ set(BS_CORE_INC_MATERIAL
 set(BS_CORE_INC_RESOURCES
 	"bsfCore/Resources/BsResources.h"
 	"bsfCore/Resources/BsResourceManifest.h"
+	"bsfCore/Resources/BsResourcePackage.h"
 	"bsfCore/Resources/BsResourceHandle.h"
 	"bsfCore/Resources/BsResource.h"
 	"bsfCore/Resources/BsGpuResourceData.h"
@@ -245,6 +248,8 @@ set(BS_CORE_INC_TEXT
 	"bsfCore/Text/BsFontImportOptions.h"
 	"bsfCore/Text/BsFontDesc.h"
 	"bsfCore/Text/BsFont.h"
+	"bsfCore/Text/BsGlyphCache.h"
+	"bsfCore/Text/BsFontManager.h"
 )
 
 set(BS_CORE_SRC_PROFILING
@@ -415,6 +420,7 @@ set(BS_CORE_SRC_RESOURCES
 	"bsfCore/Resources/BsResource.cpp"
 	"bsfCore/Resources/BsResourceHandle.cpp"
 	"bsfCore/Resources/BsResourceManifest.cpp"
+	"bsfCore/Resources/BsResourcePackage.cpp"
 	"bsfCore/Resources/BsResources.cpp"
 	"bsfCore/Resources/BsResourceMetaData.cpp"
 	"bsfCore/Resources/BsSavedResourceData.cpp"
@@ -443,6 +449,7 @@ set(BS_CORE_SRC_MATERIAL
 	"bsfCore/Material/BsShader.cpp"
 	"bsfCore/Material/BsTechnique.cpp"
 	"bsfCore/Material/BsMaterialParam.cpp"
+	"bsfCore/Material/BsMaterialParamId.cpp"
 	"bsfCore/Material/BsShaderManager.cpp"
 	"bsfCore/Material/BsMaterialParams.cpp"
 	"bsfCore/Material/BsGpuParamsSet.cpp"
@@ -464,6 +471,8 @@ set(BS_CORE_SRC_TEXT
 	"bsfCore/Text/BsFont.cpp"
 	"bsfCore/Text/BsFontImportOptions.cpp"
 	"bsfCore/Text/BsTextData.cpp"
+	"bsfCore/Text/BsGlyphCache.cpp"
+	"bsfCore/Text/BsFontManager.cpp"
 )
 
 set(BS_CORE_SRC_RENDERAPI
@@ -549,6 +558,7 @@ set(BS_CORE_SRC_SCENE
 	"bsfCore/Scene/BsPrefab.cpp"
 	"bsfCore/Scene/BsPrefabDiff.cpp"
 	"bsfCore/Scene/BsPrefabUtility.cpp"
+	"bsfCore/Scene/BsPrefabPool.cpp"
 	"bsfCore/Scene/BsTransform.cpp"
 	"bsfCore/Scene/BsSceneActor.cpp"
 )
@@ -4,6 +4,7 @@
 #include "Error/BsException.h"
 #include "CoreThread/BsCoreThread.h"
 #include "Debug/BsDebug.h"
+#include "Debug/BsTraceCapture.h"
 
 namespace bs
 {
@@ -103,8 +104,10 @@ namespace bs
 		if(commands == nullptr)
 			return;
 
+		TraceScope queueTraceScope("Command queue playback");
 		while(!commands->empty())
 		{
+			TraceScope commandTraceScope("Command");
 			QueuedCommand& command = commands->front();
 
 			if(command.returnsValue)
@@ -87,7 +87,11 @@ namespace bs
 			createCPUBuffers();
 
 			if (mInitData != nullptr)
+			{
+				// Initial data is kept along with the texture, so it must not reference the source file
+				mInitData->detachExternalBuffer();
 				updateCPUBuffers(0, *mInitData);
+			}
 		}
 
 		Resource::initialize();
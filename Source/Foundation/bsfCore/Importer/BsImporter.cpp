@@ -25,6 +25,9 @@ namespace bs
 
 	Importer::~Importer()
 	{
+		// Wait for any queued imports to finish before the importers are destroyed
+		mImportQueues.clear();
+
 		for(auto i = mAssetImporters.begin(); i != mAssetImporters.end(); ++i)
 		{
 			if((*i) != nullptr)
@@ -259,19 +262,40 @@ namespace bs
 	{
 		ImporterAsyncMode asyncMode = importer->getAsyncMode();
 
+		// Reentrant importers can import multiple files at once, limited only by the importer's concurrency limit
+		if(asyncMode == ImporterAsyncMode::Multi)
+		{
+			SPtr<BoundedTaskQueue> queue;
+			{
+				Lock lock(mImportQueueMutex);
+
+				SPtr<BoundedTaskQueue>& entry = mImportQueues[importer];
+				if(entry == nullptr)
+				{
+					entry = bs_shared_ptr_new<BoundedTaskQueue>("ImportWorker", 
+						importer->getMaxConcurrentImports());
+				}
+
+				queue = entry;
+			}
+
+			queue->push([importer, inputFilePath, importOptions, uuid, op]
+			{
+				doImport(op, importer, inputFilePath, uuid, importOptions);
+			});
+
+			return;
+		}
+
 		// If the importer only supports single thread import, the tasks need to be chained using dependencies so they get
 		// executed in sequence
-		UINT64 taskId = 0;
 		SPtr<Task> dependency;
-		if(asyncMode == ImporterAsyncMode::Single)
-		{
-			mLastTaskMutex.lock();
-			taskId = mTaskId++;
+		mLastTaskMutex.lock();
+		UINT64 taskId = mTaskId++;
 
-			auto iterFind = mLastQueuedTask.find(importer);
-			if(iterFind != mLastQueuedTask.end())
-				dependency = iterFind->second.task;
-		}
+		auto iterFind = mLastQueuedTask.find(importer);
+		if(iterFind != mLastQueuedTask.end())
+			dependency = iterFind->second.task;
 
 		SPtr<Task> task = Task::create("ImportWorker", 
 		[this, importer, inputFilePath, importOptions, uuid, taskId, op] 
@@ -292,11 +316,8 @@ namespace bs
 
 		}, TaskPriority::Normal, dependency);
 
-		if(asyncMode == ImporterAsyncMode::Single)
-		{
-			mLastQueuedTask[importer] = QueuedTask(task, taskId);
-			mLastTaskMutex.unlock();
-		}
+		mLastQueuedTask[importer] = QueuedTask(task, taskId);
+		mLastTaskMutex.unlock();
 
 		TaskScheduler::instance().addTask(task);
 	}
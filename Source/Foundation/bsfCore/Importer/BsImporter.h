@@ -177,7 +177,9 @@ namespace bs
 
 		/** 
 		 * Queues resource for import on a secondary thread. The system will execute the import as soon as possible
-		 * and write the resulting resource to the provided @p op object. 
+		 * and write the resulting resource to the provided @p op object. Imports using importers that don't support
+		 * multi-threaded import execute one after another, while others execute in parallel, up to the importer's
+		 * concurrency limit.
 		 */
 		template<class ReturnType>
 		void queueForImport(SpecificImporter* importer, const Path& inputFilePath, 
@@ -220,6 +222,10 @@ namespace bs
 		};
 
 		UnorderedMap<SpecificImporter*, QueuedTask> mLastQueuedTask;
+
+		/** Queues limiting the number of concurrent async imports, per importer that supports ImporterAsyncMode::Multi. */
+		UnorderedMap<SpecificImporter*, SPtr<BoundedTaskQueue>> mImportQueues;
+		Mutex mImportQueueMutex;
 	};
 
 	/** Provides easier access to Importer. */
@@ -125,6 +125,37 @@ namespace bs
 		BS_SCRIPT_EXPORT()
 		float importScale = 1.0f;
 
+		/**
+		 * Screen sizes at which simplified versions (levels of detail) of the mesh should be used, one per generated level,
+		 * in descending order. Screen size is the diameter of the mesh's bounds relative to the viewport height. No levels
+		 * of detail are generated if empty.
+		 */
+		BS_SCRIPT_EXPORT()
+		Vector<float> lodScreenSizes;
+
+		/** 
+		 * Fraction of triangles each generated level of detail keeps, relative to the previous level. Only relevant if
+		 * @p lodScreenSizes is not empty.
+		 */
+		BS_SCRIPT_EXPORT()
+		float lodReduction = 0.5f;
+
+		/**
+		 * Determines if the imported mesh should be optimized for rendering. This welds identical vertices, removes
+		 * degenerate triangles and reorders triangles and vertices for better GPU vertex cache and fetch efficiency.
+		 */
+		BS_SCRIPT_EXPORT()
+		bool optimizeMesh = true;
+
+		/**
+		 * Determines if vertices of the imported mesh should be stored in compact formats: positions quantized to 16 bits
+		 * relative to the mesh bounds, normals and tangents as 16-bit octahedral vectors and texture coordinates as half
+		 * floats. This roughly halves the vertex memory and bandwidth use. Shaders using the renderer's standard vertex 
+		 * input decode the vertices automatically.
+		 */
+		BS_SCRIPT_EXPORT()
+		bool compressVertices = false;
+
 		/**	
 		 * Determines what type (if any) of collision mesh should be imported. If enabled the collision mesh will be
 		 * available as a sub-resource returned by the importer (along with the normal mesh). 
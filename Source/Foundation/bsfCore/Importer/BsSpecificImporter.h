@@ -25,7 +25,10 @@ namespace bs
 	{
 		/** Asynchronous import is supported but only on a single thread. */
 		Single,
-		/** Asynchronous import for multiple simultaneous threads is supported. */
+		/** 
+		 * Asynchronous import for multiple simultaneous threads is supported. The importer must be reentrant, as multiple
+		 * files may be imported by it at the same time (up to SpecificImporter::getMaxConcurrentImports()).
+		 */
 		Multi
 	};
 
@@ -55,6 +58,13 @@ namespace bs
 		/** Returns the level of asynchronous import supported by this importer. */
 		virtual ImporterAsyncMode getAsyncMode() const { return ImporterAsyncMode::Multi; }
 
+		/**
+		 * Returns the maximum number of files this importer may import at the same time, when queued for asynchronous
+		 * import. Only relevant if getAsyncMode() returns ImporterAsyncMode::Multi. Zero means the number of task
+		 * scheduler worker threads is used as the limit.
+		 */
+		virtual UINT32 getMaxConcurrentImports() const { return 0; }
+
 		/**
 		 * Imports the given file. If file contains more than one resource only the primary resource is imported (for 
 		 * example for an FBX a mesh would be imported, but animations ignored).
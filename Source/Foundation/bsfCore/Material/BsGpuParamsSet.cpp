@@ -799,6 +799,59 @@ namespace bs
 			bs_frame_free(offsets);
 		}
 		bs_frame_clear();
+
+		// Build a reverse mapping from material parameters to the entries they update, so dirty parameters can be
+		// updated without iterating over all entries
+		const UINT32 numParams = params->getNumParams();
+		mParamTargetOffsets.resize(numParams + 1, 0);
+
+		auto forEachTarget = [this](auto func)
+		{
+			for (UINT32 i = 0; i < (UINT32)mDataParamInfos.size(); i++)
+				func(mDataParamInfos[i].paramIdx, ParamTarget { ParamTargetType::Data, 0, 0, i });
+
+			for (UINT32 i = 0; i < (UINT32)mPassParams.size(); i++)
+			{
+				for (UINT32 j = 0; j < NUM_STAGES; j++)
+				{
+					const StageParamInfo& stageInfo = mPassParamInfos[i].stages[j];
+
+					for (UINT32 k = 0; k < stageInfo.numTextures; k++)
+						func(stageInfo.textures[k].paramIdx, ParamTarget { ParamTargetType::Texture, i, j, k });
+
+					for (UINT32 k = 0; k < stageInfo.numLoadStoreTextures; k++)
+					{
+						func(stageInfo.loadStoreTextures[k].paramIdx, 
+							ParamTarget { ParamTargetType::LoadStoreTexture, i, j, k });
+					}
+
+					for (UINT32 k = 0; k < stageInfo.numBuffers; k++)
+						func(stageInfo.buffers[k].paramIdx, ParamTarget { ParamTargetType::Buffer, i, j, k });
+
+					for (UINT32 k = 0; k < stageInfo.numSamplerStates; k++)
+					{
+						func(stageInfo.samplerStates[k].paramIdx, 
+							ParamTarget { ParamTargetType::SamplerState, i, j, k });
+					}
+				}
+			}
+		};
+
+		forEachTarget([this](UINT32 paramIdx, const ParamTarget& target)
+		{
+			mParamTargetOffsets[paramIdx + 1]++;
+		});
+
+		for (UINT32 i = 0; i < numParams; i++)
+			mParamTargetOffsets[i + 1] += mParamTargetOffsets[i];
+
+		mParamTargets.resize(mParamTargetOffsets[numParams]);
+
+		Vector<UINT32> writeOffsets(mParamTargetOffsets.begin(), mParamTargetOffsets.end() - 1);
+		forEachTarget([this, &writeOffsets](UINT32 paramIdx, const ParamTarget& target)
+		{
+			mParamTargets[writeOffsets[paramIdx]++] = target;
+		});
 	}
 
 	template<bool Core>
@@ -885,9 +938,14 @@ namespace bs
 	template<bool Core>
 	void TGpuParamsSet<Core>::update(const SPtr<MaterialParamsType>& params, float t, bool updateAll)
 	{
-		// Note: Instead of iterating over every single parameter, it might be more efficient for @p params to keep
-		// a ring buffer and a version number. Then we could just iterate over the ring buffer and only access dirty
-		// parameters. If the version number is too high (larger than ring buffer can store), then we force update for all.
+		// Animated parameters need to be re-evaluated every update, so they always require a full update
+		if (!updateAll && !mHasAnimatedParams && updateDirty(params, t))
+		{
+			mParamVersion = params->getParamVersion();
+			return;
+		}
+
+		mHasAnimatedParams = false;
 
 		// Update data params
 		for(auto& paramInfo : mDataParamInfos)
@@ -897,283 +955,405 @@ namespace bs
 				continue;
 
 			const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
-			UINT32 arraySize = materialParamInfo->arraySize == 0 ? 1 : materialParamInfo->arraySize;
 			
-			bool isAnimated = false;
-			for(UINT32 i = 0; i < arraySize; i++)
+			bool isAnimated = isDataParamAnimated(params, *materialParamInfo);
+			if (isAnimated)
+				mHasAnimatedParams = true;
+
+			if (materialParamInfo->version <= mParamVersion && !updateAll && !isAnimated)
+				continue;
+
+			updateDataParam(params, paramInfo, t, isAnimated);
+		}
+
+		// Update object params
+		const auto numPasses = (UINT32)mPassParams.size();
+
+		for(UINT32 i = 0; i < numPasses; i++)
+		{
+			SPtr<GpuParamsType> paramPtr = mPassParams[i];
+
+			for(UINT32 j = 0; j < NUM_STAGES; j++)
 			{
-				isAnimated = params->isAnimated(*materialParamInfo, i);
-				if(isAnimated)
-					break;
+				const StageParamInfo& stageInfo = mPassParamInfos[i].stages[j];
+
+				auto updateObjectParams = [this, &params, updateAll, i](ParamTargetType type, 
+					const ObjectParamInfo* paramInfos, UINT32 numParamInfos)
+				{
+					for (UINT32 k = 0; k < numParamInfos; k++)
+					{
+						const ObjectParamInfo& paramInfo = paramInfos[k];
+
+						const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
+						if (materialParamInfo->version <= mParamVersion && !updateAll)
+							continue;
+
+						updateObjectParam(params, type, i, paramInfo);
+					}
+				};
+
+				updateObjectParams(ParamTargetType::Texture, stageInfo.textures, stageInfo.numTextures);
+				updateObjectParams(ParamTargetType::LoadStoreTexture, stageInfo.loadStoreTextures, 
+					stageInfo.numLoadStoreTextures);
+				updateObjectParams(ParamTargetType::Buffer, stageInfo.buffers, stageInfo.numBuffers);
+				updateObjectParams(ParamTargetType::SamplerState, stageInfo.samplerStates, stageInfo.numSamplerStates);
 			}
 
-			if (materialParamInfo->version <= mParamVersion && !updateAll && !isAnimated)
+			paramPtr->_markCoreDirty();
+		}
+
+		mParamVersion = params->getParamVersion();
+	}
+
+	template<bool Core>
+	bool TGpuParamsSet<Core>::updateDirty(const SPtr<MaterialParamsType>& params, float t)
+	{
+		const UINT64 paramVersion = params->getParamVersion();
+		if (mParamVersion == 0 || paramVersion < mParamVersion)
+			return false;
+
+		if ((paramVersion - mParamVersion) > MaterialParams::DIRTY_RING_SIZE)
+			return false;
+
+		// Make sure all modifications are still tracked before touching anything
+		for (UINT64 version = mParamVersion + 1; version <= paramVersion; version++)
+		{
+			if (params->getDirtyParamIndex(version) == (UINT32)-1)
+				return false;
+		}
+
+		// Track passes with modified object parameters, passes outside of the mask range are always marked as dirty
+		UINT64 dirtyPasses = 0;
+		for (UINT64 version = mParamVersion + 1; version <= paramVersion; version++)
+		{
+			const UINT32 paramIdx = params->getDirtyParamIndex(version);
+			const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramIdx);
+
+			// Parameter was modified again later, it will be updated then
+			if (materialParamInfo->version != version)
 				continue;
 
-			if(materialParamInfo->dataType != GPDT_STRUCT)
+			for (UINT32 i = mParamTargetOffsets[paramIdx]; i < mParamTargetOffsets[paramIdx + 1]; i++)
 			{
-				const GpuParamDataTypeInfo& typeInfo = GpuParams::PARAM_SIZES.lookup[(int)materialParamInfo->dataType];
-				UINT32 paramSize = typeInfo.numColumns * typeInfo.numRows * typeInfo.baseTypeSize;
+				const ParamTarget& target = mParamTargets[i];
+				if (target.type == ParamTargetType::Data)
+				{
+					const DataParamInfo& paramInfo = mDataParamInfos[target.infoIdx];
+
+					const BlockInfo& blockInfo = mBlocks[paramInfo.blockIdx];
+					if (blockInfo.buffer == nullptr || !blockInfo.allowUpdate)
+						continue;
+
+					bool isAnimated = isDataParamAnimated(params, *materialParamInfo);
+					if (isAnimated)
+						mHasAnimatedParams = true;
 
-				UINT8* data = params->getData(materialParamInfo->index);
-				if (!isAnimated)
+					updateDataParam(params, paramInfo, t, isAnimated);
+				}
+				else
 				{
-					const bool transposeMatrices = ct::gCaps().conventions.matrixOrder == Conventions::MatrixOrder::ColumnMajor;
-					if (transposeMatrices)
+					const StageParamInfo& stageInfo = mPassParamInfos[target.passIdx].stages[target.stageIdx];
+
+					const ObjectParamInfo* paramInfo;
+					switch (target.type)
 					{
-						auto writeTransposed = [&paramInfo, &paramSize, &arraySize, &paramBlock, data](auto& temp)
-						{
-							for (UINT32 i = 0; i < arraySize; i++)
-							{
-								UINT32 readOffset = i * paramSize;
-								memcpy(&temp, data + readOffset, paramSize);
-								auto transposed = temp.transpose();
-
-								UINT32 writeOffset = (paramInfo.offset + paramInfo.arrayStride * i) * sizeof(UINT32);
-								paramBlock->write(writeOffset, &transposed, paramSize);
-							}
-						};
-
-						switch (materialParamInfo->dataType)
-						{
-						case GPDT_MATRIX_2X2:
-						{
-							MatrixNxM<2, 2> matrix;
-							writeTransposed(matrix);
-						}
-						break;
-						case GPDT_MATRIX_2X3:
-						{
-							MatrixNxM<2, 3> matrix;
-							writeTransposed(matrix);
-						}
-						break;
-						case GPDT_MATRIX_2X4:
-						{
-							MatrixNxM<2, 4> matrix;
-							writeTransposed(matrix);
-						}
-						break;
-						case GPDT_MATRIX_3X2:
-						{
-							MatrixNxM<3, 2> matrix;
-							writeTransposed(matrix);
-						}
-						break;
-						case GPDT_MATRIX_3X3:
-						{
-							Matrix3 matrix;
-							writeTransposed(matrix);
-						}
+					default:
+					case ParamTargetType::Texture:
+						paramInfo = &stageInfo.textures[target.infoIdx];
 						break;
-						case GPDT_MATRIX_3X4:
-						{
-							MatrixNxM<3, 4> matrix;
-							writeTransposed(matrix);
-						}
+					case ParamTargetType::LoadStoreTexture:
+						paramInfo = &stageInfo.loadStoreTextures[target.infoIdx];
 						break;
-						case GPDT_MATRIX_4X2:
-						{
-							MatrixNxM<4, 2> matrix;
-							writeTransposed(matrix);
-						}
+					case ParamTargetType::Buffer:
+						paramInfo = &stageInfo.buffers[target.infoIdx];
 						break;
-						case GPDT_MATRIX_4X3:
-						{
-							MatrixNxM<4, 3> matrix;
-							writeTransposed(matrix);
-						}
+					case ParamTargetType::SamplerState:
+						paramInfo = &stageInfo.samplerStates[target.infoIdx];
 						break;
-						case GPDT_MATRIX_4X4:
-						{
-							Matrix4 matrix;
-							writeTransposed(matrix);
-						}
-						break;
-						default:
-						{
-							for (UINT32 i = 0; i < arraySize; i++)
-							{
-								UINT32 arrayOffset = i * paramSize;
-								UINT32 writeOffset = (paramInfo.offset + paramInfo.arrayStride * i) * sizeof(UINT32);
-								paramBlock->write(writeOffset, data + arrayOffset, paramSize);
-							}
-							break;
-						}
-						}
 					}
+
+					updateObjectParam(params, target.type, target.passIdx, *paramInfo);
+
+					if (target.passIdx < 64)
+						dirtyPasses |= 1ULL << target.passIdx;
 					else
-					{
-						for (UINT32 i = 0; i < arraySize; i++)
-						{
-							UINT32 readOffset = i * paramSize;
-							UINT32 writeOffset = (paramInfo.offset + paramInfo.arrayStride * i) * sizeof(UINT32);
-							paramBlock->write(writeOffset, data + readOffset, paramSize);
-						}
-					}
+						dirtyPasses = ~0ULL;
 				}
-				else // Animated
-				{
-					if (materialParamInfo->dataType == GPDT_FLOAT1)
-					{
-						assert(paramSize == sizeof(float));
+			}
+		}
 
-						for (UINT32 i = 0; i < arraySize; i++)
-						{
-							UINT32 readOffset = i * paramSize;
-							UINT32 writeOffset = (paramInfo.offset + paramInfo.arrayStride * i) * sizeof(UINT32);
+		if (dirtyPasses != 0)
+		{
+			const auto numPasses = (UINT32)mPassParams.size();
+			for (UINT32 i = 0; i < numPasses; i++)
+			{
+				if (i >= 64 || (dirtyPasses & (1ULL << i)) != 0)
+					mPassParams[i]->_markCoreDirty();
+			}
+		}
 
-							float value;
-							if (params->isAnimated(*materialParamInfo, i))
-							{
-								const TAnimationCurve<float>& curve = params->template getCurveParam<float>(*materialParamInfo, i);
+		return true;
+	}
 
-								value = curve.evaluate(t, true);
-							}
-							else
-								memcpy(&value, data + readOffset, paramSize);
+	template<bool Core>
+	bool TGpuParamsSet<Core>::isDataParamAnimated(const SPtr<MaterialParamsType>& params,
+		const MaterialParams::ParamData& paramData)
+	{
+		UINT32 arraySize = paramData.arraySize == 0 ? 1 : paramData.arraySize;
+		for (UINT32 i = 0; i < arraySize; i++)
+		{
+			if (params->isAnimated(paramData, i))
+				return true;
+		}
 
-							paramBlock->write(writeOffset, &value, paramSize);
-						}
-					}
-					else if (materialParamInfo->dataType == GPDT_FLOAT4)
-					{
-						assert(paramSize == sizeof(Rect2));
+		return false;
+	}
 
-						CoreVariantHandleType<SpriteTexture, Core> spriteTexture =
-							params->getOwningSpriteTexture(*materialParamInfo);
+	template<bool Core>
+	void TGpuParamsSet<Core>::updateDataParam(const SPtr<MaterialParamsType>& params, const DataParamInfo& paramInfo,
+		float t, bool isAnimated)
+	{
+		ParamBlockPtrType paramBlock = mBlocks[paramInfo.blockIdx].buffer;
 
-						UINT32 writeOffset = paramInfo.offset * sizeof(UINT32);
-						Rect2 uv = Rect2(0.0f, 0.0f, 1.0f, 1.0f);
-						if (spriteTexture != nullptr)
-							uv = spriteTexture->evaluate(t);
+		const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
+		UINT32 arraySize = materialParamInfo->arraySize == 0 ? 1 : materialParamInfo->arraySize;
 
-						paramBlock->write(writeOffset, &uv, paramSize);
+		if(materialParamInfo->dataType != GPDT_STRUCT)
+		{
+			const GpuParamDataTypeInfo& typeInfo = GpuParams::PARAM_SIZES.lookup[(int)materialParamInfo->dataType];
+			UINT32 paramSize = typeInfo.numColumns * typeInfo.numRows * typeInfo.baseTypeSize;
 
-						// Only the first array element receives sprite UVs, the rest are treated as normal
-						for (UINT32 i = 1; i < arraySize; i++)
+			UINT8* data = params->getData(materialParamInfo->index);
+			if (!isAnimated)
+			{
+				const bool transposeMatrices = ct::gCaps().conventions.matrixOrder == Conventions::MatrixOrder::ColumnMajor;
+				if (transposeMatrices)
+				{
+					auto writeTransposed = [&paramInfo, &paramSize, &arraySize, &paramBlock, data](auto& temp)
+					{
+						for (UINT32 i = 0; i < arraySize; i++)
 						{
 							UINT32 readOffset = i * paramSize;
-							writeOffset = (paramInfo.offset + paramInfo.arrayStride * i) * sizeof(UINT32);
+							memcpy(&temp, data + readOffset, paramSize);
+							auto transposed = temp.transpose();
 
-							paramBlock->write(writeOffset, data + readOffset, paramSize);
+							UINT32 writeOffset = (paramInfo.offset + paramInfo.arrayStride * i) * sizeof(UINT32);
+							paramBlock->write(writeOffset, &transposed, paramSize);
 						}
+					};
+
+					switch (materialParamInfo->dataType)
+					{
+					case GPDT_MATRIX_2X2:
+					{
+						MatrixNxM<2, 2> matrix;
+						writeTransposed(matrix);
+					}
+					break;
+					case GPDT_MATRIX_2X3:
+					{
+						MatrixNxM<2, 3> matrix;
+						writeTransposed(matrix);
 					}
-					else if (materialParamInfo->dataType == GPDT_COLOR)
+					break;
+					case GPDT_MATRIX_2X4:
+					{
+						MatrixNxM<2, 4> matrix;
+						writeTransposed(matrix);
+					}
+					break;
+					case GPDT_MATRIX_3X2:
+					{
+						MatrixNxM<3, 2> matrix;
+						writeTransposed(matrix);
+					}
+					break;
+					case GPDT_MATRIX_3X3:
+					{
+						Matrix3 matrix;
+						writeTransposed(matrix);
+					}
+					break;
+					case GPDT_MATRIX_3X4:
+					{
+						MatrixNxM<3, 4> matrix;
+						writeTransposed(matrix);
+					}
+					break;
+					case GPDT_MATRIX_4X2:
+					{
+						MatrixNxM<4, 2> matrix;
+						writeTransposed(matrix);
+					}
+					break;
+					case GPDT_MATRIX_4X3:
+					{
+						MatrixNxM<4, 3> matrix;
+						writeTransposed(matrix);
+					}
+					break;
+					case GPDT_MATRIX_4X4:
+					{
+						Matrix4 matrix;
+						writeTransposed(matrix);
+					}
+					break;
+					default:
 					{
 						for (UINT32 i = 0; i < arraySize; i++)
 						{
-							assert(paramSize == sizeof(Color));
-
-							UINT32 readOffset = i * paramSize;
+							UINT32 arrayOffset = i * paramSize;
 							UINT32 writeOffset = (paramInfo.offset + paramInfo.arrayStride * i) * sizeof(UINT32);
-
-							Color value;
-							if (params->isAnimated(*materialParamInfo, i))
-							{
-								const ColorGradient& gradient = params->getColorGradientParam(*materialParamInfo, i);
-
-								const float wrappedT = Math::repeat(t, gradient.getDuration());
-								value = Color::fromRGBA(gradient.evaluate(wrappedT));
-							}
-							else
-								memcpy(&value, data + readOffset, paramSize);
-
-							paramBlock->write(writeOffset, &value, paramSize);
+							paramBlock->write(writeOffset, data + arrayOffset, paramSize);
 						}
+						break;
+					}
+					}
+				}
+				else
+				{
+					for (UINT32 i = 0; i < arraySize; i++)
+					{
+						UINT32 readOffset = i * paramSize;
+						UINT32 writeOffset = (paramInfo.offset + paramInfo.arrayStride * i) * sizeof(UINT32);
+						paramBlock->write(writeOffset, data + readOffset, paramSize);
 					}
 				}
 			}
-			else
+			else // Animated
 			{
-				UINT32 paramSize = params->getStructSize(*materialParamInfo);
-				void* paramData = bs_stack_alloc(paramSize);
-				for (UINT32 i = 0; i < arraySize; i++)
+				if (materialParamInfo->dataType == GPDT_FLOAT1)
 				{
-					params->getStructData(*materialParamInfo, paramData, paramSize, i);
-
-					UINT32 readOffset = i * paramSize;
-					UINT32 writeOffset = (paramInfo.offset + paramInfo.arrayStride * i) * sizeof(UINT32);
-					paramBlock->write(writeOffset, paramData, paramSize);
-				}	
-				bs_stack_free(paramData);
-			}
-		}
+					assert(paramSize == sizeof(float));
 
-		// Update object params
-		const auto numPasses = (UINT32)mPassParams.size();
+					for (UINT32 i = 0; i < arraySize; i++)
+					{
+						UINT32 readOffset = i * paramSize;
+						UINT32 writeOffset = (paramInfo.offset + paramInfo.arrayStride * i) * sizeof(UINT32);
 
-		for(UINT32 i = 0; i < numPasses; i++)
-		{
-			SPtr<GpuParamsType> paramPtr = mPassParams[i];
+						float value;
+						if (params->isAnimated(*materialParamInfo, i))
+						{
+							const TAnimationCurve<float>& curve = params->template getCurveParam<float>(*materialParamInfo, i);
 
-			for(UINT32 j = 0; j < NUM_STAGES; j++)
-			{
-				const StageParamInfo& stageInfo = mPassParamInfos[i].stages[j];
+							value = curve.evaluate(t, true);
+						}
+						else
+							memcpy(&value, data + readOffset, paramSize);
 
-				for(UINT32 k = 0; k < stageInfo.numTextures; k++)
+						paramBlock->write(writeOffset, &value, paramSize);
+					}
+				}
+				else if (materialParamInfo->dataType == GPDT_FLOAT4)
 				{
-					const ObjectParamInfo& paramInfo = stageInfo.textures[k];
+					assert(paramSize == sizeof(Rect2));
 
-					const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
-					if (materialParamInfo->version <= mParamVersion && !updateAll)
-						continue;
+					CoreVariantHandleType<SpriteTexture, Core> spriteTexture =
+						params->getOwningSpriteTexture(*materialParamInfo);
 
-					TextureSurface surface;
-					TextureType texture;
-					params->getTexture(*materialParamInfo, texture, surface);
+					UINT32 writeOffset = paramInfo.offset * sizeof(UINT32);
+					Rect2 uv = Rect2(0.0f, 0.0f, 1.0f, 1.0f);
+					if (spriteTexture != nullptr)
+						uv = spriteTexture->evaluate(t);
 
-					paramPtr->setTexture(paramInfo.setIdx, paramInfo.slotIdx, texture, surface);
-				}
+					paramBlock->write(writeOffset, &uv, paramSize);
 
-				for (UINT32 k = 0; k < stageInfo.numLoadStoreTextures; k++)
-				{
-					const ObjectParamInfo& paramInfo = stageInfo.loadStoreTextures[k];
-
-					const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
-					if (materialParamInfo->version <= mParamVersion && !updateAll)
-						continue;
-
-					TextureSurface surface;
-					TextureType texture;
-					params->getLoadStoreTexture(*materialParamInfo, texture, surface);
+					// Only the first array element receives sprite UVs, the rest are treated as normal
+					for (UINT32 i = 1; i < arraySize; i++)
+					{
+						UINT32 readOffset = i * paramSize;
+						writeOffset = (paramInfo.offset + paramInfo.arrayStride * i) * sizeof(UINT32);
 
-					paramPtr->setLoadStoreTexture(paramInfo.setIdx, paramInfo.slotIdx, texture, surface);
+						paramBlock->write(writeOffset, data + readOffset, paramSize);
+					}
 				}
-
-				for (UINT32 k = 0; k < stageInfo.numBuffers; k++)
+				else if (materialParamInfo->dataType == GPDT_COLOR)
 				{
-					const ObjectParamInfo& paramInfo = stageInfo.buffers[k];
+					for (UINT32 i = 0; i < arraySize; i++)
+					{
+						assert(paramSize == sizeof(Color));
 
-					const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
-					if (materialParamInfo->version <= mParamVersion && !updateAll)
-						continue;
+						UINT32 readOffset = i * paramSize;
+						UINT32 writeOffset = (paramInfo.offset + paramInfo.arrayStride * i) * sizeof(UINT32);
+
+						Color value;
+						if (params->isAnimated(*materialParamInfo, i))
+						{
+							const ColorGradient& gradient = params->getColorGradientParam(*materialParamInfo, i);
 
-					BufferType buffer;
-					params->getBuffer(*materialParamInfo, buffer);
+							const float wrappedT = Math::repeat(t, gradient.getDuration());
+							value = Color::fromRGBA(gradient.evaluate(wrappedT));
+						}
+						else
+							memcpy(&value, data + readOffset, paramSize);
 
-					paramPtr->setBuffer(paramInfo.setIdx, paramInfo.slotIdx, buffer);
+						paramBlock->write(writeOffset, &value, paramSize);
+					}
 				}
+			}
+		}
+		else
+		{
+			UINT32 paramSize = params->getStructSize(*materialParamInfo);
+			void* paramData = bs_stack_alloc(paramSize);
+			for (UINT32 i = 0; i < arraySize; i++)
+			{
+				params->getStructData(*materialParamInfo, paramData, paramSize, i);
 
-				for (UINT32 k = 0; k < stageInfo.numSamplerStates; k++)
-				{
-					const ObjectParamInfo& paramInfo = stageInfo.samplerStates[k];
+				UINT32 readOffset = i * paramSize;
+				UINT32 writeOffset = (paramInfo.offset + paramInfo.arrayStride * i) * sizeof(UINT32);
+				paramBlock->write(writeOffset, paramData, paramSize);
+			}	
+			bs_stack_free(paramData);
+		}
+	}
 
-					const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
-					if (materialParamInfo->version <= mParamVersion && !updateAll)
-						continue;
+	template<bool Core>
+	void TGpuParamsSet<Core>::updateObjectParam(const SPtr<MaterialParamsType>& params, ParamTargetType type,
+		UINT32 passIdx, const ObjectParamInfo& paramInfo)
+	{
+		const SPtr<GpuParamsType>& paramPtr = mPassParams[passIdx];
+		const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
 
-					SamplerStateType samplerState;
-					params->getSamplerState(*materialParamInfo, samplerState);
+		switch (type)
+		{
+		case ParamTargetType::Texture:
+		{
+			TextureSurface surface;
+			TextureType texture;
+			params->getTexture(*materialParamInfo, texture, surface);
 
-					paramPtr->setSamplerState(paramInfo.setIdx, paramInfo.slotIdx, samplerState);
-				}
-			}
+			paramPtr->setTexture(paramInfo.setIdx, paramInfo.slotIdx, texture, surface);
+		}
+		break;
+		case ParamTargetType::LoadStoreTexture:
+		{
+			TextureSurface surface;
+			TextureType texture;
+			params->getLoadStoreTexture(*materialParamInfo, texture, surface);
 
-			paramPtr->_markCoreDirty();
+			paramPtr->setLoadStoreTexture(paramInfo.setIdx, paramInfo.slotIdx, texture, surface);
 		}
+		break;
+		case ParamTargetType::Buffer:
+		{
+			BufferType buffer;
+			params->getBuffer(*materialParamInfo, buffer);
 
-		mParamVersion = params->getParamVersion();
+			paramPtr->setBuffer(paramInfo.setIdx, paramInfo.slotIdx, buffer);
+		}
+		break;
+		case ParamTargetType::SamplerState:
+		{
+			SamplerStateType samplerState;
+			params->getSamplerState(*materialParamInfo, samplerState);
+
+			paramPtr->setSamplerState(paramInfo.setIdx, paramInfo.slotIdx, samplerState);
+		}
+		break;
+		default:
+			break;
+		}
 	}
 
 	template class TGpuParamsSet <false>;
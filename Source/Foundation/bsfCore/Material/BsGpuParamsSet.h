@@ -99,6 +99,21 @@ namespace bs
 			StageParamInfo stages[GPT_COUNT];
 		};
 
+		/** Types of entries a material parameter can map to. */
+		enum class ParamTargetType
+		{
+			Data, Texture, LoadStoreTexture, Buffer, SamplerState
+		};
+
+		/** Reference to a DataParamInfo or an ObjectParamInfo entry a single material parameter maps to. */
+		struct ParamTarget
+		{
+			ParamTargetType type;
+			UINT32 passIdx;
+			UINT32 stageIdx;
+			UINT32 infoIdx;
+		};
+
 	public:
 		TGpuParamsSet() = default;
 		TGpuParamsSet(const SPtr<TechniqueType>& technique, const ShaderType& shader,
@@ -171,12 +186,35 @@ namespace bs
 	private:
 		template<bool Core2> friend class TMaterial;
 
+		/** 
+		 * Updates only the parameters modified since the last update, as reported by the dirty parameter ring in
+		 * @p params. Returns false if the modifications couldn't be determined, in which case a full update is required.
+		 */
+		bool updateDirty(const SPtr<MaterialParamsType>& params, float t);
+
+		/** Writes the value of a data parameter into its parameter block buffer. */
+		void updateDataParam(const SPtr<MaterialParamsType>& params, const DataParamInfo& paramInfo, float t,
+			bool isAnimated);
+
+		/** Assigns the value of an object parameter to the GPU parameters of the pass it belongs to. */
+		void updateObjectParam(const SPtr<MaterialParamsType>& params, ParamTargetType type, UINT32 passIdx,
+			const ObjectParamInfo& paramInfo);
+
+		/** Checks if any element of the provided data parameter is animated. */
+		static bool isDataParamAnimated(const SPtr<MaterialParamsType>& params,
+			const MaterialParams::ParamData& paramData);
+
 		Vector<SPtr<GpuParamsType>> mPassParams;
 		Vector<BlockInfo> mBlocks;
 		Vector<DataParamInfo> mDataParamInfos;
 		PassParamInfo* mPassParamInfos;
 
+		// Targets of each material parameter, targets for parameter i are in range [mParamTargetOffsets[i], [i + 1])
+		Vector<UINT32> mParamTargetOffsets;
+		Vector<ParamTarget> mParamTargets;
+
 		UINT64 mParamVersion;
+		bool mHasAnimatedParams = false;
 		UINT8* mData;
 	};
 
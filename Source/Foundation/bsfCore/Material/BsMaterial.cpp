@@ -14,6 +14,7 @@
 #include "Material/BsMaterialParams.h"
 #include "Material/BsGpuParamsSet.h"
 #include "Animation/BsAnimationCurve.h"
+#include "Image/BsColorGradient.h"
 #include "CoreThread/BsCoreObjectSync.h"
 #include "Private/RTTI/BsShaderVariationRTTI.h"
 
@@ -388,6 +389,90 @@ namespace bs
 		_markDependenciesDirty();
 	}
 
+	template<bool Core>
+	UINT32 TMaterial<Core>::resolveParam(const MaterialParamId& id) const
+	{
+		// Parameters only exist once the shader has been loaded
+		if (mParams == nullptr)
+			return (UINT32)-1;
+
+		return id.validate(*mParams, mShader->getParamIndex(id.getName()));
+	}
+
+	template<bool Core>
+	template<class T>
+	bool TMaterial<Core>::setParamInternal(const TMaterialDataParamId<T>& id, const T& value, UINT32 arrayIdx)
+	{
+		const UINT32 paramIdx = resolveParam(id);
+		if (paramIdx == (UINT32)-1)
+			return false;
+
+		const MaterialParams::ParamData* data = mParams->getParamData(paramIdx);
+		if (arrayIdx >= data->arraySize)
+		{
+			LOGWRN("Array index out of range. Provided index was " + toString(arrayIdx) + 
+				" but array length is " + toString(data->arraySize));
+			return false;
+		}
+
+		mParams->setDataParam(*data, arrayIdx, value);
+		return true;
+	}
+
+	template<bool Core>
+	void TMaterial<Core>::setParam(const MaterialTextureParamId& id, const TextureType& value, 
+		const TextureSurface& surface)
+	{
+		const UINT32 paramIdx = resolveParam(id);
+		if (paramIdx == (UINT32)-1)
+			return;
+
+		const MaterialParams::ParamData* data = mParams->getParamData(paramIdx);
+
+		// If there is a default value, assign that instead of null
+		TextureType newValue = value;
+		if (newValue == nullptr)
+			mParams->getDefaultTexture(*data, newValue);
+
+		mParams->setTexture(*data, newValue, surface);
+		_markCoreDirty();
+		_markDependenciesDirty();
+		_markResourcesDirty();
+	}
+
+	template<bool Core>
+	void TMaterial<Core>::setParam(const MaterialBufferParamId& id, const BufferType& value)
+	{
+		const UINT32 paramIdx = resolveParam(id);
+		if (paramIdx == (UINT32)-1)
+			return;
+
+		const MaterialParams::ParamData* data = mParams->getParamData(paramIdx);
+
+		mParams->setBuffer(*data, value);
+		_markCoreDirty();
+		_markDependenciesDirty();
+	}
+
+	template<bool Core>
+	void TMaterial<Core>::setParam(const MaterialSamplerStateParamId& id, const SamplerStateType& value)
+	{
+		const UINT32 paramIdx = resolveParam(id);
+		if (paramIdx == (UINT32)-1)
+			return;
+
+		const MaterialParams::ParamData* data = mParams->getParamData(paramIdx);
+
+		// If there is a default value, assign that instead of null
+		SamplerStateType newValue = value;
+		if (newValue == nullptr)
+			mParams->getDefaultSamplerState(*data, newValue);
+
+		mParams->setSamplerState(*data, newValue);
+		_markCoreDirty();
+		_markDependenciesDirty();
+	}
+
 	template <bool Core>
 	template <typename T>
 	void TMaterial<Core>::setParamValue(const String& name, UINT8* buffer, UINT32 numElements)
@@ -571,6 +656,44 @@ namespace bs
 	template BS_CORE_EXPORT void TMaterial<true>::getParam(const String&, TMaterialDataParam<Matrix4x2, true>&) const;
 	template BS_CORE_EXPORT void TMaterial<true>::getParam(const String&, TMaterialDataParam<Matrix4x3, true>&) const;
 
+	template BS_CORE_EXPORT bool TMaterial<false>::setParamInternal(const TMaterialDataParamId<float>&, const float&, UINT32);
+	template BS_CORE_EXPORT bool TMaterial<false>::setParamInternal(const TMaterialDataParamId<int>&, const int&, UINT32);
+	template BS_CORE_EXPORT bool TMaterial<false>::setParamInternal(const TMaterialDataParamId<Color>&, const Color&, UINT32);
+	template BS_CORE_EXPORT bool TMaterial<false>::setParamInternal(const TMaterialDataParamId<Vector2>&, const Vector2&, UINT32);
+	template BS_CORE_EXPORT bool TMaterial<false>::setParamInternal(const TMaterialDataParamId<Vector3>&, const Vector3&, UINT32);
+	template BS_CORE_EXPORT bool TMaterial<false>::setParamInternal(const TMaterialDataParamId<Vector4>&, const Vector4&, UINT32);
+	template BS_CORE_EXPORT bool TMaterial<false>::setParamInternal(const TMaterialDataParamId<Vector2I>&, const Vector2I&, UINT32);
+	template BS_CORE_EXPORT bool TMaterial<false>::setParamInternal(const TMaterialDataParamId<Vector3I>&, const Vector3I&, UINT32);
+	template BS_CORE_EXPORT bool TMaterial<false>::setParamInternal(const TMaterialDataParamId<Vector4I>&, const Vector4I&, UINT32);
+	template BS_CORE_EXPORT bool TMaterial<false>::setParamInternal(const TMaterialDataParamId<Matrix2>&, const Matrix2&, UINT32);
+	template BS_CORE_EXPORT bool TMaterial<false>::setParamInternal(const TMaterialDataParamId<Matrix2x3>&, const Matrix2x3&, UINT32);
+	template BS_CORE_EXPORT bool TMaterial<false>::setParamInternal(const TMaterialDataParamId<Matrix2x4>&, const Matrix2x4&, UINT32);
+	template BS_CORE_EXPORT bool TMaterial<false>::setParamInternal(const TMaterialDataParamId<Matrix3>&, const Matrix3&, UINT32);
+	template BS_CORE_EXPORT bool TMaterial<false>::setParamInternal(const TMaterialDataParamId<Matrix3x2>&, const Matrix3x2&, UINT32);
+	template BS_CORE_EXPORT bool TMaterial<false>::setParamInternal(const TMaterialDataParamId<Matrix3x4>&, const Matrix3x4&, UINT32);
+	template BS_CORE_EXPORT bool TMaterial<false>::setParamInternal(const TMaterialDataParamId<Matrix4>&, const Matrix4&, UINT32);
+	template BS_CORE_EXPORT bool TMaterial<false>::setParamInternal(const TMaterialDataParamId<Matrix4x2>&, const Matrix4x2&, UINT32);
+	template BS_CORE_EXPORT bool TMaterial<false>::setParamInternal(const TMaterialDataParamId<Matrix4x3>&, const Matrix4x3&, UINT32);
+
+	template BS_CORE_EXPORT bool TMaterial<true>::setParamInternal(const TMaterialDataParamId<float>&, const float&, UINT32);
+	template BS_CORE_EXPORT bool TMaterial<true>::setParamInternal(const TMaterialDataParamId<int>&, const int&, UINT32);
+	template BS_CORE_EXPORT bool TMaterial<true>::setParamInternal(const TMaterialDataParamId<Color>&, const Color&, UINT32);
+	template BS_CORE_EXPORT bool TMaterial<true>::setParamInternal(const TMaterialDataParamId<Vector2>&, const Vector2&, UINT32);
+	template BS_CORE_EXPORT bool TMaterial<true>::setParamInternal(const TMaterialDataParamId<Vector3>&, const Vector3&, UINT32);
+	template BS_CORE_EXPORT bool TMaterial<true>::setParamInternal(const TMaterialDataParamId<Vector4>&, const Vector4&, UINT32);
+	template BS_CORE_EXPORT bool TMaterial<true>::setParamInternal(const TMaterialDataParamId<Vector2I>&, const Vector2I&, UINT32);
+	template BS_CORE_EXPORT bool TMaterial<true>::setParamInternal(const TMaterialDataParamId<Vector3I>&, const Vector3I&, UINT32);
+	template BS_CORE_EXPORT bool TMaterial<true>::setParamInternal(const TMaterialDataParamId<Vector4I>&, const Vector4I&, UINT32);
+	template BS_CORE_EXPORT bool TMaterial<true>::setParamInternal(const TMaterialDataParamId<Matrix2>&, const Matrix2&, UINT32);
+	template BS_CORE_EXPORT bool TMaterial<true>::setParamInternal(const TMaterialDataParamId<Matrix2x3>&, const Matrix2x3&, UINT32);
+	template BS_CORE_EXPORT bool TMaterial<true>::setParamInternal(const TMaterialDataParamId<Matrix2x4>&, const Matrix2x4&, UINT32);
+	template BS_CORE_EXPORT bool TMaterial<true>::setParamInternal(const TMaterialDataParamId<Matrix3>&, const Matrix3&, UINT32);
+	template BS_CORE_EXPORT bool TMaterial<true>::setParamInternal(const TMaterialDataParamId<Matrix3x2>&, const Matrix3x2&, UINT32);
+	template BS_CORE_EXPORT bool TMaterial<true>::setParamInternal(const TMaterialDataParamId<Matrix3x4>&, const Matrix3x4&, UINT32);
+	template BS_CORE_EXPORT bool TMaterial<true>::setParamInternal(const TMaterialDataParamId<Matrix4>&, const Matrix4&, UINT32);
+	template BS_CORE_EXPORT bool TMaterial<true>::setParamInternal(const TMaterialDataParamId<Matrix4x2>&, const Matrix4x2&, UINT32);
+	template BS_CORE_EXPORT bool TMaterial<true>::setParamInternal(const TMaterialDataParamId<Matrix4x3>&, const Matrix4x3&, UINT32);
+
 	Material::Material()
 		:mLoadFlags(Load_None)
 	{ }
@@ -7,6 +7,7 @@
 #include "Resources/BsIResourceListener.h"
 #include "Material/BsMaterialParam.h"
 #include "Material/BsMaterialParams.h"
+#include "Material/BsMaterialParamId.h"
 #include "Material/BsTechnique.h"
 #include "Animation/BsAnimationCurve.h"
 #include "Math/BsVector2.h"
@@ -330,6 +331,60 @@ namespace bs
 		/** Assigns a sampler state to the shader parameter with the specified name. */
 		void setSamplerState(const String& name, const SamplerStateType& value) { return getParamSamplerState(name).set(value); }
 
+		/**
+		 * Assigns a value to the data parameter identified by @p id. Equivalent to setFloat(), setColor() and similar 
+		 * methods, except the parameter is looked up by its StringID in a table kept by the shader.
+		 *
+		 * Optionally if the parameter is an array you may provide an array index to assign the value to.
+		 */
+		template<class T>
+		void setParam(const TMaterialDataParamId<T>& id, const T& value, UINT32 arrayIdx = 0)
+		{
+			if (setParamInternal(id, value, arrayIdx))
+				_markCoreDirty();
+		}
+
+		/** Equivalent to setTexture(), except the parameter is looked up by @p id in the shader. */
+		void setParam(const MaterialTextureParamId& id, const TextureType& value, 
+			const TextureSurface& surface = TextureSurface::COMPLETE);
+
+		/** Equivalent to setBuffer(), except the parameter is looked up by @p id in the shader. */
+		void setParam(const MaterialBufferParamId& id, const BufferType& value);
+
+		/** Equivalent to setSamplerState(), except the parameter is looked up by @p id in the shader. */
+		void setParam(const MaterialSamplerStateParamId& id, const SamplerStateType& value);
+
+		/**
+		 * Assigns values to multiple data parameters of the same type. Equivalent to calling 
+		 * setParam(const TMaterialDataParamId<T>&, const T&, UINT32) for each entry, except the material is only marked
+		 * as dirty once.
+		 *
+		 * @param[in]	ids			Identifiers of the parameters to assign, @p count entries.
+		 * @param[in]	values		Values to assign, @p count entries.
+		 * @param[in]	count		Number of parameters to assign.
+		 */
+		template<class T>
+		void setParamBatch(const TMaterialDataParamId<T>* ids, const T* values, UINT32 count)
+		{
+			bool anySet = false;
+			for (UINT32 i = 0; i < count; i++)
+				anySet |= setParamInternal(ids[i], values[i], 0);
+
+			if (anySet)
+				_markCoreDirty();
+		}
+
+		/**
+		 * Assigns values to multiple data parameters, provided as a list of identifier and value pairs, e.g.
+		 * setParamBatch(tintId, Color::White, intensityId, 2.0f). The material is only marked as dirty once.
+		 */
+		template<class T, class... Rest>
+		void setParamBatch(const TMaterialDataParamId<T>& id, const T& value, const Rest&... rest)
+		{
+			if (setParamBatchInternal(id, value, rest...))
+				_markCoreDirty();
+		}
+
 		/**
 		 * Returns a float value assigned with the parameter with the specified name. If a curve is assigned to this
 		 * parameter, returns the curve value evaluated at time 0. Use getBoundParamType() to determine
@@ -702,6 +757,27 @@ namespace bs
 
 		/** @} */
 	protected:
+		/** 
+		 * Assigns a value to a data parameter without marking the material as dirty. Returns true if the value was 
+		 * assigned. 
+		 */
+		template<class T>
+		bool setParamInternal(const TMaterialDataParamId<T>& id, const T& value, UINT32 arrayIdx);
+
+		/** Returns the index of the parameter identified by @p id in the material parameters, or -1 if not found. */
+		UINT32 resolveParam(const MaterialParamId& id) const;
+
+		/** Terminates the recursion in setParamBatchInternal(const TMaterialDataParamId<T>&, const T&, const Rest&...). */
+		bool setParamBatchInternal() { return false; }
+
+		/** Assigns the first identifier and value pair from a list, and then recurses into the rest of the list. */
+		template<class T, class... Rest>
+		bool setParamBatchInternal(const TMaterialDataParamId<T>& id, const T& value, const Rest&... rest)
+		{
+			const bool set = setParamInternal(id, value, 0);
+			return setParamBatchInternal(rest...) || set;
+		}
+
 		/**
 		 * Assigns a value from a raw buffer to the parameter with the specified name. Buffer must be of sizeof(T) * 
 		 * numElements size and initialized.
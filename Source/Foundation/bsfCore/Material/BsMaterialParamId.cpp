@@ -0,0 +1,18 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Material/BsMaterialParamId.h"
+
+namespace bs
+{
+	MaterialParamId::MaterialParamId(const StringID& name, MaterialParamsBase::ParamType type, GpuParamDataType dataType)
+		:mName(name), mType(type), mDataType(dataType)
+	{ }
+
+	void MaterialParamId::reportError(const MaterialParamsBase& params, UINT32 paramIdx) const
+	{
+		const MaterialParamsBase::GetParamResult result = paramIdx == (UINT32)-1 ? 
+			MaterialParamsBase::GetParamResult::NotFound : MaterialParamsBase::GetParamResult::InvalidType;
+
+		params.reportGetParamError(result, mName.c_str(), 0);
+	}
+}
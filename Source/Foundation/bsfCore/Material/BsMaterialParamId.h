@@ -0,0 +1,103 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Material/BsMaterialParams.h"
+#include "String/BsStringID.h"
+
+namespace bs
+{
+	/** @addtogroup Material
+	 *  @{
+	 */
+
+	/**
+	 * Identifies a material parameter by its name and type, independently of any particular material. Unlike the
+	 * name-based Material setters, the parameter is looked up by its StringID in a table kept by the shader, which is
+	 * shared by all materials using that shader and doesn't require any string comparisons.
+	 *
+	 * Identifiers are meant to be created once (e.g. as static or member variables) and then reused, instead of being
+	 * created for every access. Use the typed variants TMaterialDataParamId, MaterialTextureParamId,
+	 * MaterialBufferParamId and MaterialSamplerStateParamId with Material::setParam.
+	 */
+	class BS_CORE_EXPORT MaterialParamId
+	{
+	public:
+		MaterialParamId(const StringID& name, MaterialParamsBase::ParamType type, GpuParamDataType dataType);
+
+		/** Returns the name of the parameter. */
+		const StringID& getName() const { return mName; }
+
+		/**
+		 * Checks that the parameter at the provided index is of the type this identifier refers to. Reports an error if 
+		 * it isn't.
+		 *
+		 * @param[in]	params		Material parameters to look up the parameter in.
+		 * @param[in]	paramIdx	Index of the parameter with this identifier's name in @p params, as returned by
+		 *							Shader::getParamIndex(). -1 if the shader has no such parameter.
+		 * @return					@p paramIdx if the parameter exists and its type matches, -1 otherwise.
+		 */
+		UINT32 validate(const MaterialParamsBase& params, UINT32 paramIdx) const
+		{
+			if (paramIdx != (UINT32)-1)
+			{
+				const MaterialParamsBase::ParamData* data = params.getParamData(paramIdx);
+				const bool isDataParam = mType == MaterialParamsBase::ParamType::Data;
+
+				if (data->type == mType && (!isDataParam || data->dataType == mDataType))
+					return paramIdx;
+			}
+
+			reportError(params, paramIdx);
+			return (UINT32)-1;
+		}
+
+	private:
+		/** Reports an error for a parameter that doesn't exist, or whose type doesn't match. */
+		void reportError(const MaterialParamsBase& params, UINT32 paramIdx) const;
+
+		StringID mName;
+		MaterialParamsBase::ParamType mType;
+		GpuParamDataType mDataType;
+	};
+
+	/** Identifies a data material parameter of type @p T. See MaterialParamId. */
+	template<class T>
+	class TMaterialDataParamId : public MaterialParamId
+	{
+	public:
+		TMaterialDataParamId(const StringID& name)
+			:MaterialParamId(name, MaterialParamsBase::ParamType::Data, (GpuParamDataType)TGpuDataParamInfo<T>::TypeId)
+		{ }
+	};
+
+	/** Identifies a texture material parameter. See MaterialParamId. */
+	class MaterialTextureParamId : public MaterialParamId
+	{
+	public:
+		MaterialTextureParamId(const StringID& name)
+			:MaterialParamId(name, MaterialParamsBase::ParamType::Texture, GPDT_UNKNOWN)
+		{ }
+	};
+
+	/** Identifies a buffer material parameter. See MaterialParamId. */
+	class MaterialBufferParamId : public MaterialParamId
+	{
+	public:
+		MaterialBufferParamId(const StringID& name)
+			:MaterialParamId(name, MaterialParamsBase::ParamType::Buffer, GPDT_UNKNOWN)
+		{ }
+	};
+
+	/** Identifies a sampler state material parameter. See MaterialParamId. */
+	class MaterialSamplerStateParamId : public MaterialParamId
+	{
+	public:
+		MaterialSamplerStateParamId(const StringID& name)
+			:MaterialParamId(name, MaterialParamsBase::ParamType::Sampler, GPDT_UNKNOWN)
+		{ }
+	};
+
+	/** @} */
+}
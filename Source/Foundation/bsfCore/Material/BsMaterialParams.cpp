@@ -232,7 +232,7 @@ namespace bs
 
 		paramInfo.colorGradient = bs_pool_new<ColorGradient>(input);
 
-		param.version = ++mParamVersion;
+		markDirty(param);
 	}
 
 	UINT32 MaterialParamsBase::getParamIndex(const String& name) const
@@ -640,7 +640,7 @@ namespace bs
 		}
 
 		memcpy(structParam.data, value, structParam.dataSize);
-		param.version = ++mParamVersion;
+		markDirty(param);
 	}
 
 	template<bool Core>
@@ -672,7 +672,7 @@ namespace bs
 		textureParam.isLoadStore = false;
 		textureParam.surface = surface;
 
-		param.version = ++mParamVersion;
+		markDirty(param);
 	}
 
 	template<bool Core>
@@ -691,7 +691,7 @@ namespace bs
 		textureParam.isLoadStore = false;
 		textureParam.surface = TextureSurface::COMPLETE;
 
-		param.version = ++mParamVersion;
+		markDirty(param);
 	}
 
 	template<bool Core>
@@ -705,7 +705,7 @@ namespace bs
 	{
 		mBufferParams[param.index].value = value;
 
-		param.version = ++mParamVersion;
+		markDirty(param);
 	}
 
 	template<bool Core>
@@ -725,7 +725,7 @@ namespace bs
 		textureParam.isLoadStore = true;
 		textureParam.surface = surface;
 
-		param.version = ++mParamVersion;
+		markDirty(param);
 	}
 
 	template<bool Core>
@@ -739,7 +739,7 @@ namespace bs
 	{
 		mSamplerStateParams[param.index].value = value;
 
-		param.version = ++mParamVersion;
+		markDirty(param);
 	}
 
 	template<bool Core>
@@ -1235,8 +1235,6 @@ namespace bs
 		sourceData = rttiReadElem(numDirtySamplerParams, sourceData);
 		sourceData = rttiReadElem(numDirtyStructParams, sourceData);
 
-		mParamVersion++;
-
 		for(UINT32 i = 0; i < numDirtyDataParams; i++)
 		{
 			// Param index
@@ -1244,7 +1242,7 @@ namespace bs
 			sourceData = rttiReadElem(paramIdx, sourceData);
 
 			ParamData& param = mParams[paramIdx];
-			param.version = mParamVersion;
+			markDirty(param);
 
 			const UINT32 arraySize = param.arraySize > 1 ? param.arraySize : 1;
 			const GpuParamDataTypeInfo& typeInfo = bs::GpuParams::PARAM_SIZES.lookup[(int)param.dataType];
@@ -1293,7 +1291,7 @@ namespace bs
 			sourceData = rttiReadElem(paramIdx, sourceData);
 
 			ParamData& param = mParams[paramIdx];
-			param.version = mParamVersion;
+			markDirty(param);
 
 			MaterialParamTextureDataCore* sourceTexData = (MaterialParamTextureDataCore*)sourceData;
 			sourceData += sizeof(MaterialParamTextureDataCore);
@@ -1308,7 +1306,7 @@ namespace bs
 			sourceData = rttiReadElem(paramIdx, sourceData);
 
 			ParamData& param = mParams[paramIdx];
-			param.version = mParamVersion;
+			markDirty(param);
 
 			MaterialParamBufferDataCore* sourceBufferData = (MaterialParamBufferDataCore*)sourceData;
 			sourceData += sizeof(MaterialParamBufferDataCore);
@@ -1323,7 +1321,7 @@ namespace bs
 			sourceData = rttiReadElem(paramIdx, sourceData);
 
 			ParamData& param = mParams[paramIdx];
-			param.version = mParamVersion;
+			markDirty(param);
 
 			MaterialParamSamplerStateDataCore* sourceSamplerStateData = (MaterialParamSamplerStateDataCore*)sourceData;
 			sourceData += sizeof(MaterialParamSamplerStateDataCore);
@@ -1339,7 +1337,7 @@ namespace bs
 			sourceData = rttiReadElem(paramIdx, sourceData);
 
 			ParamData& param = mParams[paramIdx];
-			param.version = mParamVersion;
+			markDirty(param);
 
 			const UINT32 arraySize = param.arraySize > 1 ? param.arraySize : 1;
 			const ParamStructDataType& paramData = mStructParams[param.index];
@@ -320,7 +320,7 @@ namespace bs
 			assert(sizeof(input) == paramTypeSize);
 			memcpy(&mDataParamsBuffer[paramInfo.offset], &input, paramTypeSize);
 
-			param.version = ++mParamVersion;
+			markDirty(param);
 		}
 
 		/**
@@ -364,7 +364,7 @@ namespace bs
 
 				paramInfo.floatCurve = bs_pool_new<TAnimationCurve<T>>(std::move(input));
 
-				param.version = ++mParamVersion;
+				markDirty(param);
 			}
 		}
 
@@ -391,9 +391,32 @@ namespace bs
 		/** Returns a counter that gets incremented whenever a parameter gets updated. */
 		UINT64 getParamVersion() const { return mParamVersion; }
 
+		/**
+		 * Returns the global index of the parameter that was modified when the parameter version was incremented to
+		 * @p version. Only the last DIRTY_RING_SIZE modifications are tracked, returns -1 for older versions and for the
+		 * initial version.
+		 */
+		UINT32 getDirtyParamIndex(UINT64 version) const
+		{
+			if (version <= 1 || version > mParamVersion || (mParamVersion - version) >= DIRTY_RING_SIZE)
+				return (UINT32)-1;
+
+			return mDirtyRing[version & (DIRTY_RING_SIZE - 1)];
+		}
+
+		/** Number of most recent parameter modifications tracked by getDirtyParamIndex(). Must be a power of two. */
+		static constexpr UINT32 DIRTY_RING_SIZE = 64;
+
 	protected:
 		const static UINT32 STATIC_BUFFER_SIZE = 256;
 
+		/** Increments the parameter version, assigns it to the provided parameter and records it as modified. */
+		void markDirty(const ParamData& param) const
+		{
+			param.version = ++mParamVersion;
+			mDirtyRing[mParamVersion & (DIRTY_RING_SIZE - 1)] = (UINT32)(&param - mParams.data());
+		}
+
 		UnorderedMap<String, UINT32> mParamLookup;
 		Vector<ParamData> mParams;
 
@@ -408,6 +431,7 @@ namespace bs
 		UINT32 mNumSamplerParams = 0;
 
 		mutable UINT64 mParamVersion = 1;
+		mutable UINT32 mDirtyRing[DIRTY_RING_SIZE] = {};
 		mutable StaticAlloc<STATIC_BUFFER_SIZE> mAlloc;
 	};
 
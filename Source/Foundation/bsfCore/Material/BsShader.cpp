@@ -242,12 +242,38 @@ namespace bs
 	template<bool Core>
 	TShader<Core>::TShader(const String& name, const TSHADER_DESC<Core>& desc, UINT32 id)
 		:mName(name), mDesc(desc), mId(id)
-	{ }
+	{
+		buildParamIndexLookup();
+	}
 
 	template<bool Core>
 	TShader<Core>::~TShader() 
 	{ }
 
+	template<bool Core>
+	void TShader<Core>::buildParamIndexLookup()
+	{
+		// Must match the order in which MaterialParamsBase assigns the indices: data parameters of known type, followed 
+		// by texture, buffer and sampler parameters
+		mParamIndexLookup.clear();
+
+		UINT32 paramIdx = 0;
+		for (auto& entry : mDesc.dataParams)
+		{
+			if (entry.second.type != GPDT_UNKNOWN)
+				mParamIndexLookup[entry.first] = paramIdx++;
+		}
+
+		for (auto& entry : mDesc.textureParams)
+			mParamIndexLookup[entry.first] = paramIdx++;
+
+		for (auto& entry : mDesc.bufferParams)
+			mParamIndexLookup[entry.first] = paramIdx++;
+
+		for (auto& entry : mDesc.samplerParams)
+			mParamIndexLookup[entry.first] = paramIdx++;
+	}
+
 	template<bool Core>
 	GpuParamType TShader<Core>::getParamType(const String& name) const
 	{
@@ -471,13 +471,30 @@ namespace bs
 		 */
 		UINT8* getDefaultValue(UINT32 index) const;
 
+		/**
+		 * Returns the index of the parameter with the specified name in material parameters created from this shader, as
+		 * used by MaterialParamsBase::getParamData(UINT32). Returns -1 if the shader has no such parameter.
+		 */
+		UINT32 getParamIndex(const StringID& name) const
+		{
+			auto iterFind = mParamIndexLookup.find(name);
+			if (iterFind == mParamIndexLookup.end())
+				return (UINT32)-1;
+
+			return iterFind->second;
+		}
+
 		/** Returns the unique shader ID. */
 		UINT32 getId() const { return mId; }
 
 	protected:
+		/** Builds the lookup table used by getParamIndex(). Must be called whenever the shader parameters change. */
+		void buildParamIndexLookup();
+
 		String mName;
 		TSHADER_DESC<Core> mDesc;
 		UINT32 mId;
+		UnorderedMap<StringID, UINT32> mParamIndexLookup;
 	};
 
 	/** @} */
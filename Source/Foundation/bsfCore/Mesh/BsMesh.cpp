@@ -20,7 +20,7 @@ namespace bs
 		:MeshBase(desc.numVertices, desc.numIndices, desc.subMeshes), mVertexDesc(desc.vertexDesc), mUsage(desc.usage),
 		mIndexType(desc.indexType), mSkeleton(desc.skeleton), mMorphShapes(desc.morphShapes)
 	{
-
+		mProperties.mLODs = desc.lods;
 	}
 
 	Mesh::Mesh(const SPtr<MeshData>& initialMeshData, const MESH_DESC& desc)
@@ -28,7 +28,9 @@ namespace bs
 		mCPUData(initialMeshData), mVertexDesc(initialMeshData->getVertexDesc()),
 		mUsage(desc.usage), mIndexType(initialMeshData->getIndexType()), mSkeleton(desc.skeleton),
 		mMorphShapes(desc.morphShapes)
-	{ }
+	{
+		mProperties.mLODs = desc.lods;
+	}
 
 	Mesh::Mesh()
 		:MeshBase(0, 0, DOT_TRIANGLE_LIST)
@@ -85,7 +87,13 @@ namespace bs
 	void Mesh::initialize()
 	{
 		if (mCPUData != nullptr)
+		{
+			// Cached data outlives the load, so it must not keep referencing the (potentially mapped) source file
+			if ((mUsage & MU_CPUCACHED) != 0)
+				mCPUData->detachExternalBuffer();
+
 			updateBounds(*mCPUData);
+		}
 
 		MeshBase::initialize();
 
@@ -96,6 +104,7 @@ namespace bs
 	void Mesh::updateBounds(const MeshData& meshData)
 	{
 		mProperties.mBounds = meshData.calculateBounds();
+		mProperties.mPositionBounds = meshData.getPositionBounds();
 		markCoreDirty();
 	}
 
@@ -111,6 +120,7 @@ namespace bs
 		desc.numIndices = mProperties.mNumIndices;
 		desc.vertexDesc = mVertexDesc;
 		desc.subMeshes = mProperties.mSubMeshes;
+		desc.lods = mProperties.mLODs;
 		desc.usage = mUsage;
 		desc.indexType = mIndexType;
 		desc.skeleton = mSkeleton;
@@ -262,8 +272,9 @@ namespace bs
 		: MeshBase(desc.numVertices, desc.numIndices, desc.subMeshes), mVertexData(nullptr), mIndexBuffer(nullptr)
 		, mVertexDesc(desc.vertexDesc), mUsage(desc.usage), mIndexType(desc.indexType), mDeviceMask(deviceMask)
 		, mTempInitialMeshData(initialMeshData), mSkeleton(desc.skeleton), mMorphShapes(desc.morphShapes)
-
-	{ }
+	{
+		mProperties.mLODs = desc.lods;
+	}
 
 	Mesh::~Mesh()
 	{
@@ -512,6 +523,7 @@ namespace bs
 	void Mesh::updateBounds(const MeshData& meshData)
 	{
 		mProperties.mBounds = meshData.calculateBounds();
+		mProperties.mPositionBounds = meshData.getPositionBounds();
 
 		// TODO - Sync this to sim-thread possibly?
 	}
@@ -39,6 +39,13 @@ namespace bs
 		 */
 		Vector<SubMesh> subMeshes;
 
+		/** 
+		 * Optional simplified versions of the mesh, used when the mesh is rendered at a small size on screen. Each level
+		 * must reference indices within the mesh's index buffer, and contain one entry per each entry in @p subMeshes.
+		 * Ordered from the most to the least detailed level. See MeshUtility::generateLODs.
+		 */
+		Vector<MeshLOD> lods;
+
 		/** Optimizes performance depending on planned usage of the mesh. */
 		INT32 usage = MU_STATIC; 
 
@@ -40,6 +40,38 @@ namespace bs
 		return (UINT32)mSubMeshes.size();
 	}
 
+	const SubMesh& MeshProperties::getSubMesh(UINT32 subMeshIdx, UINT32 lod) const
+	{
+		if (lod == 0)
+			return getSubMesh(subMeshIdx);
+
+		if (lod > mLODs.size())
+		{
+			BS_EXCEPT(InvalidParametersException, "Invalid level of detail index ("
+				+ toString(lod) + "). Number of levels available: " + toString(getNumLODs()));
+		}
+
+		const Vector<SubMesh>& subMeshes = mLODs[lod - 1].subMeshes;
+		if (subMeshIdx >= subMeshes.size())
+		{
+			BS_EXCEPT(InvalidParametersException, "Invalid sub-mesh index ("
+				+ toString(subMeshIdx) + "). Number of sub-meshes available: " + toString((int)subMeshes.size()));
+		}
+
+		return subMeshes[subMeshIdx];
+	}
+
+	float MeshProperties::getLODScreenSize(UINT32 lod) const
+	{
+		if (lod == 0)
+			return std::numeric_limits<float>::infinity();
+
+		if (lod > mLODs.size())
+			return 0.0f;
+
+		return mLODs[lod - 1].screenSize;
+	}
+
 	MeshBase::MeshBase(UINT32 numVertices, UINT32 numIndices, DrawOperationType drawOp)
 		:mProperties(numVertices, numIndices, drawOp)
 	{ }
@@ -53,10 +85,11 @@ namespace bs
 
 	CoreSyncData MeshBase::syncToCore(FrameAlloc* allocator)
 	{
-		UINT32 size = sizeof(Bounds);
+		UINT32 size = sizeof(Bounds) + sizeof(AABox);
 		UINT8* buffer = allocator->alloc(size);
 
-		memcpy(buffer, &mProperties.mBounds, size);
+		memcpy(buffer, &mProperties.mBounds, sizeof(Bounds));
+		memcpy(buffer + sizeof(Bounds), &mProperties.mPositionBounds, sizeof(AABox));
 		return CoreSyncData(buffer, size);
 	}
 
@@ -87,7 +120,10 @@ namespace bs
 
 	void MeshBase::syncToCore(const CoreSyncData& data)
 	{
-		mProperties.mBounds = data.getData<Bounds>();
+		const UINT8* buffer = data.getBuffer();
+
+		memcpy(&mProperties.mBounds, buffer, sizeof(Bounds));
+		memcpy(&mProperties.mPositionBounds, buffer + sizeof(Bounds), sizeof(AABox));
 	}
 	}
 }
\ No newline at end of file
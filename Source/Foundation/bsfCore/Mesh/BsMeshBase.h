@@ -31,6 +31,22 @@ namespace bs
 		MU_CPUCACHED	BS_SCRIPT_EXPORT(n:CPUCached) = 0x1000, 
 	};
 
+	/**
+	 * Describes a single simplified version (level of detail) of a mesh. Each level references a portion of the mesh's
+	 * index buffer for each of the mesh's sub-meshes, while sharing the vertex buffer with the original mesh.
+	 */
+	struct BS_CORE_EXPORT MeshLOD
+	{
+		/**
+		 * Size of the mesh on screen below which this level of detail is used. Size is the mesh's bounding sphere
+		 * diameter, in relation to the height of the viewport (e.g. 0.5 means the mesh covers half of the viewport).
+		 */
+		float screenSize = 0.0f;
+
+		/** Sub-meshes to render at this level of detail. One for each sub-mesh of the original mesh, in the same order. */
+		Vector<SubMesh> subMeshes;
+	};
+
 	/** Properties of a Mesh. Shared between sim and core thread versions of a Mesh. */
 	class BS_CORE_EXPORT MeshProperties
 	{
@@ -48,6 +64,21 @@ namespace bs
 		/** Retrieves a total number of sub-meshes in this mesh. */
 		UINT32 getNumSubMeshes() const;
 
+		/**
+		 * Retrieves a sub-mesh containing data used for rendering a certain portion of this mesh, at the specified level
+		 * of detail. Level 0 represents the original mesh.
+		 */
+		const SubMesh& getSubMesh(UINT32 subMeshIdx, UINT32 lod) const;
+
+		/** Returns the number of levels of detail the mesh contains, including the original mesh. */
+		UINT32 getNumLODs() const { return (UINT32)mLODs.size() + 1; }
+
+		/**
+		 * Returns the screen size below which the specified level of detail is used. See MeshLOD::screenSize. Level 0
+		 * represents the original mesh, and is used for any size above the size of level 1.
+		 */
+		float getLODScreenSize(UINT32 lod) const;
+
 		/**	Returns maximum number of vertices the mesh may store. */
 		UINT32 getNumVertices() const { return mNumVertices; }
 
@@ -57,6 +88,9 @@ namespace bs
 		/**	Returns bounds of the geometry contained in the vertex buffers for all sub-meshes. */
 		const Bounds& getBounds() const { return mBounds; }
 
+		/** Returns the box that quantized vertex positions are relative to. See MeshData::setPositionBounds(). */
+		const AABox& getPositionBounds() const { return mPositionBounds; }
+
 	protected:
 		friend class MeshBase;
 		friend class ct::MeshBase;
@@ -67,9 +101,11 @@ namespace bs
 		friend class MeshBaseRTTI;
 
 		Vector<SubMesh> mSubMeshes;
+		Vector<MeshLOD> mLODs;
 		UINT32 mNumVertices;
 		UINT32 mNumIndices;
 		Bounds mBounds;
+		AABox mPositionBounds;
 	};
 
 	/** @} */
@@ -359,22 +359,42 @@ namespace bs
 		{
 			const VertexElement& curElement = vertexDesc->getElement(i);
 
-			if (curElement.getSemantic() != VES_POSITION || (curElement.getType() != VET_FLOAT3 && curElement.getType() != VET_FLOAT4))
+			if (curElement.getSemantic() != VES_POSITION)
+				continue;
+
+			const VertexElementType type = curElement.getType();
+			if (type != VET_FLOAT3 && type != VET_FLOAT4 && type != VET_SHORT4_NORM)
 				continue;
 
 			UINT8* data = getElementData(curElement.getSemantic(), curElement.getSemanticIdx(), curElement.getStreamIdx());
 			UINT32 stride = vertexDesc->getVertexStride(curElement.getStreamIdx());
 
+			const Vector3 boundsCenter = mPositionBounds.getCenter();
+			const Vector3 boundsExtents = mPositionBounds.getHalfSize();
+			auto getPosition = [&](UINT32 idx)
+			{
+				if (type != VET_SHORT4_NORM)
+					return *(Vector3*)(data + stride * idx);
+
+				const INT16* quantized = (const INT16*)(data + stride * idx);
+				Vector3 position(
+					std::max(quantized[0] / 32767.0f, -1.0f),
+					std::max(quantized[1] / 32767.0f, -1.0f),
+					std::max(quantized[2] / 32767.0f, -1.0f));
+
+				return boundsCenter + position * boundsExtents;
+			};
+
 			if (getNumVertices() > 0)
 			{
-				Vector3 curPosition = *(Vector3*)data;
+				Vector3 curPosition = getPosition(0);
 				Vector3 accum = curPosition;
 				Vector3 min = curPosition;
 				Vector3 max = curPosition;
 
 				for (UINT32 i = 1; i < getNumVertices(); i++)
 				{
-					curPosition = *(Vector3*)(data + stride * i);
+					curPosition = getPosition(i);
 					accum += curPosition;
 					min = Vector3::min(min, curPosition);
 					max = Vector3::max(max, curPosition);
@@ -385,7 +405,7 @@ namespace bs
 
 				for (UINT32 i = 0; i < getNumVertices(); i++)
 				{
-					curPosition = *(Vector3*)(data + stride * i);
+					curPosition = getPosition(i);
 					float dist = center.squaredDistance(curPosition);
 
 					if (dist > radiusSqrd)
@@ -229,6 +229,15 @@ namespace bs
 		/**	Calculates the bounds of all vertices stored in the internal buffer. */
 		Bounds calculateBounds() const;
 
+		/**
+		 * Sets the box that quantized vertex positions (stored as VET_SHORT4_NORM) are relative to. Normalized positions
+		 * in [-1, 1] range map to the minimum and maximum corners of the box. Not relevant for other position formats.
+		 */
+		void setPositionBounds(const AABox& bounds) { mPositionBounds = bounds; }
+
+		/** Returns the box that quantized vertex positions are relative to. See setPositionBounds(). */
+		const AABox& getPositionBounds() const { return mPositionBounds; }
+
 		/**
 		 * Combines a number of submeshes and their mesh data into one large mesh data buffer.
 		 *
@@ -291,6 +300,7 @@ namespace bs
 		UINT32 mNumVertices;
 		UINT32 mNumIndices;
 		IndexType mIndexType;
+		AABox mPositionBounds;
 
 		SPtr<VertexDataDesc> mVertexData;
 
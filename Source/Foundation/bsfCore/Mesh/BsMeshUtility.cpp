@@ -5,6 +5,10 @@
 #include "Math/BsVector3.h"
 #include "Math/BsVector2.h"
 #include "Math/BsPlane.h"
+#include "Mesh/BsMeshBase.h"
+#include "Mesh/BsMeshData.h"
+#include "RenderAPI/BsVertexDataDesc.h"
+#include "Utility/BsBitwise.h"
 
 namespace bs
 {
@@ -935,4 +939,1065 @@ namespace bs
 			ptr += stride;
 		}
 	}
+
+	/** Converts a value in [-1, 1] range into a 16-bit signed normalized value. */
+	static INT16 toSNorm16(float value)
+	{
+		return (INT16)Math::clamp(Math::roundToInt(value * 32767.0f), -32767, 32767);
+	}
+
+	/** Converts a 16-bit signed normalized value into a value in [-1, 1] range. */
+	static float fromSNorm16(INT16 value)
+	{
+		return std::max(value / 32767.0f, -1.0f);
+	}
+
+	/** Projects a unit vector onto an octahedron, and unfolds the octahedron onto a [-1, 1] square. */
+	static Vector2 encodeOctahedral(const Vector3& vector)
+	{
+		const float invL1Norm = 1.0f / (Math::abs(vector.x) + Math::abs(vector.y) + Math::abs(vector.z));
+		Vector2 output(vector.x * invL1Norm, vector.y * invL1Norm);
+
+		// Fold the lower hemisphere over the diagonals
+		if (vector.z < 0.0f)
+		{
+			const Vector2 folded((1.0f - Math::abs(output.y)) * (output.x >= 0.0f ? 1.0f : -1.0f),
+				(1.0f - Math::abs(output.x)) * (output.y >= 0.0f ? 1.0f : -1.0f));
+
+			output = folded;
+		}
+
+		return output;
+	}
+
+	/** Inverse of encodeOctahedral(). */
+	static Vector3 decodeOctahedral(const Vector2& encoded)
+	{
+		Vector3 output(encoded.x, encoded.y, 1.0f - Math::abs(encoded.x) - Math::abs(encoded.y));
+
+		const float t = std::max(-output.z, 0.0f);
+		output.x += output.x >= 0.0f ? -t : t;
+		output.y += output.y >= 0.0f ? -t : t;
+
+		return Vector3::normalize(output);
+	}
+
+	void MeshUtility::packOctahedral(Vector3* source, UINT8* destination, UINT32 count, UINT32 inStride, UINT32 outStride)
+	{
+		UINT8* srcPtr = (UINT8*)source;
+		UINT8* dstPtr = destination;
+		for (UINT32 i = 0; i < count; i++)
+		{
+			const Vector2 encoded = encodeOctahedral(*(Vector3*)srcPtr);
+
+			INT16* packed = (INT16*)dstPtr;
+			packed[0] = toSNorm16(encoded.x);
+			packed[1] = toSNorm16(encoded.y);
+
+			srcPtr += inStride;
+			dstPtr += outStride;
+		}
+	}
+
+	void MeshUtility::packOctahedral(Vector4* source, UINT8* destination, UINT32 count, UINT32 inStride, UINT32 outStride)
+	{
+		static constexpr float MIN_VALUE = 1.0f / 32767.0f;
+
+		UINT8* srcPtr = (UINT8*)source;
+		UINT8* dstPtr = destination;
+		for (UINT32 i = 0; i < count; i++)
+		{
+			const Vector4& src = *(Vector4*)srcPtr;
+			const Vector2 encoded = encodeOctahedral(Vector3(src.x, src.y, src.z));
+
+			// Remap to [0, 1] range so the sign can be stored, and make sure the value doesn't round to zero
+			const float sign = src.w < 0.0f ? -1.0f : 1.0f;
+			const float y = std::max(encoded.y * 0.5f + 0.5f, MIN_VALUE) * sign;
+
+			INT16* packed = (INT16*)dstPtr;
+			packed[0] = toSNorm16(encoded.x);
+			packed[1] = toSNorm16(y);
+
+			srcPtr += inStride;
+			dstPtr += outStride;
+		}
+	}
+
+	void MeshUtility::unpackOctahedral(UINT8* source, Vector3* destination, UINT32 count, UINT32 stride)
+	{
+		UINT8* ptr = source;
+		for (UINT32 i = 0; i < count; i++)
+		{
+			const INT16* packed = (const INT16*)ptr;
+			destination[i] = decodeOctahedral(Vector2(fromSNorm16(packed[0]), fromSNorm16(packed[1])));
+
+			ptr += stride;
+		}
+	}
+
+	void MeshUtility::unpackOctahedral(UINT8* source, Vector4* destination, UINT32 count, UINT32 stride)
+	{
+		UINT8* ptr = source;
+		for (UINT32 i = 0; i < count; i++)
+		{
+			const INT16* packed = (const INT16*)ptr;
+			const float y = fromSNorm16(packed[1]);
+
+			const Vector3 decoded = decodeOctahedral(Vector2(fromSNorm16(packed[0]), Math::abs(y) * 2.0f - 1.0f));
+			destination[i] = Vector4(decoded.x, decoded.y, decoded.z, y < 0.0f ? -1.0f : 1.0f);
+
+			ptr += stride;
+		}
+	}
+
+	/** Symmetric 4x4 matrix that evaluates the sum of squared distances of a point to a set of planes. */
+	struct Quadric
+	{
+		/** Adds a plane with the provided normal and distance from origin, scaled by @p weight. */
+		void addPlane(const Vector3& normal, float distance, float weight)
+		{
+			const double x = normal.x;
+			const double y = normal.y;
+			const double z = normal.z;
+			const double d = distance;
+
+			xx += weight * x * x; xy += weight * x * y; xz += weight * x * z; xd += weight * x * d;
+			yy += weight * y * y; yz += weight * y * z; yd += weight * y * d;
+			zz += weight * z * z; zd += weight * z * d;
+			dd += weight * d * d;
+		}
+
+		/** Adds the planes of another quadric to this one. */
+		void add(const Quadric& other)
+		{
+			xx += other.xx; xy += other.xy; xz += other.xz; xd += other.xd;
+			yy += other.yy; yz += other.yz; yd += other.yd;
+			zz += other.zz; zd += other.zd;
+			dd += other.dd;
+		}
+
+		/** Returns the error of the provided point. */
+		double evaluate(const Vector3& point) const
+		{
+			const double x = point.x;
+			const double y = point.y;
+			const double z = point.z;
+
+			return xx * x * x + 2.0 * xy * x * y + 2.0 * xz * x * z + 2.0 * xd * x
+				+ yy * y * y + 2.0 * yz * y * z + 2.0 * yd * y
+				+ zz * z * z + 2.0 * zd * z
+				+ dd;
+		}
+
+		double xx = 0.0, xy = 0.0, xz = 0.0, xd = 0.0;
+		double yy = 0.0, yz = 0.0, yd = 0.0;
+		double zz = 0.0, zd = 0.0;
+		double dd = 0.0;
+	};
+
+	/** Candidate collapse of an edge during mesh simplification. */
+	struct EdgeCollapse
+	{
+		double cost;
+		UINT32 from; /**< Position that is removed. */
+		UINT32 to; /**< Position that @p from is collapsed onto. */
+		UINT32 toVertex; /**< Vertex at position @p to that replaces the vertex at @p from in remaining triangles. */
+	};
+
+	void MeshUtility::simplify(const UINT8* vertices, UINT32 numVertices, UINT32 vertexStride, const UINT32* indices,
+		UINT32 numIndices, UINT32 targetNumIndices, Vector<UINT32>& output)
+	{
+		output.assign(indices, indices + numIndices);
+
+		if (numVertices == 0 || numIndices < 3)
+			return;
+
+		auto getVertex = [vertices, vertexStride](UINT32 idx) -> const Vector3&
+		{
+			return *(const Vector3*)(vertices + idx * vertexStride);
+		};
+
+		// Vertices with the same position but different attributes are collapsed together, as a single position
+		Vector<UINT32> sortedVertices(numVertices);
+		for (UINT32 i = 0; i < numVertices; i++)
+			sortedVertices[i] = i;
+
+		std::sort(sortedVertices.begin(), sortedVertices.end(), [&getVertex](UINT32 a, UINT32 b)
+		{
+			const Vector3& posA = getVertex(a);
+			const Vector3& posB = getVertex(b);
+
+			if (posA.x != posB.x)
+				return posA.x < posB.x;
+
+			if (posA.y != posB.y)
+				return posA.y < posB.y;
+
+			return posA.z < posB.z;
+		});
+
+		Vector<UINT32> positionIds(numVertices);
+		Vector<Vector3> positions;
+		Vector<bool> locked;
+		for (UINT32 i = 0; i < numVertices; i++)
+		{
+			const UINT32 vertexIdx = sortedVertices[i];
+			if (i == 0 || getVertex(vertexIdx) != getVertex(sortedVertices[i - 1]))
+			{
+				positions.push_back(getVertex(vertexIdx));
+				locked.push_back(false);
+			}
+			else // Attribute seam
+				locked.back() = true;
+
+			positionIds[vertexIdx] = (UINT32)positions.size() - 1;
+		}
+
+		const auto numPositions = (UINT32)positions.size();
+		UINT32 numTriangles = numIndices / 3;
+
+		// Lock positions on borders (edges with one triangle) and non-manifold edges (more than two triangles)
+		Vector<UINT64> edges;
+		edges.reserve(numTriangles * 3);
+		for (UINT32 i = 0; i < numTriangles * 3; i++)
+		{
+			const UINT32 a = positionIds[output[i]];
+			const UINT32 b = positionIds[output[(i % 3) == 2 ? i - 2 : i + 1]];
+
+			edges.push_back(((UINT64)std::min(a, b) << 32) | std::max(a, b));
+		}
+
+		std::sort(edges.begin(), edges.end());
+		for (UINT32 i = 0; i < (UINT32)edges.size();)
+		{
+			UINT32 count = 1;
+			while ((i + count) < (UINT32)edges.size() && edges[i + count] == edges[i])
+				count++;
+
+			if (count != 2)
+			{
+				locked[(UINT32)(edges[i] >> 32)] = true;
+				locked[(UINT32)(edges[i] & 0xFFFFFFFF)] = true;
+			}
+
+			i += count;
+		}
+
+		// Accumulate planes of all triangles around each position, weighted by triangle area
+		Vector<Quadric> quadrics(numPositions);
+		for (UINT32 i = 0; i < numTriangles; i++)
+		{
+			const UINT32 ids[] = { positionIds[output[i * 3 + 0]], positionIds[output[i * 3 + 1]],
+				positionIds[output[i * 3 + 2]] };
+
+			const Vector3 normal = Vector3::cross(positions[ids[1]] - positions[ids[0]],
+				positions[ids[2]] - positions[ids[0]]);
+
+			const float length = normal.length();
+			if (length <= 0.0f)
+				continue;
+
+			const Vector3 unitNormal = normal / length;
+			const float distance = -unitNormal.dot(positions[ids[0]]);
+
+			for (auto& id : ids)
+				quadrics[id].addPlane(unitNormal, distance, length * 0.5f);
+		}
+
+		// Collapse edges in passes. Each pass performs the cheapest collapses that don't affect the same triangles, 
+		// followed by a rebuild of the triangle list.
+		const UINT32 targetNumTriangles = targetNumIndices / 3;
+
+		Vector<UINT32> triangleOffsets;
+		Vector<UINT32> triangleCursors;
+		Vector<UINT32> positionTriangles;
+		Vector<EdgeCollapse> collapses;
+		Vector<UINT32> collapseTargets;
+		Vector<bool> touched;
+		while (numTriangles > targetNumTriangles)
+		{
+			// Find triangles referencing each position
+			triangleOffsets.assign(numPositions + 1, 0);
+			for (UINT32 i = 0; i < numTriangles * 3; i++)
+				triangleOffsets[positionIds[output[i]] + 1]++;
+
+			for (UINT32 i = 0; i < numPositions; i++)
+				triangleOffsets[i + 1] += triangleOffsets[i];
+
+			triangleCursors.assign(triangleOffsets.begin(), triangleOffsets.end() - 1);
+			positionTriangles.resize(numTriangles * 3);
+			for (UINT32 i = 0; i < numTriangles * 3; i++)
+				positionTriangles[triangleCursors[positionIds[output[i]]]++] = i / 3;
+
+			// Evaluate all collapses in both directions
+			collapses.clear();
+			for (UINT32 i = 0; i < numTriangles * 3; i++)
+			{
+				const UINT32 vertexA = output[i];
+				const UINT32 vertexB = output[(i % 3) == 2 ? i - 2 : i + 1];
+				const UINT32 a = positionIds[vertexA];
+				const UINT32 b = positionIds[vertexB];
+
+				if (!locked[a])
+					collapses.push_back({ quadrics[a].evaluate(positions[b]) + quadrics[b].evaluate(positions[b]), a, b, vertexB });
+
+				if (!locked[b])
+					collapses.push_back({ quadrics[a].evaluate(positions[a]) + quadrics[b].evaluate(positions[a]), b, a, vertexA });
+			}
+
+			std::sort(collapses.begin(), collapses.end(), 
+				[](const EdgeCollapse& a, const EdgeCollapse& b) { return a.cost < b.cost; });
+
+			collapseTargets.assign(numPositions, (UINT32)-1);
+			touched.assign(numPositions, false);
+
+			UINT32 numRemovedTriangles = 0;
+			for (auto& collapse : collapses)
+			{
+				if ((numTriangles - numRemovedTriangles) <= targetNumTriangles)
+					break;
+
+				// Collapses in this pass must not share any triangles, so the checks below use up-to-date geometry
+				if (touched[collapse.from] || touched[collapse.to])
+					continue;
+
+				// Reject collapses that would flip any of the remaining triangles
+				bool valid = true;
+				UINT32 numCollapsedTriangles = 0;
+				for (UINT32 i = triangleOffsets[collapse.from]; i < triangleOffsets[collapse.from + 1]; i++)
+				{
+					const UINT32 triangleIdx = positionTriangles[i];
+
+					Vector3 oldPositions[3];
+					Vector3 newPositions[3];
+					bool isCollapsed = false;
+					for (UINT32 j = 0; j < 3; j++)
+					{
+						const UINT32 positionId = positionIds[output[triangleIdx * 3 + j]];
+						isCollapsed |= positionId == collapse.to;
+
+						oldPositions[j] = positions[positionId];
+						newPositions[j] = positionId == collapse.from ? positions[collapse.to] : oldPositions[j];
+					}
+
+					if (isCollapsed)
+					{
+						numCollapsedTriangles++;
+						continue;
+					}
+
+					const Vector3 oldNormal = Vector3::cross(oldPositions[1] - oldPositions[0], 
+						oldPositions[2] - oldPositions[0]);
+					const Vector3 newNormal = Vector3::cross(newPositions[1] - newPositions[0], 
+						newPositions[2] - newPositions[0]);
+
+					// Also reject large rotations, as they can add up to a flip over multiple collapses
+					if (oldNormal.dot(newNormal) <= 0.25f * oldNormal.length() * newNormal.length())
+					{
+						valid = false;
+						break;
+					}
+				}
+
+				if (!valid)
+					continue;
+
+				collapseTargets[collapse.from] = collapse.toVertex;
+				quadrics[collapse.to].add(quadrics[collapse.from]);
+
+				for (UINT32 i = triangleOffsets[collapse.from]; i < triangleOffsets[collapse.from + 1]; i++)
+				{
+					const UINT32 triangleIdx = positionTriangles[i];
+					for (UINT32 j = 0; j < 3; j++)
+						touched[positionIds[output[triangleIdx * 3 + j]]] = true;
+				}
+
+				numRemovedTriangles += numCollapsedTriangles;
+			}
+
+			if (numRemovedTriangles == 0)
+				break;
+
+			// Apply the collapses and remove the degenerate triangles
+			UINT32 numRemainingTriangles = 0;
+			for (UINT32 i = 0; i < numTriangles; i++)
+			{
+				UINT32 triangle[3];
+				for (UINT32 j = 0; j < 3; j++)
+				{
+					const UINT32 vertexIdx = output[i * 3 + j];
+					const UINT32 target = collapseTargets[positionIds[vertexIdx]];
+
+					triangle[j] = target != (UINT32)-1 ? target : vertexIdx;
+				}
+
+				const UINT32 a = positionIds[triangle[0]];
+				const UINT32 b = positionIds[triangle[1]];
+				const UINT32 c = positionIds[triangle[2]];
+				if (a == b || b == c || a == c)
+					continue;
+
+				memcpy(&output[numRemainingTriangles * 3], triangle, sizeof(triangle));
+				numRemainingTriangles++;
+			}
+
+			numTriangles = numRemainingTriangles;
+		}
+
+		output.resize(numTriangles * 3);
+	}
+
+	SPtr<MeshData> MeshUtility::generateLODs(const SPtr<MeshData>& meshData, const Vector<SubMesh>& subMeshes,
+		const Vector<float>& screenSizes, float reduction, Vector<MeshLOD>& lods)
+	{
+		lods.clear();
+
+		if (screenSizes.empty())
+			return meshData;
+
+		// Positions can be in any stream
+		const SPtr<VertexDataDesc>& vertexDesc = meshData->getVertexDesc();
+		const VertexElement* positionElement = nullptr;
+		for (UINT32 i = 0; i < vertexDesc->getNumElements(); i++)
+		{
+			const VertexElement& element = vertexDesc->getElement(i);
+			if (element.getSemantic() == VES_POSITION && element.getSemanticIdx() == 0)
+			{
+				positionElement = &element;
+				break;
+			}
+		}
+
+		if (positionElement == nullptr || 
+			(positionElement->getType() != VET_FLOAT3 && positionElement->getType() != VET_FLOAT4))
+			return meshData;
+
+		const UINT32 positionStreamIdx = positionElement->getStreamIdx();
+		const UINT32 numVertices = meshData->getNumVertices();
+		const UINT32 numIndices = meshData->getNumIndices();
+		const UINT8* vertices = meshData->getElementData(VES_POSITION, 0, positionStreamIdx);
+		const UINT32 vertexStride = vertexDesc->getVertexStride(positionStreamIdx);
+		const IndexType indexType = meshData->getIndexType();
+
+		Vector<UINT32> indices(numIndices);
+		if (indexType == IT_16BIT)
+		{
+			const UINT16* srcIndices = meshData->getIndices16();
+			for (UINT32 i = 0; i < numIndices; i++)
+				indices[i] = srcIndices[i];
+		}
+		else
+			memcpy(indices.data(), meshData->getIndices32(), numIndices * sizeof(UINT32));
+
+		// Each level is generated from the previous one, so that simplifications remain consistent between levels
+		Vector<SubMesh> prevSubMeshes = subMeshes;
+		Vector<UINT32> simplifiedIndices;
+		for (UINT32 i = 0; i < (UINT32)screenSizes.size(); i++)
+		{
+			MeshLOD lod;
+			lod.screenSize = screenSizes[i];
+
+			const float levelReduction = std::pow(reduction, (float)(i + 1));
+
+			bool isSimplified = false;
+			for (UINT32 j = 0; j < (UINT32)subMeshes.size(); j++)
+			{
+				const SubMesh& prevSubMesh = prevSubMeshes[j];
+				if (prevSubMesh.drawOp != DOT_TRIANGLE_LIST || prevSubMesh.indexCount == 0)
+				{
+					lod.subMeshes.push_back(prevSubMesh);
+					continue;
+				}
+
+				const UINT32 targetNumIndices = (UINT32)(subMeshes[j].indexCount * levelReduction) / 3 * 3;
+				simplify(vertices, numVertices, vertexStride, &indices[prevSubMesh.indexOffset], prevSubMesh.indexCount,
+					targetNumIndices, simplifiedIndices);
+
+				if (simplifiedIndices.size() >= prevSubMesh.indexCount)
+				{
+					lod.subMeshes.push_back(prevSubMesh);
+					continue;
+				}
+
+				optimizeVertexCache(simplifiedIndices.data(), (UINT32)simplifiedIndices.size(), numVertices);
+
+				lod.subMeshes.push_back(SubMesh((UINT32)indices.size(), (UINT32)simplifiedIndices.size(), 
+					DOT_TRIANGLE_LIST));
+				indices.insert(indices.end(), simplifiedIndices.begin(), simplifiedIndices.end());
+
+				isSimplified = true;
+			}
+
+			if (!isSimplified)
+				break;
+
+			prevSubMeshes = lod.subMeshes;
+			lods.push_back(lod);
+		}
+
+		if (lods.empty())
+			return meshData;
+
+		const auto numOutputIndices = (UINT32)indices.size();
+		SPtr<MeshData> output = MeshData::create(numVertices, numOutputIndices, vertexDesc, indexType);
+		output->setPositionBounds(meshData->getPositionBounds());
+
+		if (indexType == IT_16BIT)
+		{
+			UINT16* dstIndices = output->getIndices16();
+			for (UINT32 i = 0; i < numOutputIndices; i++)
+				dstIndices[i] = (UINT16)indices[i];
+		}
+		else
+			memcpy(output->getIndices32(), indices.data(), numOutputIndices * sizeof(UINT32));
+
+		// Vertex data of all streams is stored contiguously after the indices
+		const UINT32 indexSize = meshData->getIndexElementSize();
+		memcpy(output->getIndexData() + numOutputIndices * indexSize, meshData->getIndexData() + numIndices * indexSize,
+			meshData->getStreamSize());
+
+		return output;
+	}
+	/** Returns a list of all vertex streams used by the provided vertex description. */
+	static Vector<UINT32> getVertexStreams(const VertexDataDesc& vertexDesc)
+	{
+		Vector<UINT32> streams;
+		for (UINT32 i = 0; i < vertexDesc.getNumElements(); i++)
+		{
+			const UINT32 streamIdx = vertexDesc.getElement(i).getStreamIdx();
+			if (std::find(streams.begin(), streams.end(), streamIdx) == streams.end())
+				streams.push_back(streamIdx);
+		}
+
+		return streams;
+	}
+
+	/** Reads indices of the provided mesh data into a 32-bit index array. */
+	static Vector<UINT32> readIndices(const MeshData& meshData)
+	{
+		const UINT32 numIndices = meshData.getNumIndices();
+
+		Vector<UINT32> indices(numIndices);
+		if (meshData.getIndexType() == IT_16BIT)
+		{
+			const UINT16* srcIndices = meshData.getIndices16();
+			for (UINT32 i = 0; i < numIndices; i++)
+				indices[i] = srcIndices[i];
+		}
+		else
+			memcpy(indices.data(), meshData.getIndices32(), numIndices * sizeof(UINT32));
+
+		return indices;
+	}
+
+	SPtr<MeshData> MeshUtility::optimize(const SPtr<MeshData>& meshData, Vector<SubMesh>& subMeshes, 
+		bool reorderVertices)
+	{
+		if (subMeshes.empty())
+			return meshData;
+
+		const SPtr<VertexDataDesc>& vertexDesc = meshData->getVertexDesc();
+		const Vector<UINT32> streams = getVertexStreams(*vertexDesc);
+		const UINT32 numVertices = meshData->getNumVertices();
+
+		Vector<UINT32> indices = readIndices(*meshData);
+
+		// Weld vertices whose data is identical in all streams, by sorting them according to their data
+		if (reorderVertices)
+		{
+			const UINT32 vertexSize = vertexDesc->getVertexStride();
+
+			Vector<UINT8> vertexData(numVertices * vertexSize);
+			UINT32 streamOffset = 0;
+			for (auto& streamIdx : streams)
+			{
+				const UINT32 stride = vertexDesc->getVertexStride(streamIdx);
+				const UINT8* src = meshData->getStreamData(streamIdx);
+
+				for (UINT32 i = 0; i < numVertices; i++)
+					memcpy(&vertexData[i * vertexSize + streamOffset], src + i * stride, stride);
+
+				streamOffset += stride;
+			}
+
+			Vector<UINT32> sortedVertices(numVertices);
+			for (UINT32 i = 0; i < numVertices; i++)
+				sortedVertices[i] = i;
+
+			const UINT8* vertexDataPtr = vertexData.data();
+			std::sort(sortedVertices.begin(), sortedVertices.end(), [vertexDataPtr, vertexSize](UINT32 a, UINT32 b)
+			{
+				const int result = memcmp(vertexDataPtr + a * vertexSize, vertexDataPtr + b * vertexSize, vertexSize);
+				return result < 0 || (result == 0 && a < b);
+			});
+
+			Vector<UINT32> weldRemap(numVertices);
+			for (UINT32 i = 0; i < numVertices; i++)
+			{
+				const UINT32 vertexIdx = sortedVertices[i];
+				const UINT32 prevVertexIdx = i > 0 ? sortedVertices[i - 1] : vertexIdx;
+
+				if (i > 0 && memcmp(vertexDataPtr + vertexIdx * vertexSize, vertexDataPtr + prevVertexIdx * vertexSize, 
+					vertexSize) == 0)
+					weldRemap[vertexIdx] = weldRemap[prevVertexIdx];
+				else
+					weldRemap[vertexIdx] = vertexIdx;
+			}
+
+			for (auto& index : indices)
+				index = weldRemap[index];
+		}
+
+		// Remove degenerate triangles and reorder the triangles of each sub-mesh
+		Vector<UINT32> outputIndices;
+		outputIndices.reserve(indices.size());
+		for (auto& subMesh : subMeshes)
+		{
+			const auto offset = (UINT32)outputIndices.size();
+			outputIndices.insert(outputIndices.end(), indices.begin() + subMesh.indexOffset, 
+				indices.begin() + subMesh.indexOffset + subMesh.indexCount);
+
+			if (subMesh.drawOp == DOT_TRIANGLE_LIST && subMesh.indexCount > 0)
+			{
+				const UINT32 numRemaining = removeDegenerateTriangles(&outputIndices[offset], subMesh.indexCount);
+				outputIndices.resize(offset + numRemaining);
+
+				if (numRemaining > 0)
+					optimizeVertexCache(&outputIndices[offset], numRemaining, numVertices);
+			}
+
+			subMesh.indexOffset = offset;
+			subMesh.indexCount = (UINT32)outputIndices.size() - offset;
+		}
+
+		const auto numOutputIndices = (UINT32)outputIndices.size();
+
+		Vector<UINT32> vertexRemap;
+		UINT32 numOutputVertices = numVertices;
+		if (reorderVertices)
+			numOutputVertices = optimizeVertexFetch(outputIndices.data(), numOutputIndices, numVertices, vertexRemap);
+
+		const IndexType indexType = meshData->getIndexType();
+		SPtr<MeshData> output = MeshData::create(numOutputVertices, numOutputIndices, vertexDesc, indexType);
+		output->setPositionBounds(meshData->getPositionBounds());
+
+		if (indexType == IT_16BIT)
+		{
+			UINT16* dstIndices = output->getIndices16();
+			for (UINT32 i = 0; i < numOutputIndices; i++)
+				dstIndices[i] = (UINT16)outputIndices[i];
+		}
+		else
+			memcpy(output->getIndices32(), outputIndices.data(), numOutputIndices * sizeof(UINT32));
+
+		for (auto& streamIdx : streams)
+		{
+			const UINT32 stride = vertexDesc->getVertexStride(streamIdx);
+			const UINT8* src = meshData->getStreamData(streamIdx);
+			UINT8* dst = output->getStreamData(streamIdx);
+
+			if (reorderVertices)
+			{
+				for (UINT32 i = 0; i < numVertices; i++)
+				{
+					if (vertexRemap[i] != (UINT32)-1)
+						memcpy(dst + vertexRemap[i] * stride, src + i * stride, stride);
+				}
+			}
+			else
+				memcpy(dst, src, numVertices * stride);
+		}
+
+		return output;
+	}
+
+	/** Maximum number of vertices in the cache simulated by MeshUtility::optimizeVertexCache(). */
+	static constexpr UINT32 VERTEX_CACHE_SIZE = 32;
+
+	/** Calculates the score of a vertex used for ordering triangles in MeshUtility::optimizeVertexCache(). */
+	static float calcVertexCacheScore(INT32 cachePosition, UINT32 numRemainingTriangles)
+	{
+		static constexpr float CACHE_DECAY_POWER = 1.5f;
+		static constexpr float LAST_TRIANGLE_SCORE = 0.75f;
+		static constexpr float VALENCE_BOOST_SCALE = 2.0f;
+		static constexpr float VALENCE_BOOST_POWER = 0.5f;
+
+		if (numRemainingTriangles == 0)
+			return -1.0f;
+
+		float score = 0.0f;
+		if (cachePosition >= 0)
+		{
+			// Vertices of the last triangle get a lower fixed score, so the same triangle isn't favored again
+			if (cachePosition < 3)
+				score = LAST_TRIANGLE_SCORE;
+			else
+			{
+				const float scale = 1.0f / (VERTEX_CACHE_SIZE - 3);
+				score = std::pow(1.0f - (cachePosition - 3) * scale, CACHE_DECAY_POWER);
+			}
+		}
+
+		// Favor vertices with few remaining triangles, so they can be finished off and don't need to be reloaded later
+		score += VALENCE_BOOST_SCALE * std::pow((float)numRemainingTriangles, -VALENCE_BOOST_POWER);
+		return score;
+	}
+
+	void MeshUtility::optimizeVertexCache(UINT32* indices, UINT32 numIndices, UINT32 numVertices)
+	{
+		const UINT32 numTriangles = numIndices / 3;
+		if (numTriangles == 0)
+			return;
+
+		// Find triangles referencing each vertex
+		Vector<UINT32> triangleOffsets(numVertices + 1, 0);
+		for (UINT32 i = 0; i < numTriangles * 3; i++)
+			triangleOffsets[indices[i] + 1]++;
+
+		for (UINT32 i = 0; i < numVertices; i++)
+			triangleOffsets[i + 1] += triangleOffsets[i];
+
+		Vector<UINT32> numActiveTriangles(numVertices, 0);
+		Vector<UINT32> vertexTriangles(numTriangles * 3);
+		for (UINT32 i = 0; i < numTriangles * 3; i++)
+		{
+			const UINT32 vertexIdx = indices[i];
+			vertexTriangles[triangleOffsets[vertexIdx] + numActiveTriangles[vertexIdx]++] = i / 3;
+		}
+
+		Vector<INT32> cachePositions(numVertices, -1);
+		Vector<float> vertexScores(numVertices);
+		for (UINT32 i = 0; i < numVertices; i++)
+			vertexScores[i] = calcVertexCacheScore(-1, numActiveTriangles[i]);
+
+		Vector<float> triangleScores(numTriangles);
+		for (UINT32 i = 0; i < numTriangles; i++)
+		{
+			triangleScores[i] = vertexScores[indices[i * 3 + 0]] + vertexScores[indices[i * 3 + 1]] + 
+				vertexScores[indices[i * 3 + 2]];
+		}
+
+		Vector<bool> isEmitted(numTriangles, false);
+		Vector<UINT32> output(numTriangles * 3);
+
+		UINT32 cache[VERTEX_CACHE_SIZE + 3];
+		UINT32 newCache[VERTEX_CACHE_SIZE + 3];
+		UINT32 cacheSize = 0;
+
+		UINT32 bestTriangle = (UINT32)-1;
+		UINT32 nextUnemitted = 0;
+		for (UINT32 i = 0; i < numTriangles; i++)
+		{
+			// No triangles share vertices with the cache, continue with the next triangle in the original order
+			if (bestTriangle == (UINT32)-1)
+			{
+				while (isEmitted[nextUnemitted])
+					nextUnemitted++;
+
+				bestTriangle = nextUnemitted;
+			}
+
+			const UINT32 triangle[] = { indices[bestTriangle * 3 + 0], indices[bestTriangle * 3 + 1], 
+				indices[bestTriangle * 3 + 2] };
+
+			memcpy(&output[i * 3], triangle, sizeof(triangle));
+			isEmitted[bestTriangle] = true;
+
+			// Remove the triangle from the list of active triangles of its vertices
+			for (auto& vertexIdx : triangle)
+			{
+				UINT32* activeTriangles = &vertexTriangles[triangleOffsets[vertexIdx]];
+				UINT32& numActive = numActiveTriangles[vertexIdx];
+
+				for (UINT32 j = 0; j < numActive; j++)
+				{
+					if (activeTriangles[j] == bestTriangle)
+					{
+						activeTriangles[j] = activeTriangles[numActive - 1];
+						numActive--;
+						break;
+					}
+				}
+			}
+
+			// Move the triangle's vertices to the front of the cache
+			UINT32 newCacheSize = 0;
+			for (auto& vertexIdx : triangle)
+			{
+				if (std::find(newCache, newCache + newCacheSize, vertexIdx) == newCache + newCacheSize)
+					newCache[newCacheSize++] = vertexIdx;
+			}
+
+			for (UINT32 j = 0; j < cacheSize; j++)
+			{
+				const UINT32 vertexIdx = cache[j];
+				if (vertexIdx != triangle[0] && vertexIdx != triangle[1] && vertexIdx != triangle[2])
+					newCache[newCacheSize++] = vertexIdx;
+			}
+
+			// Update the scores of all vertices that were in the cache, including the ones that were just pushed out
+			for (UINT32 j = 0; j < newCacheSize; j++)
+			{
+				const UINT32 vertexIdx = newCache[j];
+				cachePositions[vertexIdx] = j < VERTEX_CACHE_SIZE ? (INT32)j : -1;
+
+				const float score = calcVertexCacheScore(cachePositions[vertexIdx], numActiveTriangles[vertexIdx]);
+				const float scoreDelta = score - vertexScores[vertexIdx];
+				vertexScores[vertexIdx] = score;
+
+				const UINT32* activeTriangles = &vertexTriangles[triangleOffsets[vertexIdx]];
+				for (UINT32 k = 0; k < numActiveTriangles[vertexIdx]; k++)
+					triangleScores[activeTriangles[k]] += scoreDelta;
+			}
+
+			// Pick the best next triangle from the ones using the cached vertices
+			bestTriangle = (UINT32)-1;
+			float bestScore = -1.0f;
+			cacheSize = std::min(newCacheSize, VERTEX_CACHE_SIZE);
+			for (UINT32 j = 0; j < cacheSize; j++)
+			{
+				const UINT32 vertexIdx = newCache[j];
+				cache[j] = vertexIdx;
+
+				const UINT32* activeTriangles = &vertexTriangles[triangleOffsets[vertexIdx]];
+				for (UINT32 k = 0; k < numActiveTriangles[vertexIdx]; k++)
+				{
+					const UINT32 triangleIdx = activeTriangles[k];
+					if (triangleScores[triangleIdx] > bestScore)
+					{
+						bestScore = triangleScores[triangleIdx];
+						bestTriangle = triangleIdx;
+					}
+				}
+			}
+		}
+
+		memcpy(indices, output.data(), numTriangles * 3 * sizeof(UINT32));
+	}
+
+	UINT32 MeshUtility::optimizeVertexFetch(UINT32* indices, UINT32 numIndices, UINT32 numVertices, 
+		Vector<UINT32>& remap)
+	{
+		remap.assign(numVertices, (UINT32)-1);
+
+		UINT32 numOutputVertices = 0;
+		for (UINT32 i = 0; i < numIndices; i++)
+		{
+			UINT32& newIndex = remap[indices[i]];
+			if (newIndex == (UINT32)-1)
+				newIndex = numOutputVertices++;
+
+			indices[i] = newIndex;
+		}
+
+		return numOutputVertices;
+	}
+
+	UINT32 MeshUtility::removeDegenerateTriangles(UINT32* indices, UINT32 numIndices)
+	{
+		UINT32 numOutputIndices = 0;
+		for (UINT32 i = 0; i + 2 < numIndices; i += 3)
+		{
+			const UINT32 a = indices[i + 0];
+			const UINT32 b = indices[i + 1];
+			const UINT32 c = indices[i + 2];
+
+			if (a == b || b == c || a == c)
+				continue;
+
+			indices[numOutputIndices++] = a;
+			indices[numOutputIndices++] = b;
+			indices[numOutputIndices++] = c;
+		}
+
+		return numOutputIndices;
+	}
+
+	float MeshUtility::calculateACMR(const UINT32* indices, UINT32 numIndices, UINT32 cacheSize)
+	{
+		const UINT32 numTriangles = numIndices / 3;
+		if (numTriangles == 0)
+			return 0.0f;
+
+		UINT32 maxIndex = 0;
+		for (UINT32 i = 0; i < numIndices; i++)
+			maxIndex = std::max(maxIndex, indices[i]);
+
+		// A FIFO cache contains the vertices loaded by the last 'cacheSize' misses
+		Vector<UINT32> loadTimes(maxIndex + 1, (UINT32)-1);
+		UINT32 numMisses = 0;
+		for (UINT32 i = 0; i < numTriangles * 3; i++)
+		{
+			UINT32& loadTime = loadTimes[indices[i]];
+			if (loadTime == (UINT32)-1 || (numMisses - loadTime) >= cacheSize)
+				loadTime = numMisses++;
+		}
+
+		return numMisses / (float)numTriangles;
+	}
+
+	float MeshUtility::calculateACMR(const MeshData& meshData, const Vector<SubMesh>& subMeshes, UINT32 cacheSize)
+	{
+		const Vector<UINT32> indices = readIndices(meshData);
+
+		float numMisses = 0.0f;
+		UINT32 numTriangles = 0;
+		for (auto& subMesh : subMeshes)
+		{
+			if (subMesh.drawOp != DOT_TRIANGLE_LIST || subMesh.indexCount < 3)
+				continue;
+
+			const UINT32 numSubMeshTriangles = subMesh.indexCount / 3;
+			numMisses += calculateACMR(&indices[subMesh.indexOffset], subMesh.indexCount, cacheSize) * numSubMeshTriangles;
+			numTriangles += numSubMeshTriangles;
+		}
+
+		return numTriangles > 0 ? numMisses / numTriangles : 0.0f;
+	}
+	SPtr<MeshData> MeshUtility::compressVertices(const SPtr<MeshData>& meshData)
+	{
+		const SPtr<VertexDataDesc>& vertexDesc = meshData->getVertexDesc();
+		const UINT32 numVertices = meshData->getNumVertices();
+		const UINT32 numIndices = meshData->getNumIndices();
+
+		// Pick compressed formats for the elements that support them
+		SPtr<VertexDataDesc> outputVertexDesc = VertexDataDesc::create();
+		for (UINT32 i = 0; i < vertexDesc->getNumElements(); i++)
+		{
+			const VertexElement& element = vertexDesc->getElement(i);
+
+			VertexElementType type = element.getType();
+			switch (element.getSemantic())
+			{
+			case VES_POSITION:
+				if (element.getSemanticIdx() == 0 && (type == VET_FLOAT3 || type == VET_FLOAT4))
+					type = VET_SHORT4_NORM;
+				break;
+			case VES_NORMAL:
+				if (type == VET_FLOAT3 || type == VET_UBYTE4_NORM)
+					type = VET_SHORT2_NORM;
+				break;
+			case VES_TANGENT:
+				if (type == VET_FLOAT4 || type == VET_UBYTE4_NORM)
+					type = VET_SHORT2_NORM;
+				break;
+			case VES_TEXCOORD:
+				if (type == VET_FLOAT2)
+					type = VET_HALF2;
+				break;
+			default:
+				break;
+			}
+
+			outputVertexDesc->addVertElem(type, element.getSemantic(), element.getSemanticIdx(), element.getStreamIdx(),
+				element.getInstanceStepRate());
+		}
+
+		SPtr<MeshData> output = MeshData::create(numVertices, numIndices, outputVertexDesc, meshData->getIndexType());
+		memcpy(output->getIndexData(), meshData->getIndexData(), numIndices * meshData->getIndexElementSize());
+
+		Vector<Vector4> decoded(numVertices);
+		for (UINT32 i = 0; i < vertexDesc->getNumElements(); i++)
+		{
+			const VertexElement& srcElement = vertexDesc->getElement(i);
+			const VertexElement& dstElement = outputVertexDesc->getElement(i);
+
+			const VertexElementSemantic semantic = srcElement.getSemantic();
+			const UINT32 semanticIdx = srcElement.getSemanticIdx();
+			const UINT32 streamIdx = srcElement.getStreamIdx();
+
+			UINT8* src = meshData->getElementData(semantic, semanticIdx, streamIdx);
+			UINT8* dst = output->getElementData(semantic, semanticIdx, streamIdx);
+			const UINT32 srcStride = vertexDesc->getVertexStride(streamIdx);
+			const UINT32 dstStride = outputVertexDesc->getVertexStride(streamIdx);
+
+			const VertexElementType srcType = srcElement.getType();
+			switch (dstElement.getType())
+			{
+			case VET_SHORT4_NORM:
+			{
+				AABox bounds(Vector3::INF, -Vector3::INF);
+				for (UINT32 j = 0; j < numVertices; j++)
+				{
+					const Vector3& position = *(Vector3*)(src + j * srcStride);
+					bounds.merge(position);
+				}
+
+				if (numVertices == 0)
+					bounds = AABox(Vector3::ZERO, Vector3::ZERO);
+
+				const Vector3 center = bounds.getCenter();
+				const Vector3 extents = bounds.getHalfSize();
+				const Vector3 invExtents(
+					extents.x > 0.0f ? 1.0f / extents.x : 0.0f,
+					extents.y > 0.0f ? 1.0f / extents.y : 0.0f,
+					extents.z > 0.0f ? 1.0f / extents.z : 0.0f);
+
+				for (UINT32 j = 0; j < numVertices; j++)
+				{
+					const Vector3 position = (*(Vector3*)(src + j * srcStride) - center) * invExtents;
+
+					INT16* quantized = (INT16*)(dst + j * dstStride);
+					quantized[0] = toSNorm16(position.x);
+					quantized[1] = toSNorm16(position.y);
+					quantized[2] = toSNorm16(position.z);
+					quantized[3] = 0;
+				}
+
+				output->setPositionBounds(bounds);
+				break;
+			}
+			case VET_SHORT2_NORM:
+				if (semantic == VES_NORMAL)
+				{
+					if (srcType == VET_UBYTE4_NORM)
+					{
+						unpackNormals(src, (Vector4*)decoded.data(), numVertices, srcStride);
+						for (auto& entry : decoded)
+							*(Vector3*)&entry = Vector3::normalize(Vector3(entry.x, entry.y, entry.z));
+
+						packOctahedral((Vector3*)decoded.data(), dst, numVertices, sizeof(Vector4), dstStride);
+					}
+					else
+						packOctahedral((Vector3*)src, dst, numVertices, srcStride, dstStride);
+				}
+				else
+				{
+					if (srcType == VET_UBYTE4_NORM)
+					{
+						unpackNormals(src, decoded.data(), numVertices, srcStride);
+						for (auto& entry : decoded)
+						{
+							const Vector3 tangent = Vector3::normalize(Vector3(entry.x, entry.y, entry.z));
+							entry = Vector4(tangent.x, tangent.y, tangent.z, entry.w);
+						}
+
+						packOctahedral(decoded.data(), dst, numVertices, sizeof(Vector4), dstStride);
+					}
+					else
+						packOctahedral((Vector4*)src, dst, numVertices, srcStride, dstStride);
+				}
+				break;
+			case VET_HALF2:
+				for (UINT32 j = 0; j < numVertices; j++)
+				{
+					const Vector2& uv = *(Vector2*)(src + j * srcStride);
+
+					UINT16* packed = (UINT16*)(dst + j * dstStride);
+					packed[0] = Bitwise::floatToHalf(uv.x);
+					packed[1] = Bitwise::floatToHalf(uv.y);
+				}
+				break;
+			default:
+			{
+				const UINT32 elementSize = srcElement.getSize();
+				for (UINT32 j = 0; j < numVertices; j++)
+					memcpy(dst + j * dstStride, src + j * srcStride, elementSize);
+				break;
+			}
+			}
+		}
+
+		return output;
+	}
 }
\ No newline at end of file
@@ -179,6 +179,157 @@ namespace bs
 		 */
 		static void unpackNormals(UINT8* source, Vector4* destination, UINT32 count, UINT32 stride);
 
+		/** 
+		 * Encodes unit vectors using octahedral encoding, into two 16-bit signed normalized components (VET_SHORT2_NORM).
+		 *
+		 * @param[in]	source		Pointer to an array of unit vectors.
+		 * @param[out]	destination	Buffer that will receive the encoded vectors. Must be able to hold @p count 
+		 *							encoded vectors of 4 bytes each, separated by @p outStride.
+		 * @param[in]	count		Number of vectors to encode.
+		 * @param[in]	inStride	Distance between two vectors in the @p source buffer, in bytes.
+		 * @param[in]	outStride	Distance between two vectors in the @p destination buffer, in bytes.
+		 */
+		static void packOctahedral(Vector3* source, UINT8* destination, UINT32 count, UINT32 inStride, UINT32 outStride);
+
+		/** 
+		 * Encodes tangents using octahedral encoding. Same as packOctahedral(Vector3*, UINT8*, UINT32, UINT32, UINT32), 
+		 * except that the sign of the w component (bitangent sign) is stored in the sign of the second encoded component,
+		 * at the cost of one bit of its precision.
+		 */
+		static void packOctahedral(Vector4* source, UINT8* destination, UINT32 count, UINT32 inStride, UINT32 outStride);
+
+		/** 
+		 * Decodes unit vectors encoded with packOctahedral(Vector3*, UINT8*, UINT32, UINT32, UINT32). 
+		 *
+		 * @param[in]	source		Buffer containing the encoded vectors.
+		 * @param[out]	destination	Pre-allocated buffer to output the decoded vectors to. Must be able to hold @p count
+		 *							vectors.
+		 * @param[in]	count		Number of vectors to decode.
+		 * @param[in]	stride		Distance between two vectors in the @p source buffer, in bytes.
+		 */
+		static void unpackOctahedral(UINT8* source, Vector3* destination, UINT32 count, UINT32 stride);
+
+		/** Decodes tangents encoded with packOctahedral(Vector4*, UINT8*, UINT32, UINT32, UINT32). */
+		static void unpackOctahedral(UINT8* source, Vector4* destination, UINT32 count, UINT32 stride);
+
+		/**
+		 * Reduces the number of triangles in a triangle list by collapsing edges in order of the error they introduce, as
+		 * measured by quadric error metrics. Vertices are only ever collapsed onto other existing vertices, so the output
+		 * indices reference the same vertices as the input. Vertices on mesh borders and vertices split due to different
+		 * attributes (e.g. on UV seams) are never moved, in order to preserve the mesh silhouette and texture mapping.
+		 *
+		 * @param[in]	vertices			A set of vertex positions in Vector3 format. Each position should be 
+		 *									@p vertexStride bytes from each other.
+		 * @param[in]	numVertices			Number of vertices in the @p vertices array.
+		 * @param[in]	vertexStride		Distance in bytes between two positions in the @p vertices array.
+		 * @param[in]	indices				Set of indices containing indexes into vertex array for each triangle.
+		 * @param[in]	numIndices			Number of indices in the @p indices array. Must be a multiple of three.
+		 * @param[in]	targetNumIndices	Number of indices the simplified triangle list should contain. Simplification
+		 *									stops earlier if no more edges can be collapsed without flipping triangles.
+		 * @param[out]	output				Indices of the simplified triangle list.
+		 */
+		static void simplify(const UINT8* vertices, UINT32 numVertices, UINT32 vertexStride, const UINT32* indices,
+			UINT32 numIndices, UINT32 targetNumIndices, Vector<UINT32>& output);
+
+		/**
+		 * Generates levels of detail for a mesh by progressively simplifying its sub-meshes using simplify(). Indices of
+		 * the simplified sub-meshes are appended to the mesh's index buffer, while the vertices are shared with the
+		 * original mesh. Sub-meshes that aren't triangle lists are not simplified.
+		 *
+		 * @param[in]	meshData		Mesh data containing 3D vertex positions and indices of the original mesh.
+		 * @param[in]	subMeshes		Sub-meshes of the original mesh.
+		 * @param[in]	screenSizes		Screen sizes at which each level of detail is used, one per level. Should be in
+		 *								descending order. See MeshLOD::screenSize.
+		 * @param[in]	reduction		Fraction of triangles each level keeps, relative to the previous level. In (0, 1)
+		 *								range.
+		 * @param[out]	lods			Generated levels of detail, not including the original mesh. Might contain fewer
+		 *								levels than requested if the mesh couldn't be simplified further.
+		 * @return						Mesh data containing the original data, followed by the indices of the generated
+		 *								levels. Original mesh data if no levels were generated.
+		 */
+		static SPtr<MeshData> generateLODs(const SPtr<MeshData>& meshData, const Vector<SubMesh>& subMeshes,
+			const Vector<float>& screenSizes, float reduction, Vector<MeshLOD>& lods);
+
+		/**
+		 * Optimizes a mesh for rendering performance. Vertices with identical data are welded together, degenerate 
+		 * triangles are removed, triangles are reordered for better post-transform vertex cache utilization and vertices
+		 * are reordered in the order they are first referenced, for better vertex fetch locality. Only triangle list 
+		 * sub-meshes are modified, and any indices not referenced by a sub-mesh are removed.
+		 *
+		 * @param[in]		meshData			Mesh data to optimize.
+		 * @param[in, out]	subMeshes			Sub-meshes of the mesh. Updated to reference the indices in the optimized
+		 *										mesh data.
+		 * @param[in]		reorderVertices		If false, vertices are neither welded nor reordered and only the indices
+		 *										are modified. Use this when other data references the mesh vertices by
+		 *										their index (e.g. morph shapes).
+		 * @return								Optimized mesh data.
+		 */
+		static SPtr<MeshData> optimize(const SPtr<MeshData>& meshData, Vector<SubMesh>& subMeshes, 
+			bool reorderVertices = true);
+
+		/**
+		 * Reorders triangles in a triangle list so that vertices are reused while they are still in the post-transform
+		 * vertex cache. Uses Forsyth's linear-speed vertex cache optimization algorithm.
+		 *
+		 * @param[in, out]	indices		Indices of the triangle list to reorder.
+		 * @param[in]		numIndices	Number of indices in the @p indices array. Must be a multiple of three.
+		 * @param[in]		numVertices	Number of vertices referenced by the indices. All indices must be lower than this.
+		 */
+		static void optimizeVertexCache(UINT32* indices, UINT32 numIndices, UINT32 numVertices);
+
+		/**
+		 * Calculates new vertex indices so that vertices are ordered the same way they are first referenced by the 
+		 * provided indices, and remaps the indices accordingly. Vertices not referenced by any index are removed.
+		 *
+		 * @param[in, out]	indices		Indices to remap.
+		 * @param[in]		numIndices	Number of indices in the @p indices array.
+		 * @param[in]		numVertices	Number of vertices referenced by the indices. All indices must be lower than this.
+		 * @param[out]		remap		New index of each of the original vertices, or -1 if the vertex is removed.
+		 * @return						Number of vertices after remapping.
+		 */
+		static UINT32 optimizeVertexFetch(UINT32* indices, UINT32 numIndices, UINT32 numVertices, Vector<UINT32>& remap);
+
+		/**
+		 * Removes triangles that reference the same vertex more than once, by moving the remaining triangles towards the
+		 * start of the array.
+		 *
+		 * @param[in, out]	indices		Indices of the triangle list.
+		 * @param[in]		numIndices	Number of indices in the @p indices array. Must be a multiple of three.
+		 * @return						Number of remaining indices.
+		 */
+		static UINT32 removeDegenerateTriangles(UINT32* indices, UINT32 numIndices);
+
+		/**
+		 * Calculates the average cache miss ratio (number of vertex shader invocations per triangle) of a triangle list,
+		 * by simulating a FIFO post-transform vertex cache. Value ranges from 3 (no reuse) to around 0.5 (optimal for 
+		 * regular grids).
+		 *
+		 * @param[in]	indices		Indices of the triangle list.
+		 * @param[in]	numIndices	Number of indices in the @p indices array. Must be a multiple of three.
+		 * @param[in]	cacheSize	Number of vertices that fit in the simulated cache.
+		 */
+		static float calculateACMR(const UINT32* indices, UINT32 numIndices, UINT32 cacheSize = 16);
+
+		/** 
+		 * Calculates the average cache miss ratio of all triangle list sub-meshes of a mesh. 
+		 * See calculateACMR(const UINT32*, UINT32, UINT32).
+		 */
+		static float calculateACMR(const MeshData& meshData, const Vector<SubMesh>& subMeshes, UINT32 cacheSize = 16);
+
+		/**
+		 * Converts vertex data into compact formats, reducing vertex memory and bandwidth use:
+		 *  - Positions are quantized to 16-bit values relative to the bounds of the mesh (VET_SHORT4_NORM). The bounds are
+		 *    stored in the output and can be retrieved with MeshData::getPositionBounds().
+		 *  - Normals and tangents are stored using octahedral encoding (VET_SHORT2_NORM). See packOctahedral().
+		 *  - Texture coordinates are stored as half-precision floats (VET_HALF2).
+		 *  
+		 * Elements using other types or semantics are copied as is.
+		 *
+		 * @param[in]	meshData	Mesh data to compress.
+		 * @return					New mesh data containing the compressed vertices and the original indices.
+		 */
+		static SPtr<MeshData> compressVertices(const SPtr<MeshData>& meshData);
+
 		/** Decodes a normal from 4D 8-bit packed format into a 32-bit float format. */
 		static Vector3 unpackNormal(const UINT8* source)
 		{
@@ -34,6 +34,47 @@ namespace bs
 		output.push_back(val.a);
 	}
 
+	/** Returns the per-component minimum of the two values. */
+	template <class T>
+	T getMin(const T& a, const T& b) { return std::min(a, b); }
+
+	template <>
+	Vector3 getMin(const Vector3& a, const Vector3& b) { return Vector3::min(a, b); }
+
+	template <>
+	Vector2 getMin(const Vector2& a, const Vector2& b) { return Vector2::min(a, b); }
+
+	/** Returns the per-component maximum of the two values. */
+	template <class T>
+	T getMax(const T& a, const T& b) { return std::max(a, b); }
+
+	template <>
+	Vector3 getMax(const Vector3& a, const Vector3& b) { return Vector3::max(a, b); }
+
+	template <>
+	Vector2 getMax(const Vector2& a, const Vector2& b) { return Vector2::max(a, b); }
+
+	/** Returns an upper bound on the magnitude of any value within the per-component range [@p min, @p max]. */
+	float getMaxMagnitude(float min, float max)
+	{
+		return std::max(Math::abs(min), Math::abs(max));
+	}
+
+	float getMaxMagnitude(const Vector3& min, const Vector3& max)
+	{
+		return Vector3(
+			std::max(Math::abs(min.x), Math::abs(max.x)),
+			std::max(Math::abs(min.y), Math::abs(max.y)),
+			std::max(Math::abs(min.z), Math::abs(max.z))).length();
+	}
+
+	float getMaxMagnitude(const Vector2& min, const Vector2& max)
+	{
+		return Vector2(
+			std::max(Math::abs(min.x), Math::abs(max.x)),
+			std::max(Math::abs(min.y), Math::abs(max.y))).length();
+	}
+
 	LookupTable ColorDistribution::toLookupTable(UINT32 numSamples, bool ignoreRange) const
 	{
 		numSamples = std::max(1U, numSamples);
@@ -149,6 +190,37 @@ namespace bs
 		return LookupTable(std::move(values), minT, maxT, sizeof(T) / sizeof(float));
 	}
 
+	template <class T>
+	std::pair<T, T> TDistribution<T>::calculateRange() const
+	{
+		switch (mType)
+		{
+		default:
+		case PDT_Constant:
+			return std::make_pair(getMinConstant(), getMinConstant());
+		case PDT_RandomRange:
+			return std::make_pair(
+				getMin(getMinConstant(), getMaxConstant()), 
+				getMax(getMinConstant(), getMaxConstant()));
+		case PDT_Curve:
+			return mMinCurve.calculateRange();
+		case PDT_RandomCurveRange:
+			{
+				const std::pair<T, T> minRange = mMinCurve.calculateRange();
+				const std::pair<T, T> maxRange = mMaxCurve.calculateRange();
+
+				return std::make_pair(getMin(minRange.first, maxRange.first), getMax(minRange.second, maxRange.second));
+			}
+		}
+	}
+
+	template <class T>
+	float TDistribution<T>::getMaxMagnitude() const
+	{
+		const std::pair<T, T> range = calculateRange();
+		return bs::getMaxMagnitude(range.first, range.second);
+	}
+
 	template struct BS_CORE_EXPORT TDistribution<float>;
 	template struct BS_CORE_EXPORT TDistribution<Vector3>;
 	template struct BS_CORE_EXPORT TDistribution<Vector2>;
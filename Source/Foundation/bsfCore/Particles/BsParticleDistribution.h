@@ -390,6 +390,18 @@ namespace bs
 		 */
 		LookupTable toLookupTable(UINT32 numSamples = 128, bool ignoreRange = false) const;
 
+		/** 
+		 * Returns the minimum and maximum values the distribution can evaluate to, for any time and any random factor. For
+		 * vector types the range is calculated per-component.
+		 */
+		std::pair<T, T> calculateRange() const;
+
+		/** 
+		 * Returns the largest absolute value the distribution can evaluate to, for any time and any random factor. For
+		 * vector types this is a conservative upper bound on the length of the evaluated vector.
+		 */
+		float getMaxMagnitude() const;
+
 		bool operator== (const TDistribution<T>& rhs) const
 		{
 			if(mType != rhs.mType)
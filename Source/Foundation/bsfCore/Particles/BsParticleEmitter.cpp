@@ -1,6 +1,7 @@
 //************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "BsParticleEmitter.h"
+#include "Particles/BsParticleEvolver.h"
 #include "Mesh/BsMeshData.h"
 #include "Mesh/BsMeshUtility.h"
 #include "RenderAPI/BsVertexDataDesc.h"
@@ -291,7 +292,6 @@ namespace bs
 	void ParticleEmitterConeShape::calcBounds(AABox& shape, AABox& velocity) const
 	{
 		const float sinAngle = Math::sin(mInfo.angle);
-		const float cosAngle = Math::cos(mInfo.angle);
 
 		if(mInfo.type == ParticleEmitterConeType::Base)
 		{
@@ -300,11 +300,12 @@ namespace bs
 		}
 		else
 		{
+			// Normals of particles spawned closer to the cone axis are steeper than the cone angle, so they can travel up
+			// to the full length along the axis
 			const float topRadius = mInfo.radius + mInfo.length * sinAngle;
-			const float length = mInfo.length * cosAngle;
 
 			shape.setMin(Vector3(-topRadius, -topRadius, 0.0f));
-			shape.setMax(Vector3(topRadius, topRadius, length));
+			shape.setMax(Vector3(topRadius, topRadius, mInfo.length));
 		}
 
 		velocity.setMin(Vector3(-sinAngle, -sinAngle, 0.0f));
@@ -390,11 +391,12 @@ namespace bs
 
 	void ParticleEmitterHemisphereShape::calcBounds(AABox& shape, AABox& velocity) const
 	{
-		shape.setMin(Vector3(-mInfo.radius, -mInfo.radius, 0.0f));
-		shape.setMax(Vector3::ONE * mInfo.radius);
+		// Particles are spawned in the negative Z half of the sphere
+		shape.setMin(Vector3::ONE * -mInfo.radius);
+		shape.setMax(Vector3(mInfo.radius, mInfo.radius, 0.0f));
 
-		velocity.setMin(Vector3(-1.0f, -1.0f, 0.0f));
-		velocity.setMax(Vector3::ONE);
+		velocity.setMin(-Vector3::ONE);
+		velocity.setMax(Vector3(1.0f, 1.0f, 0.0f));
 	}
 	
 	SPtr<ParticleEmitterHemisphereShape> ParticleEmitterHemisphereShape::create(const PARTICLE_HEMISPHERE_SHAPE_DESC& desc)
@@ -1222,11 +1224,9 @@ namespace bs
 			const SPtr<Animation>& anim = renderable->getAnimation();
 			if(anim)
 			{
-				// No culling, make the box infinite
-				if(!anim->getCulling())
-					shape = AABox::INF_BOX;
-				else
-					shape = anim->getBounds();
+				// Animation bounds are in world space and the animated mesh can move freely, so there's no finite box
+				// relative to the particle system
+				shape = AABox::INF_BOX;
 			}
 			else
 			{
@@ -1467,6 +1467,42 @@ namespace bs
 		return bs_shared_ptr_new<ParticleEmitter>();
 	}
 
+	bool ParticleEmitter::calcBounds(const ParticleMotionBounds& motion, AABox& bounds) const
+	{
+		if(!mShape)
+			return false;
+
+		AABox shapeBounds;
+		AABox normalBounds;
+		mShape->calcBounds(shapeBounds, normalBounds);
+
+		if(shapeBounds == AABox::INF_BOX)
+			return false;
+
+		const float maxLifetime = mInitialLifetime.getMaxMagnitude();
+		const std::pair<float, float> speedRange = mInitialSpeed.calculateRange();
+
+		// Initial velocity is the spawn normal scaled by speed, so the movement it causes is limited by the normal bounds
+		// scaled by the smallest and the largest distance a particle can travel
+		AABox initialMotion(Vector3::ZERO, Vector3::ZERO);
+		for(float distance : { speedRange.first * maxLifetime, speedRange.second * maxLifetime })
+		{
+			initialMotion.merge(normalBounds.getMin() * distance);
+			initialMotion.merge(normalBounds.getMax() * distance);
+		}
+
+		// Evolvers and the random offset can move the particles in any direction
+		const float maxDistance = motion.maxSpeed * maxLifetime + 
+			0.5f * motion.maxAcceleration * maxLifetime * maxLifetime + mRandomOffset;
+		const Vector3 extraMotion = Vector3::ONE * maxDistance;
+
+		bounds.setExtents(
+			shapeBounds.getMin() + initialMotion.getMin() - extraMotion,
+			shapeBounds.getMax() + initialMotion.getMax() + extraMotion);
+
+		return true;
+	}
+
 	RTTITypeBase* ParticleEmitter::getRTTIStatic()
 	{
 		return ParticleEmitterRTTI::instance();
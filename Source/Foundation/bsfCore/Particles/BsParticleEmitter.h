@@ -14,6 +14,7 @@ namespace bs
 {
 	class Random;
 	class ParticleSet;
+	struct ParticleMotionBounds;
 
 	/** @addtogroup Particles
 	 *  @{
@@ -1069,6 +1070,15 @@ namespace bs
 		 */
 		UINT32 spawn(UINT32 count, Random& random, const ParticleSystemState& state, ParticleSet& set, bool spacing) const;
 
+		/**
+		 * Calculates conservative bounds that contain all particles spawned by this emitter, during their entire lifetime.
+		 *
+		 * @param[in]	motion		Limits on the movement applied to the particles by evolvers.
+		 * @param[out]	bounds		Bounds in the simulation space of the particle system.
+		 * @return					False if the bounds cannot be determined without looking at individual particles.
+		 */
+		bool calcBounds(const ParticleMotionBounds& motion, AABox& bounds) const;
+
 		// User-visible properties
 		SPtr<ParticleEmitterShape> mShape;
 
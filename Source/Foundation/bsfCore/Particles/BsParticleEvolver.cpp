@@ -62,6 +62,28 @@ namespace bs
 			return applyTransform<dir>(state.worldToLocal, output);
 	}
 
+	/** 
+	 * Returns an upper bound on how much a direction gets scaled when transformed by evaluateTransformed<true>() with the
+	 * same parameters.
+	 */
+	float getMaxTransformScale(const ParticleSystemState& state, bool inWorldSpace)
+	{
+		if(state.worldSpace == inWorldSpace)
+			return 1.0f;
+
+		const Matrix4& tfrm = state.worldSpace ? state.localToWorld : state.worldToLocal;
+
+		// Frobenius norm of the rotation/scale part is never smaller than the largest scale it applies
+		float sum = 0.0f;
+		for(UINT32 row = 0; row < 3; row++)
+		{
+			for(UINT32 col = 0; col < 3; col++)
+				sum += Math::sqr(tfrm[row][col]);
+		}
+
+		return Math::sqrt(sum);
+	}
+
 	ParticleTextureAnimation::ParticleTextureAnimation(const PARTICLE_TEXTURE_ANIMATION_DESC& desc)
 		:mDesc(desc)
 	{ }
@@ -255,6 +277,12 @@ namespace bs
 		}
 	}
 
+	bool ParticleVelocity::calcMotionBounds(const ParticleSystemState& state, ParticleMotionBounds& motion) const
+	{
+		motion.maxSpeed += mDesc.velocity.getMaxMagnitude() * getMaxTransformScale(state, mDesc.worldSpace);
+		return true;
+	}
+
 	SPtr<ParticleVelocity> ParticleVelocity::create(const PARTICLE_VELOCITY_DESC& desc)
 	{
 		return bs_shared_ptr_new<ParticleVelocity>(desc);
@@ -306,6 +334,16 @@ namespace bs
 		}
 	}
 
+	bool ParticleForce::calcMotionBounds(const ParticleSystemState& state, ParticleMotionBounds& motion) const
+	{
+		// Force gets scaled by the time step twice in evolve(), so for steps longer than a second the change in velocity
+		// is larger than the force itself
+		const float maxForce = mDesc.force.getMaxMagnitude() * getMaxTransformScale(state, mDesc.worldSpace);
+		motion.maxAcceleration += maxForce * std::max(1.0f, state.timeStep);
+
+		return true;
+	}
+
 	SPtr<ParticleForce> ParticleForce::create(const PARTICLE_FORCE_DESC& desc)
 	{
 		return bs_shared_ptr_new<ParticleForce>(desc);
@@ -356,6 +394,17 @@ namespace bs
 		}
 	}
 
+	bool ParticleGravity::calcMotionBounds(const ParticleSystemState& state, ParticleMotionBounds& motion) const
+	{
+		Vector3 gravity = state.scene->getPhysicsScene()->getGravity() * mDesc.scale;
+
+		if (!state.worldSpace)
+			gravity = state.worldToLocal.multiplyDirection(gravity);
+
+		motion.maxAcceleration += gravity.length();
+		return true;
+	}
+
 	SPtr<ParticleGravity> ParticleGravity::create(const PARTICLE_GRAVITY_DESC& desc)
 	{
 		return bs_shared_ptr_new<ParticleGravity>(desc);
@@ -37,6 +37,19 @@ namespace bs
 		INT32 priority;
 	};
 
+	/** 
+	 * Conservative limits on the movement of particles, used for calculating particle system bounds without iterating
+	 * over individual particles.
+	 */
+	struct ParticleMotionBounds
+	{
+		/** Maximum speed added to any particle on top of its initial velocity, in units per second. */
+		float maxSpeed = 0.0f;
+
+		/** Maximum acceleration applied to any particle, in units per second squared. */
+		float maxAcceleration = 0.0f;
+	};
+
 	/** Updates properties of all active particles in a particle system in some way. */
 	class BS_CORE_EXPORT BS_SCRIPT_EXPORT(m:Particles) ParticleEvolver : public ParticleModule
 	{
@@ -66,6 +79,19 @@ namespace bs
 		 */
 		virtual void evolve(Random& random, const ParticleSystemState& state, ParticleSet& set, UINT32 startIdx, 
 			UINT32 count, bool spacing, float spacingOffset) const = 0;
+
+		/**
+		 * Accumulates conservative limits on the movement this evolver applies to particles. Only called on analytical
+		 * evolvers.
+		 *
+		 * @param[in]		state	Particle system state for this frame.
+		 * @param[in, out]	motion	Limits to add the evolver's contribution to, in the simulation space of the particle
+		 *							system.
+		 * @return					False if the movement cannot be limited, in which case particle system bounds need to
+		 *							be calculated from individual particles instead.
+		 */
+		virtual bool calcMotionBounds(const ParticleSystemState& state, ParticleMotionBounds& motion) const 
+		{ return false; }
 	};
 
 	/** Structure used for initializing a ParticleTextureAnimation object. */
@@ -118,6 +144,10 @@ namespace bs
 		void evolve(Random& random, const ParticleSystemState& state, ParticleSet& set, UINT32 startIdx, 
 			UINT32 count, bool spacing, float spacingOffset) const override;
 
+		/** @copydoc ParticleEvolver::calcMotionBounds */
+		bool calcMotionBounds(const ParticleSystemState& state, ParticleMotionBounds& motion) const override
+		{ return true; }
+
 		PARTICLE_TEXTURE_ANIMATION_DESC mDesc;
 
 		/************************************************************************/
@@ -237,6 +267,9 @@ namespace bs
 		void evolve(Random& random, const ParticleSystemState& state, ParticleSet& set, UINT32 startIdx, 
 			UINT32 count, bool spacing, float spacingOffset) const override;
 
+		/** @copydoc ParticleEvolver::calcMotionBounds */
+		bool calcMotionBounds(const ParticleSystemState& state, ParticleMotionBounds& motion) const override;
+
 		PARTICLE_VELOCITY_DESC mDesc;
 
 		/************************************************************************/
@@ -292,6 +325,9 @@ namespace bs
 		void evolve(Random& random, const ParticleSystemState& state, ParticleSet& set, UINT32 startIdx, 
 			UINT32 count, bool spacing, float spacingOffset) const override;
 
+		/** @copydoc ParticleEvolver::calcMotionBounds */
+		bool calcMotionBounds(const ParticleSystemState& state, ParticleMotionBounds& motion) const override;
+
 		PARTICLE_FORCE_DESC mDesc;
 
 		/************************************************************************/
@@ -344,6 +380,9 @@ namespace bs
 		void evolve(Random& random, const ParticleSystemState& state, ParticleSet& set, UINT32 startIdx, 
 			UINT32 count, bool spacing, float spacingOffset) const override;
 
+		/** @copydoc ParticleEvolver::calcMotionBounds */
+		bool calcMotionBounds(const ParticleSystemState& state, ParticleMotionBounds& motion) const override;
+
 		PARTICLE_GRAVITY_DESC mDesc;
 
 		/************************************************************************/
@@ -396,6 +435,10 @@ namespace bs
 		void evolve(Random& random, const ParticleSystemState& state, ParticleSet& set, UINT32 startIdx, 
 			UINT32 count, bool spacing, float spacingOffset) const override;
 
+		/** @copydoc ParticleEvolver::calcMotionBounds */
+		bool calcMotionBounds(const ParticleSystemState& state, ParticleMotionBounds& motion) const override
+		{ return true; }
+
 		PARTICLE_COLOR_DESC mDesc;
 
 		/************************************************************************/
@@ -462,6 +505,10 @@ namespace bs
 		void evolve(Random& random, const ParticleSystemState& state, ParticleSet& set, UINT32 startIdx, 
 			UINT32 count, bool spacing, float spacingOffset) const override;
 
+		/** @copydoc ParticleEvolver::calcMotionBounds */
+		bool calcMotionBounds(const ParticleSystemState& state, ParticleMotionBounds& motion) const override
+		{ return true; }
+
 		PARTICLE_SIZE_DESC mDesc;
 
 		/************************************************************************/
@@ -526,6 +573,10 @@ namespace bs
 		void evolve(Random& random, const ParticleSystemState& state, ParticleSet& set, UINT32 startIdx, 
 			UINT32 count, bool spacing, float spacingOffset) const override;
 
+		/** @copydoc ParticleEvolver::calcMotionBounds */
+		bool calcMotionBounds(const ParticleSystemState& state, ParticleMotionBounds& motion) const override
+		{ return true; }
+
 		PARTICLE_ROTATION_DESC mDesc;
 
 		/************************************************************************/
@@ -290,6 +290,9 @@ namespace bs
 			preSimulate(state, 0, numParticles, false, 0.0f);
 			simulate(state, 0, numParticles, false, 0.0f);
 			postSimulate(state, 0, numParticles, false, 0.0f);
+
+			if(mSettings.useAutomaticBounds)
+				mHasAnalyticBounds = calcAnalyticBounds(state, mAnalyticBounds);
 		}
 
 		mTime = newTime;
@@ -387,11 +390,57 @@ namespace bs
 		}
 	}
 
+	bool ParticleSystem::calcAnalyticBounds(const ParticleSystemState& state, AABox& bounds) const
+	{
+		// World space particles stay where they were spawned, which depends on the history of the parent transform
+		if(mSettings.simulationSpace != ParticleSimulationSpace::Local)
+			return false;
+
+		ParticleMotionBounds motion;
+		for(auto& evolver : mEvolvers)
+		{
+			if(!evolver)
+				continue;
+
+			if(!evolver->getProperties().analytical || !evolver->calcMotionBounds(state, motion))
+				return false;
+		}
+
+		bool hasBounds = false;
+		for(auto& emitter : mEmitters)
+		{
+			if(!emitter)
+				continue;
+
+			AABox emitterBounds;
+			if(!emitter->calcBounds(motion, emitterBounds))
+				return false;
+
+			if(hasBounds)
+				bounds.merge(emitterBounds);
+			else
+				bounds = emitterBounds;
+
+			hasBounds = true;
+		}
+
+		return hasBounds;
+	}
+
 	AABox ParticleSystem::_calculateBounds() const
 	{
-		// TODO - If evolvers are deterministic (as well as their properties), calculate the maximinal bounds in an
-		// analytical way
+		const UINT32 particleCount = mParticleSet->getParticleCount();
+		if(particleCount == 0)
+			return AABox::BOX_EMPTY;
+
+		if(mHasAnalyticBounds)
+			return mAnalyticBounds;
 
+		return _calculateParticleBounds();
+	}
+
+	AABox ParticleSystem::_calculateParticleBounds() const
+	{
 		const UINT32 particleCount = mParticleSet->getParticleCount();
 		if(particleCount == 0)
 			return AABox::BOX_EMPTY;
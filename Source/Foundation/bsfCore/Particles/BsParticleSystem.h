@@ -526,9 +526,25 @@ namespace bs
 		/** 
 		 * Calculates the bounds of all the particles in the system. Should be called after a call to _simulate() to get
 		 * up-to-date bounds. The bounds are in the simulation space of the particle system.
+		 * 
+		 * If the system is simulated in local space and all of its evolvers are analytical, conservative bounds calculated
+		 * from emitter and evolver settings are returned instead of visiting individual particles. Such bounds only change
+		 * when the settings (or for some evolvers, the transform) change.
 		 */
 		AABox _calculateBounds() const;
 
+		/** 
+		 * Calculates the bounds of all the particles in the system by visiting individual particles. The bounds are in the
+		 * simulation space of the particle system.
+		 */
+		AABox _calculateParticleBounds() const;
+
+		/** 
+		 * Returns true if _calculateBounds() returns conservative bounds calculated from emitter and evolver settings, as
+		 * of the last call to _simulate().
+		 */
+		bool _hasAnalyticBounds() const { return mHasAnalyticBounds; }
+
 		/** 
 		 * Advances the particle system time according to the current time, time delta and the provided settings. 
 		 * 
@@ -605,6 +621,17 @@ namespace bs
 		 */
 		void postSimulate(const ParticleSystemState& state, UINT32 startIdx, UINT32 count, bool spacing, float spacingOffset);
 
+		/** 
+		 * Calculates conservative bounds of all particles the system can spawn, from emitter and evolver settings alone.
+		 * Bounds are in the simulation space of the particle system. 
+		 * 
+		 * @param[in]	state	State describing the current state of the simulation.
+		 * @param[out]	bounds	Calculated bounds, if the method returns true.
+		 * @return				False if the bounds cannot be determined analytically (e.g. world space simulation or
+		 *						non-analytical evolvers), in which case they need to be calculated from the particles.
+		 */
+		bool calcAnalyticBounds(const ParticleSystemState& state, AABox& bounds) const;
+
 		/** @copydoc CoreObject::createCore */
 		SPtr<ct::CoreObject> createCore() const override;
 
@@ -636,6 +663,9 @@ namespace bs
 		Random mRandom;
 		ParticleSet* mParticleSet = nullptr;
 
+		AABox mAnalyticBounds;
+		bool mHasAnalyticBounds = false;
+
 		/************************************************************************/
 		/* 								RTTI		                     		*/
 		/************************************************************************/
@@ -0,0 +1,713 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Private/Benchmarks/BsCoreBenchmarkSuite.h"
+#include "Serialization/BsMemorySerializer.h"
+#include "Serialization/BsFileSerializer.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+#include "Resources/BsResourcePackage.h"
+#include "Resources/BsResources.h"
+#include "Localization/BsStringTable.h"
+#include "Utility/BsUUID.h"
+#include "Mesh/BsMeshData.h"
+#include "RenderAPI/BsVertexDataDesc.h"
+#include "Math/BsConvexVolume.h"
+#include "Math/BsSphere.h"
+#include "Math/BsAABox.h"
+#include "Math/BsRandom.h"
+#include "Animation/BsAnimationCurve.h"
+#include "Particles/BsParticleSystem.h"
+#include "Particles/BsParticleEmitter.h"
+#include "Particles/BsParticleEvolver.h"
+#include "Image/BsPixelData.h"
+#include "Image/BsPixelUtil.h"
+#include "Image/BsTexture.h"
+#include "Image/BsSpriteTexture.h"
+
+namespace bs
+{
+	/** Number of vertices in the mesh used by the serialization benchmarks. */
+	static constexpr UINT32 NUM_MESH_VERTICES = 16384;
+
+	/** Number of resource files read by a single iteration of the package benchmarks. */
+	static constexpr UINT32 NUM_PACKAGED_RESOURCES = 512;
+
+	/** Size of a single resource file used by the package benchmarks, in bytes. */
+	static constexpr UINT32 PACKAGED_RESOURCE_SIZE = 16 * 1024;
+
+	/** Number of resources loaded by a single iteration of the resource loading benchmark. */
+	static constexpr UINT32 NUM_LOADED_RESOURCES = 5000;
+
+	/** Number of sprite textures referencing the same texture in the dependent resource loading benchmark. */
+	static constexpr UINT32 NUM_SPRITES_PER_TEXTURE = 4;
+
+	/** Number of bounds tested against the frustum by a single iteration of the culling benchmarks. */
+	static constexpr UINT32 NUM_CULLED_OBJECTS = 4096;
+
+	/** Number of curve evaluations performed by a single iteration of the animation benchmarks. */
+	static constexpr UINT32 NUM_CURVE_EVALUATIONS = 1024;
+
+	/** Number of particle systems whose bounds are queried by a single iteration of the particle bounds benchmarks. */
+	static constexpr UINT32 NUM_BOUNDED_PARTICLE_SYSTEMS = 256;
+
+	/** Maximum number of particles in each particle system used by the particle bounds benchmarks. */
+	static constexpr UINT32 NUM_BOUNDED_PARTICLES = 1000;
+
+	/** Size of the images used by the PixelUtil benchmarks, in pixels. */
+	static constexpr UINT32 IMAGE_SIZE = 512;
+
+	/** Returns a random value in the [min, max] range. */
+	static float randomRange(const Random& random, float min, float max)
+	{
+		return Math::lerp(random.getUNorm(), min, max);
+	}
+
+	/** Creates a mesh with positions, normals and texture coordinates, filled with arbitrary data. */
+	static SPtr<MeshData> createBenchmarkMesh()
+	{
+		SPtr<VertexDataDesc> vertexDesc = VertexDataDesc::create();
+		vertexDesc->addVertElem(VET_FLOAT3, VES_POSITION);
+		vertexDesc->addVertElem(VET_FLOAT3, VES_NORMAL);
+		vertexDesc->addVertElem(VET_FLOAT2, VES_TEXCOORD);
+
+		SPtr<MeshData> meshData = MeshData::create(NUM_MESH_VERTICES, NUM_MESH_VERTICES, vertexDesc);
+
+		UINT8* vertices = meshData->getStreamData(0);
+		const UINT32 vertexBytes = meshData->getStreamSize(0);
+		for(UINT32 i = 0; i < vertexBytes; i++)
+			vertices[i] = (UINT8)(i * 31);
+
+		UINT32* indices = meshData->getIndices32();
+		for(UINT32 i = 0; i < NUM_MESH_VERTICES; i++)
+			indices[i] = i;
+
+		return meshData;
+	}
+
+	/** Saves the benchmark mesh to a temporary file and returns its path. */
+	static Path saveBenchmarkMesh(const SPtr<MeshData>& meshData)
+	{
+		const Path path = FileSystem::getTempDirectoryPath() + "bsfBenchMesh.asset";
+
+		FileEncoder encoder(path);
+		encoder.encode(meshData.get());
+
+		return path;
+	}
+
+	/** Writes a set of files with arbitrary contents to a temporary folder, and returns their paths and assigned UUIDs. */
+	static Vector<std::pair<UUID, Path>> createBenchmarkResourceFiles(const Path& directory)
+	{
+		FileSystem::createDir(directory);
+
+		Vector<UINT8> contents(PACKAGED_RESOURCE_SIZE);
+		Vector<std::pair<UUID, Path>> resources;
+		for(UINT32 i = 0; i < NUM_PACKAGED_RESOURCES; i++)
+		{
+			for(UINT32 j = 0; j < PACKAGED_RESOURCE_SIZE; j++)
+				contents[j] = (UINT8)(i + j * 31);
+
+			const Path path = directory + ("resource" + toString(i) + ".asset");
+			SPtr<DataStream> stream = FileSystem::createAndOpenFile(path);
+			stream->write(contents.data(), contents.size());
+			stream->close();
+
+			resources.push_back(std::make_pair(UUIDGenerator::generateRandom(), path));
+		}
+
+		return resources;
+	}
+
+	/** Reads the entire stream and returns a value depending on all of its contents. */
+	static UINT32 readBenchmarkResource(const SPtr<DataStream>& stream, Vector<UINT8>& buffer)
+	{
+		buffer.resize(stream->size());
+		stream->read(buffer.data(), buffer.size());
+
+		UINT32 sum = 0;
+		for(auto& entry : buffer)
+			sum += entry;
+
+		return sum;
+	}
+
+	/** Creates a perspective frustum looking down the negative Z axis. */
+	static ConvexVolume createBenchmarkFrustum()
+	{
+		const Matrix4 proj = Matrix4::projectionPerspective(Degree(90.0f), 16.0f / 9.0f, 0.1f, 500.0f);
+		return ConvexVolume(proj);
+	}
+
+	/** Creates a pixel buffer filled with a gradient. */
+	static SPtr<PixelData> createBenchmarkImage(PixelFormat format)
+	{
+		SPtr<PixelData> pixelData = PixelData::create(IMAGE_SIZE, IMAGE_SIZE, 1, format);
+		for(UINT32 y = 0; y < IMAGE_SIZE; y++)
+		{
+			for(UINT32 x = 0; x < IMAGE_SIZE; x++)
+				pixelData->setColorAt(Color(x / (float)IMAGE_SIZE, y / (float)IMAGE_SIZE, 0.5f, 1.0f), x, y);
+		}
+
+		return pixelData;
+	}
+
+	/** Saves the benchmark image to a temporary file and returns its path. */
+	static Path saveBenchmarkImage(const SPtr<PixelData>& pixelData)
+	{
+		const Path path = FileSystem::getTempDirectoryPath() + "bsfBenchImage.asset";
+
+		FileEncoder encoder(path);
+		encoder.encode(pixelData.get());
+
+		return path;
+	}
+
+	/**
+	 * Creates particle systems simulated in local space using only analytical evolvers, and fills them up with particles.
+	 * Such systems have analytic bounds available after simulation.
+	 */
+	static Vector<SPtr<ParticleSystem>> createBoundedParticleSystems()
+	{
+		Vector<SPtr<ParticleSystem>> particleSystems;
+		for(UINT32 i = 0; i < NUM_BOUNDED_PARTICLE_SYSTEMS; i++)
+		{
+			SPtr<ParticleSystem> particleSystem = ParticleSystem::create();
+
+			ParticleSystemSettings settings;
+			settings.maxParticles = NUM_BOUNDED_PARTICLES;
+			settings.simulationSpace = ParticleSimulationSpace::Local;
+			particleSystem->setSettings(settings);
+
+			SPtr<ParticleEmitter> emitter = ParticleEmitter::create();
+			emitter->setShape(ParticleEmitterSphereShape::create());
+			emitter->setEmissionRate((float)NUM_BOUNDED_PARTICLES);
+			particleSystem->setEmitters({ emitter });
+
+			particleSystem->setEvolvers({
+				ParticleGravity::create(),
+				ParticleColor::create(),
+				ParticleSize::create()
+			});
+
+			particleSystem->play();
+
+			for(UINT32 j = 0; j < 60; j++)
+				particleSystem->_simulate(1.0f / 60.0f, nullptr);
+
+			particleSystems.push_back(particleSystem);
+		}
+
+		return particleSystems;
+	}
+
+	CoreBenchmarkSuite::CoreBenchmarkSuite()
+	{
+		BS_ADD_BENCHMARK(CoreBenchmarkSuite::benchSerializeMeshData)
+		BS_ADD_BENCHMARK(CoreBenchmarkSuite::benchDeserializeMeshData)
+		BS_ADD_BENCHMARK(CoreBenchmarkSuite::benchLoadMeshDataStreamed)
+		BS_ADD_BENCHMARK(CoreBenchmarkSuite::benchLoadMeshDataMapped)
+		BS_ADD_BENCHMARK(CoreBenchmarkSuite::benchLoadMeshDataMappedCopy)
+		BS_ADD_BENCHMARK(CoreBenchmarkSuite::benchLoadPixelDataStreamed)
+		BS_ADD_BENCHMARK(CoreBenchmarkSuite::benchLoadPixelDataMapped)
+		BS_ADD_BENCHMARK(CoreBenchmarkSuite::benchReadLooseResources)
+		BS_ADD_BENCHMARK(CoreBenchmarkSuite::benchReadPackagedResources)
+		BS_ADD_BENCHMARK(CoreBenchmarkSuite::benchLoadResources)
+		BS_ADD_BENCHMARK(CoreBenchmarkSuite::benchLoadDependentResources)
+		BS_ADD_BENCHMARK(CoreBenchmarkSuite::benchCullSpheres)
+		BS_ADD_BENCHMARK(CoreBenchmarkSuite::benchCullBoxes)
+		BS_ADD_BENCHMARK(CoreBenchmarkSuite::benchAnimCurveCached)
+		BS_ADD_BENCHMARK(CoreBenchmarkSuite::benchAnimCurveUncached)
+		BS_ADD_BENCHMARK(CoreBenchmarkSuite::benchParticleSimulation)
+		BS_ADD_BENCHMARK(CoreBenchmarkSuite::benchParticleBoundsAnalytic)
+		BS_ADD_BENCHMARK(CoreBenchmarkSuite::benchParticleBoundsPerParticle)
+		BS_ADD_BENCHMARK(CoreBenchmarkSuite::benchPixelConversion)
+		BS_ADD_BENCHMARK(CoreBenchmarkSuite::benchPixelScale)
+		BS_ADD_BENCHMARK(CoreBenchmarkSuite::benchGenMipmaps)
+	}
+
+	void CoreBenchmarkSuite::benchSerializeMeshData(Benchmark& bench)
+	{
+		SPtr<MeshData> meshData = createBenchmarkMesh();
+		MemorySerializer serializer;
+
+		bench.setItemsPerIteration(meshData->getSize());
+		bench.measure([&meshData, &serializer]()
+		{
+			UINT32 size = 0;
+			UINT8* buffer = serializer.encode(meshData.get(), size);
+			Benchmark::doNotOptimize(buffer);
+
+			bs_free(buffer);
+		});
+	}
+
+	void CoreBenchmarkSuite::benchDeserializeMeshData(Benchmark& bench)
+	{
+		SPtr<MeshData> meshData = createBenchmarkMesh();
+		MemorySerializer serializer;
+
+		UINT32 size = 0;
+		UINT8* buffer = serializer.encode(meshData.get(), size);
+
+		bench.setItemsPerIteration(meshData->getSize());
+		bench.measure([&serializer, buffer, size]()
+		{
+			SPtr<IReflectable> decoded = serializer.decode(buffer, size);
+			Benchmark::doNotOptimize(decoded);
+		});
+
+		bs_free(buffer);
+	}
+
+	void CoreBenchmarkSuite::benchLoadMeshDataStreamed(Benchmark& bench)
+	{
+		SPtr<MeshData> meshData = createBenchmarkMesh();
+		const Path path = saveBenchmarkMesh(meshData);
+
+		// Reads the data through a file stream, copying it into newly allocated buffers
+		bench.setItemsPerIteration(meshData->getSize());
+		bench.measure([&path]()
+		{
+			FileDecoder decoder(bs_shared_ptr_new<FileDataStream>(path));
+
+			SPtr<IReflectable> decoded = decoder.decode();
+			Benchmark::doNotOptimize(decoded);
+		});
+
+		FileSystem::remove(path);
+	}
+
+	void CoreBenchmarkSuite::benchLoadMeshDataMapped(Benchmark& bench)
+	{
+		SPtr<MeshData> meshData = createBenchmarkMesh();
+		const Path path = saveBenchmarkMesh(meshData);
+
+		// Mesh data references the mapped file directly, as for meshes that are only uploaded to the GPU
+		bench.setItemsPerIteration(meshData->getSize());
+		bench.measure([&path]()
+		{
+			FileDecoder decoder(bs_shared_ptr_new<MappedFileDataStream>(path));
+
+			SPtr<IReflectable> decoded = decoder.decode();
+			Benchmark::doNotOptimize(decoded);
+		});
+
+		FileSystem::remove(path);
+	}
+
+	void CoreBenchmarkSuite::benchLoadMeshDataMappedCopy(Benchmark& bench)
+	{
+		SPtr<MeshData> meshData = createBenchmarkMesh();
+		const Path path = saveBenchmarkMesh(meshData);
+
+		// Mesh data is copied out of the mapping after load, as for meshes that keep their data on the CPU
+		bench.setItemsPerIteration(meshData->getSize());
+		bench.measure([&path]()
+		{
+			FileDecoder decoder(bs_shared_ptr_new<MappedFileDataStream>(path));
+
+			SPtr<MeshData> decoded = std::static_pointer_cast<MeshData>(decoder.decode());
+			decoded->detachExternalBuffer();
+			Benchmark::doNotOptimize(decoded);
+		});
+
+		FileSystem::remove(path);
+	}
+
+	void CoreBenchmarkSuite::benchLoadPixelDataStreamed(Benchmark& bench)
+	{
+		SPtr<PixelData> pixelData = createBenchmarkImage(PF_RGBA8);
+		const Path path = saveBenchmarkImage(pixelData);
+
+		// Reads the data through a file stream, copying it into a newly allocated buffer
+		bench.setItemsPerIteration(pixelData->getSize());
+		bench.measure([&path]()
+		{
+			FileDecoder decoder(bs_shared_ptr_new<FileDataStream>(path));
+
+			SPtr<IReflectable> decoded = decoder.decode();
+			Benchmark::doNotOptimize(decoded);
+		});
+
+		FileSystem::remove(path);
+	}
+
+	void CoreBenchmarkSuite::benchLoadPixelDataMapped(Benchmark& bench)
+	{
+		SPtr<PixelData> pixelData = createBenchmarkImage(PF_RGBA8);
+		const Path path = saveBenchmarkImage(pixelData);
+
+		// Pixel data references the mapped file directly, as for textures that are only uploaded to the GPU
+		bench.setItemsPerIteration(pixelData->getSize());
+		bench.measure([&path]()
+		{
+			FileDecoder decoder(bs_shared_ptr_new<MappedFileDataStream>(path));
+
+			SPtr<IReflectable> decoded = decoder.decode();
+			Benchmark::doNotOptimize(decoded);
+		});
+
+		FileSystem::remove(path);
+	}
+
+	void CoreBenchmarkSuite::benchReadLooseResources(Benchmark& bench)
+	{
+		const Path directory = FileSystem::getTempDirectoryPath() + "bsfBenchLoose/";
+		Vector<std::pair<UUID, Path>> resources = createBenchmarkResourceFiles(directory);
+
+		Vector<UINT8> buffer;
+		bench.setItemsPerIteration(NUM_PACKAGED_RESOURCES);
+		bench.measure([&resources, &buffer]()
+		{
+			UINT32 sum = 0;
+			for(auto& entry : resources)
+				sum += readBenchmarkResource(FileSystem::openFile(entry.second, true), buffer);
+
+			Benchmark::doNotOptimize(sum);
+		});
+
+		FileSystem::remove(directory, true);
+	}
+
+	void CoreBenchmarkSuite::benchReadPackagedResources(Benchmark& bench)
+	{
+		const Path directory = FileSystem::getTempDirectoryPath() + "bsfBenchPackage/";
+		Vector<std::pair<UUID, Path>> resources = createBenchmarkResourceFiles(directory);
+
+		const Path packagePath = directory + "resources.pak";
+		ResourcePackage::create(packagePath, resources, false);
+		SPtr<ResourcePackage> package = ResourcePackage::open(packagePath);
+
+		Vector<UINT8> buffer;
+		bench.setItemsPerIteration(NUM_PACKAGED_RESOURCES);
+		bench.measure([&resources, &package, &buffer]()
+		{
+			UINT32 sum = 0;
+			for(auto& entry : resources)
+				sum += readBenchmarkResource(package->read(entry.first), buffer);
+
+			Benchmark::doNotOptimize(sum);
+		});
+
+		package = nullptr;
+		FileSystem::remove(directory, true);
+	}
+
+	void CoreBenchmarkSuite::benchLoadResources(Benchmark& bench)
+	{
+		const Path directory = FileSystem::getTempDirectoryPath() + "bsfBenchResources/";
+		FileSystem::createDir(directory);
+
+		Vector<Path> paths;
+		for(UINT32 i = 0; i < NUM_LOADED_RESOURCES; i++)
+		{
+			HStringTable stringTable = StringTable::create();
+			stringTable->setString("Identifier", Language::EnglishUS, "Resource " + toString(i));
+
+			const Path path = directory + ("resource" + toString(i) + ".asset");
+			gResources().save(stringTable, path, true);
+			gResources().release(stringTable);
+
+			paths.push_back(path);
+		}
+
+		// Measures the entire load pipeline (reading, deserialization and initialization) with all the resources in
+		// flight at once
+		Vector<HResource> handles(NUM_LOADED_RESOURCES);
+		bench.setItemsPerIteration(NUM_LOADED_RESOURCES);
+		bench.measure([&paths, &handles]()
+		{
+			for(UINT32 i = 0; i < NUM_LOADED_RESOURCES; i++)
+				handles[i] = gResources().loadAsync(paths[i]);
+
+			for(auto& handle : handles)
+				handle.blockUntilLoaded();
+
+			for(auto& handle : handles)
+			{
+				gResources().release(handle);
+				handle = nullptr;
+			}
+		});
+
+		FileSystem::remove(directory, true);
+	}
+
+	void CoreBenchmarkSuite::benchLoadDependentResources(Benchmark& bench)
+	{
+		const Path directory = FileSystem::getTempDirectoryPath() + "bsfBenchDependentResources/";
+		FileSystem::createDir(directory);
+
+		// Textures, each referenced by multiple sprite textures, for a total of NUM_LOADED_RESOURCES resources
+		const UINT32 numTextures = NUM_LOADED_RESOURCES / (NUM_SPRITES_PER_TEXTURE + 1);
+		const UINT32 numSprites = numTextures * NUM_SPRITES_PER_TEXTURE;
+
+		SPtr<PixelData> pixelData = PixelData::create(16, 16, 1, PF_RGBA8);
+		pixelData->setColors(Color::White);
+
+		Vector<Path> spritePaths;
+		for(UINT32 i = 0; i < numTextures; i++)
+		{
+			HTexture texture = Texture::create(pixelData);
+			gResources().save(texture, directory + ("texture" + toString(i) + ".asset"), true);
+
+			for(UINT32 j = 0; j < NUM_SPRITES_PER_TEXTURE; j++)
+			{
+				HSpriteTexture sprite = SpriteTexture::create(texture);
+
+				const Path path = directory + ("sprite" + toString(i * NUM_SPRITES_PER_TEXTURE + j) + ".asset");
+				gResources().save(sprite, path, true);
+				gResources().release(sprite);
+
+				spritePaths.push_back(path);
+			}
+
+			gResources().release(texture);
+		}
+
+		// Only the sprites are requested, and the textures are discovered as their dependencies
+		Vector<HResource> handles(numSprites);
+		bench.setItemsPerIteration(numTextures + numSprites);
+		bench.measure([&spritePaths, &handles, numSprites]()
+		{
+			for(UINT32 i = 0; i < numSprites; i++)
+				handles[i] = gResources().loadAsync(spritePaths[i]);
+
+			for(auto& handle : handles)
+				handle.blockUntilLoaded();
+
+			for(auto& handle : handles)
+			{
+				gResources().release(handle);
+				handle = nullptr;
+			}
+		});
+
+		FileSystem::remove(directory, true);
+	}
+
+	void CoreBenchmarkSuite::benchCullSpheres(Benchmark& bench)
+	{
+		const ConvexVolume frustum = createBenchmarkFrustum();
+
+		Random random(1234);
+		Vector<Sphere> spheres(NUM_CULLED_OBJECTS);
+		for(auto& entry : spheres)
+		{
+			const Vector3 center(randomRange(random, -500.0f, 500.0f), randomRange(random, -500.0f, 500.0f),
+				randomRange(random, -500.0f, 0.0f));
+			entry = Sphere(center, randomRange(random, 0.5f, 10.0f));
+		}
+
+		bench.setItemsPerIteration(NUM_CULLED_OBJECTS);
+		bench.measure([&frustum, &spheres]()
+		{
+			UINT32 numVisible = 0;
+			for(auto& entry : spheres)
+				numVisible += frustum.intersects(entry) ? 1 : 0;
+
+			Benchmark::doNotOptimize(numVisible);
+		});
+	}
+
+	void CoreBenchmarkSuite::benchCullBoxes(Benchmark& bench)
+	{
+		const ConvexVolume frustum = createBenchmarkFrustum();
+
+		Random random(1234);
+		Vector<AABox> boxes(NUM_CULLED_OBJECTS);
+		for(auto& entry : boxes)
+		{
+			const Vector3 center(randomRange(random, -500.0f, 500.0f), randomRange(random, -500.0f, 500.0f),
+				randomRange(random, -500.0f, 0.0f));
+			const Vector3 extents = Vector3::ONE * randomRange(random, 0.5f, 10.0f);
+			entry = AABox(center - extents, center + extents);
+		}
+
+		bench.setItemsPerIteration(NUM_CULLED_OBJECTS);
+		bench.measure([&frustum, &boxes]()
+		{
+			UINT32 numVisible = 0;
+			for(auto& entry : boxes)
+				numVisible += frustum.intersects(entry) ? 1 : 0;
+
+			Benchmark::doNotOptimize(numVisible);
+		});
+	}
+
+	/** Creates a curve with a large number of keyframes, so key lookup cost is visible. */
+	static TAnimationCurve<Vector3> createBenchmarkCurve()
+	{
+		Vector<TKeyframe<Vector3>> keyframes(256);
+		for(UINT32 i = 0; i < (UINT32)keyframes.size(); i++)
+		{
+			const float t = (float)i;
+			keyframes[i].time = t * 0.1f;
+			keyframes[i].value = Vector3(Math::sin(t), Math::cos(t), t);
+			keyframes[i].inTangent = Vector3(Math::cos(t), -Math::sin(t), 1.0f);
+			keyframes[i].outTangent = keyframes[i].inTangent;
+		}
+
+		return TAnimationCurve<Vector3>(keyframes);
+	}
+
+	void CoreBenchmarkSuite::benchAnimCurveCached(Benchmark& bench)
+	{
+		const TAnimationCurve<Vector3> curve = createBenchmarkCurve();
+		const float length = curve.getLength();
+
+		// Sequential evaluation, as during animation playback
+		bench.setItemsPerIteration(NUM_CURVE_EVALUATIONS);
+		bench.measure([&curve, length]()
+		{
+			TCurveCache<Vector3> cache;
+
+			Vector3 sum = Vector3::ZERO;
+			for(UINT32 i = 0; i < NUM_CURVE_EVALUATIONS; i++)
+				sum += curve.evaluate(i * length / NUM_CURVE_EVALUATIONS, cache);
+
+			Benchmark::doNotOptimize(sum);
+		});
+	}
+
+	void CoreBenchmarkSuite::benchAnimCurveUncached(Benchmark& bench)
+	{
+		const TAnimationCurve<Vector3> curve = createBenchmarkCurve();
+
+		Random random(1234);
+		Vector<float> times(NUM_CURVE_EVALUATIONS);
+		for(auto& entry : times)
+			entry = random.getRange(0.0f, curve.getLength());
+
+		bench.setItemsPerIteration(NUM_CURVE_EVALUATIONS);
+		bench.measure([&curve, &times]()
+		{
+			Vector3 sum = Vector3::ZERO;
+			for(auto& entry : times)
+				sum += curve.evaluate(entry);
+
+			Benchmark::doNotOptimize(sum);
+		});
+	}
+
+	void CoreBenchmarkSuite::benchParticleSimulation(Benchmark& bench)
+	{
+		static constexpr UINT32 MAX_PARTICLES = 10000;
+		static constexpr float TIME_STEP = 1.0f / 60.0f;
+
+		SPtr<ParticleSystem> particleSystem = ParticleSystem::create();
+
+		ParticleSystemSettings settings;
+		settings.maxParticles = MAX_PARTICLES;
+		settings.duration = 10.0f;
+		particleSystem->setSettings(settings);
+
+		SPtr<ParticleEmitter> emitter = ParticleEmitter::create();
+		emitter->setShape(ParticleEmitterSphereShape::create());
+		emitter->setEmissionRate(5000.0f);
+		particleSystem->setEmitters({ emitter });
+
+		particleSystem->setEvolvers({
+			ParticleGravity::create(),
+			ParticleColor::create(),
+			ParticleSize::create()
+		});
+
+		particleSystem->play();
+
+		// Fill up the system, so the benchmark measures steady state simulation
+		for(UINT32 i = 0; i < 120; i++)
+			particleSystem->_simulate(TIME_STEP, nullptr);
+
+		bench.setItemsPerIteration(MAX_PARTICLES);
+		bench.measure([&particleSystem]()
+		{
+			particleSystem->_simulate(TIME_STEP, nullptr);
+
+			AABox bounds = particleSystem->_calculateBounds();
+			Benchmark::doNotOptimize(bounds);
+		});
+
+		particleSystem->destroy();
+	}
+
+	void CoreBenchmarkSuite::benchParticleBoundsAnalytic(Benchmark& bench)
+	{
+		Vector<SPtr<ParticleSystem>> particleSystems = createBoundedParticleSystems();
+
+		// Analytic bounds are calculated once per simulation step, so this measures the per-frame bounds query the
+		// renderer performs for every visible system
+		bench.setItemsPerIteration(NUM_BOUNDED_PARTICLE_SYSTEMS);
+		bench.measure([&particleSystems]()
+		{
+			for(auto& particleSystem : particleSystems)
+			{
+				AABox bounds = particleSystem->_calculateBounds();
+				Benchmark::doNotOptimize(bounds);
+			}
+		});
+
+		for(auto& particleSystem : particleSystems)
+			particleSystem->destroy();
+	}
+
+	void CoreBenchmarkSuite::benchParticleBoundsPerParticle(Benchmark& bench)
+	{
+		Vector<SPtr<ParticleSystem>> particleSystems = createBoundedParticleSystems();
+
+		// Same systems as benchParticleBoundsAnalytic, with bounds calculated by visiting every particle
+		bench.setItemsPerIteration(NUM_BOUNDED_PARTICLE_SYSTEMS);
+		bench.measure([&particleSystems]()
+		{
+			for(auto& particleSystem : particleSystems)
+			{
+				AABox bounds = particleSystem->_calculateParticleBounds();
+				Benchmark::doNotOptimize(bounds);
+			}
+		});
+
+		for(auto& particleSystem : particleSystems)
+			particleSystem->destroy();
+	}
+
+	void CoreBenchmarkSuite::benchPixelConversion(Benchmark& bench)
+	{
+		SPtr<PixelData> source = createBenchmarkImage(PF_RGBA8);
+		SPtr<PixelData> destination = PixelData::create(IMAGE_SIZE, IMAGE_SIZE, 1, PF_RGBA16F);
+
+		bench.setItemsPerIteration(IMAGE_SIZE * IMAGE_SIZE);
+		bench.measure([&source, &destination]()
+		{
+			PixelUtil::bulkPixelConversion(*source, *destination);
+			Benchmark::doNotOptimize(destination->getData());
+		});
+	}
+
+	void CoreBenchmarkSuite::benchPixelScale(Benchmark& bench)
+	{
+		SPtr<PixelData> source = createBenchmarkImage(PF_RGBA8);
+		SPtr<PixelData> destination = PixelData::create(IMAGE_SIZE / 2 + 1, IMAGE_SIZE / 2 + 1, 1, PF_RGBA8);
+
+		bench.setItemsPerIteration(IMAGE_SIZE * IMAGE_SIZE);
+		bench.measure([&source, &destination]()
+		{
+			PixelUtil::scale(*source, *destination, PixelUtil::FILTER_LINEAR);
+			Benchmark::doNotOptimize(destination->getData());
+		});
+	}
+
+	void CoreBenchmarkSuite::benchGenMipmaps(Benchmark& bench)
+	{
+		SPtr<PixelData> source = createBenchmarkImage(PF_RGBA8);
+
+		MipMapGenOptions options;
+		options.isSRGB = true;
+
+		bench.setItemsPerIteration(IMAGE_SIZE * IMAGE_SIZE);
+		bench.measure([&source, &options]()
+		{
+			Vector<SPtr<PixelData>> mipmaps = PixelUtil::genMipmaps(*source, options);
+			Benchmark::doNotOptimize(mipmaps);
+		});
+	}
+}
@@ -0,0 +1,39 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Testing/BsBenchmark.h"
+
+namespace bs
+{
+	/** Benchmarks for systems in the core layer. Expects the core systems (including the core thread) to be running. */
+	class CoreBenchmarkSuite : public BenchmarkSuite
+	{
+	public:
+		CoreBenchmarkSuite();
+
+	private:
+		void benchSerializeMeshData(Benchmark& bench);
+		void benchDeserializeMeshData(Benchmark& bench);
+		void benchLoadMeshDataStreamed(Benchmark& bench);
+		void benchLoadMeshDataMapped(Benchmark& bench);
+		void benchLoadMeshDataMappedCopy(Benchmark& bench);
+		void benchLoadPixelDataStreamed(Benchmark& bench);
+		void benchLoadPixelDataMapped(Benchmark& bench);
+		void benchReadLooseResources(Benchmark& bench);
+		void benchReadPackagedResources(Benchmark& bench);
+		void benchLoadResources(Benchmark& bench);
+		void benchLoadDependentResources(Benchmark& bench);
+		void benchCullSpheres(Benchmark& bench);
+		void benchCullBoxes(Benchmark& bench);
+		void benchAnimCurveCached(Benchmark& bench);
+		void benchAnimCurveUncached(Benchmark& bench);
+		void benchParticleSimulation(Benchmark& bench);
+		void benchParticleBoundsAnalytic(Benchmark& bench);
+		void benchParticleBoundsPerParticle(Benchmark& bench);
+		void benchPixelConversion(Benchmark& bench);
+		void benchPixelScale(Benchmark& bench);
+		void benchGenMipmaps(Benchmark& bench);
+	};
+}
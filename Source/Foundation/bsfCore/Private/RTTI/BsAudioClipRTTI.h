@@ -55,6 +55,27 @@ namespace bs
 		void onDeserializationEnded(IReflectable* obj, SerializationContext* context) override
 		{
 			AudioClip* clip = static_cast<AudioClip*>(obj);
+
+			// Don't keep the source file mapped for the lifetime of the clip, as that prevents it from being overwritten
+			if (clip->mStreamData != nullptr && clip->mStreamData->isMapped())
+			{
+				const auto& mappedData = static_cast<const MappedFileDataStream&>(*clip->mStreamData);
+				if (clip->mDesc.readMode == AudioReadMode::Stream)
+				{
+					clip->mStreamOffset += (UINT32)mappedData.getFileOffset();
+					clip->mStreamData = bs_shared_ptr_new<FileDataStream>(mappedData.getPath());
+				}
+				else
+				{
+					SPtr<MemoryDataStream> memStream = bs_shared_ptr_new<MemoryDataStream>(clip->mStreamSize);
+					clip->mStreamData->seek(clip->mStreamOffset);
+					clip->mStreamData->read(memStream->getPtr(), clip->mStreamSize);
+
+					clip->mStreamData = memStream;
+					clip->mStreamOffset = 0;
+				}
+			}
+
 			clip->initialize();
 		}
 
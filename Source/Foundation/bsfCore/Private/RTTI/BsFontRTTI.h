@@ -6,6 +6,7 @@
 #include "Reflection/BsRTTIType.h"
 #include "Text/BsFont.h"
 #include "Image/BsTexture.h"
+#include "FileSystem/BsDataStream.h"
 
 namespace bs
 {
@@ -48,6 +49,37 @@ namespace bs
 	class BS_CORE_EXPORT FontRTTI : public RTTIType<Font, Resource, FontRTTI>
 	{
 	private:
+		BS_BEGIN_RTTI_MEMBERS
+			BS_RTTI_MEMBER_PLAIN_NAMED(glyphSourceDpi, mGlyphSource.dpi, 1)
+			BS_RTTI_MEMBER_PLAIN_NAMED(glyphSourceRenderMode, mGlyphSource.renderMode, 2)
+		BS_END_RTTI_MEMBERS
+
+		SPtr<DataStream> getGlyphSourceData(Font* obj, UINT32& size)
+		{
+			const SPtr<MemoryDataStream>& data = obj->mGlyphSource.data;
+			if(data == nullptr)
+			{
+				size = 0;
+				return bs_shared_ptr_new<MemoryDataStream>(nullptr, 0, false);
+			}
+
+			size = (UINT32)data->size();
+			return bs_shared_ptr_new<MemoryDataStream>(data->getPtr(), data->size(), false);
+		}
+
+		void setGlyphSourceData(Font* obj, const SPtr<DataStream>& val, UINT32 size)
+		{
+			if(size == 0)
+			{
+				obj->mGlyphSource.data = nullptr;
+				return;
+			}
+
+			// Glyph rasterizers require the entire font file in memory
+			obj->mGlyphSource.data = bs_shared_ptr_new<MemoryDataStream>(size);
+			val->read(obj->mGlyphSource.data->getPtr(), size);
+		}
+
 		FontBitmap& getBitmap(Font* obj, UINT32 idx)
 		{
 			if(idx >= obj->mFontDataPerSize.size())
@@ -80,6 +112,7 @@ namespace bs
 		FontRTTI()
 		{
 			addReflectableArrayField("mBitmaps", 0, &FontRTTI::getBitmap, &FontRTTI::getNumBitmaps, &FontRTTI::setBitmap, &FontRTTI::setNumBitmaps);
+			addDataBlockField("mGlyphSourceData", 3, &FontRTTI::getGlyphSourceData, &FontRTTI::setGlyphSourceData, 0);
 		}
 
 		const String& getRTTIName() override
@@ -17,6 +17,48 @@ namespace bs
 
 	BS_ALLOW_MEMCPY_SERIALIZATION(SubMesh);
 
+	template<> struct RTTIPlainType<MeshLOD>
+	{
+		enum { id = TID_MeshLOD }; enum { hasDynamicSize = 1 };
+
+		/** @copydoc RTTIPlainType::toMemory */
+		static void toMemory(const MeshLOD& data, char* memory)
+		{
+			UINT32 size = sizeof(UINT32);
+			char* memoryStart = memory;
+			memory += sizeof(UINT32);
+
+			memory = rttiWriteElem(data.screenSize, memory, size);
+			memory = rttiWriteElem(data.subMeshes, memory, size);
+
+			memcpy(memoryStart, &size, sizeof(UINT32));
+		}
+
+		/** @copydoc RTTIPlainType::fromMemory */
+		static UINT32 fromMemory(MeshLOD& data, char* memory)
+		{
+			UINT32 size = 0;
+			memory = rttiReadElem(size, memory);
+
+			memory = rttiReadElem(data.screenSize, memory);
+			rttiReadElem(data.subMeshes, memory);
+
+			return size;
+		}
+
+		/** @copydoc RTTIPlainType::getDynamicSize */
+		static UINT32 getDynamicSize(const MeshLOD& data)
+		{
+			UINT64 dataSize = sizeof(UINT32);
+			dataSize += rttiGetElemSize(data.screenSize);
+			dataSize += rttiGetElemSize(data.subMeshes);
+
+			assert(dataSize <= std::numeric_limits<UINT32>::max());
+
+			return (UINT32)dataSize;
+		}
+	};
+
 	class MeshBaseRTTI : public RTTIType<MeshBase, Resource, MeshBaseRTTI>
 	{
 		SubMesh& getSubMesh(MeshBase* obj, UINT32 arrayIdx) { return obj->mProperties.mSubMeshes[arrayIdx]; }
@@ -24,6 +66,11 @@ namespace bs
 		UINT32 getNumSubmeshes(MeshBase* obj) { return (UINT32)obj->mProperties.mSubMeshes.size(); }
 		void setNumSubmeshes(MeshBase* obj, UINT32 numElements) { obj->mProperties.mSubMeshes.resize(numElements); }
 
+		MeshLOD& getLOD(MeshBase* obj, UINT32 arrayIdx) { return obj->mProperties.mLODs[arrayIdx]; }
+		void setLOD(MeshBase* obj, UINT32 arrayIdx, MeshLOD& value) { obj->mProperties.mLODs[arrayIdx] = value; }
+		UINT32 getNumLODs(MeshBase* obj) { return (UINT32)obj->mProperties.mLODs.size(); }
+		void setNumLODs(MeshBase* obj, UINT32 numElements) { obj->mProperties.mLODs.resize(numElements); }
+
 		UINT32& getNumVertices(MeshBase* obj) { return obj->mProperties.mNumVertices; }
 		void setNumVertices(MeshBase* obj, UINT32& value) { obj->mProperties.mNumVertices = value; }
 
@@ -38,6 +85,9 @@ namespace bs
 
 			addPlainArrayField("mSubMeshes", 2, &MeshBaseRTTI::getSubMesh, 
 				&MeshBaseRTTI::getNumSubmeshes, &MeshBaseRTTI::setSubMesh, &MeshBaseRTTI::setNumSubmeshes);
+
+			addPlainArrayField("mLODs", 3, &MeshBaseRTTI::getLOD, 
+				&MeshBaseRTTI::getNumLODs, &MeshBaseRTTI::setLOD, &MeshBaseRTTI::setNumLODs);
 		}
 
 		SPtr<IReflectable> newRTTIObject() override
@@ -32,6 +32,9 @@ namespace bs
 		UINT32& getNumIndices(MeshData* obj) { return obj->mNumIndices; }
 		void setNumIndices(MeshData* obj, UINT32& value) { obj->mNumIndices = value; }
 
+		AABox& getPositionBounds(MeshData* obj) { return obj->mPositionBounds; }
+		void setPositionBounds(MeshData* obj, AABox& value) { obj->mPositionBounds = value; }
+
 		SPtr<DataStream> getData(MeshData* obj, UINT32& size)
 		{
 			size = obj->getInternalBufferSize();
@@ -41,8 +44,17 @@ namespace bs
 
 		void setData(MeshData* obj, const SPtr<DataStream>& value, UINT32 size)
 		{
-			obj->allocateInternalBuffer(size);
-			value->read(obj->getData(), size);
+			if (value->isMapped())
+			{
+				// Reference the data directly from the mapped file instead of copying it
+				SPtr<MemoryDataStream> memStream = std::static_pointer_cast<MemoryDataStream>(value);
+				obj->setExternalBuffer(memStream->getCurrentPtr(), value);
+			}
+			else
+			{
+				obj->allocateInternalBuffer(size);
+				value->read(obj->getData(), size);
+			}
 		}
 
 	public:
@@ -55,6 +67,7 @@ namespace bs
 			addPlainField("mNumIndices", 3, &MeshDataRTTI::getNumIndices, &MeshDataRTTI::setNumIndices);
 
 			addDataBlockField("data", 4, &MeshDataRTTI::getData, &MeshDataRTTI::setData, 0);
+			addPlainField("mPositionBounds", 5, &MeshDataRTTI::getPositionBounds, &MeshDataRTTI::setPositionBounds);
 		}
 
 		SPtr<IReflectable> newRTTIObject() override
@@ -30,6 +30,10 @@ namespace bs
 			BS_RTTI_MEMBER_PLAIN(reduceKeyFrames, 9)
 			BS_RTTI_MEMBER_REFL_ARRAY(animationEvents, 10)
 			BS_RTTI_MEMBER_PLAIN(importRootMotion, 11)
+			BS_RTTI_MEMBER_PLAIN(lodScreenSizes, 12)
+			BS_RTTI_MEMBER_PLAIN(lodReduction, 13)
+			BS_RTTI_MEMBER_PLAIN(optimizeMesh, 14)
+			BS_RTTI_MEMBER_PLAIN(compressVertices, 15)
 		BS_END_RTTI_MEMBERS
 	public:
 		const String& getRTTIName() override
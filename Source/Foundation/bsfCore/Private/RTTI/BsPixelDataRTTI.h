@@ -52,8 +52,17 @@ namespace bs
 
 		void setData(PixelData* obj, const SPtr<DataStream>& value, UINT32 size)
 		{
-			obj->allocateInternalBuffer(size);
-			value->read(obj->getData(), size);
+			if (value->isMapped())
+			{
+				// Reference the data directly from the mapped file instead of copying it
+				SPtr<MemoryDataStream> memStream = std::static_pointer_cast<MemoryDataStream>(value);
+				obj->setExternalBuffer(memStream->getCurrentPtr(), value);
+			}
+			else
+			{
+				obj->allocateInternalBuffer(size);
+				value->read(obj->getData(), size);
+			}
 		}
 		
 	public:
@@ -32,11 +32,22 @@ namespace bs
 				obj->mFilePathToUUID[entry.second] = entry.first;
 			}
 		} 
+
+		UnorderedMap<UUID, Vector<UUID>>& getDependencies(ResourceManifest* obj) { return obj->mDependencies; }
+		void setDependencies(ResourceManifest* obj, UnorderedMap<UUID, Vector<UUID>>& val) { obj->mDependencies = val; }
+
+		UnorderedMap<UUID, UINT64>& getDependencyTimestamps(ResourceManifest* obj) { return obj->mDependencyTimestamps; }
+		void setDependencyTimestamps(ResourceManifest* obj, UnorderedMap<UUID, UINT64>& val)
+		{ obj->mDependencyTimestamps = val; }
 	public:
 		ResourceManifestRTTI()
 		{
 			addPlainField("mName", 0, &ResourceManifestRTTI::getName, &ResourceManifestRTTI::setName);
 			addPlainField("mUUIDToFilePath", 1, &ResourceManifestRTTI::getUUIDMap, &ResourceManifestRTTI::setUUIDMap);
+			addPlainField("mDependencies", 2, &ResourceManifestRTTI::getDependencies, 
+				&ResourceManifestRTTI::setDependencies);
+			addPlainField("mDependencyTimestamps", 3, &ResourceManifestRTTI::getDependencyTimestamps,
+				&ResourceManifestRTTI::setDependencyTimestamps);
 		}
 
 		const String& getRTTIName() override
@@ -397,6 +397,7 @@ namespace bs
 		void onDeserializationEnded(IReflectable* obj, SerializationContext* context) override
 		{
 			Shader* shader = static_cast<Shader*>(obj);
+			shader->buildParamIndexLookup();
 			shader->initialize();
 		}
 
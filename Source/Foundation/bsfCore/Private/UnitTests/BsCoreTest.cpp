@@ -4,6 +4,16 @@
 #include "Testing/BsTestSuite.h"
 #include "Animation/BsAnimationCurve.h"
 #include "Particles/BsParticleDistribution.h"
+#include "Mesh/BsMeshData.h"
+#include "Mesh/BsMeshUtility.h"
+#include "Mesh/BsMeshBase.h"
+#include "RenderAPI/BsVertexDataDesc.h"
+#include "Utility/BsBitwise.h"
+#include "Resources/BsResourcePackage.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+#include "Utility/BsUUID.h"
+#include "Math/BsRandom.h"
 
 namespace bs
 {
@@ -17,6 +27,92 @@ namespace bs
 		return acceleration * time;
 	}
 
+	/** 
+	 * Generates a triangulated grid of @p size x @p size vertices on a gently curved height field facing the positive Y
+	 * axis. Vertices of the middle column are duplicated, as if the grid had an attribute seam along it: triangles left
+	 * of the seam reference the first @p size * @p size vertices, while triangles right of it reference the duplicates
+	 * that follow them.
+	 */
+	void createSeamedGrid(UINT32 size, Vector<Vector3>& positions, Vector<UINT32>& indices)
+	{
+		const UINT32 seamColumn = size / 2;
+
+		positions.clear();
+		for (UINT32 z = 0; z < size; z++)
+		{
+			for (UINT32 x = 0; x < size; x++)
+			{
+				const float height = 0.3f * Math::sin(Radian(x * 0.4f)) * Math::cos(Radian(z * 0.3f));
+				positions.push_back(Vector3((float)x, height, (float)z));
+			}
+		}
+
+		for (UINT32 z = 0; z < size; z++)
+			positions.push_back(positions[z * size + seamColumn]);
+
+		auto getIndex = [size, seamColumn](UINT32 x, UINT32 z, bool rightOfSeam)
+		{
+			if (rightOfSeam && x == seamColumn)
+				return size * size + z;
+
+			return z * size + x;
+		};
+
+		indices.clear();
+		for (UINT32 z = 0; z < (size - 1); z++)
+		{
+			for (UINT32 x = 0; x < (size - 1); x++)
+			{
+				const bool rightOfSeam = x >= seamColumn;
+
+				const UINT32 i00 = getIndex(x, z, rightOfSeam);
+				const UINT32 i10 = getIndex(x + 1, z, rightOfSeam);
+				const UINT32 i01 = getIndex(x, z + 1, rightOfSeam);
+				const UINT32 i11 = getIndex(x + 1, z + 1, rightOfSeam);
+
+				indices.insert(indices.end(), { i00, i01, i10, i10, i01, i11 });
+			}
+		}
+	}
+
+	/** 
+	 * Returns the signed area of a triangle list projected onto the XZ plane. Equals the area of the grid created by
+	 * createSeamedGrid() only if its triangles don't overlap, leave holes or flip.
+	 */
+	float calcProjectedArea(const Vector<Vector3>& positions, const UINT32* indices, UINT32 numIndices)
+	{
+		float area = 0.0f;
+		for (UINT32 i = 0; i < numIndices; i += 3)
+		{
+			const Vector3 ab = positions[indices[i + 1]] - positions[indices[i]];
+			const Vector3 ac = positions[indices[i + 2]] - positions[indices[i]];
+
+			area += (ab.z * ac.x - ab.x * ac.z) * 0.5f;
+		}
+
+		return area;
+	}
+
+	/** 
+	 * Returns a key uniquely identifying a triangle of a grid with @p gridSize vertices per side, given the XZ positions of
+	 * its vertices. Keys of triangles with the same vertices but different winding don't match.
+	 */
+	UINT64 getGridTriangleKey(const Vector3& a, const Vector3& b, const Vector3& c, UINT32 gridSize)
+	{
+		auto getGridIdx = [gridSize](const Vector3& position)
+		{
+			return (UINT64)(Math::roundToInt(position.z) * gridSize + Math::roundToInt(position.x));
+		};
+
+		UINT64 ids[] = { getGridIdx(a), getGridIdx(b), getGridIdx(c) };
+
+		// Rotate the smallest index to the front, which keeps the winding
+		while (ids[0] > ids[1] || ids[0] > ids[2])
+			std::rotate(ids, ids + 1, ids + 3);
+
+		return (ids[0] << 42) | (ids[1] << 21) | ids[2];
+	}
+
 	class CoreTestSuite : public TestSuite
 	{
 	public:
@@ -25,12 +121,20 @@ namespace bs
 	private:
 		void testAnimCurveIntegration();
 		void testLookupTable();
+		void testCompressedVertices();
+		void testResourcePackage();
+		void testMeshSimplify();
+		void testMeshOptimize();
 	};
 
 	CoreTestSuite::CoreTestSuite()
 	{
 		BS_ADD_TEST(CoreTestSuite::testAnimCurveIntegration);
 		BS_ADD_TEST(CoreTestSuite::testLookupTable);
+		BS_ADD_TEST(CoreTestSuite::testCompressedVertices);
+		BS_ADD_TEST(CoreTestSuite::testResourcePackage);
+		BS_ADD_TEST(CoreTestSuite::testMeshSimplify);
+		BS_ADD_TEST(CoreTestSuite::testMeshOptimize);
 	}
 
 	void CoreTestSuite::testAnimCurveIntegration()
@@ -143,6 +247,534 @@ namespace bs
 				BS_TEST_ASSERT(Math::approxEquals(valueLookup[j], valueCurve[j], EPSILON));
 		}
 	}
+
+	void CoreTestSuite::testCompressedVertices()
+	{
+		static constexpr UINT32 NUM_VERTICES = 1024;
+
+		SPtr<VertexDataDesc> vertexDesc = VertexDataDesc::create();
+		vertexDesc->addVertElem(VET_FLOAT3, VES_POSITION);
+		vertexDesc->addVertElem(VET_FLOAT3, VES_NORMAL);
+		vertexDesc->addVertElem(VET_FLOAT4, VES_TANGENT);
+		vertexDesc->addVertElem(VET_FLOAT2, VES_TEXCOORD);
+
+		SPtr<MeshData> meshData = MeshData::create(NUM_VERTICES, NUM_VERTICES, vertexDesc);
+
+		// Points on a sphere, with tangents along the latitude and with alternating bitangent signs
+		Vector3* positions = (Vector3*)meshData->getElementData(VES_POSITION);
+		Vector3* normals = (Vector3*)meshData->getElementData(VES_NORMAL);
+		Vector4* tangents = (Vector4*)meshData->getElementData(VES_TANGENT);
+		Vector2* uvs = (Vector2*)meshData->getElementData(VES_TEXCOORD);
+		UINT32 stride = vertexDesc->getVertexStride();
+
+		UINT32* indices = meshData->getIndices32();
+		for (UINT32 i = 0; i < NUM_VERTICES; i++)
+		{
+			float u = (i % 32) / 31.0f;
+			float v = (i / 32) / 31.0f;
+
+			Radian theta = Radian(u * Math::TWO_PI);
+			Radian phi = Radian(v * Math::PI);
+
+			Vector3 normal(Math::sin(phi) * Math::cos(theta), Math::cos(phi), Math::sin(phi) * Math::sin(theta));
+			Vector3 tangent(-Math::sin(theta), 0.0f, Math::cos(theta));
+
+			*(Vector3*)((UINT8*)positions + i * stride) = normal * 25.0f + Vector3(100.0f, -3.0f, 0.5f);
+			*(Vector3*)((UINT8*)normals + i * stride) = Vector3::normalize(normal);
+			*(Vector4*)((UINT8*)tangents + i * stride) = Vector4(tangent.x, tangent.y, tangent.z, (i % 2) ? 1.0f : -1.0f);
+			*(Vector2*)((UINT8*)uvs + i * stride) = Vector2(u * 4.0f, v);
+
+			indices[i] = i;
+		}
+
+		SPtr<MeshData> compressed = MeshUtility::compressVertices(meshData);
+		SPtr<VertexDataDesc> compressedDesc = compressed->getVertexDesc();
+
+		// Size reduction
+		BS_TEST_ASSERT(compressedDesc->getElement(VES_POSITION)->getType() == VET_SHORT4_NORM);
+		BS_TEST_ASSERT(compressedDesc->getElement(VES_NORMAL)->getType() == VET_SHORT2_NORM);
+		BS_TEST_ASSERT(compressedDesc->getElement(VES_TANGENT)->getType() == VET_SHORT2_NORM);
+		BS_TEST_ASSERT(compressedDesc->getElement(VES_TEXCOORD)->getType() == VET_HALF2);
+		BS_TEST_ASSERT(compressed->getStreamSize() * 2 <= meshData->getStreamSize());
+		BS_TEST_ASSERT(memcmp(compressed->getIndices32(), indices, NUM_VERTICES * sizeof(UINT32)) == 0);
+
+		// Round-trip precision
+		UINT32 compressedStride = compressedDesc->getVertexStride();
+
+		Vector<Vector3> decodedNormals(NUM_VERTICES);
+		Vector<Vector4> decodedTangents(NUM_VERTICES);
+		MeshUtility::unpackOctahedral(compressed->getElementData(VES_NORMAL), decodedNormals.data(), NUM_VERTICES,
+			compressedStride);
+		MeshUtility::unpackOctahedral(compressed->getElementData(VES_TANGENT), decodedTangents.data(), NUM_VERTICES,
+			compressedStride);
+
+		const AABox& positionBounds = compressed->getPositionBounds();
+		const Vector3 extents = positionBounds.getHalfSize();
+		const float positionError = std::max(extents.x, std::max(extents.y, extents.z)) / 32767.0f;
+
+		UINT8* compressedPositions = compressed->getElementData(VES_POSITION);
+		UINT8* compressedUVs = compressed->getElementData(VES_TEXCOORD);
+		for (UINT32 i = 0; i < NUM_VERTICES; i++)
+		{
+			const INT16* quantized = (const INT16*)(compressedPositions + i * compressedStride);
+			Vector3 position = positionBounds.getCenter() + 
+				Vector3(quantized[0] / 32767.0f, quantized[1] / 32767.0f, quantized[2] / 32767.0f) * extents;
+
+			const Vector3& originalPosition = *(Vector3*)((UINT8*)positions + i * stride);
+			for (UINT32 j = 0; j < 3; j++)
+				BS_TEST_ASSERT(Math::abs(position[j] - originalPosition[j]) <= positionError);
+
+			const Vector3& originalNormal = *(Vector3*)((UINT8*)normals + i * stride);
+			BS_TEST_ASSERT(decodedNormals[i].dot(originalNormal) >= 0.9999f);
+
+			const Vector4& originalTangent = *(Vector4*)((UINT8*)tangents + i * stride);
+			Vector3 tangent(decodedTangents[i].x, decodedTangents[i].y, decodedTangents[i].z);
+			BS_TEST_ASSERT(tangent.dot(Vector3(originalTangent.x, originalTangent.y, originalTangent.z)) >= 0.9999f);
+			BS_TEST_ASSERT(decodedTangents[i].w == originalTangent.w);
+
+			const UINT16* packedUV = (const UINT16*)(compressedUVs + i * compressedStride);
+			const Vector2& originalUV = *(Vector2*)((UINT8*)uvs + i * stride);
+			BS_TEST_ASSERT(Math::approxEquals(Bitwise::halfToFloat(packedUV[0]), originalUV.x, 0.002f));
+			BS_TEST_ASSERT(Math::approxEquals(Bitwise::halfToFloat(packedUV[1]), originalUV.y, 0.002f));
+		}
+
+		// Bounds calculated from quantized positions
+		Bounds originalBounds = meshData->calculateBounds();
+		Bounds compressedBounds = compressed->calculateBounds();
+		BS_TEST_ASSERT(Math::approxEquals(originalBounds.getBox().getMin(), compressedBounds.getBox().getMin(), 
+			positionError));
+		BS_TEST_ASSERT(Math::approxEquals(originalBounds.getBox().getMax(), compressedBounds.getBox().getMax(), 
+			positionError));
+	}
+
+	void CoreTestSuite::testResourcePackage()
+	{
+		static constexpr UINT32 NUM_RESOURCES = 16;
+
+		const Path directory = FileSystem::getTempDirectoryPath() + "bsfCoreTestPackage/";
+		FileSystem::createDir(directory);
+
+		// Package entries are copied as is when not compressing, so the contents don't need to be valid resources
+		Vector<std::pair<UUID, Path>> resources;
+		Vector<String> contents;
+		for(UINT32 i = 0; i < NUM_RESOURCES; i++)
+		{
+			String content;
+			for(UINT32 j = 0; j < 100 + i * 1000; j++)
+				content += (char)('a' + ((i + j) % 26));
+
+			const Path path = directory + ("resource" + toString(i) + ".asset");
+			SPtr<DataStream> stream = FileSystem::createAndOpenFile(path);
+			stream->write(content.data(), content.size());
+			stream->close();
+
+			resources.push_back(std::make_pair(UUIDGenerator::generateRandom(), path));
+			contents.push_back(content);
+		}
+
+		const Path packagePath = directory + "resources.pak";
+		BS_TEST_ASSERT(ResourcePackage::create(packagePath, resources, false));
+
+		SPtr<ResourcePackage> package = ResourcePackage::open(packagePath);
+		BS_TEST_ASSERT(package != nullptr);
+		BS_TEST_ASSERT(package->getNumEntries() == NUM_RESOURCES);
+
+		for(UINT32 i = 0; i < NUM_RESOURCES; i++)
+		{
+			BS_TEST_ASSERT(package->contains(resources[i].first));
+
+			SPtr<DataStream> stream = package->read(resources[i].first);
+			BS_TEST_ASSERT(stream != nullptr);
+			BS_TEST_ASSERT(stream->size() == contents[i].size());
+
+			String readContent(stream->size(), '\0');
+			BS_TEST_ASSERT(stream->read(&readContent[0], readContent.size()) == readContent.size());
+			BS_TEST_ASSERT(readContent == contents[i]);
+		}
+
+		const UUID missingUUID = UUIDGenerator::generateRandom();
+		BS_TEST_ASSERT(!package->contains(missingUUID));
+		BS_TEST_ASSERT(package->read(missingUUID) == nullptr);
+
+		// Files that aren't packages are rejected
+		BS_TEST_ASSERT(ResourcePackage::open(resources[0].second) == nullptr);
+
+		package = nullptr;
+		FileSystem::remove(directory, true);
+	}
+
+	void CoreTestSuite::testMeshSimplify()
+	{
+		static constexpr UINT32 GRID_SIZE = 33;
+		static constexpr UINT32 SEAM_COLUMN = GRID_SIZE / 2;
+
+		Vector<Vector3> positions;
+		Vector<UINT32> indices;
+		createSeamedGrid(GRID_SIZE, positions, indices);
+
+		const auto numVertices = (UINT32)positions.size();
+		const auto numIndices = (UINT32)indices.size();
+		const auto* vertices = (const UINT8*)positions.data();
+		const float gridArea = calcProjectedArea(positions, indices.data(), numIndices);
+
+		// Nothing to do if the target isn't lower than the current number of indices
+		Vector<UINT32> output;
+		MeshUtility::simplify(vertices, numVertices, sizeof(Vector3), indices.data(), numIndices, numIndices, output);
+		BS_TEST_ASSERT(output == indices);
+
+		MeshUtility::simplify(vertices, numVertices, sizeof(Vector3), indices.data(), numIndices, numIndices / 4, output);
+
+		const auto numOutputIndices = (UINT32)output.size();
+		BS_TEST_ASSERT(numOutputIndices % 3 == 0);
+		BS_TEST_ASSERT(numOutputIndices <= numIndices / 2);
+
+		Vector<bool> referenced(numVertices, false);
+		for (UINT32 i = 0; i < numOutputIndices; i += 3)
+		{
+			const UINT32 a = output[i];
+			const UINT32 b = output[i + 1];
+			const UINT32 c = output[i + 2];
+
+			BS_TEST_ASSERT(a < numVertices && b < numVertices && c < numVertices);
+			if (a >= numVertices || b >= numVertices || c >= numVertices)
+				return;
+
+			// No degenerate triangles
+			BS_TEST_ASSERT(positions[a] != positions[b] && positions[b] != positions[c] && positions[a] != positions[c]);
+
+			referenced[a] = referenced[b] = referenced[c] = true;
+		}
+
+		// Triangles keep facing the same way, and cover the same area without holes or overlaps
+		for (UINT32 i = 0; i < numOutputIndices; i += 3)
+			BS_TEST_ASSERT(calcProjectedArea(positions, &output[i], 3) > 0.0f);
+
+		BS_TEST_ASSERT(Math::approxEquals(calcProjectedArea(positions, output.data(), numOutputIndices), gridArea, 0.01f));
+
+		// Border vertices and both sides of the seam are never collapsed
+		for (UINT32 i = 0; i < GRID_SIZE; i++)
+		{
+			BS_TEST_ASSERT(referenced[i]);
+			BS_TEST_ASSERT(referenced[(GRID_SIZE - 1) * GRID_SIZE + i]);
+			BS_TEST_ASSERT(referenced[i * GRID_SIZE]);
+			BS_TEST_ASSERT(referenced[i * GRID_SIZE + GRID_SIZE - 1]);
+
+			BS_TEST_ASSERT(referenced[i * GRID_SIZE + SEAM_COLUMN]);
+			BS_TEST_ASSERT(referenced[GRID_SIZE * GRID_SIZE + i]);
+		}
+
+		// Level of detail generation, with positions in a different stream than the other vertex data
+		SPtr<VertexDataDesc> vertexDesc = VertexDataDesc::create();
+		vertexDesc->addVertElem(VET_FLOAT3, VES_NORMAL, 0, 0);
+		vertexDesc->addVertElem(VET_FLOAT3, VES_POSITION, 0, 1);
+
+		SPtr<MeshData> meshData = MeshData::create(numVertices, numIndices, vertexDesc);
+		meshData->setVertexData(VES_POSITION, positions.data(), numVertices * sizeof(Vector3), 0, 1);
+		memcpy(meshData->getIndices32(), indices.data(), numIndices * sizeof(UINT32));
+
+		Vector<Vector3> normals(numVertices, Vector3::UNIT_Y);
+		meshData->setVertexData(VES_NORMAL, normals.data(), numVertices * sizeof(Vector3), 0, 0);
+
+		// Split the grid into two sub-meshes, along with a sub-mesh that can't be simplified
+		const UINT32 halfNumIndices = numIndices / 6 * 3;
+		const Vector<SubMesh> subMeshes = 
+		{ 
+			SubMesh(0, halfNumIndices, DOT_TRIANGLE_LIST), 
+			SubMesh(halfNumIndices, numIndices - halfNumIndices, DOT_TRIANGLE_LIST),
+			SubMesh(0, 6, DOT_LINE_LIST)
+		};
+
+		Vector<MeshLOD> lods;
+		SPtr<MeshData> lodMeshData = MeshUtility::generateLODs(meshData, subMeshes, { 0.5f, 0.25f, 0.1f }, 0.5f, lods);
+
+		BS_TEST_ASSERT(!lods.empty());
+		if (lods.empty())
+			return;
+
+		BS_TEST_ASSERT(lodMeshData->getNumVertices() == numVertices);
+		BS_TEST_ASSERT(lodMeshData->getStreamSize() == meshData->getStreamSize());
+		BS_TEST_ASSERT(memcmp(lodMeshData->getElementData(VES_POSITION, 0, 1), positions.data(), 
+			numVertices * sizeof(Vector3)) == 0);
+		BS_TEST_ASSERT(memcmp(lodMeshData->getElementData(VES_NORMAL, 0, 0), normals.data(), 
+			numVertices * sizeof(Vector3)) == 0);
+		BS_TEST_ASSERT(memcmp(lodMeshData->getIndices32(), indices.data(), numIndices * sizeof(UINT32)) == 0);
+
+		const UINT32 numLODIndices = lodMeshData->getNumIndices();
+		const UINT32* lodIndices = lodMeshData->getIndices32();
+
+		Vector<SubMesh> prevSubMeshes = subMeshes;
+		for (auto& lod : lods)
+		{
+			BS_TEST_ASSERT(lod.subMeshes.size() == subMeshes.size());
+			if (lod.subMeshes.size() != subMeshes.size())
+				return;
+
+			for (UINT32 i = 0; i < 2; i++)
+			{
+				const SubMesh& subMesh = lod.subMeshes[i];
+				BS_TEST_ASSERT(subMesh.drawOp == DOT_TRIANGLE_LIST);
+				BS_TEST_ASSERT(subMesh.indexCount % 3 == 0);
+				BS_TEST_ASSERT(subMesh.indexCount <= prevSubMeshes[i].indexCount);
+				BS_TEST_ASSERT(subMesh.indexOffset + subMesh.indexCount <= numLODIndices);
+
+				for (UINT32 j = 0; j < subMesh.indexCount; j++)
+					BS_TEST_ASSERT(lodIndices[subMesh.indexOffset + j] < numVertices);
+			}
+
+			BS_TEST_ASSERT(lod.subMeshes[2].indexOffset == subMeshes[2].indexOffset);
+			BS_TEST_ASSERT(lod.subMeshes[2].indexCount == subMeshes[2].indexCount);
+
+			prevSubMeshes = lod.subMeshes;
+		}
+
+		BS_TEST_ASSERT(lods[0].subMeshes[0].indexCount < subMeshes[0].indexCount);
+		BS_TEST_ASSERT(lods[0].subMeshes[1].indexCount < subMeshes[1].indexCount);
+	}
+
+	void CoreTestSuite::testMeshOptimize()
+	{
+		static constexpr UINT32 GRID_SIZE = 24;
+		static constexpr UINT32 NUM_LINE_INDICES = 4;
+
+		struct Vertex
+		{
+			Vector3 position;
+			Vector2 uv;
+		};
+
+		auto getGridVertex = [](UINT32 x, UINT32 z, Vertex& vertex, UINT32& color)
+		{
+			vertex.position = Vector3((float)x, (x % 3) * 0.1f, (float)z);
+			vertex.uv = Vector2(x / (float)(GRID_SIZE - 1), z / (float)(GRID_SIZE - 1));
+			color = 0xFF000000 | (z << 8) | x;
+		};
+
+		// Grid triangles in random order, split between two sub-meshes
+		Vector<UINT32> gridTriangles;
+		for (UINT32 z = 0; z < (GRID_SIZE - 1); z++)
+		{
+			for (UINT32 x = 0; x < (GRID_SIZE - 1); x++)
+			{
+				const UINT32 i00 = z * GRID_SIZE + x;
+				const UINT32 i10 = i00 + 1;
+				const UINT32 i01 = i00 + GRID_SIZE;
+				const UINT32 i11 = i01 + 1;
+
+				gridTriangles.insert(gridTriangles.end(), { i00, i01, i10, i10, i01, i11 });
+			}
+		}
+
+		Random random(5);
+		const auto numGridTriangles = (UINT32)gridTriangles.size() / 3;
+		for (UINT32 i = numGridTriangles - 1; i > 0; i--)
+			std::swap_ranges(&gridTriangles[i * 3], &gridTriangles[i * 3 + 3], &gridTriangles[(random.get() % (i + 1)) * 3]);
+
+		const UINT32 numSubMeshTriangles[] = { numGridTriangles / 2, numGridTriangles - numGridTriangles / 2 };
+
+		// Every triangle gets its own copies of the vertices, so all vertices need to be welded. Some triangles are 
+		// followed by triangles that become degenerate after welding or already are.
+		Vector<Vertex> vertices;
+		Vector<UINT32> colors;
+		Vector<UINT32> indices;
+		Vector<SubMesh> subMeshes;
+		Vector<UINT64> subMeshTriangleKeys[2];
+
+		auto addVertex = [&](UINT32 gridIdx)
+		{
+			Vertex vertex;
+			UINT32 color;
+			getGridVertex(gridIdx % GRID_SIZE, gridIdx / GRID_SIZE, vertex, color);
+
+			vertices.push_back(vertex);
+			colors.push_back(color);
+			return (UINT32)vertices.size() - 1;
+		};
+
+		// Indices not referenced by any sub-mesh, referencing a vertex nothing else uses
+		vertices.push_back({ Vector3(1000.0f, 0.0f, 0.0f), Vector2::ZERO });
+		colors.push_back(0);
+		indices.insert(indices.end(), { 0, 0, 0 });
+
+		UINT32 gridTriangleIdx = 0;
+		for (UINT32 i = 0; i < 2; i++)
+		{
+			if (i == 1)
+			{
+				// Line list in between the triangle lists, which must be left as is
+				subMeshes.push_back(SubMesh((UINT32)indices.size(), NUM_LINE_INDICES, DOT_LINE_LIST));
+				for (UINT32 j = 0; j < NUM_LINE_INDICES; j++)
+					indices.push_back(addVertex(j * 5));
+			}
+
+			const auto indexOffset = (UINT32)indices.size();
+			for (UINT32 j = 0; j < numSubMeshTriangles[i]; j++)
+			{
+				const UINT32* triangle = &gridTriangles[gridTriangleIdx++ * 3];
+				const UINT32 a = addVertex(triangle[0]);
+				const UINT32 b = addVertex(triangle[1]);
+				const UINT32 c = addVertex(triangle[2]);
+				indices.insert(indices.end(), { a, b, c });
+
+				subMeshTriangleKeys[i].push_back(getGridTriangleKey(vertices[a].position, vertices[b].position, 
+					vertices[c].position, GRID_SIZE));
+
+				if (j % 10 == 0)
+					indices.insert(indices.end(), { a, addVertex(triangle[0]), c });
+				else if (j % 10 == 5)
+					indices.insert(indices.end(), { b, c, b });
+			}
+
+			subMeshes.push_back(SubMesh(indexOffset, (UINT32)indices.size() - indexOffset, DOT_TRIANGLE_LIST));
+			std::sort(subMeshTriangleKeys[i].begin(), subMeshTriangleKeys[i].end());
+		}
+
+		SPtr<VertexDataDesc> vertexDesc = VertexDataDesc::create();
+		vertexDesc->addVertElem(VET_FLOAT3, VES_POSITION, 0, 0);
+		vertexDesc->addVertElem(VET_FLOAT2, VES_TEXCOORD, 0, 0);
+		vertexDesc->addVertElem(VET_COLOR, VES_COLOR, 0, 1);
+
+		const auto numVertices = (UINT32)vertices.size();
+		const auto numIndices = (UINT32)indices.size();
+		SPtr<MeshData> meshData = MeshData::create(numVertices, numIndices, vertexDesc);
+		memcpy(meshData->getStreamData(0), vertices.data(), numVertices * sizeof(Vertex));
+		memcpy(meshData->getStreamData(1), colors.data(), numVertices * sizeof(UINT32));
+		memcpy(meshData->getIndices32(), indices.data(), numIndices * sizeof(UINT32));
+
+		const float acmrBefore = MeshUtility::calculateACMR(*meshData, subMeshes);
+
+		// Checks the optimized mesh contains the same sub-meshes and triangles, and returns its vertex cache miss ratio.
+		// Triangles that are only degenerate after welding remain if the vertices weren't welded.
+		auto validate = [&](const SPtr<MeshData>& optimized, const Vector<SubMesh>& optimizedSubMeshes, bool welded)
+		{
+			BS_TEST_ASSERT(optimizedSubMeshes.size() == 3);
+			if (optimizedSubMeshes.size() != 3)
+				return 3.0f;
+
+			const UINT32 numOutputVertices = optimized->getNumVertices();
+			const UINT32 numOutputIndices = optimized->getNumIndices();
+			const auto* outputVertices = (const Vertex*)optimized->getStreamData(0);
+			const auto* outputColors = (const UINT32*)optimized->getStreamData(1);
+			const UINT32* outputIndices = optimized->getIndices32();
+
+			// Sub-meshes are packed in their original order, without the unreferenced indices
+			UINT32 expectedOffset = 0;
+			for (auto& subMesh : optimizedSubMeshes)
+			{
+				BS_TEST_ASSERT(subMesh.indexOffset == expectedOffset);
+				expectedOffset += subMesh.indexCount;
+			}
+
+			BS_TEST_ASSERT(expectedOffset == numOutputIndices);
+			if (expectedOffset != numOutputIndices)
+				return 3.0f;
+
+			for (UINT32 i = 0; i < numOutputIndices; i++)
+			{
+				BS_TEST_ASSERT(outputIndices[i] < numOutputVertices);
+				if (outputIndices[i] >= numOutputVertices)
+					return 3.0f;
+			}
+
+			// Vertex data stays consistent across streams
+			for (UINT32 i = 0; i < numOutputVertices; i++)
+			{
+				const Vector3& position = outputVertices[i].position;
+				if (position.x >= GRID_SIZE)
+					continue;
+
+				Vertex expected;
+				UINT32 expectedColor;
+				getGridVertex(Math::roundToInt(position.x), Math::roundToInt(position.z), expected, expectedColor);
+
+				BS_TEST_ASSERT(position == expected.position);
+				BS_TEST_ASSERT(outputVertices[i].uv == expected.uv);
+				BS_TEST_ASSERT(outputColors[i] == expectedColor);
+			}
+
+			// Triangle lists contain the same triangles, with the same winding and without degenerate ones
+			const UINT32 triangleSubMeshes[] = { 0, 2 };
+			for (UINT32 i = 0; i < 2; i++)
+			{
+				const SubMesh& subMesh = optimizedSubMeshes[triangleSubMeshes[i]];
+				BS_TEST_ASSERT(subMesh.drawOp == DOT_TRIANGLE_LIST);
+
+				Vector<UINT64> triangleKeys;
+				UINT32 numDegenerate = 0;
+				for (UINT32 j = 0; j < subMesh.indexCount; j += 3)
+				{
+					const UINT32* triangle = &outputIndices[subMesh.indexOffset + j];
+					BS_TEST_ASSERT(triangle[0] != triangle[1] && triangle[1] != triangle[2] && triangle[0] != triangle[2]);
+
+					const Vector3& a = outputVertices[triangle[0]].position;
+					const Vector3& b = outputVertices[triangle[1]].position;
+					const Vector3& c = outputVertices[triangle[2]].position;
+					if (a == b || b == c || a == c)
+					{
+						numDegenerate++;
+						continue;
+					}
+
+					triangleKeys.push_back(getGridTriangleKey(a, b, c, GRID_SIZE));
+				}
+
+				BS_TEST_ASSERT(welded ? numDegenerate == 0 : numDegenerate > 0);
+
+				std::sort(triangleKeys.begin(), triangleKeys.end());
+				BS_TEST_ASSERT(triangleKeys == subMeshTriangleKeys[i]);
+			}
+
+			const SubMesh& lineSubMesh = optimizedSubMeshes[1];
+			BS_TEST_ASSERT(lineSubMesh.drawOp == DOT_LINE_LIST);
+			BS_TEST_ASSERT(lineSubMesh.indexCount == NUM_LINE_INDICES);
+			for (UINT32 i = 0; i < NUM_LINE_INDICES && i < lineSubMesh.indexCount; i++)
+			{
+				const Vector3& position = outputVertices[outputIndices[lineSubMesh.indexOffset + i]].position;
+				BS_TEST_ASSERT(position == vertices[indices[subMeshes[1].indexOffset + i]].position);
+			}
+
+			return MeshUtility::calculateACMR(*optimized, optimizedSubMeshes);
+		};
+
+		// Welding and reordering vertices
+		Vector<SubMesh> optimizedSubMeshes = subMeshes;
+		SPtr<MeshData> optimized = MeshUtility::optimize(meshData, optimizedSubMeshes);
+		const float acmrOptimized = validate(optimized, optimizedSubMeshes, true);
+
+		BS_TEST_ASSERT(optimized->getNumVertices() == GRID_SIZE * GRID_SIZE);
+		BS_TEST_ASSERT(acmrOptimized < acmrBefore);
+
+		// Vertices are ordered by their first use
+		const UINT32* optimizedIndices = optimized->getIndices32();
+		UINT32 numReferenced = 0;
+		for (UINT32 i = 0; i < optimized->getNumIndices(); i++)
+		{
+			BS_TEST_ASSERT(optimizedIndices[i] <= numReferenced);
+			numReferenced = std::max(numReferenced, optimizedIndices[i] + 1);
+		}
+
+		// Optimizing an already optimized mesh doesn't make it worse
+		Vector<SubMesh> reoptimizedSubMeshes = optimizedSubMeshes;
+		SPtr<MeshData> reoptimized = MeshUtility::optimize(optimized, reoptimizedSubMeshes);
+		BS_TEST_ASSERT(reoptimized->getNumVertices() == GRID_SIZE * GRID_SIZE);
+		BS_TEST_ASSERT(validate(reoptimized, reoptimizedSubMeshes, true) <= acmrOptimized + 0.01f);
+
+		// Without vertex reordering, only exactly degenerate triangles are removed and vertex data is left as is
+		Vector<SubMesh> indexOnlySubMeshes = subMeshes;
+		SPtr<MeshData> indexOnly = MeshUtility::optimize(meshData, indexOnlySubMeshes, false);
+		validate(indexOnly, indexOnlySubMeshes, false);
+
+		BS_TEST_ASSERT(indexOnly->getNumVertices() == numVertices);
+		BS_TEST_ASSERT(memcmp(indexOnly->getStreamData(0), meshData->getStreamData(0), 
+			meshData->getStreamSize(0)) == 0);
+		BS_TEST_ASSERT(memcmp(indexOnly->getStreamData(1), meshData->getStreamData(1), 
+			meshData->getStreamSize(1)) == 0);
+
+		// Reordering only the triangles of a mesh with shared vertices doesn't make it worse either
+		Vector<SubMesh> reorderedSubMeshes = optimizedSubMeshes;
+		SPtr<MeshData> reordered = MeshUtility::optimize(optimized, reorderedSubMeshes, false);
+		BS_TEST_ASSERT(reordered->getNumVertices() == GRID_SIZE * GRID_SIZE);
+		BS_TEST_ASSERT(validate(reordered, reorderedSubMeshes, true) <= acmrOptimized + 0.01f);
+	}
 }
 
 using namespace bs;
@@ -3,6 +3,7 @@
 #include "Profiling/BsProfilerCPU.h"
 #include "Debug/BsDebug.h"
 #include "Platform/BsPlatform.h"
+#include "Debug/BsTraceCapture.h"
 #include <chrono>
 
 #if BS_COMPILER == BS_COMPILER_MSVC
@@ -182,7 +183,10 @@ namespace bs
 					(StdFrameAlloc<ActiveBlock>(&frameAlloc));
 
 		activeBlocks->push(activeBlock);
-		
+
+		gTraceCapture().setThreadName(_name);
+		gTraceCapture().beginEvent(_name);
+
 		rootBlock->basic.beginSample();
 		isActive = true;
 	}
@@ -195,6 +199,7 @@ namespace bs
 			activeBlock.block->precise.endSample();
 
 		activeBlocks->pop();
+		gTraceCapture().endEvent();
 
 		if(!isActive)
 			LOGWRN("Profiler::endThread called on a thread that isn't being sampled.");
@@ -212,6 +217,7 @@ namespace bs
 					curBlock.block->precise.endSample();
 
 				activeBlocks->pop();
+				gTraceCapture().endEvent();
 			}
 		}
 
@@ -343,6 +349,7 @@ namespace bs
 		thread->activeBlock = ActiveBlock(ActiveSamplingType::Basic, block);
 		thread->activeBlocks->push(thread->activeBlock);
 
+		gTraceCapture().beginEvent(name);
 		block->basic.beginSample();
 	}
 
@@ -373,6 +380,7 @@ namespace bs
 #endif
 
 		block->basic.endSample();
+		gTraceCapture().endEvent();
 
 		thread->activeBlocks->pop();
 
@@ -410,6 +418,7 @@ namespace bs
 		thread->activeBlock = ActiveBlock(ActiveSamplingType::Precise, block);
 		thread->activeBlocks->push(thread->activeBlock);
 
+		gTraceCapture().beginEvent(name);
 		block->precise.beginSample();
 	}
 
@@ -440,6 +449,7 @@ namespace bs
 #endif
 
 		block->precise.endSample();
+		gTraceCapture().endEvent();
 
 		thread->activeBlocks->pop();
 
@@ -5,11 +5,28 @@
 #include "RenderAPI/BsTimerQuery.h"
 #include "RenderAPI/BsOcclusionQuery.h"
 #include "Error/BsException.h"
+#include "Debug/BsTraceCapture.h"
 
 namespace bs
 {
 	const UINT32 ProfilerGPU::MAX_QUEUE_ELEMENTS = 5;
 
+	/**
+	 * Records a resolved sample and its children on the GPU timeline of the active trace capture. Timer queries only
+	 * provide durations, so the sample is placed at the provided start time and its children are laid out back to back.
+	 */
+	static void recordTraceEvents(const GPUProfileSample& sample, UINT64 startTimestamp)
+	{
+		gTraceCapture().recordGpuEvent(sample.name.c_str(), startTimestamp, (UINT64)(sample.timeMs * 1000000.0));
+
+		UINT64 childTimestamp = startTimestamp;
+		for(auto& child : sample.children)
+		{
+			recordTraceEvents(child, childTimestamp);
+			childTimestamp += (UINT64)(child.timeMs * 1000000.0);
+		}
+	}
+
 	ProfilerGPU::ProfilerGPU()
 	{
 		mReadyReports = bs_newN<GPUProfilerReport>(MAX_QUEUE_ELEMENTS);
@@ -142,6 +159,11 @@ namespace bs
 				GPUProfilerReport report;
 				resolveSample(frameSample, report.frameSample);
 
+				// GPU timings are only known once resolved, so they're positioned relative to the time the frame was
+				// submitted on the CPU
+				if(gTraceCapture().isCapturing() && frameSample.traceTimestamp != 0)
+					recordTraceEvents(report.frameSample, frameSample.traceTimestamp);
+
 				freeSample(frameSample);
 				mUnresolvedFrames.pop();
 
@@ -205,6 +227,10 @@ namespace bs
 		reportSample.numObjectsCreated = (UINT32)(sample.endStats.numObjectsCreated - sample.startStats.numObjectsCreated);
 		reportSample.numObjectsDestroyed = (UINT32)(sample.endStats.numObjectsDestroyed - sample.startStats.numObjectsDestroyed);
 
+		reportSample.numShadowCacheHits = (UINT32)(sample.endStats.numShadowCacheHits - sample.startStats.numShadowCacheHits);
+		reportSample.numShadowCacheMisses = (UINT32)(sample.endStats.numShadowCacheMisses - sample.startStats.numShadowCacheMisses);
+		reportSample.numInstancedDrawCalls = (UINT32)(sample.endStats.numInstancedDrawCalls - sample.startStats.numInstancedDrawCalls);
+
 		for(auto& entry : sample.children)
 		{
 			reportSample.children.push_back(GPUProfileSample());
@@ -215,6 +241,7 @@ namespace bs
 	void ProfilerGPU::beginSampleInternal(ProfiledSample& sample, bool issueOcclusion)
 	{
 		sample.startStats = RenderStats::instance().getData();
+		sample.traceTimestamp = gTraceCapture().isCapturing() ? TraceCapture::getTimestamp() : 0;
 		sample.activeTimeQuery = getTimerQuery();
 		sample.activeTimeQuery->begin();
 
@@ -40,6 +40,10 @@ namespace bs
 		UINT32 numObjectsCreated; /**< How many GPU objects were created. */
 		UINT32 numObjectsDestroyed; /**< How many GPU objects were destroyed. */
 
+		UINT32 numShadowCacheHits; /**< How many times was a cached static shadow map reused. */
+		UINT32 numShadowCacheMisses; /**< How many times did a static shadow map need to be re-rendered. */
+		UINT32 numInstancedDrawCalls; /**< How many draw calls rendered a group of objects using instancing. */
+
 		Vector<GPUProfileSample> children;
 	};
 
@@ -64,6 +68,7 @@ namespace bs
 			RenderStatsData endStats;
 			SPtr<ct::TimerQuery> activeTimeQuery;
 			SPtr<ct::OcclusionQuery> activeOcclusionQuery;
+			UINT64 traceTimestamp = 0;
 
 			Vector<ProfiledSample*> children;
 		};
@@ -48,6 +48,10 @@ namespace bs
 
 		UINT64 numObjectsCreated; 
 		UINT64 numObjectsDestroyed;
+
+		UINT64 numShadowCacheHits = 0;
+		UINT64 numShadowCacheMisses = 0;
+		UINT64 numInstancedDrawCalls = 0;
 	};
 
 	/**
@@ -94,6 +98,24 @@ namespace bs
 		/** Increments index buffer change counter indicating how many times was a index buffer bound to the pipeline. */
 		void incNumIndexBufferBinds() { mData.numIndexBufferBinds++; }
 
+		/** 
+		 * Increments shadow cache hit counter indicating how many times was a cached static shadow map reused instead of
+		 * being re-rendered.
+		 */
+		void incNumShadowCacheHits() { mData.numShadowCacheHits++; }
+
+		/** 
+		 * Increments shadow cache miss counter indicating how many times did a static shadow map have to be re-rendered
+		 * because the light or the static geometry around it changed.
+		 */
+		void incNumShadowCacheMisses() { mData.numShadowCacheMisses++; }
+
+		/** 
+		 * Increments instanced draw call counter indicating how many draw calls rendered a group of objects using 
+		 * instancing.
+		 */
+		void incNumInstancedDrawCalls() { mData.numInstancedDrawCalls++; }
+
 		/**
 		 * Increments created GPU resource counter. 
 		 *
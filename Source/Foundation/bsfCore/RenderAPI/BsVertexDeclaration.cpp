@@ -29,6 +29,12 @@ namespace bs
 			return sizeof(RGBA);
 		case VET_UBYTE4_NORM:
 			return sizeof(UINT32);
+		case VET_SHORT2_NORM:
+			return sizeof(INT16) * 2;
+		case VET_SHORT4_NORM:
+			return sizeof(INT16) * 4;
+		case VET_HALF2:
+			return sizeof(UINT16) * 2;
 		case VET_FLOAT1:
 			return sizeof(float);
 		case VET_FLOAT2:
@@ -93,6 +99,8 @@ namespace bs
 		case VET_USHORT2:
 		case VET_INT2:
 		case VET_UINT2:
+		case VET_SHORT2_NORM:
+		case VET_HALF2:
 			return 2;
 		case VET_FLOAT3:
 		case VET_INT3:
@@ -105,6 +113,7 @@ namespace bs
 		case VET_UINT4:
 		case VET_UBYTE4:
 		case VET_UBYTE4_NORM:
+		case VET_SHORT4_NORM:
 			return 4;
 		default:
 			break;
@@ -9,7 +9,6 @@
 #include "Renderer/BsRenderer.h"
 #include "Animation/BsAnimation.h"
 #include "Animation/BsMorphShapes.h"
-#include "RenderAPI/BsGpuBuffer.h"
 #include "Animation/BsAnimationManager.h"
 #include "Scene/BsSceneManager.h"
 #include "CoreThread/BsCoreObjectSync.h"
@@ -494,41 +493,6 @@ namespace bs
 
 	void Renderable::createAnimationBuffers()
 	{
-		if (mAnimType == RenderableAnimType::Skinned || mAnimType == RenderableAnimType::SkinnedMorph)
-		{
-			SPtr<Skeleton> skeleton = mMesh->getSkeleton();
-			UINT32 numBones = skeleton != nullptr ? skeleton->getNumBones() : 0;
-
-			if (numBones > 0)
-			{
-				GPU_BUFFER_DESC desc;
-				desc.elementCount = numBones * 3;
-				desc.elementSize = 0;
-				desc.type = GBT_STANDARD;
-				desc.format = BF_32X4F;
-				desc.usage = GBU_DYNAMIC;
-
-				SPtr<GpuBuffer> buffer = GpuBuffer::create(desc);
-				UINT8* dest = (UINT8*)buffer->lock(0, numBones * 3 * sizeof(Vector4), GBL_WRITE_ONLY_DISCARD);
-
-				// Initialize bone transforms to identity, so the object renders properly even if no animation is animating it
-				for (UINT32 i = 0; i < numBones; i++)
-				{
-					memcpy(dest, &Matrix4::IDENTITY, 12 * sizeof(float)); // Assuming row-major format
-
-					dest += 12 * sizeof(float);
-				}
-
-				buffer->unlock();
-
-				mBoneMatrixBuffer = buffer;
-			}
-			else
-				mBoneMatrixBuffer = nullptr;
-		}
-		else
-			mBoneMatrixBuffer = nullptr;
-
 		if (mAnimType == RenderableAnimType::Morph || mAnimType == RenderableAnimType::SkinnedMorph)
 		{
 			SPtr<MorphShapes> morphShapes = mMesh->getMorphShapes();
@@ -570,24 +534,6 @@ namespace bs
 		if (animInfo == nullptr)
 			return;
 
-		if (mAnimType == RenderableAnimType::Skinned || mAnimType == RenderableAnimType::SkinnedMorph)
-		{
-			const EvaluatedAnimationData::PoseInfo& poseInfo = animInfo->poseInfo;
-
-			// Note: If multiple elements are using the same animation (not possible atm), this buffer should be shared by
-			// all such elements
-			UINT8* dest = (UINT8*)mBoneMatrixBuffer->lock(0, poseInfo.numBones * 3 * sizeof(Vector4), GBL_WRITE_ONLY_DISCARD);
-			for (UINT32 j = 0; j < poseInfo.numBones; j++)
-			{
-				const Matrix4& transform = animData.transforms[poseInfo.startIdx + j];
-				memcpy(dest, &transform, 12 * sizeof(float)); // Assuming row-major format
-
-				dest += 12 * sizeof(float);
-			}
-
-			mBoneMatrixBuffer->unlock();
-		}
-
 		if (mAnimType == RenderableAnimType::Morph || mAnimType == RenderableAnimType::SkinnedMorph)
 		{
 			if (mMorphShapeVersion != animInfo->morphShapeInfo.version)
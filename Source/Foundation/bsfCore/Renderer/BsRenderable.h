@@ -260,13 +260,13 @@ namespace bs
 
 		/** 
 		 * Updates internal animation buffers from the contents of the provided animation data object. Does nothing if
-		 * renderable is not affected by animation.
+		 * renderable is not affected by morph shape animation.
+		 *
+		 * @note	Bone matrices of skinned renderables are not stored per-renderable, and are instead expected to be 
+		 *			provided by the renderer, straight from @p animData.
 		 */
 		void updateAnimationBuffers(const EvaluatedAnimationData& animData);
 
-		/** Returns the GPU buffer containing element's bone matrices, if it has any. */
-		const SPtr<GpuBuffer>& getBoneMatrixBuffer() const { return mBoneMatrixBuffer; }
-
 		/** Returns the vertex buffer containing element's morph shape vertices, if it has any. */
 		const SPtr<VertexBuffer>& getMorphShapeBuffer() const { return mMorphShapeBuffer; }
 
@@ -291,7 +291,6 @@ namespace bs
 		UINT64 mAnimationId;
 		UINT32 mMorphShapeVersion;
 
-		SPtr<GpuBuffer> mBoneMatrixBuffer;
 		SPtr<VertexBuffer> mMorphShapeBuffer;
 		SPtr<VertexDeclaration> mMorphVertexDeclaration;
 	};
@@ -61,6 +61,34 @@ namespace bs
 		return variation;
 	}
 
+	/** Returns a shader variation used for rendering non-animated objects using instancing. */
+	static const ShaderVariation& getInstancedVertexInputVariation()
+	{
+		static ShaderVariation variation = ShaderVariation(
+		{
+			ShaderVariation::Param("SKINNED", false),
+			ShaderVariation::Param("MORPH", false),
+			ShaderVariation::Param("INSTANCED", true),
+		});
+
+		return variation;
+	}
+
+	/** Returns a forward rendering shader variation used for rendering non-animated objects using instancing. */
+	template<bool clustered>
+	static const ShaderVariation& getInstancedForwardRenderingVariation()
+	{
+		static ShaderVariation variation = ShaderVariation(
+		{
+			ShaderVariation::Param("SKINNED", false),
+			ShaderVariation::Param("MORPH", false),
+			ShaderVariation::Param("CLUSTERED", clustered),
+			ShaderVariation::Param("INSTANCED", true),
+		});
+
+		return variation;
+	}
+
 	/** Technique tags. */
 	static StringID RTag_Skinned = "Skinned";
 	static StringID RTag_Morph = "Morph";
@@ -10,6 +10,7 @@ namespace bs
 	GpuResourceData::GpuResourceData(const GpuResourceData& copy)
 	{
 		mData = copy.mData;
+		mExternalOwner = copy.mExternalOwner;
 		mLocked = copy.mLocked; // TODO - This should be shared by all copies pointing to the same data?
 		mOwnsData = false;
 	}
@@ -22,6 +23,7 @@ namespace bs
 	GpuResourceData& GpuResourceData::operator=(const GpuResourceData& rhs)
 	{
 		mData = rhs.mData;
+		mExternalOwner = rhs.mExternalOwner;
 		mLocked = rhs.mLocked; // TODO - This should be shared by all copies pointing to the same data?
 		mOwnsData = false;
 
@@ -59,6 +61,7 @@ namespace bs
 		freeInternalBuffer();
 
 		mData = (UINT8*)bs_alloc(size);
+		mExternalOwner = nullptr;
 		mOwnsData = true;
 	}
 
@@ -92,9 +95,32 @@ namespace bs
 		freeInternalBuffer();
 
 		mData = data;
+		mExternalOwner = nullptr;
 		mOwnsData = false;
 	}
 
+	void GpuResourceData::setExternalBuffer(UINT8* data, const SPtr<DataStream>& owner)
+	{
+		setExternalBuffer(data);
+		mExternalOwner = owner;
+	}
+
+	void GpuResourceData::detachExternalBuffer()
+	{
+		if(mExternalOwner == nullptr)
+			return;
+
+		UINT8* externalData = mData;
+		UINT32 size = getInternalBufferSize();
+
+		// Keep the owner alive until the data is copied
+		SPtr<DataStream> owner = mExternalOwner;
+		allocateInternalBuffer(size);
+
+		if(externalData != nullptr)
+			memcpy(mData, externalData, size);
+	}
+
 	void GpuResourceData::_lock() const
 	{
 		mLocked = true;
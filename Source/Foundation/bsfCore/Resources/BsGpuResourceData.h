@@ -66,6 +66,21 @@ namespace bs
 		 */
 		void setExternalBuffer(UINT8* data);
 
+		/**
+		 * Makes the internal data pointer point to data owned by the provided stream (for example a region of a memory
+		 * mapped file). No copying is done, and the stream is kept alive for as long as this object references its data.
+		 *
+		 * @note	If any internal data is allocated, it is freed.
+		 */
+		void setExternalBuffer(UINT8* data, const SPtr<DataStream>& owner);
+
+		/**
+		 * If the data points to a buffer owned by an external stream (see setExternalBuffer(UINT8*, const SPtr<DataStream>&)),
+		 * copies it into an internal buffer and releases the stream. Must be called on objects that are kept around after
+		 * loading, so they don't keep the source file mapped.
+		 */
+		void detachExternalBuffer();
+
 		/** Checks if the internal buffer is locked due to some other thread using it. */
 		bool isLocked() const { return mLocked; }
 
@@ -84,6 +99,7 @@ namespace bs
 
 	private:
 		UINT8* mData = nullptr;
+		SPtr<DataStream> mExternalOwner;
 		bool mOwnsData = false;
 		mutable bool mLocked = false;
 
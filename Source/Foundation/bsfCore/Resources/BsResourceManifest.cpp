@@ -37,6 +37,8 @@ namespace bs
 			if (iterFind->second != filePath)
 			{
 				mFilePathToUUID.erase(iterFind->second);
+				mDependencies.erase(uuid);
+				mDependencyTimestamps.erase(uuid);
 
 				mUUIDToFilePath[uuid] = filePath;
 				mFilePathToUUID[filePath] = uuid;
@@ -46,7 +48,11 @@ namespace bs
 		{
 			auto iterFind2 = mFilePathToUUID.find(filePath);
 			if (iterFind2 != mFilePathToUUID.end())
+			{
 				mUUIDToFilePath.erase(iterFind2->second);
+				mDependencies.erase(iterFind2->second);
+				mDependencyTimestamps.erase(iterFind2->second);
+			}
 
 			mUUIDToFilePath[uuid] = filePath;
 			mFilePathToUUID[filePath] = uuid;
@@ -61,9 +67,34 @@ namespace bs
 		{
 			mFilePathToUUID.erase(iterFind->second);
 			mUUIDToFilePath.erase(uuid);
+			mDependencies.erase(uuid);
+			mDependencyTimestamps.erase(uuid);
 		}
 	}
 
+	void ResourceManifest::setDependencies(const UUID& uuid, const Vector<UUID>& dependencies, UINT64 timestamp)
+	{
+		if(mUUIDToFilePath.find(uuid) == mUUIDToFilePath.end())
+			return;
+
+		mDependencies[uuid] = dependencies;
+		mDependencyTimestamps[uuid] = timestamp;
+	}
+
+	bool ResourceManifest::getDependencies(const UUID& uuid, UINT64 timestamp, Vector<UUID>& dependencies) const
+	{
+		auto iterFind = mDependencies.find(uuid);
+		if(iterFind == mDependencies.end())
+			return false;
+
+		auto iterFindTimestamp = mDependencyTimestamps.find(uuid);
+		if(iterFindTimestamp == mDependencyTimestamps.end() || iterFindTimestamp->second != timestamp)
+			return false;
+
+		dependencies = iterFind->second;
+		return true;
+	}
+
 	bool ResourceManifest::uuidToFilePath(const UUID& uuid, Path& filePath) const
 	{
 		auto iterFind = mUUIDToFilePath.find(uuid);
@@ -147,6 +178,9 @@ namespace bs
 				copy->mUUIDToFilePath[elem.first] = elementRelativePath;
 			}
 
+			copy->mDependencies = manifest->mDependencies;
+			copy->mDependencyTimestamps = manifest->mDependencyTimestamps;
+
 			FileEncoder fs(path);
 			fs.encode(copy.get());
 		}
@@ -174,6 +208,9 @@ namespace bs
 			copy->mUUIDToFilePath[elem.first] = absPath;
 		}
 
+		copy->mDependencies = manifest->mDependencies;
+		copy->mDependencyTimestamps = manifest->mDependencyTimestamps;
+
 		return copy;
 	}
 
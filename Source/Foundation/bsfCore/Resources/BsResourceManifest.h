@@ -62,6 +62,26 @@ namespace bs
 		BS_SCRIPT_EXPORT()
 		bool filePathExists(const Path& filePath) const;
 
+		/**
+		 * Records the dependencies of a registered resource, allowing them to be determined without reading the resource
+		 * file. Dependencies are cleared whenever the resource is unregistered or registered with a different path.
+		 *
+		 * @param[in]	uuid			UUID of the resource to record the dependencies for.
+		 * @param[in]	dependencies	UUIDs of all resources the resource depends on.
+		 * @param[in]	timestamp		Last modification time of the resource file the dependencies were determined from.
+		 */
+		void setDependencies(const UUID& uuid, const Vector<UUID>& dependencies, UINT64 timestamp);
+
+		/**
+		 * Attempts to find dependencies previously recorded with setDependencies() for the resource with the provided
+		 * UUID. Returns true if the dependencies are known and were recorded for a file with the provided modification
+		 * time, false otherwise.
+		 */
+		bool getDependencies(const UUID& uuid, UINT64 timestamp, Vector<UUID>& dependencies) const;
+
+		/** Returns all resources registered in the manifest, mapped from their UUIDs to their file paths. */
+		const UnorderedMap<UUID, Path>& getEntries() const { return mUUIDToFilePath; }
+
 		/**
 		 * Saves the resource manifest to the specified location.
 		 *
@@ -90,6 +110,8 @@ namespace bs
 		String mName;
 		UnorderedMap<UUID, Path> mUUIDToFilePath;
 		UnorderedMap<Path, UUID> mFilePathToUUID;
+		UnorderedMap<UUID, Vector<UUID>> mDependencies;
+		UnorderedMap<UUID, UINT64> mDependencyTimestamps;
 
 		/************************************************************************/
 		/* 								RTTI		                     		*/
@@ -0,0 +1,242 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Resources/BsResourcePackage.h"
+#include "Resources/BsSavedResourceData.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+#include "Serialization/BsFileSerializer.h"
+#include "Serialization/BsMemorySerializer.h"
+#include "Utility/BsCompression.h"
+#include "Debug/BsDebug.h"
+
+namespace bs
+{
+	/** Index entry as stored in the package file. */
+	struct PackageIndexEntry
+	{
+		UUID uuid;
+		UINT64 offset;
+		UINT64 size;
+	};
+
+	constexpr UINT32 ResourcePackage::MAGIC;
+	constexpr UINT32 ResourcePackage::VERSION;
+
+	ResourcePackage::ResourcePackage(const Path& path, const ConstructPrivately& dummy)
+		:mPath(path)
+	{ }
+
+	bool ResourcePackage::contains(const UUID& uuid) const
+	{
+		return mEntries.find(uuid) != mEntries.end();
+	}
+
+	SPtr<DataStream> ResourcePackage::read(const UUID& uuid) const
+	{
+		auto iterFind = mEntries.find(uuid);
+		if (iterFind == mEntries.end())
+			return nullptr;
+
+		const Entry& entry = iterFind->second;
+
+		// Mapped packages hand out views over the mapping, which don't require any copying or locking
+		if (mMappedData)
+			return bs_shared_ptr_new<MappedFileDataStream>(*mMappedData, (size_t)entry.offset, (size_t)entry.size);
+
+		// Otherwise read into memory from the entry's offset. Positional reads don't share a read position, so multiple
+		// threads can read through the same handle.
+		SPtr<MemoryDataStream> output = bs_shared_ptr_new<MemoryDataStream>((size_t)entry.size);
+		if (mFileReader->read(output->getPtr(), (size_t)entry.size, entry.offset) != entry.size)
+		{
+			LOGERR("Unable to read resource " + uuid.toString() + " from package: " + mPath.toString());
+			return nullptr;
+		}
+
+		return output;
+	}
+
+	bool ResourcePackage::readIndex()
+	{
+		mMappedData = bs_shared_ptr_new<MappedFileDataStream>(mPath);
+
+		SPtr<DataStream> stream;
+		if (mMappedData->size() > 0)
+			stream = mMappedData->clone(false);
+		else
+		{
+			mMappedData = nullptr;
+			mFileReader = bs_shared_ptr_new<PositionalFileReader>(mPath);
+			if (!mFileReader->isOpen())
+				return false;
+
+			stream = bs_shared_ptr_new<FileDataStream>(mPath);
+		}
+
+		const size_t fileSize = stream->size();
+
+		Header header;
+		if (fileSize < sizeof(header) || stream->read(&header, sizeof(header)) != sizeof(header))
+			return false;
+
+		if (header.magic != MAGIC || header.version != VERSION)
+			return false;
+
+		const UINT64 indexSize = (UINT64)header.numEntries * sizeof(PackageIndexEntry);
+		if (header.indexOffset < sizeof(header) || header.indexOffset + indexSize > fileSize)
+			return false;
+
+		Vector<PackageIndexEntry> index(header.numEntries);
+		stream->seek((size_t)header.indexOffset);
+		if (stream->read(index.data(), (size_t)indexSize) != indexSize)
+			return false;
+
+		mEntries.reserve(header.numEntries);
+		for (auto& entry : index)
+		{
+			if (entry.offset < sizeof(header) || entry.offset + entry.size > header.indexOffset)
+				return false;
+
+			mEntries[entry.uuid] = { entry.uuid, entry.offset, entry.size };
+		}
+
+		return true;
+	}
+
+	SPtr<ResourcePackage> ResourcePackage::open(const Path& path)
+	{
+		if (!FileSystem::isFile(path))
+		{
+			LOGWRN("Cannot open resource package. Specified file: " + path.toString() + " doesn't exist.");
+			return nullptr;
+		}
+
+		SPtr<ResourcePackage> package = bs_shared_ptr_new<ResourcePackage>(path, ConstructPrivately());
+		if (!package->readIndex())
+		{
+			LOGERR("Cannot open resource package. File is not a valid resource package: " + path.toString());
+			return nullptr;
+		}
+
+		return package;
+	}
+
+	/**
+	 * Compresses the object data of a saved resource, if it isn't already compressed and compression reduces its size
+	 * enough. Returns null if the resource should be stored as is.
+	 */
+	static SPtr<MemoryDataStream> compressSavedResource(const SPtr<MemoryDataStream>& input)
+	{
+		// Only worth compressing if it saves at least this much
+		static constexpr float MIN_COMPRESSION_RATIO = 0.9f;
+
+		input->seek(0);
+
+		FileDecoder decoder(input);
+		SPtr<SavedResourceData> metaData = std::static_pointer_cast<SavedResourceData>(decoder.decode());
+		if (metaData == nullptr || metaData->getCompressionMethod() != 0 || input->eof())
+			return nullptr;
+
+		UINT32 objectSize = 0;
+		input->read(&objectSize, sizeof(objectSize));
+
+		// Packaged resources are loaded often, favor decompression speed
+		CompressionMethod method = CompressionMethod::Snappy;
+		if (Compression::isSupported(CompressionMethod::LZ4))
+			method = CompressionMethod::LZ4;
+
+		SPtr<DataStream> objectData = bs_shared_ptr_new<MemoryDataStream>(input->getCurrentPtr(), objectSize, false);
+		SPtr<MemoryDataStream> compressedData = Compression::compress(objectData, method);
+		if (compressedData == nullptr || compressedData->size() > objectSize * MIN_COMPRESSION_RATIO)
+			return nullptr;
+
+		SavedResourceData compressedMetaData(metaData->getDependencies(), metaData->allowAsyncLoading(), (UINT32)method);
+
+		MemorySerializer ms;
+		UINT32 metaDataSize = 0;
+		UINT8* metaDataBytes = ms.encode(&compressedMetaData, metaDataSize);
+
+		const size_t outputSize = sizeof(UINT32) * 2 + metaDataSize + compressedData->size();
+		SPtr<MemoryDataStream> output = bs_shared_ptr_new<MemoryDataStream>(outputSize);
+		output->write(&metaDataSize, sizeof(metaDataSize));
+		output->write(metaDataBytes, metaDataSize);
+		output->write(&objectSize, sizeof(objectSize));
+		output->write(compressedData->getPtr(), compressedData->size());
+
+		bs_free(metaDataBytes);
+		return output;
+	}
+
+	bool ResourcePackage::create(const Path& path, const Vector<std::pair<UUID, Path>>& resources, bool compress)
+	{
+		Path parentDir = path.getDirectory();
+		if (!FileSystem::exists(parentDir))
+			FileSystem::createDir(parentDir);
+
+		std::ofstream stream;
+		stream.open(path.toPlatformString().c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+		if (stream.fail())
+		{
+			LOGERR("Failed to create resource package: \"" + path.toString() + "\". Error: " + strerror(errno) + ".");
+			return false;
+		}
+
+		Header header;
+		header.magic = MAGIC;
+		header.version = VERSION;
+		header.numEntries = 0;
+		header.padding = 0;
+		header.indexOffset = 0;
+
+		stream.write((char*)&header, sizeof(header));
+
+		Vector<PackageIndexEntry> index;
+		index.reserve(resources.size());
+
+		UINT64 offset = sizeof(header);
+		for (auto& entry : resources)
+		{
+			if (!FileSystem::isFile(entry.second))
+			{
+				LOGWRN("Skipping resource " + entry.first.toString() + " when creating a package. Specified file: " +
+					entry.second.toString() + " doesn't exist.");
+				continue;
+			}
+
+			SPtr<DataStream> fileStream = FileSystem::openFile(entry.second, true);
+			SPtr<MemoryDataStream> data = bs_shared_ptr_new<MemoryDataStream>(fileStream);
+			fileStream->close();
+
+			if (compress)
+			{
+				SPtr<MemoryDataStream> compressedData = compressSavedResource(data);
+				if (compressedData)
+					data = compressedData;
+			}
+
+			stream.write((char*)data->getPtr(), data->size());
+
+			PackageIndexEntry indexEntry;
+			indexEntry.uuid = entry.first;
+			indexEntry.offset = offset;
+			indexEntry.size = data->size();
+			index.push_back(indexEntry);
+
+			offset += data->size();
+		}
+
+		header.numEntries = (UINT32)index.size();
+		header.indexOffset = offset;
+
+		stream.write((char*)index.data(), index.size() * sizeof(PackageIndexEntry));
+		stream.seekp(0);
+		stream.write((char*)&header, sizeof(header));
+
+		const bool success = !stream.fail();
+		stream.close();
+
+		if (!success)
+			LOGERR("Failed to write resource package: \"" + path.toString() + "\".");
+
+		return success;
+	}
+}
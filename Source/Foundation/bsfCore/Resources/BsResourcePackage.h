@@ -0,0 +1,92 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Utility/BsUUID.h"
+
+namespace bs
+{
+	/** @addtogroup Resources-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Read-only archive containing a set of saved resources packed into a single file, along with an index that maps
+	 * resource UUIDs to their location in the file. Once mounted through Resources::mountPackage(), resources in the
+	 * package can be loaded by their UUID without requiring a manifest entry or a separate file per resource.
+	 *
+	 * Each entry is stored in the same format Resources::save() writes to disk, with compression chosen per entry when the
+	 * package is created.
+	 *
+	 * @note	Thread safe. Entries are read using positional reads and multiple entries can be read in parallel.
+	 */
+	class BS_CORE_EXPORT ResourcePackage
+	{
+		/** Location of a single resource within the package file. */
+		struct Entry
+		{
+			UUID uuid;
+			UINT64 offset;
+			UINT64 size;
+		};
+
+		/** Header at the start of every package file. */
+		struct Header
+		{
+			UINT32 magic;
+			UINT32 version;
+			UINT32 numEntries;
+			UINT32 padding;
+			UINT64 indexOffset;
+		};
+
+		struct ConstructPrivately {};
+
+	public:
+		ResourcePackage(const Path& path, const ConstructPrivately& dummy);
+
+		/** Returns the path to the package file. */
+		const Path& getPath() const { return mPath; }
+
+		/** Checks if the package contains a resource with the specified UUID. */
+		bool contains(const UUID& uuid) const;
+
+		/** Returns the number of resources in the package. */
+		UINT32 getNumEntries() const { return (UINT32)mEntries.size(); }
+
+		/**
+		 * Opens the resource with the specified UUID for reading. The returned stream is positioned at the start of the
+		 * saved resource data. Returns null if the package doesn't contain the resource.
+		 */
+		SPtr<DataStream> read(const UUID& uuid) const;
+
+		/** Opens an existing package file. Returns null if the file doesn't exist or isn't a valid package. */
+		static SPtr<ResourcePackage> open(const Path& path);
+
+		/**
+		 * Packs the provided set of saved resources into a new package file.
+		 *
+		 * @param[in]	path		Path to the package file to create. Any existing file will be overwritten.
+		 * @param[in]	resources	UUIDs of the resources to pack, along with paths of the files they were saved to.
+		 * @param[in]	compress	If true, resources that weren't saved with compression will be compressed if it
+		 *							meaningfully reduces their size.
+		 * @return					True if the package was successfully written.
+		 */
+		static bool create(const Path& path, const Vector<std::pair<UUID, Path>>& resources, bool compress);
+
+	private:
+		/** Reads the header and the index from the package file. Returns false if the file isn't a valid package. */
+		bool readIndex();
+
+		static constexpr UINT32 MAGIC = 0x4B505342; // "BSPK"
+		static constexpr UINT32 VERSION = 0;
+
+		Path mPath;
+		SPtr<MappedFileDataStream> mMappedData;
+		SPtr<PositionalFileReader> mFileReader;
+		UnorderedMap<UUID, Entry> mEntries;
+	};
+
+	/** @} */
+}
@@ -3,6 +3,7 @@
 #include "Resources/BsResources.h"
 #include "Resources/BsResource.h"
 #include "Resources/BsResourceManifest.h"
+#include "Resources/BsResourcePackage.h"
 #include "Error/BsException.h"
 #include "Serialization/BsFileSerializer.h"
 #include "FileSystem/BsFileSystem.h"
@@ -21,16 +22,44 @@
 namespace bs
 {
 	Resources::Resources()
+		: mReadQueue("Resource read", 4), mDecompressQueue("Resource decompress")
+		, mDeserializeQueue("Resource deserialize")
 	{
 		{
 			Lock lock(mDefaultManifestMutex);
 			mDefaultResourceManifest = ResourceManifest::create("Default");
 			mResourceManifests.push_back(mDefaultResourceManifest);
 		}
+
+		// Large binary resources are loaded often and benefit most from fast decompression, while small structured
+		// resources compress a lot better with Zstandard
+		if(Compression::isSupported(CompressionMethod::LZ4))
+		{
+			mDefaultCompressionMethod = CompressionMethod::LZ4;
+
+			setCompressionMethod(TID_Texture, CompressionMethod::LZ4);
+			setCompressionMethod(TID_Mesh, CompressionMethod::LZ4);
+			setCompressionMethod(TID_Font, CompressionMethod::LZ4);
+			setCompressionMethod(TID_PhysicsMesh, CompressionMethod::LZ4);
+		}
+
+		if(Compression::isSupported(CompressionMethod::Zstd))
+		{
+			setCompressionMethod(TID_Shader, CompressionMethod::Zstd);
+			setCompressionMethod(TID_ShaderInclude, CompressionMethod::Zstd);
+			setCompressionMethod(TID_Material, CompressionMethod::Zstd);
+			setCompressionMethod(TID_Prefab, CompressionMethod::Zstd);
+			setCompressionMethod(TID_StringTable, CompressionMethod::Zstd);
+		}
 	}
 
 	Resources::~Resources()
 	{
+		// Finish any loads still in the pipeline. Stages are waited on in order, as earlier stages queue work on later ones.
+		mReadQueue.waitUntilEmpty();
+		mDecompressQueue.waitUntilEmpty();
+		mDeserializeQueue.waitUntilEmpty();
+
 		unloadAll();
 	}
 
@@ -49,7 +78,7 @@ namespace bs
 		if (!foundUUID)
 			uuid = UUIDGenerator::generateRandom();
 
-		return loadInternal(uuid, filePath, true, loadFlags).resource;
+		return loadInternal(uuid, filePath, true, loadFlags, false).resource;
 	}
 
 	HResource Resources::load(const WeakResourceHandle<Resource>& handle, ResourceLoadFlags loadFlags)
@@ -76,7 +105,7 @@ namespace bs
 		if (!foundUUID)
 			uuid = UUIDGenerator::generateRandom();
 
-		return loadInternal(uuid, filePath, false, loadFlags).resource;
+		return loadInternal(uuid, filePath, false, loadFlags, false).resource;
 	}
 
 	HResource Resources::loadFromUUID(const UUID& uuid, bool async, ResourceLoadFlags loadFlags)
@@ -84,14 +113,50 @@ namespace bs
 		Path filePath;
 		getFilePathFromUUID(uuid, filePath);
 
-		return loadInternal(uuid, filePath, !async, loadFlags).resource;
+		return loadInternal(uuid, filePath, !async, loadFlags, true).resource;
 	}
 
 	Resources::LoadInfo Resources::loadInternal(const UUID& uuid, const Path& filePath, bool synchronous, 
-		ResourceLoadFlags loadFlags)
+		ResourceLoadFlags loadFlags, bool searchPackages)
 	{
 		LoadInfo output;
 
+		// Resources in mounted packages take priority over paths found in manifests, but not over explicitly provided paths
+		SPtr<ResourcePackage> package;
+		if (searchPackages)
+			package = findPackage(uuid);
+
+		// Determine the dependencies before acquiring any locks, as it might require reading the resource file. Use the
+		// dependencies recorded in the manifest if available, so dependencies of the entire hierarchy can be queued
+		// without having to wait on file reads.
+		SPtr<SavedResourceData> savedResourceData;
+		UINT32 resourceSize = 0;
+		if (package != nullptr || FileSystem::isFile(filePath))
+		{
+			Vector<UUID> cachedDependencies;
+			if (package == nullptr && getCachedDependencies(uuid, filePath, cachedDependencies))
+			{
+				// Only resources that allow async loading have their dependencies recorded
+				savedResourceData = bs_shared_ptr_new<SavedResourceData>(cachedDependencies, true, 0);
+				resourceSize = (UINT32)FileSystem::getFileSize(filePath);
+			}
+			else
+			{
+				SPtr<DataStream> stream;
+				if (package != nullptr)
+					stream = package->read(uuid);
+				else
+					stream = FileSystem::openFile(filePath, true);
+
+				if (stream != nullptr)
+				{
+					FileDecoder fs(stream);
+					savedResourceData = std::static_pointer_cast<SavedResourceData>(fs.decode());
+					resourceSize = fs.getSize();
+				}
+			}
+		}
+
 		// Retrieve/create resource handle, and register with the system
 		bool loadInProgress = false;
 		bool loadFailed = false;
@@ -159,35 +224,28 @@ namespace bs
 			}
 
 			// If we have nowhere to load from, warn and complete load if a file path was provided, otherwise pass through
-			// as we might just want to complete a previously queued load 
-			if (filePath.isEmpty())
+			// as we might just want to complete a previously queued load. Packaged resources don't require a file path.
+			if (package == nullptr)
 			{
-				if (!alreadyLoading)
+				if (filePath.isEmpty())
+				{
+					if (!alreadyLoading)
+					{
+						LOGWRN_VERBOSE("Cannot load resource. Resource with UUID '" + uuid.toString() + "' doesn't exist.");
+						loadFailed = true;
+					}
+				}
+				else if (!FileSystem::isFile(filePath))
 				{
-					LOGWRN_VERBOSE("Cannot load resource. Resource with UUID '" + uuid.toString() + "' doesn't exist.");
+					LOGWRN_VERBOSE("Cannot load resource. Specified file: " + filePath.toString() + " doesn't exist.");
 					loadFailed = true;
 				}
 			}
-			else if (!FileSystem::isFile(filePath))
-			{
-				LOGWRN_VERBOSE("Cannot load resource. Specified file: " + filePath.toString() + " doesn't exist.");
-				loadFailed = true;
-			}
 
 			if(!loadFailed)
 			{
-				// Load dependency data if a file path is provided
-				SPtr<SavedResourceData> savedResourceData;
-				if (!filePath.isEmpty())
-				{
-					// Note: Ideally this data gets cached eventually (e.g. as part of the manifest). When loading objects
-					// with a lot of dependencies (e.g. scenes) this will get called for every dependency, synchronously, 
-					// which might take a while. It would be nice to just read it from a single location. Another option is
-					// to make this whole block asynchronous so every dependency does it on its own thread.
-					FileDecoder fs(filePath);
-					savedResourceData = std::static_pointer_cast<SavedResourceData>(fs.decode());
-					output.size = fs.getSize();
-				}
+				if (package != nullptr || !filePath.isEmpty())
+					output.size = resourceSize;
 
 				// Register an in-progress load unless there is an existing load operation, or the resource is already
 				// loaded
@@ -282,7 +340,7 @@ namespace bs
 					}
 				}
 
-				initiateLoad = !alreadyLoading && !filePath.isEmpty();
+				initiateLoad = !alreadyLoading && (package != nullptr || !filePath.isEmpty());
 
 				if(savedResourceData != nullptr)
 					synchronous = synchronous || !savedResourceData->allowAsyncLoading();
@@ -321,7 +379,7 @@ namespace bs
 				Path depFilePath;
 				getFilePathFromUUID(depUUID, depFilePath);
 
-				LoadInfo loadInfo = loadInternal(depUUID, depFilePath, synchronous, depLoadFlags);
+				LoadInfo loadInfo = loadInternal(depUUID, depFilePath, synchronous, depLoadFlags, true);
 				dependencies[i] = loadInfo.resource;
 
 				// Calculate the size of dependencies that still need to be loaded, for progress reporting
@@ -354,21 +412,17 @@ namespace bs
 		// Actually start the file read operation if not already loaded or in progress
 		if (initiateLoad)
 		{
+			SPtr<ResourceLoadJob> job = bs_shared_ptr_new<ResourceLoadJob>();
+			job->filePath = filePath;
+			job->package = package;
+			job->resource = output.resource;
+			job->loadWithSaveData = loadFlags.isSet(ResourceLoadFlag::KeepSourceData);
+
 			// Synchronous or the resource doesn't support async, read the file immediately
 			if (synchronous)
-			{
-				loadCallback(filePath, output.resource, loadFlags.isSet(ResourceLoadFlag::KeepSourceData));
-			}
-			else // Asynchronous, read the file on a worker thread
-			{
-				String fileName = filePath.getFilename();
-				String taskName = "Resource load: " + fileName;
-
-				bool keepSourceData = loadFlags.isSet(ResourceLoadFlag::KeepSourceData);
-				SPtr<Task> task = Task::create(taskName, 
-					std::bind(&Resources::loadCallback, this, filePath, output.resource, keepSourceData));
-				TaskScheduler::instance().addTask(task);
-			}
+				loadCallback(job);
+			else // Asynchronous, read the file on worker threads
+				queueLoad(job);
 		}
 		else
 		{
@@ -383,14 +437,29 @@ namespace bs
 		return output;
 	}
 
-	SPtr<Resource> Resources::loadFromDiskAndDeserialize(const Path& filePath, bool loadWithSaveData, 
-		std::atomic<float>& progress)
+	bool Resources::readResourceData(ResourceLoadJob& job)
 	{
-		Lock fileLock = FileScheduler::getLock(filePath);
+		const UUID& uuid = job.resource.getUUID();
+
+		// Packages are read-only and support parallel reads, so they don't need to go through the file scheduler
+		Lock fileLock;
+		SPtr<DataStream> stream;
+		if (job.package != nullptr)
+			stream = job.package->read(uuid);
+		else
+		{
+			fileLock = FileScheduler::getLock(job.filePath);
+
+			// Resources kept for saving are read through a regular file stream. Otherwise their data could reference a
+			// memory mapped file, keeping it mapped and preventing it from being overwritten when the resource is saved.
+			if (job.loadWithSaveData && FileSystem::isFile(job.filePath))
+				stream = bs_shared_ptr_new<FileDataStream>(job.filePath);
+			else
+				stream = FileSystem::openFile(job.filePath, true);
+		}
 
-		SPtr<DataStream> stream = FileSystem::openFile(filePath, true);
 		if (stream == nullptr)
-			return nullptr;
+			return false;
 
 		if (stream->size() > std::numeric_limits<UINT32>::max())
 		{
@@ -398,66 +467,115 @@ namespace bs
 				"File size is larger that UINT32 can hold. Ask a programmer to use a bigger data type.");
 		}
 
+		// Read small files in their entirety so the following stages never block on I/O. Larger files are memory mapped
+		// by openFile() already. Resources kept for saving retain the file stream, as do files that failed to map, so
+		// resources that stream their data from the file (e.g. streaming audio clips) don't end up fully in memory.
+		if (stream->isFile() && !job.loadWithSaveData && stream->size() < MappedFileDataStream::MIN_MAPPED_FILE_SIZE)
+		{
+			stream = bs_shared_ptr_new<MemoryDataStream>(stream);
+			stream->seek(0);
+		}
+
 		CoreSerializationContext serzContext;
-		serzContext.flags = loadWithSaveData ? SF_KeepResourceSourceData : 0;
+		serzContext.flags = job.loadWithSaveData ? SF_KeepResourceSourceData : 0;
 
 		// Read meta-data
-		SPtr<SavedResourceData> metaData;
+		if (!stream->eof())
 		{
-			if (!stream->eof())
-			{
-				UINT32 objectSize = 0;
-				stream->read(&objectSize, sizeof(objectSize));
+			UINT32 objectSize = 0;
+			stream->read(&objectSize, sizeof(objectSize));
 
-				BinarySerializer bs;
-				metaData = std::static_pointer_cast<SavedResourceData>(bs.decode(stream, objectSize, &serzContext));
-			}
+			BinarySerializer bs;
+			job.metaData = std::static_pointer_cast<SavedResourceData>(bs.decode(stream, objectSize, &serzContext));
 		}
 
-		// Read resource data
-		SPtr<IReflectable> loadedData;
-		{
-			if(metaData && !stream->eof())
-			{
-				UINT32 objectSize = 0;
-				stream->read(&objectSize, sizeof(objectSize));
+		if (job.metaData == nullptr || stream->eof())
+			return false;
 
-				if (metaData->getCompressionMethod() != 0)
-				{
-					stream = Compression::decompress(stream, [&progress](float val)
-					{
-						progress.exchange(val * 0.9f, std::memory_order_relaxed);
-					});
+		stream->read(&job.objectSize, sizeof(job.objectSize));
+		job.stream = stream;
 
-					BinarySerializer bs;
-					loadedData = bs.decode(stream, objectSize, &serzContext, [&progress](float val)
-					{
-						progress.exchange(0.9f + val * 0.1f, std::memory_order_relaxed);
-					});
-				}
-				else
-				{
-					BinarySerializer bs;
-					loadedData = bs.decode(stream, objectSize, &serzContext, [&progress](float val)
-					{
-						progress.exchange(val, std::memory_order_relaxed);
-					});
-				}
-			}
-		}
+		return true;
+	}
 
-		if (loadedData == nullptr)
+	bool Resources::decompressResourceData(ResourceLoadJob& job)
+	{
+		if (job.metaData->getCompressionMethod() == 0)
+			return true;
+
+		std::atomic<float>& progress = job.loadData->progress;
+
+		auto method = (CompressionMethod)job.metaData->getCompressionMethod();
+		if (!Compression::isSupported(method))
 		{
-			LOGERR("Unable to load resource at path \"" + filePath.toString() + "\"");
+			LOGERR("Resource was saved using compression method " + toString((UINT32)method) + " which isn't "
+				"available in this build. Rebuild with the required compression library, or re-save the resource "
+				"using a different compression method.");
+
+			job.stream = nullptr;
+			return false;
 		}
-		else
+
+		job.stream = Compression::decompress(job.stream, method, [&progress](float val)
+		{
+			progress.exchange(val * 0.9f, std::memory_order_relaxed);
+		});
+
+		return job.stream != nullptr;
+	}
+
+	void Resources::deserializeResourceData(ResourceLoadJob& job)
+	{
+		CoreSerializationContext serzContext;
+		serzContext.flags = job.loadWithSaveData ? SF_KeepResourceSourceData : 0;
+
+		// Decompression, if any, accounts for most of the progress
+		std::atomic<float>& progress = job.loadData->progress;
+		const float progressStart = job.metaData->getCompressionMethod() != 0 ? 0.9f : 0.0f;
+
+		BinarySerializer bs;
+		SPtr<IReflectable> loadedData = bs.decode(job.stream, job.objectSize, &serzContext, 
+			[&progress, progressStart](float val)
+		{
+			progress.exchange(progressStart + val * (1.0f - progressStart), std::memory_order_relaxed);
+		});
+
+		job.stream = nullptr;
+
+		if (loadedData != nullptr)
 		{
 			if (!loadedData->isDerivedFrom(Resource::getRTTIStatic()))
 				BS_EXCEPT(InternalErrorException, "Loaded class doesn't derive from Resource.");
+
+			job.loadedResource = std::static_pointer_cast<Resource>(loadedData);
 		}
+	}
 
-		SPtr<Resource> resource = std::static_pointer_cast<Resource>(loadedData);
-		return resource;
+	void Resources::finishResourceLoad(ResourceLoadJob& job)
+	{
+		if (job.loadedResource == nullptr)
+		{
+			if (job.package != nullptr)
+			{
+				LOGERR("Unable to load resource " + job.resource.getUUID().toString() + " from package \"" + 
+					job.package->getPath().toString() + "\"");
+			}
+			else
+			{
+				LOGERR("Unable to load resource at path \"" + job.filePath.toString() + "\"");
+			}
+		}
+
+		{
+			Lock lock(mInProgressResourcesMutex);
+
+			job.loadData->loadedData = job.loadedResource;
+			job.loadData->remainingDependencies--;
+			job.loadData->progress.exchange(1.0f, std::memory_order_relaxed);
+		}
+
+		job.loadedResource = nullptr;
+		loadComplete(job.resource, true);
 	}
 
 	void Resources::release(ResourceHandleBase& resource)
@@ -658,9 +776,12 @@ namespace bs
 		for (UINT32 i = 0; i < (UINT32)dependencyList.size(); i++)
 			dependencyUUIDs[i] = dependencyList[i].resource.getUUID();
 
-		UINT32 compressionMethod = (compress && resource->isCompressible()) ? 1 : 0;
+		CompressionMethod compressionMethod = CompressionMethod::None;
+		if (compress && resource->isCompressible())
+			compressionMethod = getCompressionMethod(resource->getTypeId());
+
 		SPtr<SavedResourceData> resourceData = bs_shared_ptr_new<SavedResourceData>(dependencyUUIDs, 
-			resource->allowAsyncLoading(), compressionMethod);
+			resource->allowAsyncLoading(), (UINT32)compressionMethod);
 
 		Path parentDir = filePath.getDirectory();
 		if (!FileSystem::exists(parentDir))
@@ -721,10 +842,10 @@ namespace bs
 			UINT8* bytes = ms.encode(resource.get(), numBytes);
 
 			SPtr<MemoryDataStream> objStream = bs_shared_ptr_new<MemoryDataStream>(bytes, numBytes);
-			if (compressionMethod != 0)
+			if (compressionMethod != CompressionMethod::None)
 			{
 				SPtr<DataStream> srcStream = std::static_pointer_cast<DataStream>(objStream);
-				objStream = Compression::compress(srcStream);
+				objStream = Compression::compress(srcStream, compressionMethod);
 			}
 
 			stream.write((char*)&numBytes, sizeof(numBytes));
@@ -739,6 +860,64 @@ namespace bs
 			FileSystem::remove(filePath);
 			FileSystem::move(savePath, filePath);
 		}
+
+		// Record the dependencies in manifests referencing the file, so they can be determined without reading the file
+		// when loading. Resources that don't allow async loading are skipped, as their dependencies are read from the file
+		// along with the async flag.
+		if (resource->allowAsyncLoading())
+		{
+			const UINT64 timestamp = (UINT64)FileSystem::getLastModifiedTime(filePath);
+			Lock lock(mDefaultManifestMutex);
+
+			for (auto& manifest : mResourceManifests)
+			{
+				UUID uuid;
+				if (manifest->filePathToUUID(filePath, uuid))
+					manifest->setDependencies(uuid, dependencyUUIDs, timestamp);
+			}
+		}
+	}
+
+	bool Resources::getCachedDependencies(const UUID& uuid, const Path& filePath, Vector<UUID>& dependencies) const
+	{
+		// Recorded dependencies are only valid for the exact file they were determined from, as the file might have been
+		// overwritten since (e.g. by a re-import)
+		const UINT64 timestamp = (UINT64)FileSystem::getLastModifiedTime(filePath);
+		Lock lock(mDefaultManifestMutex);
+
+		for(auto iter = mResourceManifests.rbegin(); iter != mResourceManifests.rend(); ++iter) 
+		{
+			Path manifestPath;
+			if (!(*iter)->uuidToFilePath(uuid, manifestPath))
+				continue;
+
+			// Only trust the recorded dependencies if the manifest references the file being loaded
+			if (manifestPath != filePath)
+				return false;
+
+			return (*iter)->getDependencies(uuid, timestamp, dependencies);
+		}
+
+		return false;
+	}
+
+	void Resources::setCompressionMethod(UINT32 typeId, CompressionMethod method)
+	{
+		mCompressionMethods[typeId] = method;
+	}
+
+	CompressionMethod Resources::getCompressionMethod(UINT32 typeId) const
+	{
+		CompressionMethod method = mDefaultCompressionMethod;
+
+		auto iterFind = mCompressionMethods.find(typeId);
+		if (iterFind != mCompressionMethods.end())
+			method = iterFind->second;
+
+		if (!Compression::isSupported(method))
+			method = CompressionMethod::Snappy;
+
+		return method;
 	}
 
 	void Resources::update(HResource& handle, const SPtr<Resource>& resource)
@@ -794,6 +973,42 @@ namespace bs
 			mResourceManifests.erase(findIter);
 	}
 
+	void Resources::mountPackage(const SPtr<ResourcePackage>& package)
+	{
+		if (package == nullptr)
+			return;
+
+		Lock lock(mPackagesMutex);
+
+		auto findIter = std::find(mPackages.begin(), mPackages.end(), package);
+		if (findIter != mPackages.end())
+			mPackages.erase(findIter);
+
+		mPackages.push_back(package);
+	}
+
+	void Resources::unmountPackage(const SPtr<ResourcePackage>& package)
+	{
+		Lock lock(mPackagesMutex);
+
+		auto findIter = std::find(mPackages.begin(), mPackages.end(), package);
+		if (findIter != mPackages.end())
+			mPackages.erase(findIter);
+	}
+
+	SPtr<ResourcePackage> Resources::findPackage(const UUID& uuid) const
+	{
+		Lock lock(mPackagesMutex);
+
+		for(auto iter = mPackages.rbegin(); iter != mPackages.rend(); ++iter)
+		{
+			if((*iter)->contains(uuid))
+				return *iter;
+		}
+
+		return nullptr;
+	}
+
 	SPtr<ResourceManifest> Resources::getResourceManifest(const String& name) const
 	{
 		for(auto iter = mResourceManifests.rbegin(); iter != mResourceManifests.rend(); ++iter) 
@@ -1009,25 +1224,75 @@ namespace bs
 		}
 	}
 
-	void Resources::loadCallback(const Path& filePath, HResource& resource, bool loadWithSaveData)
+	void Resources::loadCallback(const SPtr<ResourceLoadJob>& job)
 	{
-		ResourceLoadData* myLoadData;
 		{
 			Lock lock(mInProgressResourcesMutex);
-			myLoadData = mInProgressResources[resource.getUUID()];
+			job->loadData = mInProgressResources[job->resource.getUUID()];
 		}
 
-		SPtr<Resource> rawResource = loadFromDiskAndDeserialize(filePath, loadWithSaveData, myLoadData->progress);
+		if (readResourceData(*job) && decompressResourceData(*job))
+			deserializeResourceData(*job);
 
+		finishResourceLoad(*job);
+	}
+
+	void Resources::queueLoad(const SPtr<ResourceLoadJob>& job)
+	{
 		{
 			Lock lock(mInProgressResourcesMutex);
-
-			myLoadData->loadedData = rawResource;
-			myLoadData->remainingDependencies--;
-			myLoadData->progress.exchange(1.0f, std::memory_order_relaxed);
+			job->loadData = mInProgressResources[job->resource.getUUID()];
 		}
 
-		loadComplete(resource, true);
+		// Each stage is queued separately so I/O of one resource can overlap with processing of others, while limiting
+		// the number of simultaneous reads so they don't compete for the disk
+		mReadQueue.push([this, job]()
+		{
+			if (!readResourceData(*job))
+			{
+				finishResourceLoad(*job);
+				return;
+			}
+
+			auto deserialize = [this, job]()
+			{
+				deserializeResourceData(*job);
+				finishResourceLoad(*job);
+			};
+
+			if (job->metaData->getCompressionMethod() == 0)
+			{
+				mDeserializeQueue.push(deserialize);
+				return;
+			}
+
+			mDecompressQueue.push([this, job, deserialize]()
+			{
+				if (!decompressResourceData(*job))
+				{
+					finishResourceLoad(*job);
+					return;
+				}
+
+				mDeserializeQueue.push(deserialize);
+			});
+		});
+	}
+
+	void Resources::setMaxConcurrentLoads(ResourceLoadStage stage, UINT32 count)
+	{
+		switch (stage)
+		{
+		case ResourceLoadStage::Read:
+			mReadQueue.setMaxConcurrent(count);
+			break;
+		case ResourceLoadStage::Decompress:
+			mDecompressQueue.setMaxConcurrent(count);
+			break;
+		case ResourceLoadStage::Deserialize:
+			mDeserializeQueue.setMaxConcurrent(count);
+			break;
+		}
 	}
 
 	BS_CORE_EXPORT Resources& gResources()
@@ -4,6 +4,8 @@
 
 #include "BsCorePrerequisites.h"
 #include "Utility/BsModule.h"
+#include "Utility/BsCompression.h"
+#include "Threading/BsTaskScheduler.h"
 
 namespace bs
 {
@@ -39,6 +41,17 @@ namespace bs
 	typedef Flags<ResourceLoadFlag> ResourceLoadFlags;
 	BS_FLAGS_OPERATORS(ResourceLoadFlag);
 
+	/** Stages of the asynchronous resource loading pipeline. */
+	enum class ResourceLoadStage
+	{
+		/** Reading the resource file into memory. */
+		Read,
+		/** Decompressing the resource data, if the resource was saved with compression. */
+		Decompress,
+		/** Deserializing the resource object from its data. */
+		Deserialize
+	};
+
 	/**
 	 * Manager for dealing with all engine resources. It allows you to save new resources and load existing ones.
 	 *
@@ -78,6 +91,21 @@ namespace bs
 			std::atomic<float> progress;
 		};
 
+		/** State of a single resource as it passes through the loading pipeline. */
+		struct ResourceLoadJob
+		{
+			Path filePath;
+			SPtr<ResourcePackage> package;
+			HResource resource;
+			bool loadWithSaveData = false;
+			ResourceLoadData* loadData = nullptr;
+
+			SPtr<DataStream> stream;
+			SPtr<SavedResourceData> metaData;
+			UINT32 objectSize = 0;
+			SPtr<Resource> loadedResource;
+		};
+
 		/** Information about an issued resource load. */
 		struct LoadInfo
 		{
@@ -229,6 +257,35 @@ namespace bs
 		BS_SCRIPT_EXPORT()
 		void save(BS_NORREF const HResource& resource, bool compress = false);
 
+		/**
+		 * Sets the compression method used when saving compressed resources of the specified type. If the method isn't
+		 * supported on this platform, Snappy compression is used instead.
+		 *
+		 * @param[in]	typeId		RTTI type ID of the resource type.
+		 * @param[in]	method		Compression method to use for resources of the type.
+		 */
+		void setCompressionMethod(UINT32 typeId, CompressionMethod method);
+
+		/** Sets the compression method used when saving compressed resources of types with no explicitly set method. */
+		void setDefaultCompressionMethod(CompressionMethod method) { mDefaultCompressionMethod = method; }
+
+		/** 
+		 * Returns the compression method that will be used when saving compressed resources of the specified type. 
+		 *
+		 * @see		setCompressionMethod
+		 */
+		CompressionMethod getCompressionMethod(UINT32 typeId) const;
+
+		/**
+		 * Sets the maximum number of asynchronous resource loads that can be processing the specified stage at once. 
+		 * Limiting the number of simultaneous reads avoids disk contention, while decompression and deserialization are
+		 * CPU bound and by default run on as many threads as there are workers. 
+		 *
+		 * @param[in]	stage	Loading stage to limit.
+		 * @param[in]	count	Maximum number of loads in the stage. Zero means the number of available worker threads.
+		 */
+		void setMaxConcurrentLoads(ResourceLoadStage stage, UINT32 count);
+
 		/**
 		 * Updates an existing resource handle with a new resource. Caller must ensure that new resource type matches the 
 		 * original resource type.
@@ -284,6 +341,16 @@ namespace bs
 		BS_SCRIPT_EXPORT()
 		void unregisterResourceManifest(const SPtr<ResourceManifest>& manifest);
 
+		/**
+		 * Mounts a resource package, allowing resources contained within it to be loaded by their UUID. Resources in a
+		 * mounted package take priority over resources referenced by manifests, and packages mounted later take priority
+		 * over ones mounted earlier. Loads from an explicitly provided file path always read the file at that path.
+		 */
+		void mountPackage(const SPtr<ResourcePackage>& package);
+
+		/** Unmounts a resource package previously mounted with mountPackage(). */
+		void unmountPackage(const SPtr<ResourcePackage>& package);
+
 		/**
 		 * Allows you to retrieve resource manifest containing UUID <-> file path mapping that is used when resolving 
 		 * resource references.
@@ -366,17 +433,48 @@ namespace bs
 		 * Starts resource loading or returns an already loaded resource. Both UUID and filePath must match the	same 
 		 * resource, although you may provide an empty path in which case the resource will be retrieved from memory if its
 		 * currently loaded.
+		 *
+		 * If @p searchPackages is true, the resource is loaded from a mounted package containing it instead of the
+		 * provided path. Should be false when the caller explicitly provided the path to load from.
 		 */
-		LoadInfo loadInternal(const UUID& UUID, const Path& filePath, bool synchronous, ResourceLoadFlags loadFlags);
+		LoadInfo loadInternal(const UUID& UUID, const Path& filePath, bool synchronous, ResourceLoadFlags loadFlags,
+			bool searchPackages);
 
-		/** Performs actually reading and deserializing of the resource file. Called from various worker threads. */
-		SPtr<Resource> loadFromDiskAndDeserialize(const Path& filePath, bool loadWithSaveData, std::atomic<float>& progress);
+		/** 
+		 * Reads the resource file (or package entry) into memory and decodes its meta-data. Returns false if the data 
+		 * couldn't be read. Called from various worker threads. 
+		 */
+		bool readResourceData(ResourceLoadJob& job);
+
+		/** 
+		 * Decompresses the resource data read by readResourceData(), if it was saved with compression. Returns false if
+		 * decompression failed. Called from various worker threads. 
+		 */
+		bool decompressResourceData(ResourceLoadJob& job);
+
+		/** Deserializes the resource object from its data. Called from various worker threads. */
+		void deserializeResourceData(ResourceLoadJob& job);
+
+		/** Assigns the deserialized resource (if any) to its load data, and notifies that the resource was loaded. */
+		void finishResourceLoad(ResourceLoadJob& job);
 
 		/**	Triggered when individual resource has finished loading. */
 		void loadComplete(HResource& resource, bool notifyProgress);
 
-		/**	Callback triggered when the task manager is ready to process the loading task. */
-		void loadCallback(const Path& filePath, HResource& resource, bool loadWithSaveData);
+		/**	Performs all the loading stages for a resource immediately, on the calling thread. */
+		void loadCallback(const SPtr<ResourceLoadJob>& job);
+
+		/** Queues the resource on the asynchronous loading pipeline, performing each stage on worker threads. */
+		void queueLoad(const SPtr<ResourceLoadJob>& job);
+
+		/** 
+		 * Retrieves the resource dependencies recorded in the manifest referencing the provided UUID. Returns false if no
+		 * dependencies are recorded or if the manifest doesn't reference the provided file path.
+		 */
+		bool getCachedDependencies(const UUID& uuid, const Path& filePath, Vector<UUID>& dependencies) const;
+
+		/** Returns the most recently mounted package containing the resource with the specified UUID, if any. */
+		SPtr<ResourcePackage> findPackage(const UUID& uuid) const;
 
 		/**	Destroys a resource, freeing its memory. */
 		void destroy(ResourceHandleBase& resource);
@@ -384,16 +482,25 @@ namespace bs
 	private:
 		Vector<SPtr<ResourceManifest>> mResourceManifests;
 		SPtr<ResourceManifest> mDefaultResourceManifest;
+		Vector<SPtr<ResourcePackage>> mPackages;
+		UnorderedMap<UINT32, CompressionMethod> mCompressionMethods;
+		CompressionMethod mDefaultCompressionMethod = CompressionMethod::Snappy;
 
 		Mutex mInProgressResourcesMutex;
 		Mutex mLoadedResourceMutex;
-		Mutex mDefaultManifestMutex;
+		mutable Mutex mDefaultManifestMutex;
+		mutable Mutex mPackagesMutex;
 		RecursiveMutex mDestroyMutex;
 
 		UnorderedMap<UUID, WeakResourceHandle<Resource>> mHandles;
 		UnorderedMap<UUID, LoadedResourceData> mLoadedResources;
 		UnorderedMap<UUID, ResourceLoadData*> mInProgressResources; // Resources that are being asynchronously loaded
 		UnorderedMap<UUID, Vector<ResourceLoadData*>> mDependantLoads; // Allows dependency to be notified when a dependant is loaded
+
+		// Asynchronous loading pipeline, declared last so any queued loads finish before other members are destroyed
+		BoundedTaskQueue mReadQueue;
+		BoundedTaskQueue mDecompressQueue;
+		BoundedTaskQueue mDeserializeQueue;
 	};
 
 	/** Provides easier access to Resources manager. */
@@ -20,7 +20,16 @@ namespace bs
 		 * Note that this flag must be specified on component creation, in its constructor and any later changes
 		 * to the flag could be ignored.
 		 */
-		AlwaysRun = 1 
+		AlwaysRun = 1,
+
+		/**
+		 * Signals that update() and fixedUpdate() of this component type are safe to call concurrently with other
+		 * components of the same type, allowing the scene manager to update them in parallel on the task scheduler.
+		 * Such components must not create, destroy, activate or deactivate scene objects or components from those
+		 * methods, and must not touch state shared with other components without synchronization. Off by default. Like
+		 * AlwaysRun, this flag should be set in the component's constructor.
+		 */
+		ParallelUpdate = 1 << 1
 	};
 
 	typedef Flags<ComponentFlag> ComponentFlags;
@@ -115,6 +124,7 @@ namespace bs
 		friend class SceneManager;
 		friend class SceneObject;
 		friend class SceneObjectRTTI;
+		friend class PrefabPool;
 
 		Component(HSceneObject parent);
 		virtual ~Component() = default;
@@ -144,6 +154,19 @@ namespace bs
 		 */
 		virtual void onEnabled() {}
 
+		/**
+		 * Called when the component's scene object is taken out of a PrefabPool, including the first time it is spawned.
+		 * Called after the component is enabled. Pooled objects are not destroyed and re-created between uses, so this is
+		 * where any per-instance state should be reset.
+		 */
+		virtual void onSpawned() {}
+
+		/**
+		 * Called when the component's scene object is returned to a PrefabPool, just before it is deactivated. The
+		 * component is not destroyed, and will receive onSpawned() when it is reused.
+		 */
+		virtual void onDespawned() {}
+
 		/** 
 		 * Called when the component's parent scene object has changed. Not called if the component is in Stopped state. 
 		 * Also only called if necessary notify flags are set via _setNotifyFlags().
@@ -159,6 +182,17 @@ namespace bs
 		/** Checks if the component has a certain flag enabled. */
 		bool hasFlag(ComponentFlag flag) const { return mFlags.isSet(flag); }
 
+		/**
+		 * Sets the order in which the component gets updated, relative to other components. Components with a lower
+		 * order get their update() and fixedUpdate() methods called first. Components with the same order are updated
+		 * grouped by type. Default order is 0. Should be set in the component's constructor, changes made afterwards only
+		 * apply once the component is re-activated.
+		 */
+		void setUpdateOrder(INT32 order) { mUpdateOrder = order; }
+
+		/** Returns the order in which the component gets updated. See setUpdateOrder(). */
+		INT32 getUpdateOrder() const { return mUpdateOrder; }
+
 		/** Sets an index that uniquely identifies a component with the SceneManager. */
 		void setSceneManagerId(UINT32 id) { mSceneManagerId = id; }
 
@@ -183,6 +217,7 @@ namespace bs
 		TransformChangedFlags mNotifyFlags = TCF_None;
 		ComponentFlags mFlags;
 		UINT32 mSceneManagerId = 0;
+		INT32 mUpdateOrder = 0;
 
 	private:
 		HSceneObject mParent;
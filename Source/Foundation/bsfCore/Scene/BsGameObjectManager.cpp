@@ -8,15 +8,21 @@ namespace bs
 	GameObjectManager::~GameObjectManager()
 	{
 		destroyQueuedObjects();
+
+		for (auto& page : mPages)
+		{
+			if (page != nullptr)
+				bs_delete(page);
+		}
 	}
 
 	GameObjectHandleBase GameObjectManager::getObject(UINT64 id) const
 	{
 		Lock lock(mMutex);
 
-		const auto iterFind = mObjects.find(id);
-		if (iterFind != mObjects.end())
-			return iterFind->second;
+		const SPtr<GameObjectHandleData>* slot = findSlot(id);
+		if (slot != nullptr)
+			return GameObjectHandleBase(*slot);
 
 		return nullptr;
 	}
@@ -25,10 +31,10 @@ namespace bs
 	{
 		Lock lock(mMutex);
 
-		const auto iterFind = mObjects.find(id);
-		if (iterFind != mObjects.end())
+		const SPtr<GameObjectHandleData>* slot = findSlot(id);
+		if (slot != nullptr)
 		{
-			object = iterFind->second;
+			object = GameObjectHandleBase(*slot);
 			return true;
 		}
 
@@ -39,7 +45,7 @@ namespace bs
 	{
 		Lock lock(mMutex);
 
-		return mObjects.find(id) != mObjects.end();
+		return findSlot(id) != nullptr;
 	}
 
 	void GameObjectManager::remapId(UINT64 oldId, UINT64 newId)
@@ -48,8 +54,14 @@ namespace bs
 			return;
 
 		Lock lock(mMutex);
-		mObjects[newId] = mObjects[oldId];
-		mObjects.erase(oldId);
+
+		const SPtr<GameObjectHandleData>* slot = findSlot(oldId);
+		if (slot == nullptr)
+			return;
+
+		SPtr<GameObjectHandleData> data = *slot;
+		clearSlot(oldId);
+		setSlot(newId, data);
 	}
 
 	UINT64 GameObjectManager::reserveId()
@@ -63,15 +75,56 @@ namespace bs
 			return;
 
 		const UINT64 instanceId = object->getInstanceId();
-		mQueuedForDestroy[instanceId] = object;
+		mQueuedForDestroy.push_back(std::make_pair(instanceId, object));
 	}
 
 	void GameObjectManager::destroyQueuedObjects()
 	{
-		for (auto& objPair : mQueuedForDestroy)
-			objPair.second->destroyInternal(objPair.second, true);
+		// Destroying an object can queue more objects for destruction (e.g. from component callbacks), so keep going until
+		// the queue stays empty. Work on a local copy so the queue isn't modified while it's being iterated over.
+		Vector<std::pair<UINT64, GameObjectHandleBase>> queuedForDestroy;
+		while (!mQueuedForDestroy.empty())
+		{
+			std::swap(queuedForDestroy, mQueuedForDestroy);
+
+			// Destroy in order of creation, and only once per object even if queued multiple times
+			std::stable_sort(queuedForDestroy.begin(), queuedForDestroy.end(),
+				[](const std::pair<UINT64, GameObjectHandleBase>& a, const std::pair<UINT64, GameObjectHandleBase>& b)
+			{
+				return a.first < b.first;
+			});
+
+			UINT64 lastId = 0;
+			for (auto& entry : queuedForDestroy)
+			{
+				if (entry.first == lastId)
+					continue;
+
+				lastId = entry.first;
 
-		mQueuedForDestroy.clear();
+				// Might have been destroyed by an earlier entry (e.g. a parent destroying its children)
+				if (entry.second.isDestroyed())
+					continue;
+
+				entry.second->destroyInternal(entry.second, true);
+			}
+
+			queuedForDestroy.clear();
+		}
+	}
+
+	UINT32 GameObjectManager::_getNumAllocatedPages() const
+	{
+		Lock lock(mMutex);
+
+		UINT32 numPages = 0;
+		for (auto& page : mPages)
+		{
+			if (page != nullptr)
+				numPages++;
+		}
+
+		return numPages;
 	}
 
 	GameObjectHandleBase GameObjectManager::registerObject(const SPtr<GameObject>& object)
@@ -82,7 +135,7 @@ namespace bs
 		GameObjectHandleBase handle(object);
 		{
 			Lock lock(mMutex);
-			mObjects[id] = handle;
+			setSlot(id, handle.mData);
 		}
 
 		return handle;
@@ -92,13 +145,95 @@ namespace bs
 	{
 		{
 			Lock lock(mMutex);
-			mObjects.erase(object->getInstanceId());
+			clearSlot(object->getInstanceId());
 		}
 
 		onDestroyed(static_object_cast<GameObject>(object));
 		object.destroy();
 	}
 
+	const SPtr<GameObjectHandleData>* GameObjectManager::findSlot(UINT64 id) const
+	{
+		const UINT64 pageIdx = id / OBJECTS_PER_PAGE;
+		if (pageIdx < mFirstPageIdx || pageIdx - mFirstPageIdx >= mPages.size())
+			return nullptr;
+
+		const ObjectPage* page = mPages[(size_t)(pageIdx - mFirstPageIdx)];
+		if (page == nullptr)
+			return nullptr;
+
+		const SPtr<GameObjectHandleData>& slot = page->slots[id % OBJECTS_PER_PAGE];
+		if (slot == nullptr)
+			return nullptr;
+
+		return &slot;
+	}
+
+	void GameObjectManager::setSlot(UINT64 id, const SPtr<GameObjectHandleData>& data)
+	{
+		const UINT64 pageIdx = id / OBJECTS_PER_PAGE;
+		if (mPages.empty())
+			mFirstPageIdx = pageIdx;
+		else if (pageIdx < mFirstPageIdx)
+		{
+			mPages.insert(mPages.begin(), (size_t)(mFirstPageIdx - pageIdx), nullptr);
+			mFirstPageIdx = pageIdx;
+		}
+
+		if (pageIdx - mFirstPageIdx >= mPages.size())
+			mPages.resize((size_t)(pageIdx - mFirstPageIdx + 1), nullptr);
+
+		ObjectPage*& page = mPages[(size_t)(pageIdx - mFirstPageIdx)];
+		if (page == nullptr)
+			page = bs_new<ObjectPage>();
+
+		SPtr<GameObjectHandleData>& slot = page->slots[id % OBJECTS_PER_PAGE];
+		if (slot == nullptr)
+			page->numUsed++;
+
+		slot = data;
+	}
+
+	void GameObjectManager::clearSlot(UINT64 id)
+	{
+		const UINT64 pageIdx = id / OBJECTS_PER_PAGE;
+		if (pageIdx < mFirstPageIdx || pageIdx - mFirstPageIdx >= mPages.size())
+			return;
+
+		ObjectPage*& page = mPages[(size_t)(pageIdx - mFirstPageIdx)];
+		if (page == nullptr)
+			return;
+
+		SPtr<GameObjectHandleData>& slot = page->slots[id % OBJECTS_PER_PAGE];
+		if (slot == nullptr)
+			return;
+
+		slot = nullptr;
+		page->numUsed--;
+
+		// Keep the page IDs are currently being allocated from, as it will be filled up again shortly
+		const UINT64 activePageIdx = mNextAvailableID.load(std::memory_order_relaxed) / OBJECTS_PER_PAGE;
+		if (page->numUsed == 0 && pageIdx != activePageIdx)
+		{
+			bs_delete(page);
+			page = nullptr;
+
+			trimPages();
+		}
+	}
+
+	void GameObjectManager::trimPages()
+	{
+		while (!mPages.empty() && mPages.front() == nullptr)
+		{
+			mPages.pop_front();
+			mFirstPageIdx++;
+		}
+
+		while (!mPages.empty() && mPages.back() == nullptr)
+			mPages.pop_back();
+	}
+
 	GameObjectDeserializationState::GameObjectDeserializationState(UINT32 options)
 		:mOptions(options)
 	{ }
@@ -226,6 +361,14 @@ namespace bs
 		mDeserializedObjects[newId] = object;
 	}
 
+	void GameObjectDeserializationState::reserve(UINT32 numObjects, UINT32 numHandles)
+	{
+		mIdMapping.reserve(numObjects);
+		mDeserializedObjects.reserve(numObjects);
+		mUnresolvedHandleData.reserve(numObjects);
+		mUnresolvedHandles.reserve(numHandles);
+	}
+
 	void GameObjectDeserializationState::registerOnDeserializationEndCallback(std::function<void()> callback)
 	{
 		mEndCallbacks.push_back(callback);
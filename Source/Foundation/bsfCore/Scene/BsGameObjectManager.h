@@ -107,10 +107,45 @@ namespace bs
 		/**	Triggered when a game object is being destroyed. */
 		Event<void(const HGameObject&)> onDestroyed;
 
+		/** @name Internal
+		 *  @{
+		 */
+
+		/** Returns the number of pages currently allocated for storing object handles. */
+		UINT32 _getNumAllocatedPages() const;
+
+		/** @} */
+
 	private:
+		/** Number of consecutive IDs stored in a single page of the object table. */
+		static constexpr UINT32 OBJECTS_PER_PAGE = 1024;
+
+		/**
+		 * Block of slots for consecutive object IDs. Pages are released once all of their objects are unregistered, so
+		 * the table only grows with the range of IDs that are alive, not with the total number of objects ever created.
+		 */
+		struct ObjectPage
+		{
+			SPtr<GameObjectHandleData> slots[OBJECTS_PER_PAGE];
+			UINT32 numUsed = 0;
+		};
+
+		/** Returns the handle data stored for the specified ID, or null if none. Caller must hold the mutex. */
+		const SPtr<GameObjectHandleData>* findSlot(UINT64 id) const;
+
+		/** Stores the handle data for the specified ID, allocating a page if needed. Caller must hold the mutex. */
+		void setSlot(UINT64 id, const SPtr<GameObjectHandleData>& data);
+
+		/** Clears the handle data for the specified ID, releasing its page if empty. Caller must hold the mutex. */
+		void clearSlot(UINT64 id);
+
+		/** Releases empty entries at the start and the end of the page table. Caller must hold the mutex. */
+		void trimPages();
+
 		std::atomic<UINT64> mNextAvailableID = { 1 } ; // 0 is not a valid ID
-		Map<UINT64, GameObjectHandleBase> mObjects;
-		Map<UINT64, GameObjectHandleBase> mQueuedForDestroy;
+		Deque<ObjectPage*> mPages;
+		UINT64 mFirstPageIdx = 0; // Index of the page stored at the start of mPages
+		Vector<std::pair<UINT64, GameObjectHandleBase>> mQueuedForDestroy;
 
 		mutable Mutex mMutex;
 	};
@@ -142,6 +177,12 @@ namespace bs
 		/** Notifies the system about a new deserialized game object and its original ID. */
 		void registerObject(UINT64 originalId, GameObjectHandleBase& object);
 
+		/**
+		 * Pre-allocates internal tables for the specified number of deserialized objects and handles, avoiding
+		 * reallocations when the size of the hierarchy is known in advance.
+		 */
+		void reserve(UINT32 numObjects, UINT32 numHandles);
+
 		/**	Registers a callback that will be triggered when GameObject serialization ends. */
 		void registerOnDeserializationEndCallback(std::function<void()> callback);
 
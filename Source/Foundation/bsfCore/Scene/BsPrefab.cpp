@@ -17,6 +17,8 @@ namespace bs
 
 	Prefab::~Prefab()
 	{
+		clearInstanceTemplate();
+
 		if (mRoot != nullptr)
 			mRoot->destroy(true);
 	}
@@ -72,6 +74,8 @@ namespace bs
 		}
 
 		// Clone the hierarchy for internal storage
+		clearInstanceTemplate();
+
 		if (mRoot != nullptr)
 			mRoot->destroy(true);
 
@@ -140,6 +144,7 @@ namespace bs
 		{
 			// Update any child prefab instances in case their prefabs changed
 			_updateChildInstances();
+			clearInstanceTemplate();
 		}
 #endif
 
@@ -154,10 +159,47 @@ namespace bs
 		if (mRoot == nullptr)
 			return HSceneObject();
 
+		updateInstanceTemplate();
+
+		return SceneObject::decodeHierarchy(mInstanceTemplate.data, mInstanceTemplate.size, preserveUUIDs,
+			mInstanceTemplate.numObjects);
+	}
+
+	void Prefab::updateInstanceTemplate() const
+	{
+		if (mInstanceTemplate.data != nullptr && mInstanceTemplate.hash == mHash)
+			return;
+
+		clearInstanceTemplate();
+
 		mRoot->mPrefabHash = mHash;
 		mRoot->mLinkId = -1;
 
-		return mRoot->clone(false, preserveUUIDs);
+		mInstanceTemplate.data = mRoot->encodeHierarchy(false, mInstanceTemplate.size);
+		mInstanceTemplate.hash = mHash;
+
+		Stack<HSceneObject> todo;
+		todo.push(mRoot);
+
+		while (!todo.empty())
+		{
+			HSceneObject current = todo.top();
+			todo.pop();
+
+			mInstanceTemplate.numObjects += 1 + (UINT32)current->getComponents().size();
+
+			UINT32 numChildren = current->getNumChildren();
+			for (UINT32 i = 0; i < numChildren; i++)
+				todo.push(current->getChild(i));
+		}
+	}
+
+	void Prefab::clearInstanceTemplate() const
+	{
+		if (mInstanceTemplate.data != nullptr)
+			bs_free(mInstanceTemplate.data);
+
+		mInstanceTemplate = InstanceTemplate();
 	}
 
 	RTTITypeBase* Prefab::getRTTIStatic()
@@ -18,6 +18,18 @@ namespace bs
 	 */
 	class BS_CORE_EXPORT Prefab : public Resource
 	{
+		/**
+		 * Serialized copy of the prefab hierarchy that instances are decoded from, so the hierarchy doesn't need to be
+		 * serialized again for every instantiation.
+		 */
+		struct InstanceTemplate
+		{
+			UINT8* data = nullptr;
+			UINT32 size = 0;
+			UINT32 numObjects = 0;
+			UINT32 hash = 0;
+		};
+
 	public:
 		Prefab();
 		~Prefab();
@@ -108,11 +120,19 @@ namespace bs
 		/**	Creates an empty and uninitialized prefab. */
 		static SPtr<Prefab> createEmpty();
 
+		/** Serializes the prefab hierarchy into the instance template, unless the template is already up to date. */
+		void updateInstanceTemplate() const;
+
+		/** Releases the instance template, forcing it to be rebuilt on next instantiation. */
+		void clearInstanceTemplate() const;
+
 		HSceneObject mRoot;
 		UINT32 mHash = 0;
 		UUID mUUID;
 		bool mIsScene = true;
 
+		mutable InstanceTemplate mInstanceTemplate;
+
 		/************************************************************************/
 		/* 								RTTI		                     		*/
 		/************************************************************************/
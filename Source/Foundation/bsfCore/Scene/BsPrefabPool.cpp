@@ -0,0 +1,153 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Scene/BsPrefabPool.h"
+#include "Scene/BsPrefab.h"
+#include "Scene/BsSceneObject.h"
+#include "Scene/BsSceneManager.h"
+#include "Scene/BsComponent.h"
+#include "Debug/BsDebug.h"
+
+namespace bs
+{
+	/** Flags of the object parked instances are parented to. */
+	static constexpr UINT32 PARKING_FLAGS = SOF_Internal | SOF_Persistent | SOF_DontSave;
+
+	PrefabPool::PrefabPool(const HPrefab& prefab, UINT32 initialSize)
+		:mPrefab(prefab)
+	{
+		// Parked instances are deactivated and kept under an inactive object, so their components don't receive updates
+		mParkingRoot = SceneObject::create("PrefabPool", PARKING_FLAGS);
+		mParkingRoot->setActive(false);
+
+		reserve(initialSize);
+	}
+
+	PrefabPool::~PrefabPool()
+	{
+		clear();
+
+		if (!mParkingRoot.isDestroyed())
+			mParkingRoot->destroy();
+	}
+
+	HSceneObject PrefabPool::spawn(const Vector3& position, const Quaternion& rotation, const HSceneObject& parent)
+	{
+		HSceneObject instance;
+		while (!mParked.empty())
+		{
+			instance = mParked.back();
+			mParked.pop_back();
+
+			// Parked instances can get destroyed externally, e.g. when the scene is cleared
+			if (!instance.isDestroyed(true))
+				break;
+
+			instance = nullptr;
+		}
+
+		if (instance == nullptr)
+		{
+			if (!mPrefab.isLoaded(false))
+			{
+				LOGWRN("Cannot spawn an instance from a prefab pool as the prefab isn't loaded.");
+				return HSceneObject();
+			}
+
+			instance = mPrefab->instantiate();
+		}
+
+		// Parking root's flags are inherited by the parked instances, but shouldn't apply to the spawned ones. The new
+		// parent's flags are inherited when re-parenting.
+		instance->_unsetFlags(PARKING_FLAGS);
+
+		if (parent != nullptr)
+			instance->setParent(parent, false);
+		else
+			instance->setParent(gSceneManager().getMainScene()->getRoot(), false);
+
+		// Re-parenting doesn't change the active state, so it needs to be restored explicitly
+		instance->setActive(true);
+
+		instance->setPosition(position);
+		instance->setRotation(rotation);
+
+		notifyComponents(instance, true);
+		return instance;
+	}
+
+	void PrefabPool::despawn(const HSceneObject& instance)
+	{
+		if (instance.isDestroyed(true))
+			return;
+
+		if (instance->getPrefabLink(true) != mPrefab.getUUID())
+		{
+			LOGWRN("Object despawned into a prefab pool wasn't instantiated from the pool's prefab. Destroying it instead.");
+			instance->destroy();
+			return;
+		}
+
+		notifyComponents(instance, false);
+
+		instance->setParent(mParkingRoot, false);
+		instance->setActive(false);
+		mParked.push_back(instance);
+	}
+
+	void PrefabPool::reserve(UINT32 count)
+	{
+		if (count <= (UINT32)mParked.size())
+			return;
+
+		if (!mPrefab.isLoaded(false))
+		{
+			LOGWRN("Cannot reserve instances in a prefab pool as the prefab isn't loaded.");
+			return;
+		}
+
+		mParked.reserve(count);
+		while ((UINT32)mParked.size() < count)
+		{
+			HSceneObject instance = mPrefab->instantiate();
+			instance->setParent(mParkingRoot, false);
+			instance->setActive(false);
+
+			mParked.push_back(instance);
+		}
+	}
+
+	void PrefabPool::clear()
+	{
+		for (auto& instance : mParked)
+		{
+			if (!instance.isDestroyed(true))
+				instance->destroy();
+		}
+
+		mParked.clear();
+	}
+
+	void PrefabPool::notifyComponents(const HSceneObject& root, bool spawned)
+	{
+		Stack<HSceneObject> todo;
+		todo.push(root);
+
+		while (!todo.empty())
+		{
+			HSceneObject current = todo.top();
+			todo.pop();
+
+			for (auto& component : current->getComponents())
+			{
+				if (spawned)
+					component->onSpawned();
+				else
+					component->onDespawned();
+			}
+
+			UINT32 numChildren = current->getNumChildren();
+			for (UINT32 i = 0; i < numChildren; i++)
+				todo.push(current->getChild(i));
+		}
+	}
+}
@@ -0,0 +1,79 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Math/BsVector3.h"
+#include "Math/BsQuaternion.h"
+
+namespace bs
+{
+	/** @addtogroup Scene
+	 *  @{
+	 */
+
+	/**
+	 * Keeps instances of a prefab around for reuse. Instead of destroying instances that are no longer needed they are
+	 * deactivated and parked in the pool, and reactivated when a new instance is requested. This avoids the cost of
+	 * instantiation, game object registration and component creation and destruction for objects that are frequently
+	 * spawned and despawned, such as projectiles.
+	 *
+	 * Components of pooled objects don't receive onInitialized() and onDestroyed() calls when they are reused. Instead
+	 * Component::onSpawned() and Component::onDespawned() are called, where components should reset any per-instance
+	 * state.
+	 *
+	 * @note	Sim thread only.
+	 */
+	class BS_CORE_EXPORT PrefabPool
+	{
+	public:
+		/**
+		 * Creates a new pool for instances of the provided prefab.
+		 *
+		 * @param[in]	prefab		Prefab to instantiate. Must be loaded.
+		 * @param[in]	initialSize	Number of instances to instantiate and park right away.
+		 */
+		PrefabPool(const HPrefab& prefab, UINT32 initialSize = 0);
+		~PrefabPool();
+
+		/**
+		 * Returns an instance of the prefab. A parked instance will be reused if available, otherwise a new one is
+		 * instantiated.
+		 *
+		 * @param[in]	position	Position of the instance, relative to its parent.
+		 * @param[in]	rotation	Rotation of the instance, relative to its parent.
+		 * @param[in]	parent		Object to parent the instance to. If null the instance is placed at the scene root.
+		 * @return					Active instance of the prefab.
+		 */
+		HSceneObject spawn(const Vector3& position = Vector3::ZERO, const Quaternion& rotation = Quaternion::IDENTITY,
+			const HSceneObject& parent = HSceneObject());
+
+		/**
+		 * Deactivates the provided instance and parks it in the pool for reuse. The instance must have been returned by
+		 * spawn() on this pool, otherwise it will be destroyed instead.
+		 */
+		void despawn(const HSceneObject& instance);
+
+		/** Makes sure at least @p count instances are parked in the pool, instantiating new ones if needed. */
+		void reserve(UINT32 count);
+
+		/** Destroys all parked instances. Instances that are currently spawned are not affected. */
+		void clear();
+
+		/** Returns the number of instances parked in the pool and ready to be reused. */
+		UINT32 getNumParked() const { return (UINT32)mParked.size(); }
+
+		/** Returns the prefab the pool is instantiating. */
+		const HPrefab& getPrefab() const { return mPrefab; }
+
+	private:
+		/** Triggers Component::onSpawned() or Component::onDespawned() on all components in the hierarchy. */
+		static void notifyComponents(const HSceneObject& root, bool spawned);
+
+		HPrefab mPrefab;
+		HSceneObject mParkingRoot;
+		Vector<HSceneObject> mParked;
+	};
+
+	/** @} */
+}
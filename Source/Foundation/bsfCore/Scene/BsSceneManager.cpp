@@ -13,6 +13,8 @@
 #include "Scene/BsSceneActor.h"
 #include "Scene/BsPrefab.h"
 #include "Physics/BsPhysics.h"
+#include "Profiling/BsProfilerCPU.h"
+#include "Threading/BsTaskScheduler.h"
 
 namespace bs
 {
@@ -439,6 +441,9 @@ namespace bs
 		list.push_back(component);
 
 		component->setSceneManagerId(encodeComponentId(idx, listType));
+
+		if(listType == ActiveList)
+			mUpdateBucketsDirty = true;
 	}
 
 	void SceneManager::removeFromStateList(const HComponent& component)
@@ -452,6 +457,9 @@ namespace bs
 
 		Vector<HComponent>& list = *mComponentsPerState[listType - 1];
 
+		if(listType == ActiveList)
+			mUpdateBucketsDirty = true;
+
 		UINT32 lastIdx;
 		decodeComponentId(list.back()->getSceneManagerId(), lastIdx, listType);
 
@@ -534,16 +542,135 @@ namespace bs
 		return component->getRTTI()->getRTTIId() == rttiId;
 	}
 
+	void SceneManager::updateBuckets()
+	{
+		if(!mUpdateBucketsDirty)
+			return;
+
+		struct SortEntry
+		{
+			INT32 updateOrder;
+			UINT32 rttiId;
+			bool parallel;
+			UINT32 idx;
+		};
+
+		const auto numComponents = (UINT32)mActiveComponents.size();
+
+		Vector<SortEntry> entries;
+		entries.reserve(numComponents);
+
+		for(UINT32 i = 0; i < numComponents; i++)
+		{
+			const HComponent& component = mActiveComponents[i];
+
+			SortEntry entry;
+			entry.updateOrder = component->getUpdateOrder();
+			entry.rttiId = component->getRTTI()->getRTTIId();
+			entry.parallel = component->hasFlag(ComponentFlag::ParallelUpdate);
+			entry.idx = i;
+
+			entries.push_back(entry);
+		}
+
+		// Stable sort so components within a bucket keep the order in which they were activated
+		std::stable_sort(entries.begin(), entries.end(), [](const SortEntry& a, const SortEntry& b)
+		{
+			if(a.updateOrder != b.updateOrder)
+				return a.updateOrder < b.updateOrder;
+
+			if(a.rttiId != b.rttiId)
+				return a.rttiId < b.rttiId;
+
+			return a.parallel < b.parallel;
+		});
+
+		mUpdateBuckets.clear();
+		for(auto& entry : entries)
+		{
+			const HComponent& component = mActiveComponents[entry.idx];
+
+			const bool newBucket = mUpdateBuckets.empty() || 
+				mUpdateBuckets.back().updateOrder != entry.updateOrder ||
+				mUpdateBuckets.back().rttiId != entry.rttiId ||
+				mUpdateBuckets.back().parallel != entry.parallel;
+
+			if(newBucket)
+			{
+				mUpdateBuckets.push_back(ComponentUpdateBucket());
+
+				ComponentUpdateBucket& bucket = mUpdateBuckets.back();
+				bucket.updateOrder = entry.updateOrder;
+				bucket.rttiId = entry.rttiId;
+				bucket.parallel = entry.parallel;
+				bucket.name = "Update: " + component->getRTTI()->getRTTIName();
+			}
+
+			mUpdateBuckets.back().components.push_back(component);
+		}
+
+		mUpdateBucketsDirty = false;
+	}
+
+	void SceneManager::runBuckets(bool fixed)
+	{
+		// Number of components processed by a single task when updating in parallel
+		static constexpr UINT32 PARALLEL_BATCH_SIZE = 64;
+
+		for(auto& bucket : mUpdateBuckets)
+		{
+			gProfilerCPU().beginSample(bucket.name.c_str());
+
+			const auto numComponents = (UINT32)bucket.components.size();
+			if(bucket.parallel && numComponents > PARALLEL_BATCH_SIZE)
+			{
+				const UINT32 numBatches = Math::divideAndRoundUp(numComponents, PARALLEL_BATCH_SIZE);
+
+				Vector<HComponent>& components = bucket.components;
+				SPtr<TaskGroup> taskGroup = TaskGroup::create("ComponentUpdate", 
+					[&components, numComponents, fixed](UINT32 batchIdx)
+				{
+					const UINT32 start = batchIdx * PARALLEL_BATCH_SIZE;
+					const UINT32 end = std::min(start + PARALLEL_BATCH_SIZE, numComponents);
+
+					for(UINT32 i = start; i < end; i++)
+					{
+						if(fixed)
+							components[i]->fixedUpdate();
+						else
+							components[i]->update();
+					}
+				}, numBatches);
+
+				TaskScheduler::instance().addTaskGroup(taskGroup);
+				taskGroup->wait();
+			}
+			else
+			{
+				for(auto& entry : bucket.components)
+				{
+					// Component could have been immediately destroyed by an update of another component
+					if(entry.isDestroyed(false))
+						continue;
+
+					if(fixed)
+						entry->fixedUpdate();
+					else
+						entry->update();
+				}
+			}
+
+			gProfilerCPU().endSample(bucket.name.c_str());
+		}
+	}
+
 	void SceneManager::_update()
 	{
 		processStateChanges();
-
-		// Note: Eventually perform updates based on component types and/or on component priority. Right now we just
-		// iterate in an undefined order, but it wouldn't be hard to change it.
+		updateBuckets();
 
 		ScopeToggle toggle(mDisableStateChange);
-		for (auto& entry : mActiveComponents)
-			entry->update();
+		runBuckets(false);
 
 		GameObjectManager::instance().destroyQueuedObjects();
 	}
@@ -551,10 +678,10 @@ namespace bs
 	void SceneManager::_fixedUpdate()
 	{
 		processStateChanges();
+		updateBuckets();
 
 		ScopeToggle toggle(mDisableStateChange);
-		for (auto& entry : mActiveComponents)
-			entry->fixedUpdate();
+		runBuckets(true);
 	}
 
 	void SceneManager::registerNewSO(const HSceneObject& node)
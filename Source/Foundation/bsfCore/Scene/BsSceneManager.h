@@ -161,10 +161,17 @@ namespace bs
 		/**	Notifies the scene manager that a camera either became the main camera, or has stopped being main camera. */
 		void _notifyMainCameraStateChanged(const SPtr<Camera>& camera);
 
-		/** Called every frame. Calls update methods on all scene objects and their components. */
+		/** 
+		 * Called every frame. Calls update methods on all scene objects and their components. Components are updated
+		 * in buckets sorted by their update order (see Component::setUpdateOrder()) and then grouped by type. Buckets of
+		 * types with the ComponentFlag::ParallelUpdate flag are updated in parallel on the task scheduler.
+		 */
 		void _update();
 
-		/** Called at fixed time internals. Calls the fixed update method on all active components. */
+		/** 
+		 * Called at fixed time internals. Calls the fixed update method on all active components, in the same order as
+		 * _update().
+		 */
 		void _fixedUpdate();
 
 		/** Updates dirty transforms on any core objects that may be tied with scene objects. */
@@ -206,6 +213,19 @@ namespace bs
 			ComponentStateEventType type;
 		};
 
+		/** 
+		 * Group of active components of the same type and update order. Components in the bucket are updated one after
+		 * another, before moving on to the next bucket.
+		 */
+		struct ComponentUpdateBucket
+		{
+			INT32 updateOrder = 0;
+			UINT32 rttiId = 0;
+			bool parallel = false;
+			String name;
+			Vector<HComponent> components;
+		};
+
 		friend class SceneObject;
 
 		/**
@@ -236,6 +256,16 @@ namespace bs
 		/** Iterates over components that had their state modified and moves them to the appropriate state lists. */
 		void processStateChanges();
 
+		/** Sorts the active components into update buckets, if the active component list changed since last call. */
+		void updateBuckets();
+
+		/** 
+		 * Calls update() or fixedUpdate() on all components in the update buckets.
+		 *
+		 * @param[in]	fixed	If true fixedUpdate() is called, otherwise update() is called.
+		 */
+		void runBuckets(bool fixed);
+
 		/** 
 		 * Encodes an index and a type into a single 32-bit integer. Top 2 bits represent the type, while the rest represent
 		 * the index.
@@ -262,6 +292,9 @@ namespace bs
 		std::array<Vector<HComponent>*, 3> mComponentsPerState = 
 			{ { &mActiveComponents, &mInactiveComponents, &mUninitializedComponents } };
 
+		Vector<ComponentUpdateBucket> mUpdateBuckets;
+		bool mUpdateBucketsDirty = true;
+
 		SPtr<RenderTarget> mMainRT;
 		HEvent mMainRTResizedConn;
 
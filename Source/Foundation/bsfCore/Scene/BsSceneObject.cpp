@@ -753,6 +753,17 @@ namespace bs
 	}
 
 	HSceneObject SceneObject::clone(bool instantiate, bool preserveUUIDs)
+	{
+		UINT32 bufferSize = 0;
+		UINT8* buffer = encodeHierarchy(instantiate, bufferSize);
+
+		HSceneObject cloneObj = decodeHierarchy(buffer, bufferSize, preserveUUIDs);
+		bs_free(buffer);
+
+		return cloneObj;
+	}
+
+	UINT8* SceneObject::encodeHierarchy(bool instantiate, UINT32& size)
 	{
 		const bool isInstantiated = !hasFlag(SOF_DontInstantiate);
 
@@ -761,11 +772,19 @@ namespace bs
 		else
 			_unsetFlags(SOF_DontInstantiate);
 
-		UINT32 bufferSize = 0;
-
 		MemorySerializer serializer;
-		UINT8* buffer = serializer.encode(this, bufferSize, (void*(*)(size_t))&bs_alloc);
+		UINT8* buffer = serializer.encode(this, size, (void*(*)(size_t))&bs_alloc);
 
+		if(isInstantiated)
+			_unsetFlags(SOF_DontInstantiate);
+		else
+			_setFlags(SOF_DontInstantiate);
+
+		return buffer;
+	}
+
+	HSceneObject SceneObject::decodeHierarchy(UINT8* buffer, UINT32 size, bool preserveUUIDs, UINT32 numObjects)
+	{
 		int flags = GODM_RestoreExternal | GODM_UseNewIds;
 		if(!preserveUUIDs)
 			flags |= GODM_UseNewUUID;
@@ -773,14 +792,13 @@ namespace bs
 		CoreSerializationContext serzContext;
 		serzContext.goState = bs_shared_ptr_new<GameObjectDeserializationState>(flags);
 
-		SPtr<SceneObject> cloneObj = std::static_pointer_cast<SceneObject>(
-			serializer.decode(buffer, bufferSize, &serzContext));
-		bs_free(buffer);
+		// Every game object has a handle to its parent, and is referenced by its parent's child or component list
+		if(numObjects > 0)
+			serzContext.goState->reserve(numObjects, numObjects * 2);
 
-		if(isInstantiated)
-			_unsetFlags(SOF_DontInstantiate);
-		else
-			_setFlags(SOF_DontInstantiate);
+		MemorySerializer serializer;
+		SPtr<SceneObject> cloneObj = std::static_pointer_cast<SceneObject>(
+			serializer.decode(buffer, size, &serzContext));
 
 		return cloneObj->mThisHandle;
 	}
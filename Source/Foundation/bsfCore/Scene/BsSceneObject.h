@@ -447,6 +447,30 @@ namespace bs
 		HSceneObject clone(bool instantiate = true, bool preserveUUIDs = false);
 
 	private:
+		/**
+		 * Serializes this object and its entire hierarchy into a buffer that can be decoded using decodeHierarchy().
+		 * The buffer must be released using bs_free().
+		 *
+		 * @param[in]	instantiate		If false, the hierarchy decoded from the buffer will not be instantiated.
+		 * @param[out]	size			Size of the returned buffer, in bytes.
+		 * @return						Buffer containing the serialized hierarchy.
+		 */
+		UINT8* encodeHierarchy(bool instantiate, UINT32& size);
+
+		/**
+		 * Creates a new scene object hierarchy from a buffer previously output by encodeHierarchy(). The same buffer can
+		 * be decoded multiple times.
+		 *
+		 * @param[in]	buffer			Buffer containing the serialized hierarchy.
+		 * @param[in]	size			Size of the buffer, in bytes.
+		 * @param[in]	preserveUUIDs	If false, each decoded game object will be assigned a brand new UUID. Otherwise the
+		 *								UUIDs stored in the buffer are used.
+		 * @param[in]	numObjects		Optional number of game objects (scene objects and components) in the buffer. Used
+		 *								for pre-allocating the handle remapping tables.
+		 * @return						Root of the decoded hierarchy.
+		 */
+		static HSceneObject decodeHierarchy(UINT8* buffer, UINT32 size, bool preserveUUIDs, UINT32 numObjects = 0);
+
 		SPtr<SceneInstance> mParentScene;
 		HSceneObject mParent;
 		Vector<HSceneObject> mChildren;
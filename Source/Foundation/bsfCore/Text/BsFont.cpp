@@ -3,20 +3,55 @@
 #include "Text/BsFont.h"
 #include "Private/RTTI/BsFontRTTI.h"
 #include "Resources/BsResources.h"
+#include "Text/BsFontManager.h"
+#include "Text/BsGlyphCache.h"
 
 namespace bs
 {
 	const CharDesc& FontBitmap::getCharDesc(UINT32 charId) const
 	{
-		auto iterFind = characters.find(charId);
-		if(iterFind != characters.end())
-		{
-			return characters.at(charId);
-		}
+		// Glyph cache modifies the lookup as glyphs get added or evicted, so it needs to perform the lookup itself
+		if(glyphCache != nullptr)
+			return glyphCache->getCharDesc(charId);
+
+		const CharDesc* charDesc = _findCharDesc(charId);
+		if(charDesc != nullptr)
+			return *charDesc;
 
 		return missingGlyph;
 	}
 
+	const CharDesc* FontBitmap::_findCharDesc(UINT32 charId) const
+	{
+		if(charId < (UINT32)mDirectLookup.size())
+			return mDirectLookup[charId];
+
+		auto iterFind = mHashedLookup.find(charId);
+		if(iterFind != mHashedLookup.end())
+			return iterFind->second;
+
+		return nullptr;
+	}
+
+	void FontBitmap::_updateCharLookup()
+	{
+		mDirectLookup.clear();
+		mHashedLookup.clear();
+
+		for(auto& entry : characters)
+		{
+			if(entry.first < DIRECT_LOOKUP_SIZE)
+			{
+				if(entry.first >= (UINT32)mDirectLookup.size())
+					mDirectLookup.resize(entry.first + 1, nullptr);
+
+				mDirectLookup[entry.first] = &entry.second;
+			}
+			else
+				mHashedLookup[entry.first] = &entry.second;
+		}
+	}
+
 	RTTITypeBase* FontBitmap::getRTTIStatic()
 	{
 		return FontBitmapRTTI::instance();
@@ -36,6 +71,14 @@ namespace bs
 		for(auto iter = fontData.begin(); iter != fontData.end(); ++iter)
 			mFontDataPerSize[(*iter)->size] = *iter;
 
+		for(auto& entry : mFontDataPerSize)
+		{
+			entry.second->_updateCharLookup();
+
+			if(mGlyphSource.data != nullptr && FontManager::isStarted())
+				entry.second->glyphCache = FontManager::instance()._createGlyphCache(*this, *entry.second);
+		}
+
 		Resource::initialize();
 	}
 
@@ -112,10 +155,18 @@ namespace bs
 		return static_resource_cast<Font>(gResources()._createResourceHandle(newFont));
 	}
 
-	SPtr<Font> Font::_createPtr(const Vector<SPtr<FontBitmap>>& fontData)
+	HFont Font::create(const Vector<SPtr<FontBitmap>>& fontData, const FontGlyphSource& glyphSource)
+	{
+		SPtr<Font> newFont = _createPtr(fontData, glyphSource);
+
+		return static_resource_cast<Font>(gResources()._createResourceHandle(newFont));
+	}
+
+	SPtr<Font> Font::_createPtr(const Vector<SPtr<FontBitmap>>& fontData, const FontGlyphSource& glyphSource)
 	{
 		SPtr<Font> newFont = bs_core_ptr<Font>(new (bs_alloc<Font>()) Font());
 		newFont->_setThisPtr(newFont);
+		newFont->mGlyphSource = glyphSource;
 		newFont->initialize(fontData);
 
 		return newFont;
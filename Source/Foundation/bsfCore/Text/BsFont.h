@@ -15,7 +15,12 @@ namespace bs
 	/**	Contains textures and data about every character for a bitmap font of a specific size. */
 	struct BS_CORE_EXPORT BS_SCRIPT_EXPORT(m:GUI_Engine) FontBitmap : public IReflectable
 	{
-		/**	Returns a character description for the character with the specified Unicode key. */
+		/**
+		 * Returns a character description for the character with the specified Unicode key. If the bitmap doesn't contain
+		 * the character the missing glyph is returned instead, and if the bitmap has a glyph cache the character is queued
+		 * for rasterization. Descriptions of glyphs added by the glyph cache are only valid until the cache is next
+		 * updated, use GlyphCache::getCharDesc() to keep them around for longer.
+		 */
 		BS_SCRIPT_EXPORT()
 		const CharDesc& getCharDesc(UINT32 charId) const;
 
@@ -43,9 +48,37 @@ namespace bs
 		BS_SCRIPT_EXPORT()
 		Vector<HTexture> texturePages;
 
-		/** All characters in the font referenced by character ID. */
+		/**
+		 * All characters in the font referenced by character ID. _updateCharLookup() must be called after the map is
+		 * modified.
+		 */
 		Map<UINT32, CharDesc> characters;
 
+		/** Cache that rasterizes glyphs missing from @p characters at runtime, if the font supports it. */
+		SPtr<GlyphCache> glyphCache;
+
+		/**
+		 * Rebuilds the lookup table used by getCharDesc() from the @p characters map.
+		 *
+		 * @note	Internal method.
+		 */
+		void _updateCharLookup();
+
+		/**
+		 * Returns the description of the character with the specified Unicode key, or null if the bitmap doesn't contain
+		 * it. Unlike getCharDesc() this doesn't interact with the glyph cache, and isn't synchronized with it.
+		 *
+		 * @note	Internal method.
+		 */
+		const CharDesc* _findCharDesc(UINT32 charId) const;
+
+	private:
+		/** Characters with IDs below this value are looked up by direct indexing, rest by hashing. */
+		static constexpr UINT32 DIRECT_LOOKUP_SIZE = 0x800;
+
+		Vector<const CharDesc*> mDirectLookup;
+		UnorderedMap<UINT32, const CharDesc*> mHashedLookup;
+
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
 		/************************************************************************/
@@ -55,6 +88,19 @@ namespace bs
 		RTTITypeBase* getRTTI() const override;
 	};
 
+	/** Font file and settings used for rasterizing glyphs of a font at runtime. */
+	struct FontGlyphSource
+	{
+		/** Contents of the font file. Null if the font only contains pre-rasterized glyphs. */
+		SPtr<MemoryDataStream> data;
+
+		/** Dots per inch scale to rasterize the glyphs with. */
+		UINT32 dpi = 96;
+
+		/** Determines how are the glyphs rendered. */
+		FontRenderMode renderMode = FontRenderMode::HintedSmooth;
+	};
+
 	/**
 	 * Font resource containing data about textual characters and how to render text. Contains one or multiple font 
 	 * bitmaps, each for a specific size.
@@ -85,6 +131,12 @@ namespace bs
 		/**	Creates a new font from the provided per-size font data. */
 		static HFont create(const Vector<SPtr<FontBitmap>>& fontInitData);
 
+		/**
+		 * Creates a new font from the provided per-size font data. Glyphs missing from the font data will be rasterized
+		 * from the provided font file at runtime, if a glyph rasterizer is registered with the FontManager.
+		 */
+		static HFont create(const Vector<SPtr<FontBitmap>>& fontInitData, const FontGlyphSource& glyphSource);
+
 	public: // ***** INTERNAL ******
 		using Resource::initialize;
 
@@ -99,8 +151,12 @@ namespace bs
 		 */
 		void initialize(const Vector<SPtr<FontBitmap>>& fontData);
 
+		/** Returns the font file and settings used for rasterizing glyphs at runtime. */
+		const FontGlyphSource& getGlyphSource() const { return mGlyphSource; }
+
 		/** Creates a new font as a pointer instead of a resource handle. */
-		static SPtr<Font> _createPtr(const Vector<SPtr<FontBitmap>>& fontInitData);
+		static SPtr<Font> _createPtr(const Vector<SPtr<FontBitmap>>& fontInitData,
+			const FontGlyphSource& glyphSource = FontGlyphSource());
 
 		/** Creates a Font without initializing it. */
 		static SPtr<Font> _createEmpty();
@@ -120,6 +176,7 @@ namespace bs
 
 	private:
 		Map<UINT32, SPtr<FontBitmap>> mFontDataPerSize;
+		FontGlyphSource mGlyphSource;
 
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
@@ -12,15 +12,6 @@ namespace bs
 	 *  @{
 	 */
 
-	/**	Determines how is a font rendered into the bitmap texture. */
-	enum class BS_SCRIPT_EXPORT(m:Text,api:bsf,api:bed) FontRenderMode
-	{
-		Smooth, /*< Render antialiased fonts without hinting (slightly more blurry). */
-		Raster, /*< Render non-antialiased fonts without hinting (slightly more blurry). */
-		HintedSmooth, /*< Render antialiased fonts with hinting. */
-		HintedRaster /*< Render non-antialiased fonts with hinting. */
-	};
-
 	/** Represents a range of character code. */
 	struct BS_SCRIPT_EXPORT(m:Text,pl:true,api:bsf,api:bed) CharRange
 	{
@@ -63,6 +54,14 @@ namespace bs
 		BS_SCRIPT_EXPORT()
 		bool italic = false;
 
+		/**
+		 * If true, the font file will be stored along with the font, and glyphs for characters outside of
+		 * @p charIndexRanges will be rasterized at runtime, as they are needed. Increases the size of the font resource
+		 * but allows any character supported by the font to be rendered.
+		 */
+		BS_SCRIPT_EXPORT()
+		bool dynamicGlyphs = false;
+
 		/** Creates a new import options object that allows you to customize how are fonts imported. */
 		BS_SCRIPT_EXPORT(ec:T)
 		static SPtr<FontImportOptions> create();
@@ -0,0 +1,53 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Text/BsFontManager.h"
+#include "Text/BsFont.h"
+
+namespace bs
+{
+	SPtr<GlyphCache> FontManager::_createGlyphCache(Font& font, FontBitmap& bitmap)
+	{
+		const FontGlyphSource& glyphSource = font.getGlyphSource();
+		if(glyphSource.data == nullptr || mRasterizerFactory == nullptr)
+			return nullptr;
+
+		SPtr<GlyphRasterizer> rasterizer = mRasterizerFactory->create(glyphSource.data, bitmap.size, glyphSource.dpi,
+			glyphSource.renderMode);
+
+		if(rasterizer == nullptr)
+			return nullptr;
+
+		SPtr<GlyphCache> cache = bs_shared_ptr_new<GlyphCache>(font, bitmap, rasterizer, mGlyphCacheDesc);
+		mGlyphCaches.push_back(cache.get());
+
+		return cache;
+	}
+
+	void FontManager::unregisterGlyphCache(GlyphCache* cache)
+	{
+		auto iterFind = std::find(mGlyphCaches.begin(), mGlyphCaches.end(), cache);
+		if(iterFind != mGlyphCaches.end())
+			mGlyphCaches.erase(iterFind);
+	}
+
+	void FontManager::_update()
+	{
+		bs_frame_mark();
+		{
+			FrameVector<const Font*> changedFonts;
+			for(auto& cache : mGlyphCaches)
+			{
+				if(!cache->_update())
+					continue;
+
+				const Font* font = &cache->getFont();
+				if(std::find(changedFonts.begin(), changedFonts.end(), font) == changedFonts.end())
+					changedFonts.push_back(font);
+			}
+
+			for(auto& font : changedFonts)
+				onGlyphsChanged(*font);
+		}
+		bs_frame_clear();
+	}
+}
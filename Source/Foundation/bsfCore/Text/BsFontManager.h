@@ -0,0 +1,69 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Utility/BsModule.h"
+#include "Text/BsGlyphCache.h"
+
+namespace bs
+{
+	/** @addtogroup Text-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Keeps track of glyph caches of all loaded fonts and updates them every frame. Fonts that contain their source font
+	 * file get a glyph cache for each of their bitmaps, as long as a glyph rasterizer factory is registered (normally
+	 * done by the font importer plugin).
+	 *
+	 * @note	Sim thread only.
+	 */
+	class BS_CORE_EXPORT FontManager : public Module<FontManager>
+	{
+	public:
+		/** Registers the factory used for creating glyph rasterizers. Only affects fonts created after this call. */
+		void setRasterizerFactory(const SPtr<GlyphRasterizerFactory>& factory) { mRasterizerFactory = factory; }
+
+		/** Returns the factory used for creating glyph rasterizers, if any. */
+		const SPtr<GlyphRasterizerFactory>& getRasterizerFactory() const { return mRasterizerFactory; }
+
+		/** Sets the settings used for newly created glyph caches. */
+		void setGlyphCacheDesc(const GLYPH_CACHE_DESC& desc) { mGlyphCacheDesc = desc; }
+
+		/** Returns the settings used for newly created glyph caches. */
+		const GLYPH_CACHE_DESC& getGlyphCacheDesc() const { return mGlyphCacheDesc; }
+
+		/**
+		 * Triggered when glyphs are added to or removed from one of the bitmaps of a font. Any text using the font should
+		 * be laid out again.
+		 */
+		Event<void(const Font&)> onGlyphsChanged;
+
+		/** @name Internal
+		 *  @{
+		 */
+
+		/**
+		 * Creates a glyph cache for the provided font bitmap. Returns null if the font has no source font file or if no
+		 * rasterizer supports it.
+		 */
+		SPtr<GlyphCache> _createGlyphCache(Font& font, FontBitmap& bitmap);
+
+		/** Updates all glyph caches and triggers onGlyphsChanged for fonts whose glyphs changed. Called once per frame. */
+		void _update();
+
+		/** @} */
+	private:
+		friend class GlyphCache;
+
+		/** Unregisters a glyph cache that's being destroyed. */
+		void unregisterGlyphCache(GlyphCache* cache);
+
+		SPtr<GlyphRasterizerFactory> mRasterizerFactory;
+		GLYPH_CACHE_DESC mGlyphCacheDesc;
+		Vector<GlyphCache*> mGlyphCaches;
+	};
+
+	/** @} */
+}
@@ -0,0 +1,363 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Text/BsGlyphCache.h"
+#include "Text/BsFont.h"
+#include "Text/BsFontManager.h"
+#include "Image/BsTexture.h"
+#include "Image/BsPixelData.h"
+#include "Image/BsPixelUtil.h"
+#include "Threading/BsTaskScheduler.h"
+#include "Utility/BsTime.h"
+#include "Debug/BsDebug.h"
+
+namespace bs
+{
+	GlyphCache::GlyphCache(Font& font, FontBitmap& bitmap, const SPtr<GlyphRasterizer>& rasterizer,
+		const GLYPH_CACHE_DESC& desc)
+		: mFont(font), mBitmap(bitmap), mDesc(desc), mFirstPage((UINT32)bitmap.texturePages.size())
+	{
+		mWorkerData = bs_shared_ptr_new<WorkerData>();
+		mWorkerData->rasterizer = rasterizer;
+	}
+
+	GlyphCache::~GlyphCache()
+	{
+		// Worker data is shared with the rasterization task, so an active task can safely finish on its own
+		if(FontManager::isStarted())
+			FontManager::instance().unregisterGlyphCache(this);
+	}
+
+	const CharDesc& GlyphCache::getCharDesc(UINT32 charId, SmallVector<UINT32, 4>* pinnedPages)
+	{
+		Lock lock(mMutex);
+
+		const CharDesc* charDesc = mBitmap._findCharDesc(charId);
+		if(charDesc == nullptr)
+		{
+			requestGlyph(charId);
+			return mBitmap.missingGlyph;
+		}
+
+		Page* page = findPage(charDesc->page);
+		if(page != nullptr)
+		{
+			page->lastUsedFrame = mCurrentFrame;
+
+			if(pinnedPages != nullptr)
+			{
+				auto iterFind = std::find(pinnedPages->begin(), pinnedPages->end(), charDesc->page);
+				if(iterFind == pinnedPages->end())
+				{
+					page->numPins++;
+					pinnedPages->add(charDesc->page);
+				}
+			}
+		}
+
+		return *charDesc;
+	}
+
+	void GlyphCache::unpinPage(UINT32 pageIdx)
+	{
+		Lock lock(mMutex);
+
+		Page* page = findPage(pageIdx);
+		if(page != nullptr)
+		{
+			assert(page->numPins > 0);
+			page->numPins--;
+		}
+	}
+
+	void GlyphCache::requestGlyph(UINT32 charId)
+	{
+		if(mRequested.insert(charId).second)
+			mPending.push_back(charId);
+	}
+
+	bool GlyphCache::_update()
+	{
+		Lock lock(mMutex);
+		mCurrentFrame = gTime().getFrameIdx();
+
+		Vector<RasterizedGlyph> rasterized;
+		{
+			Lock lock(mWorkerData->mutex);
+			std::swap(rasterized, mWorkerData->rasterized);
+		}
+
+		bool modified = false;
+		for(auto& glyph : rasterized)
+		{
+			if((glyph.desc.width + mDesc.padding) > mDesc.maxPageSize ||
+				(glyph.desc.height + mDesc.padding) > mDesc.maxPageSize)
+			{
+				// Glyph stays marked as requested, so it doesn't get rasterized again
+				LOGWRN("Glyph for character " + toString(glyph.desc.charId) + " doesn't fit in a glyph cache page.");
+				continue;
+			}
+
+			if(addGlyph(glyph))
+				modified = true;
+			else // No room until pages currently in use free up, allow the glyph to be requested again
+				mRequested.erase(glyph.desc.charId);
+		}
+
+		// Evicting a page removes glyphs from the bitmap even if the glyph that needed the space couldn't be added, in
+		// which case the lookup would still reference the removed glyphs
+		if(mGlyphsEvicted)
+		{
+			modified = true;
+			mGlyphsEvicted = false;
+		}
+
+		if(modified)
+		{
+			for(auto& page : mPages)
+			{
+				if(!page.dirty)
+					continue;
+
+				updateTexture(page);
+				page.dirty = false;
+			}
+
+			mBitmap._updateCharLookup();
+		}
+
+		// Rasterizer isn't thread safe, so only a single task runs at a time
+		if(!mPending.empty() && (mActiveTask == nullptr || mActiveTask->isComplete()))
+		{
+			Vector<UINT32> charIds;
+			std::swap(charIds, mPending);
+
+			SPtr<WorkerData> workerData = mWorkerData;
+			mActiveTask = Task::create("GlyphRasterization", [workerData, charIds]()
+			{
+				for(auto& charId : charIds)
+				{
+					RasterizedGlyph glyph;
+					if(!workerData->rasterizer->rasterize(charId, glyph))
+						continue;
+
+					Lock lock(workerData->mutex);
+					workerData->rasterized.push_back(std::move(glyph));
+				}
+			});
+
+			TaskScheduler::instance().addTask(mActiveTask);
+		}
+
+		return modified;
+	}
+
+	bool GlyphCache::addGlyph(const RasterizedGlyph& glyph)
+	{
+		CharDesc desc = glyph.desc;
+
+		UINT32 pageIdx = 0;
+		UINT32 x = 0;
+		UINT32 y = 0;
+		if(desc.width == 0 || desc.height == 0)
+		{
+			// Nothing to store (e.g. whitespace), only the metrics are needed
+			if(mPages.empty())
+			{
+				if(mDesc.maxPages == 0)
+					return false;
+
+				createPage();
+			}
+
+			pageIdx = (UINT32)mPages.size() - 1;
+		}
+		else if(!allocate(desc.width + mDesc.padding, desc.height + mDesc.padding, pageIdx, x, y))
+			return false;
+
+		Page& page = mPages[pageIdx];
+		const UINT32 pageWidth = page.pixels->getWidth();
+		const UINT32 pageHeight = page.pixels->getHeight();
+
+		UINT8* dstBuffer = page.pixels->getData() + (y * pageWidth + x) * 2;
+		const UINT8* srcBuffer = glyph.pixels.data();
+		for(UINT32 row = 0; row < desc.height; row++)
+		{
+			for(UINT32 column = 0; column < desc.width; column++)
+			{
+				dstBuffer[column * 2 + 0] = srcBuffer[column];
+				dstBuffer[column * 2 + 1] = srcBuffer[column];
+			}
+
+			dstBuffer += pageWidth * 2;
+			srcBuffer += desc.width;
+		}
+
+		const float invWidth = 1.0f / pageWidth;
+		const float invHeight = 1.0f / pageHeight;
+
+		desc.page = page.textureIdx;
+		desc.uvX = x * invWidth;
+		desc.uvY = y * invHeight;
+		desc.uvWidth = desc.width * invWidth;
+		desc.uvHeight = desc.height * invHeight;
+
+		mBitmap.characters[desc.charId] = desc;
+		page.glyphs.push_back({ desc.charId, x, y });
+		page.dirty = true;
+
+		return true;
+	}
+
+	bool GlyphCache::allocate(UINT32 width, UINT32 height, UINT32& pageIdx, UINT32& x, UINT32& y)
+	{
+		for(UINT32 i = 0; i < (UINT32)mPages.size(); i++)
+		{
+			Page& page = mPages[i];
+			if(!page.layout.addElement(width, height, x, y))
+				continue;
+
+			if(page.layout.getWidth() != page.pixels->getWidth() || page.layout.getHeight() != page.pixels->getHeight())
+				resizePage(page);
+
+			pageIdx = i;
+			return true;
+		}
+
+		if((UINT32)mPages.size() < mDesc.maxPages)
+		{
+			createPage();
+			pageIdx = (UINT32)mPages.size() - 1;
+		}
+		else
+		{
+			UINT32 lruIdx = (UINT32)-1;
+			UINT64 lruFrame = std::numeric_limits<UINT64>::max();
+			for(UINT32 i = 0; i < (UINT32)mPages.size(); i++)
+			{
+				// Glyphs on pinned pages are referenced by existing text layouts
+				if(mPages[i].numPins > 0)
+					continue;
+
+				if(mPages[i].lastUsedFrame < lruFrame)
+				{
+					lruIdx = i;
+					lruFrame = mPages[i].lastUsedFrame;
+				}
+			}
+
+			// Don't evict pages used during the last frame, as their glyphs are likely still being displayed
+			if(lruIdx == (UINT32)-1 || (lruFrame + 1) >= mCurrentFrame)
+				return false;
+
+			evictPage(lruIdx);
+			pageIdx = lruIdx;
+		}
+
+		Page& page = mPages[pageIdx];
+		if(!page.layout.addElement(width, height, x, y))
+			return false;
+
+		if(page.layout.getWidth() != page.pixels->getWidth() || page.layout.getHeight() != page.pixels->getHeight())
+			resizePage(page);
+
+		return true;
+	}
+
+	void GlyphCache::createPage()
+	{
+		Page page;
+		page.textureIdx = (UINT32)mBitmap.texturePages.size();
+		page.layout = TextureAtlasLayout(mDesc.initialPageSize, mDesc.initialPageSize, mDesc.maxPageSize,
+			mDesc.maxPageSize, true);
+		page.lastUsedFrame = mCurrentFrame;
+
+		mBitmap.texturePages.push_back(HTexture());
+		mPages.push_back(page);
+
+		resizePage(mPages.back());
+	}
+
+	void GlyphCache::evictPage(UINT32 pageIdx)
+	{
+		Page& page = mPages[pageIdx];
+		for(auto& glyph : page.glyphs)
+		{
+			mBitmap.characters.erase(glyph.charId);
+			mRequested.erase(glyph.charId);
+		}
+
+		page.glyphs.clear();
+		page.layout = TextureAtlasLayout(mDesc.initialPageSize, mDesc.initialPageSize, mDesc.maxPageSize,
+			mDesc.maxPageSize, true);
+		page.pixels = nullptr;
+		page.lastUsedFrame = mCurrentFrame;
+
+		resizePage(page);
+		mGlyphsEvicted = true;
+	}
+
+	void GlyphCache::resizePage(Page& page)
+	{
+		const UINT32 width = page.layout.getWidth();
+		const UINT32 height = page.layout.getHeight();
+
+		SPtr<PixelData> pixels = bs_shared_ptr_new<PixelData>(width, height, 1, PF_RG8);
+		pixels->allocateInternalBuffer();
+		memset(pixels->getData(), 0, width * height * 2);
+
+		// Layout only grows towards the right and bottom, so existing glyphs keep their pixel positions
+		if(page.pixels != nullptr)
+		{
+			const UINT32 oldWidth = page.pixels->getWidth();
+			const UINT32 oldHeight = page.pixels->getHeight();
+
+			for(UINT32 row = 0; row < oldHeight; row++)
+				memcpy(pixels->getData() + row * width * 2, page.pixels->getData() + row * oldWidth * 2, oldWidth * 2);
+		}
+
+		page.pixels = pixels;
+		page.dirty = true;
+
+		const float invWidth = 1.0f / width;
+		const float invHeight = 1.0f / height;
+		for(auto& glyph : page.glyphs)
+		{
+			auto iterFind = mBitmap.characters.find(glyph.charId);
+			if(iterFind == mBitmap.characters.end())
+				continue;
+
+			CharDesc& desc = iterFind->second;
+			desc.uvX = glyph.x * invWidth;
+			desc.uvY = glyph.y * invHeight;
+			desc.uvWidth = desc.width * invWidth;
+			desc.uvHeight = desc.height * invHeight;
+		}
+	}
+
+	void GlyphCache::updateTexture(Page& page)
+	{
+		const UINT32 width = page.pixels->getWidth();
+		const UINT32 height = page.pixels->getHeight();
+
+		HTexture& texture = mBitmap.texturePages[page.textureIdx];
+		if(!texture.isLoaded(false) || texture->getProperties().getWidth() != width ||
+			texture->getProperties().getHeight() != height)
+		{
+			TEXTURE_DESC texDesc;
+			texDesc.width = width;
+			texDesc.height = height;
+			texDesc.format = PF_RG8;
+			texDesc.usage = TU_DYNAMIC;
+
+			texture = Texture::create(texDesc);
+			texture->setName(u8"FontDynamicPage" + toString(page.textureIdx));
+		}
+
+		// Write happens on the core thread, so it gets its own copy of the pixels. This also handles the case where the
+		// render backend doesn't support the page format.
+		SPtr<PixelData> data = texture->getProperties().allocBuffer(0, 0);
+		PixelUtil::bulkPixelConversion(*page.pixels, *data);
+
+		texture->writeData(data, 0, 0, true);
+	}
+}
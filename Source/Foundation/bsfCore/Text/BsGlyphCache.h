@@ -0,0 +1,215 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Text/BsFontDesc.h"
+#include "Image/BsTextureAtlasLayout.h"
+#include "Utility/BsSmallVector.h"
+
+namespace bs
+{
+	/** @addtogroup Text-Internal
+	 *  @{
+	 */
+
+	/** Metrics and pixels of a single glyph output by a GlyphRasterizer. */
+	struct RasterizedGlyph
+	{
+		/** Description of the character. Page and texture coordinates are assigned once the glyph is added to a cache. */
+		CharDesc desc;
+
+		/** Coverage of the glyph, one byte per pixel, desc.width * desc.height pixels in rows from top to bottom. */
+		Vector<UINT8> pixels;
+	};
+
+	/**
+	 * Rasterizes glyphs of a single font face of a specific size. Implementations are provided by plugins through a
+	 * GlyphRasterizerFactory.
+	 *
+	 * @note	Doesn't need to be thread safe, but must be usable from any thread. A single rasterizer is never used from
+	 *			multiple threads simultaneously.
+	 */
+	class BS_CORE_EXPORT GlyphRasterizer
+	{
+	public:
+		virtual ~GlyphRasterizer() = default;
+
+		/**
+		 * Rasterizes the glyph for the specified character.
+		 *
+		 * @param[in]	charId		Unicode key of the character to rasterize.
+		 * @param[out]	output		Metrics and pixels of the rasterized glyph.
+		 * @return					False if the font doesn't contain a glyph for the character, true otherwise.
+		 */
+		virtual bool rasterize(UINT32 charId, RasterizedGlyph& output) = 0;
+	};
+
+	/** Creates glyph rasterizers from font files. */
+	class BS_CORE_EXPORT GlyphRasterizerFactory
+	{
+	public:
+		virtual ~GlyphRasterizerFactory() = default;
+
+		/**
+		 * Creates a new glyph rasterizer.
+		 *
+		 * @param[in]	fontData	Contents of the font file. Must be kept alive for the lifetime of the rasterizer.
+		 * @param[in]	size		Size of the font to rasterize glyphs for, in points.
+		 * @param[in]	dpi			Dots per inch scale to rasterize the glyphs with.
+		 * @param[in]	renderMode	Determines how are the glyphs rendered.
+		 * @return					New rasterizer, or null if the font file is not supported.
+		 */
+		virtual SPtr<GlyphRasterizer> create(const SPtr<MemoryDataStream>& fontData, UINT32 size, UINT32 dpi,
+			FontRenderMode renderMode) = 0;
+	};
+
+	/** Settings that control how much memory can a GlyphCache use. */
+	struct GLYPH_CACHE_DESC
+	{
+		/** Width and height of a newly created page texture, in pixels. */
+		UINT32 initialPageSize = 256;
+
+		/** Maximum width and height a page texture can grow to, in pixels. */
+		UINT32 maxPageSize = 1024;
+
+		/** Maximum number of pages a cache can create before it starts evicting the least recently used ones. */
+		UINT32 maxPages = 4;
+
+		/** Number of empty pixels to leave between glyphs, so neighbouring glyphs don't bleed into each other. */
+		UINT32 padding = 1;
+	};
+
+	/**
+	 * Extends a FontBitmap with glyphs rasterized at runtime. Glyphs requested from the bitmap that it doesn't contain are
+	 * rasterized on a worker thread, and added to the bitmap during the next _update() call. Rasterized glyphs are packed
+	 * into dynamic texture pages appended to FontBitmap::texturePages. Pages grow as needed up to a maximum size, after
+	 * which new pages are created. Once the maximum number of pages is reached, the least recently used page is evicted
+	 * and its glyphs are removed from the bitmap, to be rasterized again if they are requested again. Pages that are
+	 * pinned are never evicted, allowing text layouts to keep referencing the glyph descriptions on those pages.
+	 *
+	 * @note	Glyph lookups and pinning are thread safe. _update() must be called from the sim thread.
+	 */
+	class BS_CORE_EXPORT GlyphCache
+	{
+		/** Location of a glyph within a page, in pixels. */
+		struct PageGlyph
+		{
+			UINT32 charId;
+			UINT32 x;
+			UINT32 y;
+		};
+
+		/** Texture page containing rasterized glyphs. */
+		struct Page
+		{
+			UINT32 textureIdx = 0;
+			TextureAtlasLayout layout;
+			SPtr<PixelData> pixels;
+			Vector<PageGlyph> glyphs;
+			UINT64 lastUsedFrame = 0;
+			UINT32 numPins = 0;
+			bool dirty = false;
+		};
+
+		/** Data shared between the cache and the worker thread performing rasterization. */
+		struct WorkerData
+		{
+			SPtr<GlyphRasterizer> rasterizer;
+			Mutex mutex;
+			Vector<RasterizedGlyph> rasterized;
+		};
+
+	public:
+		GlyphCache(Font& font, FontBitmap& bitmap, const SPtr<GlyphRasterizer>& rasterizer,
+			const GLYPH_CACHE_DESC& desc);
+		~GlyphCache();
+
+		/** Returns the font whose bitmap the cache is extending. */
+		Font& getFont() const { return mFont; }
+
+		/**
+		 * Returns a character description for the character with the specified Unicode key, and marks the page it is on
+		 * as used during the current frame. If the bitmap doesn't contain the character, the missing glyph is returned
+		 * and the character is queued for rasterization.
+		 *
+		 * @param[in]		charId		Unicode key of the character to look up.
+		 * @param[in, out]	pinnedPages	If not null, the page the character is on gets pinned and added to this list,
+		 *								unless the list already contains it. The returned description stays valid until
+		 *								all the pages in the list are unpinned through unpinPage(). If null the
+		 *								description is only valid until the next _update().
+		 * @return						Description of the character, or the missing glyph.
+		 */
+		const CharDesc& getCharDesc(UINT32 charId, SmallVector<UINT32, 4>* pinnedPages = nullptr);
+
+		/** Releases a page previously pinned by getCharDesc(), allowing it to be evicted. */
+		void unpinPage(UINT32 page);
+
+		/**
+		 * Adds glyphs rasterized since the last call to the font bitmap, and starts rasterization of any newly requested
+		 * glyphs. Returns true if the set of glyphs in the bitmap changed, in which case any text using the bitmap should
+		 * be laid out again.
+		 */
+		bool _update();
+
+	private:
+		/** Returns the page with the specified texture index, or null if the page isn't managed by the cache. */
+		Page* findPage(UINT32 page)
+		{
+			if (page >= mFirstPage && (page - mFirstPage) < (UINT32)mPages.size())
+				return &mPages[page - mFirstPage];
+
+			return nullptr;
+		}
+
+		/**
+		 * Queues the glyph for the specified character for rasterization. Does nothing if the glyph was already requested
+		 * or if the font has no glyph for the character. Caller must hold the mutex.
+		 */
+		void requestGlyph(UINT32 charId);
+
+		/** Copies the rasterized glyph into one of the pages, and registers it with the bitmap. */
+		bool addGlyph(const RasterizedGlyph& glyph);
+
+		/**
+		 * Finds a location on one of the pages for a glyph of the specified size, creating or evicting pages as needed.
+		 * Returns false if no page can fit the glyph without evicting glyphs that are currently in use.
+		 */
+		bool allocate(UINT32 width, UINT32 height, UINT32& pageIdx, UINT32& x, UINT32& y);
+
+		/** Creates a new empty page. */
+		void createPage();
+
+		/**
+		 * Removes all glyphs from the page with the specified index. The bitmap's lookup must be rebuilt before the next
+		 * lookup, which _update() does whenever a page was evicted.
+		 */
+		void evictPage(UINT32 pageIdx);
+
+		/** Resizes the pixel buffer of the page to match its layout, and recalculates texture coordinates of its glyphs. */
+		void resizePage(Page& page);
+
+		/** Writes the pixels of the page into its texture, creating the texture if needed. */
+		void updateTexture(Page& page);
+
+		Font& mFont;
+		FontBitmap& mBitmap;
+		GLYPH_CACHE_DESC mDesc;
+
+		UINT32 mFirstPage;
+		Vector<Page> mPages;
+		UINT64 mCurrentFrame = 0;
+		bool mGlyphsEvicted = false;
+
+		UnorderedSet<UINT32> mRequested;
+		Vector<UINT32> mPending;
+		SPtr<WorkerData> mWorkerData;
+		SPtr<Task> mActiveTask;
+
+		// Guards the bitmap's character lookup along with the page usage and request state, as lookups can happen from
+		// any thread that lays out text
+		Mutex mMutex;
+	};
+
+	/** @} */
+}
@@ -2,6 +2,7 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "Text/BsTextData.h"
 #include "Text/BsFont.h"
+#include "Text/BsGlyphCache.h"
 #include "Math/BsVector2.h"
 #include "Debug/BsDebug.h"
 
@@ -380,7 +381,7 @@ namespace bs
 				break;
 
 			UINT32 charId = text[charIdx];
-			const CharDesc& charDesc = mFontData->getCharDesc(charId);
+			const CharDesc& charDesc = findChar(charId);
 
 			TextLine* curLine = &MemBuffer->LineBuffer[curLineIdx];
 
@@ -504,6 +505,23 @@ namespace bs
 		mNumPageInfos = MemBuffer->NextFreePageInfo;
 	}
 
+	TextDataBase::~TextDataBase()
+	{
+		if(mFontData != nullptr && mFontData->glyphCache != nullptr)
+		{
+			for(auto& page : mPinnedPages)
+				mFontData->glyphCache->unpinPage(page);
+		}
+	}
+
+	const CharDesc& TextDataBase::findChar(UINT32 charId)
+	{
+		if(mFontData->glyphCache != nullptr)
+			return mFontData->glyphCache->getCharDesc(charId, &mPinnedPages);
+
+		return mFontData->getCharDesc(charId);
+	}
+
 	void TextDataBase::generatePersistentData(const U32String& text, UINT8* buffer, UINT32& size, bool freeTemporary)
 	{
 		UINT32 charArraySize = mNumChars * sizeof(const CharDesc*);
@@ -523,7 +541,7 @@ namespace bs
 		for (UINT32 i = 0; i < mNumChars; i++)
 		{
 			UINT32 charId = text[i];
-			const CharDesc& charDesc = mFontData->getCharDesc(charId);
+			const CharDesc& charDesc = findChar(charId);
 
 			mChars[i] = &charDesc;
 		}
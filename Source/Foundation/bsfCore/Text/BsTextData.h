@@ -5,6 +5,7 @@
 #include "BsCorePrerequisites.h"
 #include "Text/BsFontDesc.h"
 #include "Math/BsVector2I.h"
+#include "Utility/BsSmallVector.h"
 
 namespace bs
 {
@@ -219,7 +220,7 @@ namespace bs
 		 */
 		BS_CORE_EXPORT TextDataBase(const U32String& text, const HFont& font, UINT32 fontSize,
 			UINT32 width = 0, UINT32 height = 0, bool wordWrap = false, bool wordBreak = true);
-		BS_CORE_EXPORT virtual ~TextDataBase() = default;
+		BS_CORE_EXPORT virtual ~TextDataBase();
 
 		/**	Returns the number of lines that were generated. */
 		BS_CORE_EXPORT UINT32 getNumLines() const { return mNumLines; }
@@ -263,6 +264,12 @@ namespace bs
 	private:
 		friend class TextLine;
 
+		/** 
+		 * Looks up the description of the character with the specified Unicode key. If the font has a glyph cache, the 
+		 * page the character is on is pinned for the lifetime of the text data, so the description remains valid.
+		 */
+		const CharDesc& findChar(UINT32 charId);
+
 		/**	Returns Y offset that determines the line on which the characters are placed. In pixels. */
 		INT32 getBaselineOffset() const;
 
@@ -290,6 +297,7 @@ namespace bs
 
 		HFont mFont;
 		SPtr<const FontBitmap> mFontData;
+		SmallVector<UINT32, 4> mPinnedPages;
 
 		// Static buffers used to reduce runtime memory allocation
 	protected:
@@ -108,7 +108,7 @@ namespace bs
 		UINT32 numElements = mImageSprite->getNumRenderElements();
 		numElements += mTextSprite->getNumRenderElements();
 
-		if(mCaretShown && gGUIManager().getCaretBlinkState())
+		if(mCaretShown)
 			numElements += gGUIManager().getInputCaretTool()->getSprite()->getNumRenderElements();
 
 		if(mSelectionShown)
@@ -137,7 +137,12 @@ namespace bs
 		UINT32 localRenderElementIdx;
 		Sprite* sprite = renderElemToSprite(renderElementIdx, localRenderElementIdx);
 
-		UINT32 numQuads = sprite->getNumQuads(localRenderElementIdx);
+		// Caret render elements are kept while the caret blinks, so blinking only changes the element's mesh contents
+		// instead of its render element layout
+		UINT32 numQuads = 0;
+		if(sprite != gGUIManager().getInputCaretTool()->getSprite() || gGUIManager().getCaretBlinkState())
+			numQuads = sprite->getNumQuads(localRenderElementIdx);
+
 		numVertices = numQuads * 4;
 		numIndices = numQuads * 6;
 		type = GUIMeshType::Triangle;
@@ -162,7 +167,7 @@ namespace bs
 		TEXT_SPRITE_DESC textDesc = getTextDesc();
 		mTextSprite->update(textDesc, (UINT64)_getParentWidget());
 
-		if(mCaretShown && gGUIManager().getCaretBlinkState())
+		if(mCaretShown)
 		{
 			gGUIManager().getInputCaretTool()->updateText(this, textDesc); // TODO - These shouldn't be here. Only call this when one of these parameters changes.
 			gGUIManager().getInputCaretTool()->updateSprite();
@@ -207,7 +212,7 @@ namespace bs
 			return mImageSprite;
 		}
 
-		if(mCaretShown && gGUIManager().getCaretBlinkState())
+		if(mCaretShown)
 		{
 			oldNumElements = newNumElements;
 			newNumElements += gGUIManager().getInputCaretTool()->getSprite()->getNumRenderElements();
@@ -252,7 +257,7 @@ namespace bs
 		if(renderElemIdx < newNumElements)
 			return Vector2I(mLayoutData.area.x, mLayoutData.area.y);;
 
-		if(mCaretShown && gGUIManager().getCaretBlinkState())
+		if(mCaretShown)
 		{
 			oldNumElements = newNumElements;
 			newNumElements += gGUIManager().getInputCaretTool()->getSprite()->getNumRenderElements();
@@ -293,7 +298,7 @@ namespace bs
 		if(renderElemIdx < newNumElements)
 			return mLayoutData.getLocalClipRect();
 
-		if(mCaretShown && gGUIManager().getCaretBlinkState())
+		if(mCaretShown)
 		{
 			oldNumElements = newNumElements;
 			newNumElements += gGUIManager().getInputCaretTool()->getSprite()->getNumRenderElements();
@@ -396,6 +401,9 @@ namespace bs
 
 		UINT32 localRenderElementIdx;
 		Sprite* sprite = renderElemToSprite(renderElementIdx, localRenderElementIdx);
+		if(sprite == gGUIManager().getInputCaretTool()->getSprite() && !gGUIManager().getCaretBlinkState())
+			return;
+
 		Vector2I offset = renderElemToOffset(renderElementIdx);
 		Rect2I clipRect = renderElemToClipRect(renderElementIdx);
 
@@ -37,6 +37,8 @@
 #include "RenderAPI/BsSamplerState.h"
 #include "Managers/BsRenderStateManager.h"
 #include "Resources/BsBuiltinResources.h"
+#include "Text/BsFont.h"
+#include "Text/BsFontManager.h"
 
 using namespace std::placeholders;
 
@@ -47,12 +49,13 @@ namespace bs
 		GUIGroupElement()
 		{ }
 
-		GUIGroupElement(GUIElement* _element, UINT32 _renderElement)
-			:element(_element), renderElement(_renderElement)
+		GUIGroupElement(GUIElement* _element, UINT32 _renderElement, UINT64 _mergeHash = 0)
+			:element(_element), renderElement(_renderElement), mergeHash(_mergeHash)
 		{ }
 
 		GUIElement* element;
 		UINT32 renderElement;
+		UINT64 mergeHash;
 	};
 
 	struct GUIMaterialGroup
@@ -98,6 +101,9 @@ namespace bs
 		DragAndDropManager::startUp();
 		mDragEndedConn = DragAndDropManager::instance().onDragEnded.connect(std::bind(&GUIManager::onMouseDragEnded, this, _1, _2));
 
+		mFontGlyphsChangedConn = FontManager::instance().onGlyphsChanged.connect(
+			std::bind(&GUIManager::onFontGlyphsChanged, this, _1));
+
 		GUIDropDownBoxManager::startUp();
 		GUITooltipManager::startUp();
 
@@ -139,6 +145,7 @@ namespace bs
 		mOnVirtualButtonDown.disconnect();
 
 		mDragEndedConn.disconnect();
+		mFontGlyphsChangedConn.disconnect();
 
 		mWindowGainedFocusConn.disconnect();
 		mWindowLostFocusConn.disconnect();
@@ -458,13 +465,17 @@ namespace bs
 
 			// Check if anything is dirty. If nothing is we can skip the update
 			bool isDirty = renderData.isDirty;
+			bool needsRebuild = renderData.isDirty;
 			renderData.isDirty = false;
 
+			mUpdatedElements.clear();
 			for(auto& widget : renderData.widgets)
 			{
-				if (widget->isDirty(true))
+				bool meshDirty = false;
+				if (widget->isDirty(meshDirty, mUpdatedElements))
 				{
 					isDirty = true;
+					needsRebuild |= meshDirty;
 				}
 			}
 
@@ -473,270 +484,554 @@ namespace bs
 
 			mCoreDirty = true;
 
-			bs_frame_mark();
+			// If only the contents of some elements changed, try updating them in place without regrouping everything
+			if(!needsRebuild && updateMeshElements(renderData, mUpdatedElements))
+				continue;
+
+			rebuildMeshes(renderData);
+		}
+
+		mUpdatedElements.clear();
+	}
+
+	void GUIManager::rebuildMeshes(GUIRenderData& renderData)
+	{
+		bs_frame_mark();
+		{
+			// Make a list of all GUI elements, sorted from farthest to nearest (highest depth to lowest)
+			auto elemComp = [](const GUIGroupElement& a, const GUIGroupElement& b)
 			{
-				// Make a list of all GUI elements, sorted from farthest to nearest (highest depth to lowest)
-				auto elemComp = [](const GUIGroupElement& a, const GUIGroupElement& b)
-				{
-					UINT32 aDepth = a.element->_getRenderElementDepth(a.renderElement);
-					UINT32 bDepth = b.element->_getRenderElementDepth(b.renderElement);
+				UINT32 aDepth = a.element->_getRenderElementDepth(a.renderElement);
+				UINT32 bDepth = b.element->_getRenderElementDepth(b.renderElement);
+
+				// Compare pointers just to differentiate between two elements with the same depth, their order doesn't really matter, but std::set
+				// requires all elements to be unique
+				return (aDepth > bDepth) || 
+					(aDepth == bDepth && a.element > b.element) || 
+					(aDepth == bDepth && a.element == b.element && a.renderElement > b.renderElement); 
+			};
 
-					// Compare pointers just to differentiate between two elements with the same depth, their order doesn't really matter, but std::set
-					// requires all elements to be unique
-					return (aDepth > bDepth) || 
-						(aDepth == bDepth && a.element > b.element) || 
-						(aDepth == bDepth && a.element == b.element && a.renderElement > b.renderElement); 
-				};
+			FrameSet<GUIGroupElement, std::function<bool(const GUIGroupElement&, const GUIGroupElement&)>> allElements(elemComp);
 
-				FrameSet<GUIGroupElement, std::function<bool(const GUIGroupElement&, const GUIGroupElement&)>> allElements(elemComp);
+			// Record which elements are part of the meshes, so they can later be updated without a rebuild
+			renderData.elementInfos.clear();
+			renderData.meshElements.clear();
 
-				for (auto& widget : renderData.widgets)
+			UINT32 totalNumRenderElems = 0;
+			for (auto& widget : renderData.widgets)
+			{
+				const Vector<GUIElement*>& elements = widget->getElements();
+
+				for (auto& element : elements)
 				{
-					const Vector<GUIElement*>& elements = widget->getElements();
+					if (!element->_isVisible())
+						continue;
 
-					for (auto& element : elements)
+					UINT32 numRenderElems = element->_getNumRenderElements();
+					for (UINT32 i = 0; i < numRenderElems; i++)
 					{
-						if (!element->_isVisible())
-							continue;
-
-						UINT32 numRenderElems = element->_getNumRenderElements();
-						for (UINT32 i = 0; i < numRenderElems; i++)
-						{
-							allElements.insert(GUIGroupElement(element, i));
-						}
+						allElements.insert(GUIGroupElement(element, i));
 					}
-				}
-
-				// Group the elements in such a way so that we end up with a smallest amount of
-				// meshes, without breaking back to front rendering order
-				FrameUnorderedMap<UINT64, FrameVector<GUIMaterialGroup>> materialGroups;
-				for (auto& elem : allElements)
-				{
-					GUIElement* guiElem = elem.element;
-					UINT32 renderElemIdx = elem.renderElement;
-					UINT32 elemDepth = guiElem->_getRenderElementDepth(renderElemIdx);
 
-					Rect2I tfrmedBounds = guiElem->_getClippedBounds();
-					tfrmedBounds.transform(guiElem->_getParentWidget()->getWorldTfrm());
+					GUIMeshElementInfo& elementInfo = renderData.elementInfos[element];
+					elementInfo.firstRenderElement = totalNumRenderElems;
+					elementInfo.numRenderElements = numRenderElems;
+					elementInfo.bounds = element->_getClippedBounds();
 
-					SpriteMaterial* spriteMaterial = nullptr;
-					const SpriteMaterialInfo& matInfo = guiElem->_getMaterial(renderElemIdx, &spriteMaterial);
-					assert(spriteMaterial != nullptr);
+					totalNumRenderElems += numRenderElems;
+				}
+			}
 
-					UINT64 hash = spriteMaterial->getMergeHash(matInfo);
-					FrameVector<GUIMaterialGroup>& groupsPerMaterial = materialGroups[hash];
-					
-					// Try to find a group this material will fit in:
-					//  - Group that has a depth value same or one below elements depth will always be a match
-					//  - Otherwise, we search higher depth values as well, but we only use them if no elements in between those depth values
-					//    overlap the current elements bounds.
-					GUIMaterialGroup* foundGroup = nullptr;
+			renderData.meshElementLookup.resize(totalNumRenderElems);
+			renderData.meshElements.reserve(totalNumRenderElems);
 
-					if(spriteMaterial->allowBatching())
+			// Group the elements in such a way so that we end up with a smallest amount of
+			// meshes, without breaking back to front rendering order
+			FrameUnorderedMap<UINT64, FrameVector<GUIMaterialGroup>> materialGroups;
+			for (auto& elem : allElements)
+			{
+				GUIElement* guiElem = elem.element;
+				UINT32 renderElemIdx = elem.renderElement;
+				UINT32 elemDepth = guiElem->_getRenderElementDepth(renderElemIdx);
+
+				Rect2I tfrmedBounds = guiElem->_getClippedBounds();
+				tfrmedBounds.transform(guiElem->_getParentWidget()->getWorldTfrm());
+
+				SpriteMaterial* spriteMaterial = nullptr;
+				const SpriteMaterialInfo& matInfo = guiElem->_getMaterial(renderElemIdx, &spriteMaterial);
+				assert(spriteMaterial != nullptr);
+
+				UINT64 hash = spriteMaterial->getMergeHash(matInfo);
+				FrameVector<GUIMaterialGroup>& groupsPerMaterial = materialGroups[hash];
+				
+				// Try to find a group this material will fit in:
+				//  - Group that has a depth value same or one below elements depth will always be a match
+				//  - Otherwise, we search higher depth values as well, but we only use them if no elements in between those depth values
+				//    overlap the current elements bounds.
+				GUIMaterialGroup* foundGroup = nullptr;
+
+				if(spriteMaterial->allowBatching())
+				{
+					for (auto groupIter = groupsPerMaterial.rbegin(); groupIter != groupsPerMaterial.rend(); ++groupIter)
 					{
-						for (auto groupIter = groupsPerMaterial.rbegin(); groupIter != groupsPerMaterial.rend(); ++groupIter)
+						// If we separate meshes by widget, ignore any groups with widget parents other than mine
+						if (mSeparateMeshesByWidget)
 						{
-							// If we separate meshes by widget, ignore any groups with widget parents other than mine
-							if (mSeparateMeshesByWidget)
+							if (groupIter->elements.size() > 0)
 							{
-								if (groupIter->elements.size() > 0)
-								{
-									GUIElement* otherElem = groupIter->elements.begin()->element; // We only need to check the first element
-									if (otherElem->_getParentWidget() != guiElem->_getParentWidget())
-										continue;
-								}
+								GUIElement* otherElem = groupIter->elements.begin()->element; // We only need to check the first element
+								if (otherElem->_getParentWidget() != guiElem->_getParentWidget())
+									continue;
 							}
+						}
 
-							GUIMaterialGroup& group = *groupIter;
-							if (group.depth == elemDepth)
-							{
-								foundGroup = &group;
-								break;
-							}
-							else
-							{
-								UINT32 startDepth = elemDepth;
-								UINT32 endDepth = group.depth;
+						GUIMaterialGroup& group = *groupIter;
+						if (group.depth == elemDepth)
+						{
+							foundGroup = &group;
+							break;
+						}
+						else
+						{
+							UINT32 startDepth = elemDepth;
+							UINT32 endDepth = group.depth;
 
-								Rect2I potentialGroupBounds = group.bounds;
-								potentialGroupBounds.encapsulate(tfrmedBounds);
+							Rect2I potentialGroupBounds = group.bounds;
+							potentialGroupBounds.encapsulate(tfrmedBounds);
 
-								bool foundOverlap = false;
-								for (auto& material : materialGroups)
+							bool foundOverlap = false;
+							for (auto& material : materialGroups)
+							{
+								for (auto& matGroup : material.second)
 								{
-									for (auto& matGroup : material.second)
-									{
-										if (&matGroup == &group)
-											continue;
+									if (&matGroup == &group)
+										continue;
 
-										if ((matGroup.minDepth >= startDepth && matGroup.minDepth <= endDepth)
-											|| (matGroup.depth >= startDepth && matGroup.depth <= endDepth))
+									if ((matGroup.minDepth >= startDepth && matGroup.minDepth <= endDepth)
+										|| (matGroup.depth >= startDepth && matGroup.depth <= endDepth))
+									{
+										if (matGroup.bounds.overlaps(potentialGroupBounds))
 										{
-											if (matGroup.bounds.overlaps(potentialGroupBounds))
-											{
-												foundOverlap = true;
-												break;
-											}
+											foundOverlap = true;
+											break;
 										}
 									}
 								}
+							}
 
-								if (!foundOverlap)
-								{
-									foundGroup = &group;
-									break;
-								}
+							if (!foundOverlap)
+							{
+								foundGroup = &group;
+								break;
 							}
 						}
 					}
+				}
 
-					if (foundGroup == nullptr)
-					{
-						groupsPerMaterial.push_back(GUIMaterialGroup());
-						foundGroup = &groupsPerMaterial[groupsPerMaterial.size() - 1];
+				if (foundGroup == nullptr)
+				{
+					groupsPerMaterial.push_back(GUIMaterialGroup());
+					foundGroup = &groupsPerMaterial[groupsPerMaterial.size() - 1];
 
-						foundGroup->depth = elemDepth;
-						foundGroup->minDepth = elemDepth;
-						foundGroup->bounds = tfrmedBounds;
-						foundGroup->elements.push_back(GUIGroupElement(guiElem, renderElemIdx));
-						foundGroup->matInfo = matInfo.clone();
-						foundGroup->material = spriteMaterial;
+					foundGroup->depth = elemDepth;
+					foundGroup->minDepth = elemDepth;
+					foundGroup->bounds = tfrmedBounds;
+					foundGroup->elements.push_back(GUIGroupElement(guiElem, renderElemIdx, hash));
+					foundGroup->matInfo = matInfo.clone();
+					foundGroup->material = spriteMaterial;
 
-						guiElem->_getMeshInfo(renderElemIdx, foundGroup->numVertices, foundGroup->numIndices, foundGroup->meshType);
-					}
-					else
-					{
-						foundGroup->bounds.encapsulate(tfrmedBounds);
-						foundGroup->elements.push_back(GUIGroupElement(guiElem, renderElemIdx));
-						foundGroup->minDepth = std::min(foundGroup->minDepth, elemDepth);
-						
-						UINT32 numVertices;
-						UINT32 numIndices;
-						GUIMeshType meshType;
-						guiElem->_getMeshInfo(renderElemIdx, numVertices, numIndices, meshType);
-						assert(meshType == foundGroup->meshType); // It's expected that GUI element doesn't use same material for different mesh types so this should always be true
-
-						foundGroup->numVertices += numVertices;
-						foundGroup->numIndices += numIndices;
-
-						spriteMaterial->merge(foundGroup->matInfo, matInfo);
-					}
+					guiElem->_getMeshInfo(renderElemIdx, foundGroup->numVertices, foundGroup->numIndices, foundGroup->meshType);
+				}
+				else
+				{
+					foundGroup->bounds.encapsulate(tfrmedBounds);
+					foundGroup->elements.push_back(GUIGroupElement(guiElem, renderElemIdx, hash));
+					foundGroup->minDepth = std::min(foundGroup->minDepth, elemDepth);
+					
+					UINT32 numVertices;
+					UINT32 numIndices;
+					GUIMeshType meshType;
+					guiElem->_getMeshInfo(renderElemIdx, numVertices, numIndices, meshType);
+					assert(meshType == foundGroup->meshType); // It's expected that GUI element doesn't use same material for different mesh types so this should always be true
+
+					foundGroup->numVertices += numVertices;
+					foundGroup->numIndices += numIndices;
+
+					spriteMaterial->merge(foundGroup->matInfo, matInfo);
 				}
+			}
+
+			// Make a list of all GUI elements, sorted from farthest to nearest (highest depth to lowest)
+			auto groupComp = [](GUIMaterialGroup* a, GUIMaterialGroup* b)
+			{
+				return (a->depth > b->depth) || (a->depth == b->depth && a > b);
+				// Compare pointers just to differentiate between two elements with the same depth, their order doesn't really matter, but std::set
+				// requires all elements to be unique
+			};
+
+			UINT32 numMeshes = 0;
+			UINT32 numIndices[2] = { 0, 0 };
+			UINT32 numVertices[2] = { 0, 0 };
 
-				// Make a list of all GUI elements, sorted from farthest to nearest (highest depth to lowest)
-				auto groupComp = [](GUIMaterialGroup* a, GUIMaterialGroup* b)
+			FrameSet<GUIMaterialGroup*, std::function<bool(GUIMaterialGroup*, GUIMaterialGroup*)>> sortedGroups(groupComp);
+			for(auto& material : materialGroups)
+			{
+				for(auto& group : material.second)
 				{
-					return (a->depth > b->depth) || (a->depth == b->depth && a > b);
-					// Compare pointers just to differentiate between two elements with the same depth, their order doesn't really matter, but std::set
-					// requires all elements to be unique
-				};
+					sortedGroups.insert(&group);
 
-				UINT32 numMeshes = 0;
-				UINT32 numIndices[2] = { 0, 0 };
-				UINT32 numVertices[2] = { 0, 0 };
+					UINT32 typeIdx = (UINT32)group.meshType;
+					numIndices[typeIdx] += group.numIndices;
+					numVertices[typeIdx] += group.numVertices;
+
+					numMeshes++;
+				}
+			}
 
-				FrameSet<GUIMaterialGroup*, std::function<bool(GUIMaterialGroup*, GUIMaterialGroup*)>> sortedGroups(groupComp);
-				for(auto& material : materialGroups)
+			renderData.triangleMesh = nullptr;
+			renderData.lineMesh = nullptr;
+			renderData.triangleMeshData = nullptr;
+			renderData.lineMeshData = nullptr;
+
+			renderData.cachedMeshes.resize(numMeshes);
+
+			SPtr<MeshData> meshData[2];
+			SPtr<VertexDataDesc> vertexDesc[2] = { mTriangleVertexDesc, mLineVertexDesc };
+
+			UINT8* vertices[2] = { nullptr, nullptr };
+			UINT32* indices[2] = { nullptr, nullptr };
+
+			for(UINT32 i = 0; i < 2; i++)
+			{
+				if(numVertices[i] > 0 && numIndices[i] > 0)
 				{
-					for(auto& group : material.second)
-					{
-						sortedGroups.insert(&group);
+					meshData[i] = MeshData::create(numVertices[i], numIndices[i], vertexDesc[i]);
 
-						UINT32 typeIdx = (UINT32)group.meshType;
-						numIndices[typeIdx] += group.numIndices;
-						numVertices[typeIdx] += group.numVertices;
+					vertices[i] = meshData[i]->getElementData(VES_POSITION);
+					indices[i] = meshData[i]->getIndices32();
+				}
+			}
 
-						numMeshes++;
-					}
+			// Fill buffers for each group and update their meshes
+			UINT32 meshIdx = 0;
+			UINT32 vertexOffset[2] = { 0, 0 };
+			UINT32 indexOffset[2] = { 0, 0 };
+
+			for(auto& group : sortedGroups)
+			{
+				GUIWidget* widget;
+
+				if (group->elements.size() == 0)
+					widget = nullptr;
+				else
+				{
+					GUIElement* elem = group->elements.begin()->element;
+					widget = elem->_getParentWidget();
 				}
 
-				renderData.triangleMesh = nullptr;
-				renderData.lineMesh = nullptr;
+				GUIMeshData& guiMeshData = renderData.cachedMeshes[meshIdx];
+				guiMeshData.matInfo = group->matInfo;
+				guiMeshData.material = group->material;
+				guiMeshData.widget = widget;
+				guiMeshData.isLine = group->meshType == GUIMeshType::Line;
+
+				UINT32 typeIdx = (UINT32)group->meshType;
+				guiMeshData.indexOffset = indexOffset[typeIdx];
+				guiMeshData.firstElement = (UINT32)renderData.meshElements.size();
+				guiMeshData.numElements = (UINT32)group->elements.size();
 
-				renderData.cachedMeshes.resize(numMeshes);
+				UINT32 groupNumIndices = 0;
+				for(auto& matElement : group->elements)
+				{
+					matElement.element->_fillBuffer(
+						vertices[typeIdx], indices[typeIdx], 
+						vertexOffset[typeIdx], indexOffset[typeIdx], 
+						numVertices[typeIdx], numIndices[typeIdx], matElement.renderElement);
+
+					UINT32 elemNumVertices;
+					UINT32 elemNumIndices;
+					GUIMeshType meshType;
+					matElement.element->_getMeshInfo(matElement.renderElement, elemNumVertices, elemNumIndices, meshType);
+
+					UINT32 indexStart = indexOffset[typeIdx];
+					UINT32 indexEnd = indexStart + elemNumIndices;
+
+					for(UINT32 i = indexStart; i < indexEnd; i++)
+						indices[typeIdx][i] += vertexOffset[typeIdx];
+
+					GUIMeshElement meshElement;
+					meshElement.element = matElement.element;
+					meshElement.renderElement = matElement.renderElement;
+					meshElement.meshIdx = meshIdx;
+					meshElement.depth = matElement.element->_getRenderElementDepth(matElement.renderElement);
+					meshElement.mergeHash = matElement.mergeHash;
+					meshElement.meshType = meshType;
+					meshElement.vertexOffset = vertexOffset[typeIdx];
+					meshElement.numVertices = elemNumVertices;
+					meshElement.indexOffset = indexStart;
+					meshElement.numIndices = elemNumIndices;
+
+					const GUIMeshElementInfo& elementInfo = renderData.elementInfos[matElement.element];
+					renderData.meshElementLookup[elementInfo.firstRenderElement + matElement.renderElement] = 
+						(UINT32)renderData.meshElements.size();
+					renderData.meshElements.push_back(meshElement);
+
+					indexOffset[typeIdx] += elemNumIndices;
+					vertexOffset[typeIdx] += elemNumVertices;
+
+					groupNumIndices += elemNumIndices;
+				}
 
-				SPtr<MeshData> meshData[2];
-				SPtr<VertexDataDesc> vertexDesc[2] = { mTriangleVertexDesc, mLineVertexDesc };
+				guiMeshData.indexCount = groupNumIndices;
 
-				UINT8* vertices[2] = { nullptr, nullptr };
-				UINT32* indices[2] = { nullptr, nullptr };
+				meshIdx++;
+			}
 
-				for(UINT32 i = 0; i < 2; i++)
+			// Meshes are dynamic as they can get partially updated by updateMeshElements()
+			if(meshData[0])
+				renderData.triangleMesh = Mesh::_createPtr(meshData[0], MU_DYNAMIC, DOT_TRIANGLE_LIST);
+
+			if(meshData[1])
+				renderData.lineMesh = Mesh::_createPtr(meshData[1], MU_DYNAMIC, DOT_LINE_LIST);
+
+			renderData.triangleMeshData = meshData[0];
+			renderData.lineMeshData = meshData[1];
+		}
+
+		bs_frame_clear();
+	}
+
+	bool GUIManager::updateMeshElements(GUIRenderData& renderData, const Vector<GUIElement*>& updatedElements)
+	{
+		// Make sure all updated elements can keep their place in the existing batches
+		bool layoutChanged = false;
+		for(auto& element : updatedElements)
+		{
+			auto iterFind = renderData.elementInfos.find(element);
+			if(iterFind == renderData.elementInfos.end())
+			{
+				// Hidden elements aren't part of any batch
+				if(!element->_isVisible())
+					continue;
+
+				return false;
+			}
+
+			const GUIMeshElementInfo& info = iterFind->second;
+			if(!element->_isVisible() || element->_getNumRenderElements() != info.numRenderElements)
+				return false;
+
+			// Bounds are used for determining which elements can be batched without breaking the rendering order
+			if(element->_getClippedBounds() != info.bounds)
+				return false;
+
+			for(UINT32 i = 0; i < info.numRenderElements; i++)
+			{
+				const UINT32 meshElementIdx = renderData.meshElementLookup[info.firstRenderElement + i];
+				const GUIMeshElement& meshElement = renderData.meshElements[meshElementIdx];
+
+				SpriteMaterial* spriteMaterial = nullptr;
+				const SpriteMaterialInfo& matInfo = element->_getMaterial(i, &spriteMaterial);
+
+				UINT32 numVertices;
+				UINT32 numIndices;
+				GUIMeshType meshType;
+				element->_getMeshInfo(i, numVertices, numIndices, meshType);
+
+				if(meshType != meshElement.meshType || element->_getRenderElementDepth(i) != meshElement.depth)
+					return false;
+
+				if(spriteMaterial->getMergeHash(matInfo) != meshElement.mergeHash)
+					return false;
+
+				if(numVertices != meshElement.numVertices || numIndices != meshElement.numIndices)
+					layoutChanged = true;
+			}
+		}
+
+		bs_frame_mark();
+		{
+			const UINT32 numMeshElements = (UINT32)renderData.meshElements.size();
+			FrameVector<bool> dirtyElements(numMeshElements, false);
+			FrameVector<bool> dirtyMeshes(renderData.cachedMeshes.size(), false);
+			bool dirtyTypes[2] = { false, false };
+
+			for(auto& element : updatedElements)
+			{
+				auto iterFind = renderData.elementInfos.find(element);
+				if(iterFind == renderData.elementInfos.end())
+					continue;
+
+				const GUIMeshElementInfo& info = iterFind->second;
+				for(UINT32 i = 0; i < info.numRenderElements; i++)
 				{
-					if(numVertices[i] > 0 && numIndices[i] > 0)
-					{
-						meshData[i] = MeshData::create(numVertices[i], numIndices[i], vertexDesc[i]);
+					const UINT32 meshElementIdx = renderData.meshElementLookup[info.firstRenderElement + i];
+					GUIMeshElement& meshElement = renderData.meshElements[meshElementIdx];
 
-						vertices[i] = meshData[i]->getElementData(VES_POSITION);
-						indices[i] = meshData[i]->getIndices32();
-					}
+					element->_getMeshInfo(i, meshElement.numVertices, meshElement.numIndices, meshElement.meshType);
+
+					dirtyElements[meshElementIdx] = true;
+					dirtyMeshes[meshElement.meshIdx] = true;
+					dirtyTypes[(UINT32)meshElement.meshType] = true;
+				}
+			}
+
+			// Determine where each element ends up in the meshes, keeping the order of the batches
+			FrameVector<UINT32> vertexOffsets(numMeshElements);
+			FrameVector<UINT32> indexOffsets(numMeshElements);
+
+			UINT32 numVertices[2] = { 0, 0 };
+			UINT32 numIndices[2] = { 0, 0 };
+
+			for(UINT32 i = 0; i < numMeshElements; i++)
+			{
+				const GUIMeshElement& meshElement = renderData.meshElements[i];
+				UINT32 typeIdx = (UINT32)meshElement.meshType;
+
+				vertexOffsets[i] = numVertices[typeIdx];
+				indexOffsets[i] = numIndices[typeIdx];
+
+				numVertices[typeIdx] += meshElement.numVertices;
+				numIndices[typeIdx] += meshElement.numIndices;
+			}
+
+			SPtr<Mesh>* meshes[2] = { &renderData.triangleMesh, &renderData.lineMesh };
+			SPtr<MeshData>* cachedMeshData[2] = { &renderData.triangleMeshData, &renderData.lineMeshData };
+			SPtr<VertexDataDesc> vertexDesc[2] = { mTriangleVertexDesc, mLineVertexDesc };
+			DrawOperationType drawOps[2] = { DOT_TRIANGLE_LIST, DOT_LINE_LIST };
+
+			// Data of clean elements is copied from the previous mesh data, only dirty elements are re-emitted. A new 
+			// mesh data object is used as the previous one might still be in use by the core thread.
+			SPtr<MeshData> meshData[2];
+			UINT8* vertices[2] = { nullptr, nullptr };
+			UINT32* indices[2] = { nullptr, nullptr };
+			UINT8* oldVertices[2] = { nullptr, nullptr };
+			UINT32* oldIndices[2] = { nullptr, nullptr };
+			UINT32 vertexStride[2] = { 0, 0 };
+
+			for(UINT32 i = 0; i < 2; i++)
+			{
+				if(!dirtyTypes[i])
+					continue;
+
+				if(numVertices[i] > 0 && numIndices[i] > 0)
+				{
+					meshData[i] = MeshData::create(numVertices[i], numIndices[i], vertexDesc[i]);
+
+					vertices[i] = meshData[i]->getElementData(VES_POSITION);
+					indices[i] = meshData[i]->getIndices32();
+				}
+
+				const SPtr<MeshData>& oldMeshData = *cachedMeshData[i];
+				if(oldMeshData)
+				{
+					oldVertices[i] = oldMeshData->getElementData(VES_POSITION);
+					oldIndices[i] = oldMeshData->getIndices32();
 				}
 
-				// Fill buffers for each group and update their meshes
-				UINT32 meshIdx = 0;
-				UINT32 vertexOffset[2] = { 0, 0 };
-				UINT32 indexOffset[2] = { 0, 0 };
+				vertexStride[i] = vertexDesc[i]->getVertexStride();
+			}
+
+			for(UINT32 i = 0; i < numMeshElements; i++)
+			{
+				GUIMeshElement& meshElement = renderData.meshElements[i];
+				UINT32 typeIdx = (UINT32)meshElement.meshType;
 
-				for(auto& group : sortedGroups)
+				const UINT32 vertexOffset = vertexOffsets[i];
+				const UINT32 indexOffset = indexOffsets[i];
+
+				if(meshData[typeIdx] && meshElement.numVertices > 0 && meshElement.numIndices > 0)
 				{
-					GUIWidget* widget;
+					UINT32* elemIndices = indices[typeIdx] + indexOffset;
+					if(dirtyElements[i])
+					{
+						meshElement.element->_fillBuffer(
+							vertices[typeIdx], indices[typeIdx],
+							vertexOffset, indexOffset,
+							numVertices[typeIdx], numIndices[typeIdx], meshElement.renderElement);
 
-					if (group->elements.size() == 0)
-						widget = nullptr;
+						for(UINT32 j = 0; j < meshElement.numIndices; j++)
+							elemIndices[j] += vertexOffset;
+					}
 					else
 					{
-						GUIElement* elem = group->elements.begin()->element;
-						widget = elem->_getParentWidget();
+						const UINT32 stride = vertexStride[typeIdx];
+						memcpy(vertices[typeIdx] + vertexOffset * stride, 
+							oldVertices[typeIdx] + meshElement.vertexOffset * stride, meshElement.numVertices * stride);
+
+						const UINT32* oldElemIndices = oldIndices[typeIdx] + meshElement.indexOffset;
+						for(UINT32 j = 0; j < meshElement.numIndices; j++)
+							elemIndices[j] = oldElemIndices[j] - meshElement.vertexOffset + vertexOffset;
 					}
+				}
 
-					GUIMeshData& guiMeshData = renderData.cachedMeshes[meshIdx];
-					guiMeshData.matInfo = group->matInfo;
-					guiMeshData.material = group->material;
-					guiMeshData.widget = widget;
-					guiMeshData.isLine = group->meshType == GUIMeshType::Line;
+				meshElement.vertexOffset = vertexOffset;
+				meshElement.indexOffset = indexOffset;
+			}
 
-					UINT32 typeIdx = (UINT32)group->meshType;
-					guiMeshData.indexOffset = indexOffset[typeIdx];
+			for(UINT32 i = 0; i < 2; i++)
+			{
+				if(!dirtyTypes[i])
+					continue;
 
-					UINT32 groupNumIndices = 0;
-					for(auto& matElement : group->elements)
-					{
-						matElement.element->_fillBuffer(
-							vertices[typeIdx], indices[typeIdx], 
-							vertexOffset[typeIdx], indexOffset[typeIdx], 
-							numVertices[typeIdx], numIndices[typeIdx], matElement.renderElement);
+				SPtr<Mesh>& mesh = *meshes[i];
+				SPtr<MeshData>& oldMeshData = *cachedMeshData[i];
 
-						UINT32 elemNumVertices;
-						UINT32 elemNumIndices;
-						GUIMeshType meshType;
-						matElement.element->_getMeshInfo(matElement.renderElement, elemNumVertices, elemNumIndices, meshType);
+				if(!meshData[i])
+					mesh = nullptr;
+				else
+				{
+					// Write into the existing mesh if the size didn't change, otherwise create a new one
+					if(mesh && oldMeshData && oldMeshData->getNumVertices() == numVertices[i] && 
+						oldMeshData->getNumIndices() == numIndices[i])
+						mesh->writeData(meshData[i], true);
+					else
+						mesh = Mesh::_createPtr(meshData[i], MU_DYNAMIC, drawOps[i]);
+				}
 
-						UINT32 indexStart = indexOffset[typeIdx];
-						UINT32 indexEnd = indexStart + elemNumIndices;
+				oldMeshData = meshData[i];
+			}
 
-						for(UINT32 i = indexStart; i < indexEnd; i++)
-							indices[typeIdx][i] += vertexOffset[typeIdx];
+			// Update batch ranges and materials, as merged material information might depend on element contents
+			for(UINT32 i = 0; i < (UINT32)renderData.cachedMeshes.size(); i++)
+			{
+				GUIMeshData& guiMeshData = renderData.cachedMeshes[i];
+				if(guiMeshData.numElements == 0)
+					continue;
 
-						indexOffset[typeIdx] += elemNumIndices;
-						vertexOffset[typeIdx] += elemNumVertices;
+				if(layoutChanged)
+				{
+					guiMeshData.indexOffset = indexOffsets[guiMeshData.firstElement];
+					guiMeshData.indexCount = 0;
 
-						groupNumIndices += elemNumIndices;
-					}
+					for(UINT32 j = 0; j < guiMeshData.numElements; j++)
+						guiMeshData.indexCount += renderData.meshElements[guiMeshData.firstElement + j].numIndices;
+				}
 
-					guiMeshData.indexCount = groupNumIndices;
+				if(dirtyMeshes[i])
+				{
+					const GUIMeshElement& firstElement = renderData.meshElements[guiMeshData.firstElement];
 
-					meshIdx++;
-				}
+					SpriteMaterial* spriteMaterial = nullptr;
+					guiMeshData.matInfo = firstElement.element->_getMaterial(firstElement.renderElement, 
+						&spriteMaterial).clone();
 
-				if(meshData[0])
-					renderData.triangleMesh = Mesh::_createPtr(meshData[0], MU_STATIC, DOT_TRIANGLE_LIST);
+					for(UINT32 j = 1; j < guiMeshData.numElements; j++)
+					{
+						const GUIMeshElement& meshElement = renderData.meshElements[guiMeshData.firstElement + j];
 
-				if(meshData[1])
-					renderData.lineMesh = Mesh::_createPtr(meshData[1], MU_STATIC, DOT_LINE_LIST);
-			}
+						SpriteMaterial* elemMaterial = nullptr;
+						const SpriteMaterialInfo& matInfo = meshElement.element->_getMaterial(meshElement.renderElement,
+							&elemMaterial);
 
-			bs_frame_clear();
+						spriteMaterial->merge(guiMeshData.matInfo, matInfo);
+					}
+				}
+			}
 		}
+		bs_frame_clear();
+
+		return true;
 	}
 
 	void GUIManager::updateCaretTexture()
@@ -1491,6 +1786,19 @@ namespace bs
 		}
 	}
 
+	void GUIManager::onFontGlyphsChanged(const Font& font)
+	{
+		for(auto& widgetInfo : mWidgets)
+		{
+			for(auto& element : widgetInfo.widget->getElements())
+			{
+				const GUIElementStyle* style = element->_getStyle();
+				if(style != nullptr && style->font.isLoaded(false) && style->font.get() == &font)
+					element->_markLayoutAsDirty();
+			}
+		}
+	}
+
 	void GUIManager::onWindowFocusGained(RenderWindow& win)
 	{
 		for(auto& widgetInfo : mWidgets)
@@ -1723,6 +2031,20 @@ namespace bs
 		return nullptr;
 	}
 
+	void GUIManager::_getTriangleMesh(const Viewport* target, SPtr<Mesh>& mesh, SPtr<MeshData>& meshData) const
+	{
+		auto iterFind = mCachedGUIData.find(target);
+		if(iterFind == mCachedGUIData.end())
+		{
+			mesh = nullptr;
+			meshData = nullptr;
+			return;
+		}
+
+		mesh = iterFind->second.triangleMesh;
+		meshData = iterFind->second.triangleMeshData;
+	}
+
 	SPtr<RenderWindow> GUIManager::getBridgeWindow(const SPtr<RenderTexture>& target) const
 	{
 		if (target == nullptr)
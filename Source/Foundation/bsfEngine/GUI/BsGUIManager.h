@@ -58,6 +58,33 @@ namespace bs
 			SpriteMaterialInfo matInfo;
 			GUIWidget* widget;
 			bool isLine;
+
+			// Range of entries in GUIRenderData::meshElements that are part of this mesh
+			UINT32 firstElement = 0;
+			UINT32 numElements = 0;
+		};
+
+		/** Location of a single render element of a GUI element, within the meshes of a viewport. */
+		struct GUIMeshElement
+		{
+			GUIElement* element;
+			UINT32 renderElement;
+			UINT32 meshIdx;
+			UINT32 depth;
+			UINT64 mergeHash;
+			GUIMeshType meshType;
+			UINT32 vertexOffset;
+			UINT32 numVertices;
+			UINT32 indexOffset;
+			UINT32 numIndices;
+		};
+
+		/** Information about a GUI element whose render elements are part of the meshes of a viewport. */
+		struct GUIMeshElementInfo
+		{
+			UINT32 firstRenderElement;
+			UINT32 numRenderElements;
+			Rect2I bounds;
 		};
 
 		/**	GUI render data for a single viewport. */
@@ -69,9 +96,16 @@ namespace bs
 
 			SPtr<Mesh> triangleMesh;
 			SPtr<Mesh> lineMesh;
+			SPtr<MeshData> triangleMeshData;
+			SPtr<MeshData> lineMeshData;
 			Vector<GUIMeshData> cachedMeshes;
 			Vector<GUIWidget*> widgets;
 			bool isDirty;
+
+			// Batch layout of the last full rebuild, allowing dirty elements to be updated without regrouping
+			Vector<GUIMeshElement> meshElements; // In the order they are stored in the meshes
+			Vector<UINT32> meshElementLookup; // GUIMeshElementInfo::firstRenderElement + render element -> meshElements
+			UnorderedMap<GUIElement*, GUIMeshElementInfo> elementInfos;
 		};
 
 		/**	Render data for a single GUI group used for notifying the core GUI renderer. */
@@ -240,12 +274,38 @@ namespace bs
 		/**	Returns the parent render window of the specified widget. */
 		const RenderWindow* getWidgetWindow(const GUIWidget& widget) const;
 
+		/**
+		 * Returns the mesh that triangle GUI elements rendered on the provided viewport were batched in during the last
+		 * update, along with the data it was last written with. Outputs null if the viewport has no such elements.
+		 * Primarily useful for debugging and testing.
+		 */
+		void _getTriangleMesh(const Viewport* target, SPtr<Mesh>& mesh, SPtr<MeshData>& meshData) const;
+
 	private:
 		friend class ct::GUIRenderer;
 
 		/**	Recreates all dirty GUI meshes and makes them ready for rendering. */
 		void updateMeshes();
 
+		/** 
+		 * Groups all visible elements of a viewport into batches and builds the viewport meshes from scratch. Records the
+		 * resulting batch layout so further changes can be handled by updateMeshElements(). 
+		 */
+		void rebuildMeshes(GUIRenderData& renderData);
+
+		/**
+		 * Re-emits the mesh data of the provided elements, keeping the existing batch layout. Batches are only rebuilt if
+		 * the number of vertices or indices of an element changes, in which case data of clean elements is copied over
+		 * rather than regenerated.
+		 *
+		 * @param[in]	renderData		Render data of the viewport the elements are rendered on.
+		 * @param[in]	updatedElements	Elements whose render elements were updated since the meshes were last built.
+		 * @return						False if the elements changed in a way that requires them to be regrouped (e.g.
+		 *								their depth, material or bounds changed) in which case the meshes weren't
+		 *								modified and rebuildMeshes() needs to be called instead.
+		 */
+		bool updateMeshElements(GUIRenderData& renderData, const Vector<GUIElement*>& updatedElements);
+
 		/**	Recreates the input caret texture. */
 		void updateCaretTexture();
 
@@ -304,6 +364,9 @@ namespace bs
 		/**	Called by the drag and drop managed to notify us the drag ended. */
 		void onMouseDragEnded(const PointerEvent& event, DragCallbackInfo& dragInfo);
 
+		/** Called when glyphs of a font change, requiring any text using the font to be laid out again. */
+		void onFontGlyphsChanged(const Font& font);
+
 		/**	Called when the specified window gains focus. */
 		void onWindowFocusGained(RenderWindow& win);
 
@@ -368,6 +431,7 @@ namespace bs
 
 		Vector<WidgetInfo> mWidgets;
 		UnorderedMap<const Viewport*, GUIRenderData> mCachedGUIData;
+		Vector<GUIElement*> mUpdatedElements;
 
 		SPtr<ct::GUIRenderer> mRenderer;
 		bool mCoreDirty;
@@ -433,6 +497,7 @@ namespace bs
 		HEvent mOnVirtualButtonDown;
 
 		HEvent mDragEndedConn;
+		HEvent mFontGlyphsChangedConn;
 
 		HEvent mWindowGainedFocusConn;
 		HEvent mWindowLostFocusConn;
@@ -366,6 +366,42 @@ namespace bs
 		return dirty;
 	}
 
+	bool GUIWidget::isDirty(bool& meshDirty, Vector<GUIElement*>& updatedElements)
+	{
+		meshDirty = false;
+
+		if (!mIsActive)
+			return false;
+
+		const bool dirty = mWidgetIsDirty || !mDirtyContents.empty();
+		if(!dirty)
+			return false;
+
+		meshDirty = mWidgetIsDirty;
+		mWidgetIsDirty = false;
+
+		// Update render contents recursively because updates can cause child GUI elements to become dirty
+		while(!mDirtyContents.empty())
+		{
+			mDirtyContentsTemp.swap(mDirtyContents);
+
+			for (auto& dirtyElement : mDirtyContentsTemp)
+			{
+				dirtyElement->_updateRenderElements();
+				updatedElements.push_back(dirtyElement);
+			}
+
+			mDirtyContentsTemp.clear();
+		}
+
+		// Updates can cause elements to be added, removed or hidden
+		meshDirty |= mWidgetIsDirty;
+		mWidgetIsDirty = false;
+
+		updateBounds();
+		return true;
+	}
+
 	bool GUIWidget::inBounds(const Vector2I& position) const
 	{
 		Viewport* target = getTarget();
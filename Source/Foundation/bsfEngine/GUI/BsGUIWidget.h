@@ -69,6 +69,19 @@ namespace bs
 		 */
 		bool isDirty(bool cleanIfDirty);
 
+		/**
+		 * Return true if widget or any of its elements are dirty. All dirty elements will be updated and widget will be
+		 * marked as clean.
+		 *
+		 * @param[out]	meshDirty		Set to true if the widget's elements were added, removed, changed visibility or 
+		 *								the widget itself changed in a way that requires all of its meshes to be rebuilt.
+		 *								Otherwise only the contents of the elements in @p updatedElements changed.
+		 * @param[out]	updatedElements	Elements that had their render elements updated. Elements might be listed more than
+		 *								once.
+		 * @return						True if dirty, false if not. The returned state is the one before cleaning.
+		 */
+		bool isDirty(bool& meshDirty, Vector<GUIElement*>& updatedElements);
+
 		/**	Returns the viewport that this widget will be rendered on. */
 		Viewport* getTarget() const;
 
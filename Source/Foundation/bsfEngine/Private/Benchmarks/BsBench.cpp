@@ -0,0 +1,100 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Private/Benchmarks/BsEngineBenchmarkSuite.h"
+#include "Private/Benchmarks/BsCoreBenchmarkSuite.h"
+#include "Private/Benchmarks/BsUtilityBenchmarkSuite.h"
+#include "Testing/BsBenchmarkOutput.h"
+#include "FileSystem/BsPath.h"
+#include <iostream>
+
+/**
+ * Runs all the framework benchmarks using the null render API, renderer, audio and physics plugins, optionally saving
+ * the results and comparing them against a previously saved baseline. A different renderer plugin can be provided, for
+ * benchmarks that depend on the renderer (e.g. bsfRenderBeast).
+ *
+ * Usage: bsfBench [--filter <text>] [--repetitions <count>] [--warmup <count>] [--min-time <ms>] [--output <path>]
+ *                 [--baseline <path>] [--tolerance <fraction>] [--renderer <plugin>]
+ *
+ * Returns 0 on success, 1 if any benchmark regressed compared to the baseline and 2 on invalid input.
+ */
+int main(int argc, char * argv[])
+{
+	using namespace bs;
+
+	BenchmarkSettings settings;
+	Path outputPath;
+	Path baselinePath;
+	double tolerance = 0.1;
+	String renderer = "bsfNullRenderer";
+
+	for(int i = 1; i < argc; i++)
+	{
+		const bool hasValue = i + 1 < argc;
+		if(strcmp(argv[i], "--filter") == 0 && hasValue)
+			settings.filter = argv[++i];
+		else if(strcmp(argv[i], "--repetitions") == 0 && hasValue)
+			settings.repetitions = (UINT32)std::max(atoi(argv[++i]), 1);
+		else if(strcmp(argv[i], "--warmup") == 0 && hasValue)
+			settings.warmupRepetitions = (UINT32)std::max(atoi(argv[++i]), 0);
+		else if(strcmp(argv[i], "--min-time") == 0 && hasValue)
+			settings.minRepetitionTimeMs = atof(argv[++i]);
+		else if(strcmp(argv[i], "--output") == 0 && hasValue)
+			outputPath = argv[++i];
+		else if(strcmp(argv[i], "--baseline") == 0 && hasValue)
+			baselinePath = argv[++i];
+		else if(strcmp(argv[i], "--tolerance") == 0 && hasValue)
+			tolerance = atof(argv[++i]);
+		else if(strcmp(argv[i], "--renderer") == 0 && hasValue)
+			renderer = argv[++i];
+		else
+		{
+			std::cout << "Unknown or incomplete argument: " << argv[i] << std::endl;
+			return 2;
+		}
+	}
+
+	Vector<BenchmarkResult> baseline;
+	if(!baselinePath.isEmpty() && !BenchmarkUtility::loadResults(baselinePath, baseline))
+	{
+		std::cout << "Unable to read the baseline results from: " << baselinePath.toString() << std::endl;
+		return 2;
+	}
+
+	START_UP_DESC desc;
+	desc.renderAPI = "bsfNullRenderAPI";
+	desc.renderer = renderer;
+	desc.audio = "bsfNullAudio";
+	desc.physics = "bsfNullPhysics";
+	desc.importers.push_back("bsfFreeImgImporter");
+	desc.importers.push_back("bsfFBXImporter");
+
+	desc.primaryWindowDesc.videoMode = VideoMode(64, 64);
+	desc.primaryWindowDesc.fullscreen = false;
+	desc.primaryWindowDesc.title = "bsf benchmark";
+	desc.primaryWindowDesc.hidden = true;
+
+	Application::startUp<BenchmarkApplication>(desc);
+
+	// Frames should run as fast as possible
+	gApplication().setFPSLimit(0);
+
+	SPtr<BenchmarkSuite> benchmarks = BenchmarkSuite::create<UtilityBenchmarkSuite>();
+	benchmarks->add(BenchmarkSuite::create<CoreBenchmarkSuite>());
+	benchmarks->add(BenchmarkSuite::create<EngineBenchmarkSuite>());
+
+	ConsoleBenchmarkOutput output;
+	benchmarks->run(settings, output);
+	benchmarks = nullptr;
+
+	Application::shutDown();
+
+	const Vector<BenchmarkResult>& results = output.getResults();
+	if(!outputPath.isEmpty() && !BenchmarkUtility::saveResults(outputPath, results))
+		std::cout << "Unable to write the results to: " << outputPath.toString() << std::endl;
+
+	if(baselinePath.isEmpty())
+		return 0;
+
+	std::cout << std::endl << "Comparison against " << baselinePath.toString() << ":" << std::endl;
+	return BenchmarkUtility::compareResults(results, baseline, tolerance) > 0 ? 1 : 0;
+}
@@ -0,0 +1,982 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Private/Benchmarks/BsEngineBenchmarkSuite.h"
+#include "Resources/BsBuiltinResources.h"
+#include "Scene/BsSceneObject.h"
+#include "Scene/BsPrefab.h"
+#include "Scene/BsSceneManager.h"
+#include "Components/BsCCamera.h"
+#include "Components/BsCRenderable.h"
+#include "Components/BsCRigidbody.h"
+#include "Components/BsCBoxCollider.h"
+#include "RenderAPI/BsRenderTexture.h"
+#include "RenderAPI/BsViewport.h"
+#include "GUI/BsGUIManager.h"
+#include "GUI/BsGUIWidget.h"
+#include "GUI/BsGUIPanel.h"
+#include "GUI/BsGUILabel.h"
+#include "GUI/BsGUIContent.h"
+#include "Renderer/BsRenderQueue.h"
+#include "Math/BsRandom.h"
+#include "Material/BsMaterial.h"
+#include "Renderer/BsRenderer.h"
+#include "Renderer/BsRendererManager.h"
+#include "Material/BsMaterialParamId.h"
+#include "Material/BsShader.h"
+#include "Material/BsTechnique.h"
+#include "Material/BsPass.h"
+#include "Material/BsGpuParamsSet.h"
+#include "RenderAPI/BsGpuParamDesc.h"
+#include "RenderAPI/BsGpuProgram.h"
+#include "Managers/BsGpuProgramManager.h"
+#include "CoreThread/BsCoreThread.h"
+#include "Importer/BsImporter.h"
+#include "Importer/BsMeshImportOptions.h"
+#include "Threading/BsTaskScheduler.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+#include "Private/UnitTests/BsEngineTestAssets.h"
+#include "Mesh/BsMeshData.h"
+#include "Mesh/BsMeshUtility.h"
+#include "RenderAPI/BsVertexDataDesc.h"
+#include "RenderAPI/BsSubMesh.h"
+#include "Utility/BsShapeMeshes3D.h"
+
+namespace bs
+{
+	/** Number of objects along each side of the grid of objects created by the scene benchmarks. */
+	static constexpr UINT32 GRID_SIZE = 16;
+
+	/** Number of elements along each side of the grid of labels created by the GUI benchmarks. */
+	static constexpr UINT32 GUI_GRID_SIZE = 100;
+
+	/** Size of a single label created by the GUI benchmarks, in pixels. */
+	static constexpr UINT32 GUI_ELEMENT_SIZE = 10;
+
+	/** Number of scene objects in the hierarchy spawned by the prefab benchmarks. */
+	static constexpr UINT32 PREFAB_NUM_OBJECTS = 50;
+
+	/** Number of hierarchies spawned during a single iteration of the prefab benchmarks. */
+	static constexpr UINT32 PREFAB_NUM_INSTANCES = 10000;
+
+	/** Number of components updated by the component update benchmarks. */
+	static constexpr UINT32 NUM_UPDATED_COMPONENTS = 10000;
+
+	/** Number of elements sorted by the render queue benchmarks. */
+	static constexpr UINT32 NUM_SORTED_ELEMENTS = 10000;
+
+	/** Render queue filled with random sort parameters, that can be sorted using either of its sorting methods. */
+	class BenchmarkRenderQueue : public ct::RenderQueue
+	{
+	public:
+		BenchmarkRenderQueue()
+			:RenderQueue(ct::StateReduction::Distance)
+		{
+			// Typical opaque queue contents: few priorities, a few dozen shaders and mostly unique distances
+			Random random(1);
+			for(UINT32 i = 0; i < NUM_SORTED_ELEMENTS; i++)
+			{
+				mSortableElementIdx.push_back(i);
+				mSortableElements.emplace_back();
+
+				auto& entry = mSortableElements.back();
+				entry.seqIdx = i;
+				entry.priority = (INT32)(random.get() % 2);
+				entry.distFromCamera = random.getUNorm() * 1000.0f;
+				entry.shaderId = random.get() % 32;
+				entry.techniqueIdx = 0;
+				entry.passIdx = 0;
+
+				mElements.push_back(nullptr);
+			}
+
+			mSortKeysTemp.resize(NUM_SORTED_ELEMENTS);
+			mSortableElementIdxTemp.resize(NUM_SORTED_ELEMENTS);
+		}
+
+		/** Sorts the elements by generating sort keys and radix sorting them, as done by sort(). */
+		void sortWithKeys()
+		{
+			generateSortKeys();
+			radixSort(mSortKeys.data(), mSortableElementIdx.data(), mSortKeysTemp.data(), 
+				mSortableElementIdxTemp.data(), NUM_SORTED_ELEMENTS);
+		}
+
+		/** Sorts the elements using the element sorter callbacks, as done by sort() if keys can't be generated. */
+		void sortWithCallbacks()
+		{
+			for(UINT32 i = 0; i < NUM_SORTED_ELEMENTS; i++)
+				mSortableElementIdx[i] = i;
+
+			std::sort(mSortableElementIdx.begin(), mSortableElementIdx.end(), 
+				[this](UINT32 a, UINT32 b) { return elementSorterPreferDistance(a, b, mSortableElements); });
+		}
+
+		/** Returns the index of the first element in the sorted order. */
+		UINT32 getFirst() const { return mSortableElementIdx[0]; }
+	};
+
+	/** Number of materials updated by the material parameter benchmarks. */
+	static constexpr UINT32 NUM_UPDATED_MATERIALS = 10000;
+
+	/** Number of parameters modified on each material, every iteration of the material parameter benchmarks. */
+	static constexpr UINT32 NUM_MODIFIED_PARAMS = 2;
+
+	/** Language of the GPU programs created by BenchmarkGpuProgramFactory. */
+	static const char* BENCHMARK_GPU_PROGRAM_LANGUAGE = "bsfbenchmark";
+
+	/**
+	 * Fragment program reporting a block of float parameters named gValue0, gValue1, .... Other program types have no
+	 * parameters. Used in place of compiled programs, which the null render API doesn't provide parameter information for.
+	 */
+	class BenchmarkGpuProgram : public ct::GpuProgram
+	{
+	public:
+		static constexpr UINT32 NUM_DATA_PARAMS = 32;
+
+		BenchmarkGpuProgram(const GPU_PROGRAM_DESC& desc)
+			:GpuProgram(desc, GDF_DEFAULT)
+		{
+			if(desc.type != GPT_FRAGMENT_PROGRAM)
+				return;
+
+			GpuParamBlockDesc blockDesc;
+			blockDesc.name = "BenchmarkParams";
+			blockDesc.slot = 0;
+			blockDesc.set = 0;
+			blockDesc.blockSize = NUM_DATA_PARAMS;
+			blockDesc.isShareable = true;
+
+			mParametersDesc->paramBlocks[blockDesc.name] = blockDesc;
+
+			for(UINT32 i = 0; i < NUM_DATA_PARAMS; i++)
+			{
+				GpuParamDataDesc paramDesc;
+				paramDesc.name = "gValue" + toString(i);
+				paramDesc.elementSize = 1;
+				paramDesc.arraySize = 1;
+				paramDesc.arrayElementStride = 1;
+				paramDesc.type = GPDT_FLOAT1;
+				paramDesc.paramBlockSlot = blockDesc.slot;
+				paramDesc.paramBlockSet = blockDesc.set;
+				paramDesc.gpuMemOffset = i;
+				paramDesc.cpuMemOffset = i;
+
+				mParametersDesc->params[paramDesc.name] = paramDesc;
+			}
+		}
+	};
+
+	class BenchmarkGpuProgramFactory : public ct::GpuProgramFactory
+	{
+	public:
+		SPtr<ct::GpuProgram> create(const GPU_PROGRAM_DESC& desc, GpuDeviceFlags deviceMask) override
+		{
+			SPtr<ct::GpuProgram> program = bs_shared_ptr_new<BenchmarkGpuProgram>(desc);
+			program->_setThisPtr(program);
+
+			return program;
+		}
+
+		SPtr<ct::GpuProgram> create(GpuProgramType type, GpuDeviceFlags deviceMask) override
+		{
+			GPU_PROGRAM_DESC desc;
+			desc.type = type;
+
+			return create(desc, deviceMask);
+		}
+
+		SPtr<GpuProgramBytecode> compileBytecode(const GPU_PROGRAM_DESC& desc) override
+		{
+			return nullptr;
+		}
+	};
+
+	/** Materials and their parameter sets, as kept by the renderer for each renderable. */
+	struct BenchmarkMaterials
+	{
+		Vector<HMaterial> materials;
+		Vector<SPtr<GpuParamsSet>> paramsSets;
+		Vector<MaterialParamFloat> params;
+	};
+
+	/**
+	 * Registers the benchmark GPU program factory, and creates materials using the programs it creates. Each material has
+	 * its own parameter set, fully updated once.
+	 */
+	static void createBenchmarkMaterials(BenchmarkGpuProgramFactory& factory, BenchmarkMaterials& output)
+	{
+		gCoreThread().queueCommand([&factory]()
+		{
+			ct::GpuProgramManager::instance().addFactory(BENCHMARK_GPU_PROGRAM_LANGUAGE, &factory);
+		});
+		gCoreThread().submit(true);
+
+		SHADER_DESC shaderDesc;
+		for(UINT32 i = 0; i < BenchmarkGpuProgram::NUM_DATA_PARAMS; i++)
+			shaderDesc.addParameter(SHADER_DATA_PARAM_DESC("value" + toString(i), "gValue" + toString(i), GPDT_FLOAT1));
+
+		// Sources are ignored, but passes only create programs with non-empty sources
+		PASS_DESC passDesc;
+		passDesc.vertexProgramDesc.source = "benchmark";
+		passDesc.vertexProgramDesc.language = BENCHMARK_GPU_PROGRAM_LANGUAGE;
+		passDesc.vertexProgramDesc.type = GPT_VERTEX_PROGRAM;
+		passDesc.fragmentProgramDesc.source = "benchmark";
+		passDesc.fragmentProgramDesc.language = BENCHMARK_GPU_PROGRAM_LANGUAGE;
+		passDesc.fragmentProgramDesc.type = GPT_FRAGMENT_PROGRAM;
+
+		shaderDesc.techniques.push_back(Technique::create(BENCHMARK_GPU_PROGRAM_LANGUAGE, { Pass::create(passDesc) }));
+		HShader shader = Shader::create("BenchmarkShader", shaderDesc);
+
+		output.materials.resize(NUM_UPDATED_MATERIALS);
+		output.paramsSets.resize(NUM_UPDATED_MATERIALS);
+		for(UINT32 i = 0; i < NUM_UPDATED_MATERIALS; i++)
+		{
+			output.materials[i] = Material::create(shader);
+			output.paramsSets[i] = output.materials[i]->createParamsSet();
+			output.materials[i]->updateParamsSet(output.paramsSets[i], 0.0f, true);
+
+			for(UINT32 j = 0; j < NUM_MODIFIED_PARAMS; j++)
+				output.params.push_back(output.materials[i]->getParamFloat("value" + toString(j * 7)));
+		}
+	}
+
+	/** Releases the materials created by createBenchmarkMaterials() and unregisters the GPU program factory. */
+	static void destroyBenchmarkMaterials(BenchmarkMaterials& materials)
+	{
+		materials = BenchmarkMaterials();
+
+		gCoreThread().queueCommand([]()
+		{
+			ct::GpuProgramManager::instance().removeFactory(BENCHMARK_GPU_PROGRAM_LANGUAGE);
+		});
+		gCoreThread().submit(true);
+	}
+
+	/** Number of parameter assignments performed during a single iteration of the material parameter set benchmarks. */
+	static constexpr UINT32 NUM_PARAM_SETS = 1000000;
+
+	/** Number of distinct shaders used by materials in the material parameter set benchmarks. */
+	static constexpr UINT32 NUM_PARAM_SET_SHADERS = 8;
+
+	/** Creates two materials for each of NUM_PARAM_SET_SHADERS shaders, each with a float parameter named "intensity". */
+	static Vector<HMaterial> createParamSetMaterials()
+	{
+		SHADER_DESC shaderDesc;
+		shaderDesc.addParameter(SHADER_DATA_PARAM_DESC("intensity", "gIntensity", GPDT_FLOAT1));
+		shaderDesc.addParameter(SHADER_DATA_PARAM_DESC("tint", "gTint", GPDT_COLOR));
+		shaderDesc.addParameter(SHADER_DATA_PARAM_DESC("offset", "gOffset", GPDT_FLOAT4));
+
+		Vector<HMaterial> materials;
+		for(UINT32 i = 0; i < NUM_PARAM_SET_SHADERS; i++)
+		{
+			HShader shader = Shader::create("BenchmarkShader", shaderDesc);
+			materials.push_back(Material::create(shader));
+			materials.push_back(Material::create(shader));
+		}
+
+		return materials;
+	}
+
+	/** Component performing a small amount of self-contained work every update, like a typical gameplay component. */
+	class BenchmarkComponent : public Component
+	{
+	public:
+		BenchmarkComponent(const HSceneObject& parent, bool parallel)
+			:Component(parent)
+		{
+			setFlag(ComponentFlag::ParallelUpdate, parallel);
+		}
+
+		void update() override
+		{
+			mAngle += 0.01f;
+			mVelocity = Vector3(Math::cos(Radian(mAngle)), 0.0f, Math::sin(Radian(mAngle)));
+			mPosition += mVelocity * (1.0f / 60.0f);
+		}
+
+	private:
+		float mAngle = 0.0f;
+		Vector3 mVelocity = Vector3::ZERO;
+		Vector3 mPosition = Vector3::ZERO;
+	};
+
+	/** Creates a root object with a child object holding a benchmark component for each benchmarked component. */
+	static HSceneObject createBenchmarkComponents(bool parallel)
+	{
+		HSceneObject root = SceneObject::create("BenchmarkRoot");
+		for(UINT32 i = 0; i < NUM_UPDATED_COMPONENTS; i++)
+		{
+			HSceneObject so = SceneObject::create("Component");
+			so->setParent(root);
+			so->addComponent<BenchmarkComponent>(parallel);
+		}
+
+		// Sorts the components into update buckets, so only the updates themselves are measured
+		gSceneManager()._update();
+		return root;
+	}
+
+	/** Creates a camera, and a grid of box renderables parented to a single root object which is returned. */
+	static HSceneObject createBenchmarkScene(bool physics)
+	{
+		HSceneObject root = SceneObject::create("BenchmarkRoot");
+
+		HSceneObject cameraSO = SceneObject::create("Camera");
+		cameraSO->setParent(root);
+		cameraSO->setPosition(Vector3(0.0f, GRID_SIZE * 1.0f, GRID_SIZE * 2.0f));
+		cameraSO->lookAt(Vector3::ZERO);
+
+		HCamera camera = cameraSO->addComponent<CCamera>();
+		camera->setMain(true);
+
+		const HMesh boxMesh = BuiltinResources::instance().getMesh(BuiltinMesh::Box);
+		for(UINT32 y = 0; y < GRID_SIZE; y++)
+		{
+			for(UINT32 x = 0; x < GRID_SIZE; x++)
+			{
+				HSceneObject boxSO = SceneObject::create("Box");
+				boxSO->setParent(root);
+				boxSO->setPosition(Vector3(x * 2.0f - GRID_SIZE, physics ? 5.0f : 0.0f, y * 2.0f - GRID_SIZE));
+
+				HRenderable renderable = boxSO->addComponent<CRenderable>();
+				renderable->setMesh(boxMesh);
+
+				if(physics)
+				{
+					boxSO->addComponent<CBoxCollider>();
+					boxSO->addComponent<CRigidbody>();
+				}
+			}
+		}
+
+		return root;
+	}
+
+	/** Number of renderables along each side of the grid rendered by the instancing benchmarks. */
+	static constexpr UINT32 INSTANCING_GRID_SIZE = 32;
+
+	/** Returns true if the active renderer is RenderBeast, which implements instancing. */
+	static bool isInstancingRendererActive()
+	{
+		SPtr<ct::Renderer> renderer = RendererManager::instance().getActive();
+		return renderer != nullptr && renderer->getName() == StringID("RenderBeast");
+	}
+
+	/**
+	 * Creates a camera looking at a grid of box renderables. If @p sharedMaterial is true all renderables use the same
+	 * material and can be drawn with instancing, otherwise each gets its own material and is drawn separately.
+	 */
+	static HSceneObject createInstancingBenchmarkScene(bool sharedMaterial)
+	{
+		HSceneObject root = SceneObject::create("BenchmarkRoot");
+
+		HSceneObject cameraSO = SceneObject::create("Camera");
+		cameraSO->setParent(root);
+		cameraSO->setPosition(Vector3(0.0f, 0.0f, INSTANCING_GRID_SIZE * 3.0f));
+		cameraSO->lookAt(Vector3::ZERO);
+
+		HCamera camera = cameraSO->addComponent<CCamera>();
+		camera->setMain(true);
+
+		const HShader shader = BuiltinResources::instance().getBuiltinShader(BuiltinShader::Standard);
+		const HMesh boxMesh = BuiltinResources::instance().getMesh(BuiltinMesh::Box);
+		const HMaterial material = Material::create(shader);
+
+		for(UINT32 y = 0; y < INSTANCING_GRID_SIZE; y++)
+		{
+			for(UINT32 x = 0; x < INSTANCING_GRID_SIZE; x++)
+			{
+				HSceneObject boxSO = SceneObject::create("Box");
+				boxSO->setParent(root);
+				boxSO->setPosition(Vector3(x * 2.0f - INSTANCING_GRID_SIZE, y * 2.0f - INSTANCING_GRID_SIZE, 0.0f));
+
+				HRenderable renderable = boxSO->addComponent<CRenderable>();
+				renderable->setMesh(boxMesh);
+				renderable->setMaterial(sharedMaterial ? material : Material::create(shader));
+			}
+		}
+
+		return root;
+	}
+
+	/**
+	 * Measures frames rendering the instancing benchmark scene. Only runs with RenderBeast (see the --renderer option of
+	 * bsfBench), as other renderers don't draw anything.
+	 */
+	static void benchFrameInstancing(Benchmark& bench, bool sharedMaterial)
+	{
+		if(!isInstancingRendererActive())
+			return;
+
+		BenchmarkApplication& app = static_cast<BenchmarkApplication&>(gApplication());
+		HSceneObject root = createInstancingBenchmarkScene(sharedMaterial);
+
+		// Lets the renderer register the renderables and their materials
+		app.runFrames(2);
+
+		bench.setItemsPerIteration(INSTANCING_GRID_SIZE * INSTANCING_GRID_SIZE);
+		bench.measure([&app]() { app.runFrames(1); });
+
+		root->destroy();
+		app.runFrames(1);
+	}
+
+	/** 
+	 * Creates a GUI widget with a grid of single character labels, rendered by a camera to an off-screen target large 
+	 * enough for all the labels to be visible. 
+	 */
+	static SPtr<GUIWidget> createBenchmarkGUI(HCamera& camera, Vector<GUILabel*>& labels)
+	{
+		TEXTURE_DESC textureDesc;
+		textureDesc.type = TEX_TYPE_2D;
+		textureDesc.width = GUI_GRID_SIZE * GUI_ELEMENT_SIZE;
+		textureDesc.height = GUI_GRID_SIZE * GUI_ELEMENT_SIZE;
+		textureDesc.format = PF_RGBA8;
+		textureDesc.usage = TU_RENDERTARGET;
+
+		HSceneObject cameraSO = SceneObject::create("GUICamera");
+		camera = cameraSO->addComponent<CCamera>();
+		camera->getViewport()->setTarget(RenderTexture::create(textureDesc, false));
+
+		SPtr<GUIWidget> widget = GUIWidget::create(camera);
+		for(UINT32 y = 0; y < GUI_GRID_SIZE; y++)
+		{
+			for(UINT32 x = 0; x < GUI_GRID_SIZE; x++)
+			{
+				GUILabel* label = widget->getPanel()->addNewElement<GUILabel>(HString("A"));
+				label->setPosition(x * GUI_ELEMENT_SIZE, y * GUI_ELEMENT_SIZE);
+				label->setSize(GUI_ELEMENT_SIZE, GUI_ELEMENT_SIZE);
+
+				labels.push_back(label);
+			}
+		}
+
+		gGUIManager().update();
+		return widget;
+	}
+
+	/** Creates a hierarchy of scene objects, half of which have a renderable component, as a prefab would contain. */
+	static HSceneObject createBenchmarkHierarchy()
+	{
+		const HMesh boxMesh = BuiltinResources::instance().getMesh(BuiltinMesh::Box);
+
+		Vector<HSceneObject> objects;
+		for(UINT32 i = 0; i < PREFAB_NUM_OBJECTS; i++)
+		{
+			HSceneObject so = SceneObject::create("Node");
+			so->setPosition(Vector3((float)i, 0.0f, 0.0f));
+
+			if(i > 0)
+				so->setParent(objects[(i - 1) / 4], false);
+
+			if((i % 2) == 0)
+				so->addComponent<CRenderable>()->setMesh(boxMesh);
+
+			objects.push_back(so);
+		}
+
+		return objects[0];
+	}
+
+	/** Number of meshes in the FBX file imported by the FBX import benchmarks. */
+	static constexpr UINT32 FBX_NUM_MESHES = 256;
+
+	/** Number of quads along each side of a mesh in the FBX file imported by the FBX import benchmarks. */
+	static constexpr UINT32 FBX_GRID_SIZE = 16;
+
+	/** Number of keyframes of every animation curve in the FBX file imported by the FBX import benchmarks. */
+	static constexpr UINT32 FBX_NUM_KEYFRAMES = 120;
+
+	/** Number of files imported during a single iteration of the bulk import benchmark. */
+	static constexpr UINT32 NUM_IMPORTED_TEXTURES = 256;
+
+	/** Width and height of the textures imported by the bulk import benchmark. */
+	static constexpr UINT32 IMPORTED_TEXTURE_SIZE = 128;
+
+	/** Returns the folder the import benchmarks write their source files to. */
+	static Path getImportBenchmarkFolder()
+	{
+		return FileSystem::getTempDirectoryPath() + "bsfBenchImport/";
+	}
+
+	/** Writes an uncompressed 32-bit TGA file filled with a pattern depending on @p seed. */
+	static void writeBenchmarkTGA(const Path& path, UINT32 size, UINT32 seed)
+	{
+		Vector<UINT8> data(18 + size * size * 4, 0);
+		data[2] = 2; // Uncompressed true-color
+		data[12] = (UINT8)(size & 0xFF);
+		data[13] = (UINT8)(size >> 8);
+		data[14] = (UINT8)(size & 0xFF);
+		data[15] = (UINT8)(size >> 8);
+		data[16] = 32;
+		data[17] = 8; // Alpha bits
+
+		UINT8* pixels = data.data() + 18;
+		for(UINT32 y = 0; y < size; y++)
+		{
+			for(UINT32 x = 0; x < size; x++)
+			{
+				UINT8* pixel = pixels + (y * size + x) * 4;
+				pixel[0] = (UINT8)(x + seed);
+				pixel[1] = (UINT8)(y * 3 + seed);
+				pixel[2] = (UINT8)((x ^ y) + seed);
+				pixel[3] = 255;
+			}
+		}
+
+		SPtr<DataStream> stream = FileSystem::createAndOpenFile(path);
+		stream->write(data.data(), data.size());
+		stream->close();
+	}
+
+	/** Writes the FBX file imported by the FBX import benchmarks, and returns import options for it. */
+	static SPtr<MeshImportOptions> createBenchmarkFBX(const Path& path)
+	{
+		FileSystem::createDir(path.getParent());
+		EngineTestAssets::writeFBXScene(path, FBX_NUM_MESHES, FBX_GRID_SIZE, FBX_NUM_KEYFRAMES);
+
+		SPtr<MeshImportOptions> options = MeshImportOptions::create();
+		options->importAnimation = true;
+
+		return options;
+	}
+
+	/** Mesh data along with the sub-meshes describing it. */
+	struct BenchmarkMesh
+	{
+		SPtr<MeshData> meshData;
+		Vector<SubMesh> subMeshes;
+	};
+
+	/** Generates meshes identical to the built-in meshes (see BuiltinMesh), before they are converted for rendering. */
+	static Vector<BenchmarkMesh> createBuiltinMeshes()
+	{
+		SPtr<VertexDataDesc> vertexDesc = VertexDataDesc::create();
+		vertexDesc->addVertElem(VET_FLOAT3, VES_POSITION);
+		vertexDesc->addVertElem(VET_FLOAT2, VES_TEXCOORD);
+		vertexDesc->addVertElem(VET_FLOAT3, VES_NORMAL);
+		vertexDesc->addVertElem(VET_FLOAT4, VES_TANGENT);
+		vertexDesc->addVertElem(VET_COLOR, VES_COLOR);
+
+		Vector<BenchmarkMesh> meshes;
+		auto addMesh = [&meshes, &vertexDesc](UINT32 numVertices, UINT32 numIndices)
+		{
+			BenchmarkMesh mesh;
+			mesh.meshData = MeshData::create(numVertices, numIndices, vertexDesc);
+			mesh.subMeshes.push_back(SubMesh(0, numIndices, DOT_TRIANGLE_LIST));
+
+			meshes.push_back(mesh);
+			return mesh.meshData;
+		};
+
+		UINT32 numVertices = 0;
+		UINT32 numIndices = 0;
+		ShapeMeshes3D::getNumElementsAABox(numVertices, numIndices);
+		ShapeMeshes3D::solidAABox(AABox(Vector3(-0.5f, -0.5f, -0.5f), Vector3(0.5f, 0.5f, 0.5f)),
+			addMesh(numVertices, numIndices), 0, 0);
+
+		ShapeMeshes3D::getNumElementsSphere(3, numVertices, numIndices);
+		ShapeMeshes3D::solidSphere(Sphere(Vector3::ZERO, 1.0f), addMesh(numVertices, numIndices), 0, 0, 3);
+
+		ShapeMeshes3D::getNumElementsCone(10, numVertices, numIndices);
+		ShapeMeshes3D::solidCone(Vector3::ZERO, Vector3::UNIT_Y, 1.0f, 1.0f, Vector2::ONE,
+			addMesh(numVertices, numIndices), 0, 0);
+
+		ShapeMeshes3D::getNumElementsCylinder(10, numVertices, numIndices);
+		ShapeMeshes3D::solidCylinder(Vector3::ZERO, Vector3::UNIT_Y, 1.0f, 1.0f, Vector2::ONE,
+			addMesh(numVertices, numIndices), 0, 0);
+
+		std::array<Vector3, 2> axes = {{ Vector3::UNIT_X, Vector3::UNIT_Z }};
+		std::array<float, 2> sizes = {{ 1.0f, 1.0f }};
+		ShapeMeshes3D::getNumElementsQuad(numVertices, numIndices);
+		ShapeMeshes3D::solidQuad(Rect3(Vector3::ZERO, axes, sizes), addMesh(numVertices, numIndices), 0, 0);
+
+		ShapeMeshes3D::getNumElementsDisc(10, numVertices, numIndices);
+		ShapeMeshes3D::solidDisc(Vector3::ZERO, 1.0f, Vector3::UNIT_Y, addMesh(numVertices, numIndices), 0, 0);
+
+		return meshes;
+	}
+
+	BenchmarkApplication::BenchmarkApplication(const START_UP_DESC& desc)
+		:Application(desc)
+	{ }
+
+	void BenchmarkApplication::runFrames(UINT32 count)
+	{
+		if(count == 0)
+			return;
+
+		mFramesRemaining = count;
+		runMainLoop();
+	}
+
+	void BenchmarkApplication::postUpdate()
+	{
+		Application::postUpdate();
+
+		// The loop exits after the current frame completes
+		if(mFramesRemaining > 0 && --mFramesRemaining == 0)
+			stopMainLoop();
+	}
+
+	EngineBenchmarkSuite::EngineBenchmarkSuite()
+	{
+		BS_ADD_BENCHMARK(EngineBenchmarkSuite::benchFrameEmpty)
+		BS_ADD_BENCHMARK(EngineBenchmarkSuite::benchFrameRenderables)
+		BS_ADD_BENCHMARK(EngineBenchmarkSuite::benchFramePhysics)
+		BS_ADD_BENCHMARK(EngineBenchmarkSuite::benchFrameInstanced)
+		BS_ADD_BENCHMARK(EngineBenchmarkSuite::benchFrameNotInstanced)
+		BS_ADD_BENCHMARK(EngineBenchmarkSuite::benchGUIUpdateElement)
+		BS_ADD_BENCHMARK(EngineBenchmarkSuite::benchGUIRebuild)
+		BS_ADD_BENCHMARK(EngineBenchmarkSuite::benchPrefabInstantiate)
+		BS_ADD_BENCHMARK(EngineBenchmarkSuite::benchSceneObjectClone)
+		BS_ADD_BENCHMARK(EngineBenchmarkSuite::benchComponentUpdate)
+		BS_ADD_BENCHMARK(EngineBenchmarkSuite::benchComponentUpdateParallel)
+		BS_ADD_BENCHMARK(EngineBenchmarkSuite::benchRenderQueueSort)
+		BS_ADD_BENCHMARK(EngineBenchmarkSuite::benchRenderQueueSortCallbacks)
+		BS_ADD_BENCHMARK(EngineBenchmarkSuite::benchMaterialParamUpdate)
+		BS_ADD_BENCHMARK(EngineBenchmarkSuite::benchMaterialParamUpdateAll)
+		BS_ADD_BENCHMARK(EngineBenchmarkSuite::benchMaterialSetParamId)
+		BS_ADD_BENCHMARK(EngineBenchmarkSuite::benchMaterialSetParamName)
+		BS_ADD_BENCHMARK(EngineBenchmarkSuite::benchImportFBX)
+		BS_ADD_BENCHMARK(EngineBenchmarkSuite::benchImportFBXSerial)
+		BS_ADD_BENCHMARK(EngineBenchmarkSuite::benchImportBulk)
+		BS_ADD_BENCHMARK(EngineBenchmarkSuite::benchOptimizeBuiltinMeshes)
+	}
+
+	void EngineBenchmarkSuite::benchFrameEmpty(Benchmark& bench)
+	{
+		BenchmarkApplication& app = static_cast<BenchmarkApplication&>(gApplication());
+
+		bench.measure([&app]() { app.runFrames(1); });
+	}
+
+	void EngineBenchmarkSuite::benchFrameRenderables(Benchmark& bench)
+	{
+		BenchmarkApplication& app = static_cast<BenchmarkApplication&>(gApplication());
+		HSceneObject root = createBenchmarkScene(false);
+
+		bench.setItemsPerIteration(GRID_SIZE * GRID_SIZE);
+		bench.measure([&app]() { app.runFrames(1); });
+
+		root->destroy();
+		app.runFrames(1);
+	}
+
+	void EngineBenchmarkSuite::benchFramePhysics(Benchmark& bench)
+	{
+		BenchmarkApplication& app = static_cast<BenchmarkApplication&>(gApplication());
+		HSceneObject root = createBenchmarkScene(true);
+
+		bench.setItemsPerIteration(GRID_SIZE * GRID_SIZE);
+		bench.measure([&app]() { app.runFrames(1); });
+
+		root->destroy();
+		app.runFrames(1);
+	}
+
+	void EngineBenchmarkSuite::benchFrameInstanced(Benchmark& bench)
+	{
+		benchFrameInstancing(bench, true);
+	}
+
+	void EngineBenchmarkSuite::benchFrameNotInstanced(Benchmark& bench)
+	{
+		benchFrameInstancing(bench, false);
+	}
+
+	void EngineBenchmarkSuite::benchGUIUpdateElement(Benchmark& bench)
+	{
+		HCamera camera;
+		Vector<GUILabel*> labels;
+		SPtr<GUIWidget> widget = createBenchmarkGUI(camera, labels);
+
+		// Only the contents of a single element change, as when a caret blinks or a counter updates
+		UINT32 iteration = 0;
+		bench.setItemsPerIteration((UINT64)labels.size());
+		bench.measure([&labels, &iteration]()
+		{
+			labels[labels.size() / 2]->setContent(GUIContent(HString((iteration++ % 2) == 0 ? "B" : "A")));
+			gGUIManager().update();
+		});
+
+		widget->_destroy();
+		camera->SO()->destroy();
+	}
+
+	void EngineBenchmarkSuite::benchGUIRebuild(Benchmark& bench)
+	{
+		HCamera camera;
+		Vector<GUILabel*> labels;
+		SPtr<GUIWidget> widget = createBenchmarkGUI(camera, labels);
+
+		// Showing or hiding an element requires all the elements to be regrouped
+		UINT32 iteration = 0;
+		bench.setItemsPerIteration((UINT64)labels.size());
+		bench.measure([&labels, &iteration]()
+		{
+			labels[labels.size() / 2]->setVisible((iteration++ % 2) != 0);
+			gGUIManager().update();
+		});
+
+		widget->_destroy();
+		camera->SO()->destroy();
+	}
+
+	void EngineBenchmarkSuite::benchPrefabInstantiate(Benchmark& bench)
+	{
+		HSceneObject source = createBenchmarkHierarchy();
+		HPrefab prefab = Prefab::create(source, false);
+		source->destroy(true);
+
+		// Includes destroying the instances, so memory use stays constant across iterations
+		Vector<HSceneObject> instances(PREFAB_NUM_INSTANCES);
+		bench.setItemsPerIteration(PREFAB_NUM_INSTANCES);
+		bench.measure([&prefab, &instances]()
+		{
+			for(auto& instance : instances)
+				instance = prefab->instantiate();
+
+			for(auto& instance : instances)
+				instance->destroy(true);
+		});
+	}
+
+	void EngineBenchmarkSuite::benchSceneObjectClone(Benchmark& bench)
+	{
+		HSceneObject source = createBenchmarkHierarchy();
+
+		// Serializes the hierarchy for every copy, as prefab instantiation used to
+		Vector<HSceneObject> instances(PREFAB_NUM_INSTANCES);
+		bench.setItemsPerIteration(PREFAB_NUM_INSTANCES);
+		bench.measure([&source, &instances]()
+		{
+			for(auto& instance : instances)
+				instance = source->clone();
+
+			for(auto& instance : instances)
+				instance->destroy(true);
+		});
+
+		source->destroy(true);
+	}
+
+	void EngineBenchmarkSuite::benchComponentUpdate(Benchmark& bench)
+	{
+		HSceneObject root = createBenchmarkComponents(false);
+
+		bench.setItemsPerIteration(NUM_UPDATED_COMPONENTS);
+		bench.measure([]() { gSceneManager()._update(); });
+
+		root->destroy(true);
+	}
+
+	void EngineBenchmarkSuite::benchComponentUpdateParallel(Benchmark& bench)
+	{
+		HSceneObject root = createBenchmarkComponents(true);
+
+		bench.setItemsPerIteration(NUM_UPDATED_COMPONENTS);
+		bench.measure([]() { gSceneManager()._update(); });
+
+		root->destroy(true);
+	}
+
+	void EngineBenchmarkSuite::benchRenderQueueSort(Benchmark& bench)
+	{
+		BenchmarkRenderQueue queue;
+
+		bench.setItemsPerIteration(NUM_SORTED_ELEMENTS);
+		bench.measure([&queue]()
+		{
+			queue.sortWithKeys();
+			Benchmark::doNotOptimize(queue.getFirst());
+		});
+	}
+
+	void EngineBenchmarkSuite::benchRenderQueueSortCallbacks(Benchmark& bench)
+	{
+		BenchmarkRenderQueue queue;
+
+		bench.setItemsPerIteration(NUM_SORTED_ELEMENTS);
+		bench.measure([&queue]()
+		{
+			queue.sortWithCallbacks();
+			Benchmark::doNotOptimize(queue.getFirst());
+		});
+	}
+
+	void EngineBenchmarkSuite::benchMaterialParamUpdate(Benchmark& bench)
+	{
+		BenchmarkGpuProgramFactory factory;
+		BenchmarkMaterials materials;
+		createBenchmarkMaterials(factory, materials);
+
+		// Only the modified parameters are transferred to the parameter sets
+		float value = 0.0f;
+		bench.setItemsPerIteration(NUM_UPDATED_MATERIALS);
+		bench.measure([&materials, &value]()
+		{
+			for(auto& param : materials.params)
+				param.set(value);
+
+			for(UINT32 i = 0; i < NUM_UPDATED_MATERIALS; i++)
+				materials.materials[i]->updateParamsSet(materials.paramsSets[i]);
+
+			value += 1.0f;
+		});
+
+		destroyBenchmarkMaterials(materials);
+	}
+
+	void EngineBenchmarkSuite::benchMaterialParamUpdateAll(Benchmark& bench)
+	{
+		BenchmarkGpuProgramFactory factory;
+		BenchmarkMaterials materials;
+		createBenchmarkMaterials(factory, materials);
+
+		// All parameters are transferred, as done before dirty parameters were tracked
+		float value = 0.0f;
+		bench.setItemsPerIteration(NUM_UPDATED_MATERIALS);
+		bench.measure([&materials, &value]()
+		{
+			for(auto& param : materials.params)
+				param.set(value);
+
+			for(UINT32 i = 0; i < NUM_UPDATED_MATERIALS; i++)
+				materials.materials[i]->updateParamsSet(materials.paramsSets[i], 0.0f, true);
+
+			value += 1.0f;
+		});
+
+		destroyBenchmarkMaterials(materials);
+	}
+
+	void EngineBenchmarkSuite::benchMaterialSetParamId(Benchmark& bench)
+	{
+		static const TMaterialDataParamId<float> intensityId("intensity");
+		Vector<HMaterial> materials = createParamSetMaterials();
+
+		// Materials of different shaders are used in turn
+		bench.setItemsPerIteration(NUM_PARAM_SETS);
+		bench.measure([&materials]()
+		{
+			const auto numMaterials = (UINT32)materials.size();
+			for(UINT32 i = 0; i < NUM_PARAM_SETS; i++)
+				materials[i % numMaterials]->setParam(intensityId, (float)i);
+		});
+	}
+
+	void EngineBenchmarkSuite::benchMaterialSetParamName(Benchmark& bench)
+	{
+		Vector<HMaterial> materials = createParamSetMaterials();
+
+		bench.setItemsPerIteration(NUM_PARAM_SETS);
+		bench.measure([&materials]()
+		{
+			const auto numMaterials = (UINT32)materials.size();
+			for(UINT32 i = 0; i < NUM_PARAM_SETS; i++)
+				materials[i % numMaterials]->setFloat("intensity", (float)i);
+		});
+	}
+
+	void EngineBenchmarkSuite::benchImportFBX(Benchmark& bench)
+	{
+		if(!gImporter().supportsFileType("fbx"))
+			return;
+
+		const Path path = getImportBenchmarkFolder() + "Scene.fbx";
+		SPtr<MeshImportOptions> options = createBenchmarkFBX(path);
+
+		bench.setItemsPerIteration(FBX_NUM_MESHES);
+		bench.measure([&path, &options]()
+		{
+			Vector<SubResourceRaw> resources = gImporter()._importAll(path, options);
+			Benchmark::doNotOptimize(resources.size());
+		});
+
+		FileSystem::remove(getImportBenchmarkFolder(), true);
+	}
+
+	void EngineBenchmarkSuite::benchImportFBXSerial(Benchmark& bench)
+	{
+		if(!gImporter().supportsFileType("fbx"))
+			return;
+
+		const Path path = getImportBenchmarkFolder() + "Scene.fbx";
+		SPtr<MeshImportOptions> options = createBenchmarkFBX(path);
+
+		// Without workers queued tasks only run one at a time, while the importing thread waits on them
+		TaskScheduler& scheduler = TaskScheduler::instance();
+		const UINT32 numWorkers = scheduler.getNumWorkers();
+		for(UINT32 i = 0; i < numWorkers; i++)
+			scheduler.removeWorker();
+
+		bench.setItemsPerIteration(FBX_NUM_MESHES);
+		bench.measure([&path, &options]()
+		{
+			Vector<SubResourceRaw> resources = gImporter()._importAll(path, options);
+			Benchmark::doNotOptimize(resources.size());
+		});
+
+		for(UINT32 i = 0; i < numWorkers; i++)
+			scheduler.addWorker();
+
+		FileSystem::remove(getImportBenchmarkFolder(), true);
+	}
+
+	void EngineBenchmarkSuite::benchImportBulk(Benchmark& bench)
+	{
+		if(!gImporter().supportsFileType("tga"))
+			return;
+
+		const Path folder = getImportBenchmarkFolder();
+		FileSystem::createDir(folder);
+
+		Vector<Path> paths;
+		for(UINT32 i = 0; i < NUM_IMPORTED_TEXTURES; i++)
+		{
+			paths.push_back(folder + ("Texture" + toString(i) + ".tga"));
+			writeBenchmarkTGA(paths.back(), IMPORTED_TEXTURE_SIZE, i);
+		}
+
+		// All files are queued at once, as when importing a folder. Resources imported by the previous iteration are
+		// released when their operations are overwritten, by which time the import tasks no longer reference them.
+		Vector<TAsyncOp<HResource>> ops(NUM_IMPORTED_TEXTURES);
+		bench.setItemsPerIteration(NUM_IMPORTED_TEXTURES);
+		bench.measure([&paths, &ops]()
+		{
+			for(UINT32 i = 0; i < NUM_IMPORTED_TEXTURES; i++)
+				ops[i] = gImporter().importAsync(paths[i]);
+
+			for(auto& op : ops)
+				op.blockUntilComplete();
+		});
+
+		ops.clear();
+
+		FileSystem::remove(folder, true);
+	}
+
+	void EngineBenchmarkSuite::benchOptimizeBuiltinMeshes(Benchmark& bench)
+	{
+		Vector<BenchmarkMesh> meshes = createBuiltinMeshes();
+
+		UINT32 numTriangles = 0;
+		for(auto& mesh : meshes)
+			numTriangles += mesh.meshData->getNumIndices() / 3;
+
+		bench.setItemsPerIteration(numTriangles);
+		bench.measure([&meshes]()
+		{
+			for(auto& mesh : meshes)
+			{
+				// Sub-meshes are updated by the optimization, so the original ones are kept for the next iteration
+				Vector<SubMesh> subMeshes = mesh.subMeshes;
+
+				SPtr<MeshData> optimized = MeshUtility::optimize(mesh.meshData, subMeshes);
+				Benchmark::doNotOptimize(optimized);
+			}
+		});
+	}
+}
@@ -0,0 +1,59 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsPrerequisites.h"
+#include "BsApplication.h"
+#include "Testing/BsBenchmark.h"
+
+namespace bs
+{
+	/** Application that can run the main loop for a fixed number of frames, so whole frames can be benchmarked. */
+	class BenchmarkApplication : public Application
+	{
+	public:
+		BenchmarkApplication(const START_UP_DESC& desc);
+
+		/** Runs the main loop for the specified number of frames, then returns. */
+		void runFrames(UINT32 count);
+
+	protected:
+		/** @copydoc Application::postUpdate */
+		void postUpdate() override;
+
+		UINT32 mFramesRemaining = 0;
+	};
+
+	/**
+	 * Benchmarks running complete frames of the main loop. Expects BenchmarkApplication to be running, ideally with the
+	 * null render API, renderer and physics plugins so results depend only on the framework itself.
+	 */
+	class EngineBenchmarkSuite : public BenchmarkSuite
+	{
+	public:
+		EngineBenchmarkSuite();
+
+	private:
+		void benchFrameEmpty(Benchmark& bench);
+		void benchFrameRenderables(Benchmark& bench);
+		void benchFramePhysics(Benchmark& bench);
+		void benchFrameInstanced(Benchmark& bench);
+		void benchFrameNotInstanced(Benchmark& bench);
+		void benchGUIUpdateElement(Benchmark& bench);
+		void benchGUIRebuild(Benchmark& bench);
+		void benchPrefabInstantiate(Benchmark& bench);
+		void benchSceneObjectClone(Benchmark& bench);
+		void benchComponentUpdate(Benchmark& bench);
+		void benchComponentUpdateParallel(Benchmark& bench);
+		void benchRenderQueueSort(Benchmark& bench);
+		void benchRenderQueueSortCallbacks(Benchmark& bench);
+		void benchMaterialParamUpdate(Benchmark& bench);
+		void benchMaterialParamUpdateAll(Benchmark& bench);
+		void benchMaterialSetParamId(Benchmark& bench);
+		void benchMaterialSetParamName(Benchmark& bench);
+		void benchImportFBX(Benchmark& bench);
+		void benchImportFBXSerial(Benchmark& bench);
+		void benchImportBulk(Benchmark& bench);
+		void benchOptimizeBuiltinMeshes(Benchmark& bench);
+	};
+}
@@ -0,0 +1,34 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Private/UnitTests/BsEngineTestSuite.h"
+#include "BsApplication.h"
+#include "Testing/BsConsoleTestOutput.h"
+
+using namespace bs;
+
+int main(int argc, char* argv[])
+{
+	START_UP_DESC desc;
+	desc.renderAPI = "bsfNullRenderAPI";
+	desc.renderer = argc > 1 ? argv[1] : "bsfNullRenderer";
+	desc.audio = "bsfNullAudio";
+	desc.physics = "bsfNullPhysics";
+	desc.importers.push_back("bsfFBXImporter");
+
+	desc.primaryWindowDesc.videoMode = VideoMode(64, 64);
+	desc.primaryWindowDesc.fullscreen = false;
+	desc.primaryWindowDesc.title = "bsf tests";
+	desc.primaryWindowDesc.hidden = true;
+
+	Application::startUp<EngineTestApplication>(desc);
+
+	SPtr<TestSuite> tests = EngineTestSuite::create<EngineTestSuite>();
+
+	ExceptionTestOutput testOutput;
+	tests->run(testOutput);
+	tests = nullptr;
+
+	Application::shutDown();
+
+	return 0;
+}
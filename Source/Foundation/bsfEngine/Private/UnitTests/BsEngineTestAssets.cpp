@@ -0,0 +1,218 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Private/UnitTests/BsEngineTestAssets.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+
+namespace bs
+{
+	/** Number of FBX time units in one second. */
+	static constexpr INT64 FBX_TICKS_PER_SECOND = 46186158000LL;
+
+	/** Frame rate the keyframes of the generated animation are placed at. */
+	static constexpr UINT32 FBX_FRAME_RATE = 30;
+
+	/** Writes an FBX array property, with values separated by commas. */
+	template<class T>
+	static void writeFBXArray(StringStream& stream, const char* name, const Vector<T>& values)
+	{
+		stream << "\t\t" << name << ": *" << values.size() << " {\n\t\t\ta: ";
+		for(UINT32 i = 0; i < (UINT32)values.size(); i++)
+		{
+			if(i > 0)
+				stream << ",";
+
+			stream << values[i];
+		}
+
+		stream << "\n\t\t}\n";
+	}
+
+	/** Writes a geometry object containing a bumpy grid of triangles, with texture coordinates. */
+	static void writeFBXGrid(StringStream& stream, INT64 id, UINT32 meshIdx, UINT32 gridSize)
+	{
+		const UINT32 numVertsPerSide = gridSize + 1;
+
+		Vector<float> positions;
+		Vector<float> uvs;
+		for(UINT32 y = 0; y < numVertsPerSide; y++)
+		{
+			for(UINT32 x = 0; x < numVertsPerSide; x++)
+			{
+				positions.push_back((float)x);
+				positions.push_back(std::sin((x + y + meshIdx) * 0.3f) * 0.5f);
+				positions.push_back((float)y);
+
+				uvs.push_back(x / (float)gridSize);
+				uvs.push_back(y / (float)gridSize);
+			}
+		}
+
+		// The last index of every polygon is stored as (-index - 1)
+		Vector<INT32> polygonIndices;
+		Vector<INT32> uvIndices;
+		for(UINT32 y = 0; y < gridSize; y++)
+		{
+			for(UINT32 x = 0; x < gridSize; x++)
+			{
+				const INT32 v0 = (INT32)(y * numVertsPerSide + x);
+				const INT32 v1 = v0 + 1;
+				const INT32 v2 = v0 + (INT32)numVertsPerSide;
+				const INT32 v3 = v2 + 1;
+
+				const INT32 triangles[6] = { v0, v2, v1, v1, v2, v3 };
+				for(UINT32 i = 0; i < 6; i++)
+				{
+					polygonIndices.push_back((i % 3) == 2 ? -triangles[i] - 1 : triangles[i]);
+					uvIndices.push_back(triangles[i]);
+				}
+			}
+		}
+
+		stream << "\tGeometry: " << id << ", \"Geometry::Grid" << meshIdx << "\", \"Mesh\" {\n";
+		writeFBXArray(stream, "Vertices", positions);
+		writeFBXArray(stream, "PolygonVertexIndex", polygonIndices);
+		stream << "\t\tGeometryVersion: 124\n";
+		stream << "\t\tLayerElementUV: 0 {\n";
+		stream << "\t\t\tVersion: 101\n";
+		stream << "\t\t\tName: \"UVMap\"\n";
+		stream << "\t\t\tMappingInformationType: \"ByPolygonVertex\"\n";
+		stream << "\t\t\tReferenceInformationType: \"IndexToDirect\"\n";
+		writeFBXArray(stream, "UV", uvs);
+		writeFBXArray(stream, "UVIndex", uvIndices);
+		stream << "\t\t}\n";
+		stream << "\t\tLayer: 0 {\n";
+		stream << "\t\t\tVersion: 100\n";
+		stream << "\t\t\tLayerElement:  {\n";
+		stream << "\t\t\t\tType: \"LayerElementUV\"\n";
+		stream << "\t\t\t\tTypedIndex: 0\n";
+		stream << "\t\t\t}\n";
+		stream << "\t\t}\n";
+		stream << "\t}\n";
+	}
+
+	/** Writes an animation curve with a keyframe every frame, following a wave with a plateau in the middle. */
+	static void writeFBXCurve(StringStream& stream, INT64 id, UINT32 numKeyframes, float phase, float amplitude)
+	{
+		Vector<INT64> times;
+		Vector<float> values;
+		for(UINT32 i = 0; i < numKeyframes; i++)
+		{
+			times.push_back(i * FBX_TICKS_PER_SECOND / FBX_FRAME_RATE);
+
+			// Constant sections give keyframe reduction something to remove
+			const float t = i / (float)FBX_FRAME_RATE;
+			const bool plateau = i > numKeyframes / 3 && i < numKeyframes / 2;
+			values.push_back(plateau ? amplitude : std::sin(t * 2.0f + phase) * amplitude);
+		}
+
+		stream << "\tAnimationCurve: " << id << ", \"AnimCurve::\", \"\" {\n";
+		stream << "\t\tDefault: 0\n";
+		stream << "\t\tKeyVer: 4009\n";
+		writeFBXArray(stream, "KeyTime", times);
+		writeFBXArray(stream, "KeyValueFloat", values);
+		writeFBXArray(stream, "KeyAttrFlags", Vector<INT32>{ 24840 });
+		writeFBXArray(stream, "KeyAttrDataFloat", Vector<INT32>{ 0, 0, 255790911, 0 });
+		writeFBXArray(stream, "KeyAttrRefCount", Vector<INT32>{ (INT32)numKeyframes });
+		stream << "\t}\n";
+	}
+
+	void EngineTestAssets::writeFBXScene(const Path& path, UINT32 numMeshes, UINT32 gridSize, UINT32 numKeyframes)
+	{
+		static const char* COMPONENTS[] = { "X", "Y", "Z" };
+		static const char* PROPERTIES[] = { "Lcl Translation", "Lcl Rotation" };
+
+		StringStream objects;
+		StringStream connections;
+
+		INT64 nextId = 1000;
+		const INT64 stackId = nextId++;
+		const INT64 layerId = nextId++;
+
+		const INT64 duration = (INT64)std::max(numKeyframes, 1U) * FBX_TICKS_PER_SECOND / FBX_FRAME_RATE;
+		objects << "\tAnimationStack: " << stackId << ", \"AnimStack::Take\", \"\" {\n";
+		objects << "\t\tProperties70:  {\n";
+		objects << "\t\t\tP: \"LocalStop\", \"KTime\", \"Time\", \"\"," << duration << "\n";
+		objects << "\t\t\tP: \"ReferenceStop\", \"KTime\", \"Time\", \"\"," << duration << "\n";
+		objects << "\t\t}\n";
+		objects << "\t}\n";
+		objects << "\tAnimationLayer: " << layerId << ", \"AnimLayer::BaseLayer\", \"\" {\n\t}\n";
+
+		connections << "\tC: \"OO\"," << layerId << "," << stackId << "\n";
+
+		for(UINT32 i = 0; i < numMeshes; i++)
+		{
+			const INT64 modelId = nextId++;
+			const INT64 geometryId = nextId++;
+
+			objects << "\tModel: " << modelId << ", \"Model::Grid" << i << "\", \"Mesh\" {\n";
+			objects << "\t\tVersion: 232\n";
+			objects << "\t\tProperties70:  {\n";
+			objects << "\t\t\tP: \"Lcl Translation\", \"Lcl Translation\", \"\", \"A\"," << (i % 16) * gridSize << ",0,"
+				<< (i / 16) * gridSize << "\n";
+			objects << "\t\t}\n";
+			objects << "\t\tShading: T\n";
+			objects << "\t\tCulling: \"CullingOff\"\n";
+			objects << "\t}\n";
+
+			writeFBXGrid(objects, geometryId, i, gridSize);
+
+			connections << "\tC: \"OO\"," << modelId << ",0\n";
+			connections << "\tC: \"OO\"," << geometryId << "," << modelId << "\n";
+
+			if(numKeyframes == 0)
+				continue;
+
+			for(UINT32 j = 0; j < 2; j++)
+			{
+				const INT64 curveNodeId = nextId++;
+				const char* nodeName = j == 0 ? "T" : "R";
+
+				objects << "\tAnimationCurveNode: " << curveNodeId << ", \"AnimCurveNode::" << nodeName << "\", \"\" {\n";
+				objects << "\t\tProperties70:  {\n";
+				for(UINT32 k = 0; k < 3; k++)
+					objects << "\t\t\tP: \"d|" << COMPONENTS[k] << "\", \"Number\", \"\", \"A\",0\n";
+				objects << "\t\t}\n";
+				objects << "\t}\n";
+
+				connections << "\tC: \"OO\"," << curveNodeId << "," << layerId << "\n";
+				connections << "\tC: \"OP\"," << curveNodeId << "," << modelId << ", \"" << PROPERTIES[j] << "\"\n";
+
+				for(UINT32 k = 0; k < 3; k++)
+				{
+					const INT64 curveId = nextId++;
+					const float amplitude = j == 0 ? 2.0f : 45.0f;
+
+					writeFBXCurve(objects, curveId, numKeyframes, (float)(i * 3 + k), amplitude);
+					connections << "\tC: \"OP\"," << curveId << "," << curveNodeId << ", \"d|" << COMPONENTS[k] << "\"\n";
+				}
+			}
+		}
+
+		StringStream output;
+		output << "; FBX 7.4.0 project file\n";
+		output << "FBXHeaderExtension:  {\n";
+		output << "\tFBXHeaderVersion: 1003\n";
+		output << "\tFBXVersion: 7400\n";
+		output << "}\n";
+		output << "GlobalSettings:  {\n";
+		output << "\tVersion: 1000\n";
+		output << "\tProperties70:  {\n";
+		output << "\t\tP: \"UpAxis\", \"int\", \"Integer\", \"\",1\n";
+		output << "\t\tP: \"UpAxisSign\", \"int\", \"Integer\", \"\",1\n";
+		output << "\t\tP: \"FrontAxis\", \"int\", \"Integer\", \"\",2\n";
+		output << "\t\tP: \"FrontAxisSign\", \"int\", \"Integer\", \"\",1\n";
+		output << "\t\tP: \"CoordAxis\", \"int\", \"Integer\", \"\",0\n";
+		output << "\t\tP: \"CoordAxisSign\", \"int\", \"Integer\", \"\",1\n";
+		output << "\t\tP: \"UnitScaleFactor\", \"double\", \"Number\", \"\",1\n";
+		output << "\t\tP: \"TimeMode\", \"enum\", \"\", \"\",6\n"; // 30 frames per second
+		output << "\t}\n";
+		output << "}\n";
+		output << "Objects:  {\n" << objects.str() << "}\n";
+		output << "Connections:  {\n" << connections.str() << "}\n";
+
+		SPtr<DataStream> stream = FileSystem::createAndOpenFile(path);
+		stream->writeString(output.str());
+		stream->close();
+	}
+}
@@ -0,0 +1,20 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsPrerequisites.h"
+
+namespace bs
+{
+	/** Generates source files for importer plugins, so import can be tested and benchmarked without shipping assets. */
+	class EngineTestAssets
+	{
+	public:
+		/**
+		 * Writes an ASCII FBX file with @p numMeshes separate meshes. Each mesh is a bumpy grid of @p gridSize by
+		 * @p gridSize quads with texture coordinates, but no normals or tangents so they are generated on import. Each
+		 * mesh node's translation and rotation is animated with @p numKeyframes keyframes, in a single clip.
+		 */
+		static void writeFBXScene(const Path& path, UINT32 numMeshes, UINT32 gridSize, UINT32 numKeyframes);
+	};
+}
@@ -0,0 +1,1854 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Private/UnitTests/BsEngineTestSuite.h"
+#include "Scene/BsSceneObject.h"
+#include "Scene/BsPrefab.h"
+#include "Scene/BsPrefabPool.h"
+#include "Scene/BsGameObjectManager.h"
+#include "Scene/BsSceneManager.h"
+#include "Components/BsCCamera.h"
+#include "Components/BsCRenderable.h"
+#include "Components/BsCLight.h"
+#include "Resources/BsBuiltinResources.h"
+#include "RenderAPI/BsRenderTexture.h"
+#include "RenderAPI/BsViewport.h"
+#include "Mesh/BsMesh.h"
+#include "Mesh/BsMeshData.h"
+#include "GUI/BsGUIManager.h"
+#include "GUI/BsGUIWidget.h"
+#include "GUI/BsGUIPanel.h"
+#include "GUI/BsGUILabel.h"
+#include "GUI/BsGUIContent.h"
+#include "Text/BsFont.h"
+#include "Text/BsFontManager.h"
+#include "Text/BsGlyphCache.h"
+#include "Text/BsTextData.h"
+#include "Utility/BsTime.h"
+#include "FileSystem/BsDataStream.h"
+#include "Material/BsMaterial.h"
+#include "Renderer/BsRenderQueue.h"
+#include "Renderer/BsRenderElement.h"
+#include "Renderer/BsRenderer.h"
+#include "Renderer/BsRendererManager.h"
+#include "Profiling/BsRenderStats.h"
+#include "CoreThread/BsCoreThread.h"
+#include "Math/BsRandom.h"
+#include "Material/BsShader.h"
+#include "Material/BsTechnique.h"
+#include "Material/BsPass.h"
+#include "Material/BsMaterialParams.h"
+#include "Material/BsMaterialParamId.h"
+#include "Material/BsGpuParamsSet.h"
+#include "RenderAPI/BsGpuParams.h"
+#include "RenderAPI/BsGpuParam.h"
+#include "RenderAPI/BsGpuParamDesc.h"
+#include "RenderAPI/BsGpuProgram.h"
+#include "Managers/BsGpuProgramManager.h"
+#include "Image/BsTexture.h"
+#include "Particles/BsParticleSystem.h"
+#include "Particles/BsParticleEmitter.h"
+#include "Particles/BsParticleEvolver.h"
+#include "RenderAPI/BsVertexDataDesc.h"
+#include "Importer/BsImporter.h"
+#include "Importer/BsMeshImportOptions.h"
+#include "Animation/BsAnimationClip.h"
+#include "Threading/BsTaskScheduler.h"
+#include "FileSystem/BsFileSystem.h"
+#include "Private/UnitTests/BsEngineTestAssets.h"
+
+namespace bs
+{
+	/** Creates a camera rendering to an off-screen target of the specified size, usable as a GUI widget target. */
+	static HCamera createTestCamera(UINT32 width, UINT32 height)
+	{
+		TEXTURE_DESC textureDesc;
+		textureDesc.type = TEX_TYPE_2D;
+		textureDesc.width = width;
+		textureDesc.height = height;
+		textureDesc.format = PF_RGBA8;
+		textureDesc.usage = TU_RENDERTARGET;
+
+		SPtr<RenderTexture> renderTexture = RenderTexture::create(textureDesc, false);
+
+		HSceneObject cameraSO = SceneObject::create("TestCamera");
+		HCamera camera = cameraSO->addComponent<CCamera>();
+		camera->getViewport()->setTarget(renderTexture);
+
+		return camera;
+	}
+
+	/** Checks if the two mesh data objects have the same layout and contents. */
+	static bool isEqual(const SPtr<MeshData>& a, const SPtr<MeshData>& b)
+	{
+		if(a == nullptr || b == nullptr)
+			return a == b;
+
+		if(a->getNumVertices() != b->getNumVertices() || a->getNumIndices() != b->getNumIndices())
+			return false;
+
+		return memcmp(a->getData(), b->getData(), a->getSize()) == 0;
+	}
+
+	/** Checks if the two sets of named curves have the same names and keyframes, in the same order. */
+	template<class T>
+	static bool isEqual(const Vector<TNamedAnimationCurve<T>>& a, const Vector<TNamedAnimationCurve<T>>& b)
+	{
+		if(a.size() != b.size())
+			return false;
+
+		for(UINT32 i = 0; i < (UINT32)a.size(); i++)
+		{
+			if(a[i].name != b[i].name || a[i].curve.getKeyFrames() != b[i].curve.getKeyFrames())
+				return false;
+		}
+
+		return true;
+	}
+
+	/** Rasterizes every character as a solid square glyph of a fixed size. */
+	class TestGlyphRasterizer : public GlyphRasterizer
+	{
+	public:
+		static constexpr UINT32 GLYPH_SIZE = 8;
+
+		bool rasterize(UINT32 charId, RasterizedGlyph& output) override
+		{
+			output.desc.charId = charId;
+			output.desc.width = GLYPH_SIZE;
+			output.desc.height = GLYPH_SIZE;
+			output.desc.xAdvance = GLYPH_SIZE;
+			output.pixels.resize(GLYPH_SIZE * GLYPH_SIZE, 255);
+
+			return true;
+		}
+	};
+
+	class TestGlyphRasterizerFactory : public GlyphRasterizerFactory
+	{
+	public:
+		SPtr<GlyphRasterizer> create(const SPtr<MemoryDataStream>& fontData, UINT32 size, UINT32 dpi,
+			FontRenderMode renderMode) override
+		{
+			return bs_shared_ptr_new<TestGlyphRasterizer>();
+		}
+	};
+
+	/**
+	 * Advances frames and updates the glyph caches until the condition is met, or the maximum number of frames elapses.
+	 * Returns the final value of the condition.
+	 */
+	static bool updateGlyphCaches(const std::function<bool()>& condition, UINT32 maxFrames = 1000)
+	{
+		for(UINT32 i = 0; i < maxFrames; i++)
+		{
+			gTime()._update();
+			FontManager::instance()._update();
+
+			if(condition())
+				return true;
+
+			BS_THREAD_SLEEP(1);
+		}
+
+		return condition();
+	}
+
+	/**
+	 * Component that records its updates. Each @p TYPE_ID is a separate component type, with its own RTTI type ID. Type
+	 * IDs should be outside of the range used by the framework.
+	 */
+	template<UINT32 TYPE_ID>
+	class TestUpdateComponent : public Component
+	{
+	public:
+		TestUpdateComponent(const HSceneObject& parent, Vector<UINT32>* log, UINT32 tag, INT32 updateOrder,
+			bool parallel = false)
+			:Component(parent), mLog(log), mTag(tag)
+		{
+			setUpdateOrder(updateOrder);
+			setFlag(ComponentFlag::ParallelUpdate, parallel);
+		}
+
+		void update() override
+		{
+			numUpdates++;
+
+			// Parallel components can't share the log
+			if(!hasFlag(ComponentFlag::ParallelUpdate))
+				mLog->push_back(mTag);
+		}
+
+		void fixedUpdate() override { numFixedUpdates++; }
+
+		UINT32 numUpdates = 0;
+		UINT32 numFixedUpdates = 0;
+
+	private:
+		Vector<UINT32>* mLog;
+		UINT32 mTag;
+
+	public:
+		static RTTITypeBase* getRTTIStatic();
+		RTTITypeBase* getRTTI() const override { return getRTTIStatic(); }
+	};
+
+	template<UINT32 TYPE_ID>
+	class TestUpdateComponentRTTI
+		: public RTTIType<TestUpdateComponent<TYPE_ID>, Component, TestUpdateComponentRTTI<TYPE_ID>>
+	{
+	public:
+		const String& getRTTIName() override
+		{
+			static String name = "TestUpdateComponent" + toString(TYPE_ID);
+			return name;
+		}
+
+		UINT32 getRTTIId() override { return TYPE_ID; }
+		SPtr<IReflectable> newRTTIObject() override { return nullptr; }
+	};
+
+	template<UINT32 TYPE_ID>
+	RTTITypeBase* TestUpdateComponent<TYPE_ID>::getRTTIStatic()
+	{
+		return TestUpdateComponentRTTI<TYPE_ID>::instance();
+	}
+
+	using TestUpdateComponentA = TestUpdateComponent<90000>;
+	using TestUpdateComponentB = TestUpdateComponent<90001>;
+	using TestUpdateComponentC = TestUpdateComponent<90002>;
+
+	/**
+	 * Creates a hierarchy of the specified number of scene objects, where each object is parented to the one created
+	 * two steps before it. Every third object gets a renderable component.
+	 */
+	static HSceneObject createTestHierarchy(const String& name, UINT32 numObjects)
+	{
+		const HMesh boxMesh = BuiltinResources::instance().getMesh(BuiltinMesh::Box);
+
+		Vector<HSceneObject> objects;
+		for(UINT32 i = 0; i < numObjects; i++)
+		{
+			HSceneObject so = SceneObject::create(name + toString(i));
+			so->setPosition(Vector3((float)i, (float)(i % 3), 0.0f));
+
+			if(i > 0)
+				so->setParent(objects[i < 2 ? 0 : i - 2], false);
+
+			if((i % 3) == 0)
+				so->addComponent<CRenderable>()->setMesh(boxMesh);
+
+			objects.push_back(so);
+		}
+
+		return objects[0];
+	}
+
+	/**
+	 * Checks if the two hierarchies contain scene objects with the same names, transforms and component types, while
+	 * all the game objects are distinct.
+	 */
+	static bool isSameHierarchy(const HSceneObject& a, const HSceneObject& b)
+	{
+		if(a == b || a->getInstanceId() == b->getInstanceId() || a->getUUID() == b->getUUID())
+			return false;
+
+		if(a->getName() != b->getName() || a->getLocalTransform().getPosition() != b->getLocalTransform().getPosition())
+			return false;
+
+		const Vector<HComponent>& componentsA = a->getComponents();
+		const Vector<HComponent>& componentsB = b->getComponents();
+		if(componentsA.size() != componentsB.size())
+			return false;
+
+		for(UINT32 i = 0; i < (UINT32)componentsA.size(); i++)
+		{
+			if(componentsA[i]->getRTTI()->getRTTIId() != componentsB[i]->getRTTI()->getRTTIId())
+				return false;
+
+			if(componentsA[i]->getInstanceId() == componentsB[i]->getInstanceId())
+				return false;
+		}
+
+		if(a->getNumChildren() != b->getNumChildren())
+			return false;
+
+		for(UINT32 i = 0; i < a->getNumChildren(); i++)
+		{
+			if(!isSameHierarchy(a->getChild(i), b->getChild(i)))
+				return false;
+		}
+
+		return true;
+	}
+
+	/** Render element that doesn't draw anything, used for testing render queue sorting. */
+	class TestRenderElement : public ct::RenderElement
+	{
+	public:
+		void draw() const override { }
+	};
+
+	/** Language of the GPU programs created by TestGpuProgramFactory. */
+	static const char* TEST_GPU_PROGRAM_LANGUAGE = "bsftest";
+
+	/**
+	 * Fragment program reporting a fixed set of parameters: a block of float parameters named gValue0, gValue1, ..., and
+	 * textures named gTex0, gTex1, .... Other program types have no parameters. Used in place of compiled programs, which
+	 * the null render API doesn't provide parameter information for.
+	 */
+	class TestGpuProgram : public ct::GpuProgram
+	{
+	public:
+		static constexpr UINT32 NUM_DATA_PARAMS = 100;
+		static constexpr UINT32 NUM_TEXTURES = 4;
+
+		TestGpuProgram(const GPU_PROGRAM_DESC& desc)
+			:GpuProgram(desc, GDF_DEFAULT)
+		{
+			if(desc.type != GPT_FRAGMENT_PROGRAM)
+				return;
+
+			GpuParamBlockDesc blockDesc;
+			blockDesc.name = "TestParams";
+			blockDesc.slot = 0;
+			blockDesc.set = 0;
+			blockDesc.blockSize = NUM_DATA_PARAMS;
+			blockDesc.isShareable = true;
+
+			mParametersDesc->paramBlocks[blockDesc.name] = blockDesc;
+
+			for(UINT32 i = 0; i < NUM_DATA_PARAMS; i++)
+			{
+				GpuParamDataDesc paramDesc;
+				paramDesc.name = "gValue" + toString(i);
+				paramDesc.elementSize = 1;
+				paramDesc.arraySize = 1;
+				paramDesc.arrayElementStride = 1;
+				paramDesc.type = GPDT_FLOAT1;
+				paramDesc.paramBlockSlot = blockDesc.slot;
+				paramDesc.paramBlockSet = blockDesc.set;
+				paramDesc.gpuMemOffset = i;
+				paramDesc.cpuMemOffset = i;
+
+				mParametersDesc->params[paramDesc.name] = paramDesc;
+			}
+
+			for(UINT32 i = 0; i < NUM_TEXTURES; i++)
+			{
+				GpuParamObjectDesc textureDesc;
+				textureDesc.name = "gTex" + toString(i);
+				textureDesc.type = GPOT_TEXTURE2D;
+				textureDesc.slot = 1 + i;
+				textureDesc.set = 0;
+
+				mParametersDesc->textures[textureDesc.name] = textureDesc;
+			}
+		}
+	};
+
+	class TestGpuProgramFactory : public ct::GpuProgramFactory
+	{
+	public:
+		SPtr<ct::GpuProgram> create(const GPU_PROGRAM_DESC& desc, GpuDeviceFlags deviceMask) override
+		{
+			SPtr<ct::GpuProgram> program = bs_shared_ptr_new<TestGpuProgram>(desc);
+			program->_setThisPtr(program);
+
+			return program;
+		}
+
+		SPtr<ct::GpuProgram> create(GpuProgramType type, GpuDeviceFlags deviceMask) override
+		{
+			GPU_PROGRAM_DESC desc;
+			desc.type = type;
+
+			return create(desc, deviceMask);
+		}
+
+		SPtr<GpuProgramBytecode> compileBytecode(const GPU_PROGRAM_DESC& desc) override
+		{
+			return nullptr;
+		}
+	};
+
+	/**
+	 * Creates a material with parameters named value0, value1, ... and tex0, tex1, ..., mapping to the parameters of
+	 * TestGpuProgram. Expects TestGpuProgramFactory to be registered.
+	 */
+	static HMaterial createParamTestMaterial()
+	{
+		SHADER_DESC shaderDesc;
+		for(UINT32 i = 0; i < TestGpuProgram::NUM_DATA_PARAMS; i++)
+			shaderDesc.addParameter(SHADER_DATA_PARAM_DESC("value" + toString(i), "gValue" + toString(i), GPDT_FLOAT1));
+
+		for(UINT32 i = 0; i < TestGpuProgram::NUM_TEXTURES; i++)
+			shaderDesc.addParameter(SHADER_OBJECT_PARAM_DESC("tex" + toString(i), "gTex" + toString(i), GPOT_TEXTURE2D));
+
+		// Sources are ignored, but passes only create programs with non-empty sources
+		PASS_DESC passDesc;
+		passDesc.vertexProgramDesc.source = "test";
+		passDesc.vertexProgramDesc.language = TEST_GPU_PROGRAM_LANGUAGE;
+		passDesc.vertexProgramDesc.type = GPT_VERTEX_PROGRAM;
+		passDesc.fragmentProgramDesc.source = "test";
+		passDesc.fragmentProgramDesc.language = TEST_GPU_PROGRAM_LANGUAGE;
+		passDesc.fragmentProgramDesc.type = GPT_FRAGMENT_PROGRAM;
+
+		shaderDesc.techniques.push_back(Technique::create(TEST_GPU_PROGRAM_LANGUAGE, { Pass::create(passDesc) }));
+
+		HShader shader = Shader::create("ParamTestShader", shaderDesc);
+		return Material::create(shader);
+	}
+
+	/** 
+	 * Creates a shader with parameters of every kind, without any techniques. Each call creates a new shader with a unique
+	 * id, but the same parameters.
+	 */
+	static HShader createParamIdTestShader()
+	{
+		SHADER_DESC shaderDesc;
+		shaderDesc.addParameter(SHADER_DATA_PARAM_DESC("intensity", "gIntensity", GPDT_FLOAT1));
+		shaderDesc.addParameter(SHADER_DATA_PARAM_DESC("tint", "gTint", GPDT_COLOR));
+		shaderDesc.addParameter(SHADER_DATA_PARAM_DESC("offsets", "gOffsets", GPDT_FLOAT4, StringID::NONE, 4));
+		shaderDesc.addParameter(SHADER_OBJECT_PARAM_DESC("albedo", "gAlbedoTex", GPOT_TEXTURE2D));
+		shaderDesc.addParameter(SHADER_OBJECT_PARAM_DESC("data", "gData", GPOT_STRUCTURED_BUFFER));
+		shaderDesc.addParameter(SHADER_OBJECT_PARAM_DESC("sampler", "gSampler", GPOT_SAMPLER2D));
+
+		return Shader::create("ParamIdTestShader", shaderDesc);
+	}
+
+	/** Checks that the shader parameter lookup returns the same index as the material's own lookup, for all parameters. */
+	static bool isParamLookupValid(const HMaterial& material)
+	{
+		const HShader& shader = material->getShader();
+		SPtr<MaterialParams> params = material->_getInternalParams();
+
+		const auto isValid = [&shader, &params](const String& name)
+		{
+			return shader->getParamIndex(name) == params->getParamIndex(name);
+		};
+
+		for(auto& entry : shader->getDataParams())
+		{
+			if(entry.second.type != GPDT_UNKNOWN && !isValid(entry.first))
+				return false;
+		}
+
+		for(auto& entry : shader->getTextureParams())
+		{
+			if(!isValid(entry.first))
+				return false;
+		}
+
+		for(auto& entry : shader->getBufferParams())
+		{
+			if(!isValid(entry.first))
+				return false;
+		}
+
+		for(auto& entry : shader->getSamplerParams())
+		{
+			if(!isValid(entry.first))
+				return false;
+		}
+
+		return shader->getParamIndex("doesNotExist") == (UINT32)-1;
+	}
+
+	/** Render queue that can be filled with random sort parameters, and sorted using either of its sorting methods. */
+	class TestRenderQueue : public ct::RenderQueue
+	{
+	public:
+		using RenderQueue::RenderQueue;
+		using RenderQueue::radixSort;
+
+		/**
+		 * Adds entries with random sort parameters, not associated with any render elements. Parameters are picked from
+		 * small sets of values so that ties, which must be resolved by the later parameters, are common.
+		 */
+		void addRandom(UINT32 count, UINT32 seed, UINT32 numPriorities = 4)
+		{
+			static constexpr float DISTANCES[] = { -1000.0f, -5.5f, -1.0f, -0.0f, 0.0f, 0.25f, 1.0f, 1000.0f };
+
+			Random random(seed);
+			for(UINT32 i = 0; i < count; i++)
+			{
+				const auto idx = (UINT32)mSortableElementIdx.size();
+				mSortableElementIdx.push_back(idx);
+
+				mSortableElements.emplace_back();
+				auto& entry = mSortableElements.back();
+				entry.seqIdx = idx;
+				entry.priority = ((INT32)(random.get() % numPriorities) - (INT32)numPriorities / 2) * 100;
+				entry.distFromCamera = (random.get() % 2) == 0 ? DISTANCES[random.get() % 8] : random.getSNorm() * 100.0f;
+				entry.shaderId = (random.get() % 8) * 0x10001;
+				entry.techniqueIdx = random.get() % 3;
+				entry.passIdx = random.get() % 3;
+
+				mElements.push_back(nullptr);
+			}
+		}
+
+		/** Sorts the entries using the sort keys and radix sort. Returns false if the keys couldn't be generated. */
+		bool sortWithKeys(Vector<UINT32>& output)
+		{
+			if(!generateSortKeys())
+				return false;
+
+			const auto count = (UINT32)mSortableElementIdx.size();
+			mSortKeysTemp.resize(count);
+			mSortableElementIdxTemp.resize(count);
+
+			radixSort(mSortKeys.data(), mSortableElementIdx.data(), mSortKeysTemp.data(), 
+				mSortableElementIdxTemp.data(), count);
+
+			output = mSortableElementIdx;
+			return true;
+		}
+
+		/** Sorts the entries using the element sorter callbacks. */
+		void sortWithCallbacks(Vector<UINT32>& output)
+		{
+			decltype(&elementSorterNoGroup) sorter = nullptr;
+			switch(mStateReductionMode)
+			{
+			default:
+			case ct::StateReduction::None:
+				sorter = &elementSorterNoGroup;
+				break;
+			case ct::StateReduction::Material:
+				sorter = &elementSorterPreferGroup;
+				break;
+			case ct::StateReduction::Distance:
+				sorter = &elementSorterPreferDistance;
+				break;
+			}
+
+			output.resize(mSortableElementIdx.size());
+			for(UINT32 i = 0; i < (UINT32)output.size(); i++)
+				output[i] = i;
+
+			std::sort(output.begin(), output.end(), 
+				[this, sorter](UINT32 a, UINT32 b) { return sorter(a, b, mSortableElements); });
+		}
+	};
+
+	/**
+	 * Checks that every element is rendered exactly once per pass by the sorted render queue, either on its own or as a
+	 * member of an instance group, and that all members of a group can be rendered with the same instanced draw call.
+	 */
+	static bool isValidInstancing(const ct::RenderQueue& queue, const Vector<TestRenderElement>& elements,
+		UINT32 numPasses)
+	{
+		const Vector<const ct::RenderElement*>& instanced = queue.getInstancedElements();
+
+		UnorderedMap<const ct::RenderElement*, UINT32> numDraws;
+		for(auto& entry : queue.getSortedElements())
+		{
+			if(entry.numInstances < 2)
+			{
+				numDraws[entry.renderElem]++;
+				continue;
+			}
+
+			// Group leader is always the first instance
+			if(entry.firstInstance + entry.numInstances > (UINT32)instanced.size() || 
+				instanced[entry.firstInstance] != entry.renderElem)
+				return false;
+
+			for(UINT32 i = 0; i < entry.numInstances; i++)
+			{
+				const ct::RenderElement* member = instanced[entry.firstInstance + i];
+				if(member->instancingKey == 0 || member->instancingKey != entry.renderElem->instancingKey ||
+					member->mesh != entry.renderElem->mesh || member->material != entry.renderElem->material ||
+					member->subMesh.indexOffset != entry.subMesh.indexOffset ||
+					member->subMesh.indexCount != entry.subMesh.indexCount)
+					return false;
+
+				numDraws[member]++;
+			}
+		}
+
+		if(numDraws.size() != elements.size())
+			return false;
+
+		for(auto& element : elements)
+		{
+			if(numDraws[&element] != numPasses)
+				return false;
+		}
+
+		return true;
+	}
+
+	/**
+	 * Runs the main loop for the specified number of frames, and returns the number of draw calls (including instanced
+	 * ones) and instanced draw calls executed by the render API during those frames.
+	 */
+	static void countDrawCalls(UINT32 numFrames, UINT64& numDrawCalls, UINT64& numInstancedDrawCalls)
+	{
+		// Make sure the core thread is done with previous frames, so the statistics can be safely read
+		gCoreThread().submit(true);
+		const RenderStatsData before = RenderStats::instance().getData();
+
+		static_cast<EngineTestApplication&>(gApplication()).runFrames(numFrames);
+
+		gCoreThread().submit(true);
+		const RenderStatsData& after = RenderStats::instance().getData();
+
+		numDrawCalls = after.numDrawCalls - before.numDrawCalls;
+		numInstancedDrawCalls = after.numInstancedDrawCalls - before.numInstancedDrawCalls;
+	}
+
+	/**
+	 * Runs the main loop for the specified number of frames, and returns the number of times the renderer could reuse a
+	 * cached static shadow map, and the number of times it had to re-render one, during those frames.
+	 */
+	static void countShadowCacheAccesses(UINT32 numFrames, UINT64& numHits, UINT64& numMisses)
+	{
+		// Make sure the core thread is done with previous frames, so the statistics can be safely read
+		gCoreThread().submit(true);
+		const RenderStatsData before = RenderStats::instance().getData();
+
+		static_cast<EngineTestApplication&>(gApplication()).runFrames(numFrames);
+
+		gCoreThread().submit(true);
+		const RenderStatsData& after = RenderStats::instance().getData();
+
+		numHits = after.numShadowCacheHits - before.numShadowCacheHits;
+		numMisses = after.numShadowCacheMisses - before.numShadowCacheMisses;
+	}
+
+	/** 
+	 * Creates a grid of box renderables in front of the camera. If @p sharedMaterial is true all renderables use the
+	 * same material and can be instanced, otherwise each gets its own material.
+	 */
+	static HSceneObject createInstancingScene(UINT32 gridSize, bool sharedMaterial)
+	{
+		HSceneObject root = SceneObject::create("InstancingRoot");
+
+		const HShader shader = BuiltinResources::instance().getBuiltinShader(BuiltinShader::Standard);
+		const HMesh boxMesh = BuiltinResources::instance().getMesh(BuiltinMesh::Box);
+		const HMaterial material = Material::create(shader);
+
+		for(UINT32 y = 0; y < gridSize; y++)
+		{
+			for(UINT32 x = 0; x < gridSize; x++)
+			{
+				HSceneObject boxSO = SceneObject::create("Box");
+				boxSO->setParent(root);
+				boxSO->setPosition(Vector3(x * 2.0f - gridSize, y * 2.0f - gridSize, 0.0f));
+
+				HRenderable renderable = boxSO->addComponent<CRenderable>();
+				renderable->setMesh(boxMesh);
+				renderable->setMaterial(sharedMaterial ? material : Material::create(shader));
+			}
+		}
+
+		return root;
+	}
+
+	/** Creates a mesh in the shape of a tetrahedron, with CPU cached data so it can be used by particle emitters. */
+	static HMesh createParticleEmitterMesh()
+	{
+		SPtr<VertexDataDesc> vertexDesc = VertexDataDesc::create();
+		vertexDesc->addVertElem(VET_FLOAT3, VES_POSITION);
+
+		Vector3 positions[] = 
+		{
+			Vector3(-1.0f, 0.0f, -1.0f), Vector3(2.0f, 0.0f, -1.0f), Vector3(0.0f, 0.0f, 3.0f), Vector3(0.0f, 1.5f, 0.0f)
+		};
+
+		const UINT32 indices[] = { 0, 1, 2, 0, 3, 1, 1, 3, 2, 2, 3, 0 };
+
+		SPtr<MeshData> meshData = MeshData::create(4, 12, vertexDesc);
+		meshData->setVertexData(VES_POSITION, positions, sizeof(positions));
+		memcpy(meshData->getIndices32(), indices, sizeof(indices));
+
+		return Mesh::create(meshData, MU_STATIC | MU_CPUCACHED);
+	}
+
+	/** Creates emitter shapes of every type and emission sub-type whose bounds don't depend on an animated object. */
+	static Vector<SPtr<ParticleEmitterShape>> createParticleBoundsShapes(const HMesh& mesh)
+	{
+		Vector<SPtr<ParticleEmitterShape>> shapes;
+
+		for(auto type : { ParticleEmitterConeType::Base, ParticleEmitterConeType::Volume })
+		{
+			PARTICLE_CONE_SHAPE_DESC desc;
+			desc.type = type;
+			desc.radius = 0.5f;
+			desc.angle = Degree(30.0f);
+			desc.length = 2.0f;
+			desc.thickness = 0.5f;
+			desc.arc = Degree(270.0f);
+			shapes.push_back(ParticleEmitterConeShape::create(desc));
+		}
+
+		for(float thickness : { 0.0f, 1.0f })
+		{
+			PARTICLE_SPHERE_SHAPE_DESC sphereDesc;
+			sphereDesc.radius = 1.5f;
+			sphereDesc.thickness = thickness;
+			shapes.push_back(ParticleEmitterSphereShape::create(sphereDesc));
+
+			PARTICLE_HEMISPHERE_SHAPE_DESC hemisphereDesc;
+			hemisphereDesc.radius = 1.5f;
+			hemisphereDesc.thickness = thickness;
+			shapes.push_back(ParticleEmitterHemisphereShape::create(hemisphereDesc));
+
+			PARTICLE_CIRCLE_SHAPE_DESC circleDesc;
+			circleDesc.radius = 2.0f;
+			circleDesc.thickness = thickness;
+			circleDesc.arc = Degree(180.0f);
+			shapes.push_back(ParticleEmitterCircleShape::create(circleDesc));
+		}
+
+		for(auto type : { ParticleEmitterBoxType::Volume, ParticleEmitterBoxType::Surface, ParticleEmitterBoxType::Edge })
+		{
+			PARTICLE_BOX_SHAPE_DESC desc;
+			desc.type = type;
+			desc.extents = Vector3(1.0f, 2.0f, 0.5f);
+			shapes.push_back(ParticleEmitterBoxShape::create(desc));
+		}
+
+		PARTICLE_LINE_SHAPE_DESC lineDesc;
+		lineDesc.length = 3.0f;
+		shapes.push_back(ParticleEmitterLineShape::create(lineDesc));
+
+		PARTICLE_RECT_SHAPE_DESC rectDesc;
+		rectDesc.extents = Vector2(2.0f, 0.5f);
+		shapes.push_back(ParticleEmitterRectShape::create(rectDesc));
+
+		for(auto type : { ParticleEmitterMeshType::Vertex, ParticleEmitterMeshType::Edge, ParticleEmitterMeshType::Triangle })
+		{
+			PARTICLE_STATIC_MESH_SHAPE_DESC desc;
+			desc.type = type;
+			desc.mesh = mesh;
+			shapes.push_back(ParticleEmitterStaticMeshShape::create(desc));
+		}
+
+		return shapes;
+	}
+
+	/** 
+	 * Creates sets of evolvers that move particles in different ways: none, constant, random and curve velocities in
+	 * local or world space, forces, gravity and all of them combined.
+	 */
+	static Vector<Vector<SPtr<ParticleEvolver>>> createParticleBoundsEvolvers()
+	{
+		Vector<Vector<SPtr<ParticleEvolver>>> evolverSets;
+		evolverSets.push_back({});
+
+		PARTICLE_VELOCITY_DESC constantDesc;
+		constantDesc.velocity = Vector3(0.5f, 1.0f, -2.0f);
+		evolverSets.push_back({ ParticleVelocity::create(constantDesc) });
+
+		PARTICLE_VELOCITY_DESC randomDesc;
+		randomDesc.velocity = Vector3Distribution(Vector3(-2.0f, 0.0f, -1.0f), Vector3(1.0f, 3.0f, 1.0f));
+		randomDesc.worldSpace = true;
+		evolverSets.push_back({ ParticleVelocity::create(randomDesc) });
+
+		PARTICLE_VELOCITY_DESC curveDesc;
+		curveDesc.velocity = Vector3Distribution(TAnimationCurve<Vector3>({
+			{ Vector3(0.0f, 2.0f, 0.0f), Vector3::ZERO, Vector3::ZERO, 0.0f },
+			{ Vector3(3.0f, -1.0f, 1.0f), Vector3::ZERO, Vector3::ZERO, 1.0f }
+		}));
+		evolverSets.push_back({ ParticleVelocity::create(curveDesc) });
+
+		PARTICLE_FORCE_DESC forceDesc;
+		forceDesc.force = Vector3Distribution(Vector3(-3.0f, 1.0f, 0.0f), Vector3(2.0f, 4.0f, 1.0f));
+		forceDesc.worldSpace = true;
+		evolverSets.push_back({ ParticleForce::create(forceDesc) });
+
+		PARTICLE_GRAVITY_DESC gravityDesc;
+		gravityDesc.scale = 2.0f;
+		evolverSets.push_back({ ParticleGravity::create(gravityDesc) });
+
+		evolverSets.push_back({ ParticleVelocity::create(curveDesc), ParticleForce::create(forceDesc), 
+			ParticleGravity::create(gravityDesc) });
+
+		return evolverSets;
+	}
+
+	EngineTestSuite::EngineTestSuite()
+	{
+		BS_ADD_TEST(EngineTestSuite::testGUIMeshUpdate);
+		BS_ADD_TEST(EngineTestSuite::testGlyphCache);
+		BS_ADD_TEST(EngineTestSuite::testPrefabInstantiate);
+		BS_ADD_TEST(EngineTestSuite::testGameObjectTable);
+		BS_ADD_TEST(EngineTestSuite::testPrefabPool);
+		BS_ADD_TEST(EngineTestSuite::testComponentUpdateOrder);
+		BS_ADD_TEST(EngineTestSuite::testRenderQueueInstancing);
+		BS_ADD_TEST(EngineTestSuite::testRenderQueueSort);
+		BS_ADD_TEST(EngineTestSuite::testMaterialParamUpdate);
+		BS_ADD_TEST(EngineTestSuite::testMaterialParamId);
+		BS_ADD_TEST(EngineTestSuite::testInstancedDrawCalls);
+		BS_ADD_TEST(EngineTestSuite::testStaticShadowCache);
+		BS_ADD_TEST(EngineTestSuite::testParticleBounds);
+		BS_ADD_TEST(EngineTestSuite::testFBXImportParallel);
+	}
+
+	void EngineTestSuite::testGUIMeshUpdate()
+	{
+		static constexpr UINT32 NUM_LABELS = 64;
+		static constexpr UINT32 LABEL_WIDTH = 60;
+		static constexpr UINT32 LABEL_HEIGHT = 20;
+
+		HCamera camera = createTestCamera(8 * LABEL_WIDTH, 8 * LABEL_HEIGHT);
+		SPtr<GUIWidget> widget = GUIWidget::create(camera);
+		const Viewport* target = widget->getTarget();
+
+		// Labels have a fixed size, so changing their text doesn't change their bounds
+		Vector<GUILabel*> labels;
+		for(UINT32 i = 0; i < NUM_LABELS; i++)
+		{
+			GUILabel* label = widget->getPanel()->addNewElement<GUILabel>(HString("0123456789"));
+			label->setPosition((i % 8) * LABEL_WIDTH, (i / 8) * LABEL_HEIGHT);
+			label->setSize(LABEL_WIDTH, LABEL_HEIGHT);
+
+			labels.push_back(label);
+		}
+
+		/** Updates the GUI meshes and returns the triangle mesh along with a copy of its current contents. */
+		const auto updateMesh = [target](SPtr<Mesh>& mesh)
+		{
+			gGUIManager().update();
+
+			SPtr<MeshData> meshData;
+			gGUIManager()._getTriangleMesh(target, mesh, meshData);
+
+			return meshData;
+		};
+
+		/** Forces all meshes of the widget to be rebuilt and regrouped from scratch. */
+		const auto rebuildMesh = [&labels, &updateMesh](SPtr<Mesh>& mesh)
+		{
+			labels[0]->setVisible(false);
+			updateMesh(mesh);
+
+			labels[0]->setVisible(true);
+			return updateMesh(mesh);
+		};
+
+		SPtr<Mesh> initialMesh;
+		SPtr<MeshData> initialData = updateMesh(initialMesh);
+		BS_TEST_ASSERT(initialMesh != nullptr && initialData != nullptr);
+
+		// Changing contents without changing the number of quads updates the existing mesh in place, with the same
+		// result as rebuilding everything
+		{
+			labels[3]->setContent(GUIContent(HString("9876543210")));
+			labels[40]->setContent(GUIContent(HString("5555555555")));
+
+			SPtr<Mesh> updatedMesh;
+			SPtr<MeshData> updatedData = updateMesh(updatedMesh);
+			BS_TEST_ASSERT(updatedMesh == initialMesh);
+			BS_TEST_ASSERT(!isEqual(updatedData, initialData));
+
+			SPtr<Mesh> rebuiltMesh;
+			SPtr<MeshData> rebuiltData = rebuildMesh(rebuiltMesh);
+			BS_TEST_ASSERT(rebuiltMesh != updatedMesh);
+			BS_TEST_ASSERT(isEqual(updatedData, rebuiltData));
+		}
+
+		// Changing the number of quads shifts the following elements, again with the same result as a full rebuild
+		{
+			labels[10]->setContent(GUIContent(HString("01")));
+			labels[20]->setContent(GUIContent(HString("0123456789012")));
+
+			SPtr<Mesh> updatedMesh;
+			SPtr<MeshData> updatedData = updateMesh(updatedMesh);
+
+			SPtr<Mesh> rebuiltMesh;
+			SPtr<MeshData> rebuiltData = rebuildMesh(rebuiltMesh);
+			BS_TEST_ASSERT(isEqual(updatedData, rebuiltData));
+		}
+
+		widget->_destroy();
+		camera->SO()->destroy();
+	}
+
+	void EngineTestSuite::testGlyphCache()
+	{
+		static constexpr UINT32 FONT_SIZE = 10;
+		static constexpr UINT32 NUM_THREADS = 4;
+		static constexpr UINT32 NUM_LOOKUPS = 2000;
+
+		SPtr<GlyphRasterizerFactory> oldFactory = FontManager::instance().getRasterizerFactory();
+		GLYPH_CACHE_DESC oldCacheDesc = FontManager::instance().getGlyphCacheDesc();
+
+		// Page can only fit a single glyph, and there is only one page, so any new glyph requires an eviction
+		GLYPH_CACHE_DESC cacheDesc;
+		cacheDesc.initialPageSize = 16;
+		cacheDesc.maxPageSize = 16;
+		cacheDesc.maxPages = 1;
+
+		FontManager::instance().setRasterizerFactory(bs_shared_ptr_new<TestGlyphRasterizerFactory>());
+		FontManager::instance().setGlyphCacheDesc(cacheDesc);
+
+		SPtr<FontBitmap> bitmap = bs_shared_ptr_new<FontBitmap>();
+		bitmap->size = FONT_SIZE;
+		bitmap->baselineOffset = FONT_SIZE;
+		bitmap->lineHeight = FONT_SIZE;
+		bitmap->spaceWidth = FONT_SIZE / 2;
+		bitmap->missingGlyph = CharDesc();
+
+		FontGlyphSource glyphSource;
+		glyphSource.data = bs_shared_ptr_new<MemoryDataStream>(16);
+
+		HFont font = Font::create({ bitmap }, glyphSource);
+		GlyphCache* cache = bitmap->glyphCache.get();
+		BS_TEST_ASSERT(cache != nullptr);
+
+		if(cache != nullptr)
+		{
+			const auto hasGlyph = [&bitmap](UINT32 charId) { return bitmap->_findCharDesc(charId) != nullptr; };
+
+			// Missing glyphs get rasterized and added during later updates
+			BS_TEST_ASSERT(cache->getCharDesc('A').charId != 'A');
+			BS_TEST_ASSERT(updateGlyphCaches([&hasGlyph]() { return hasGlyph('A'); }));
+
+			// Text layout pins the page of the glyphs it uses, so another glyph can't take its place
+			{
+				TextData<> textData(U"AAA", font, FONT_SIZE);
+				const CharDesc& layoutDesc = cache->getCharDesc('A');
+
+				const bool added = updateGlyphCaches([cache, &hasGlyph]()
+				{
+					cache->getCharDesc('B');
+					return hasGlyph('B');
+				}, 50);
+
+				BS_TEST_ASSERT(!added);
+				BS_TEST_ASSERT(hasGlyph('A'));
+				BS_TEST_ASSERT(layoutDesc.charId == 'A');
+			}
+
+			// Once the layout is gone the page can be evicted
+			BS_TEST_ASSERT(updateGlyphCaches([cache, &hasGlyph]()
+			{
+				cache->getCharDesc('B');
+				return hasGlyph('B');
+			}));
+			BS_TEST_ASSERT(!hasGlyph('A'));
+
+			// Lookups and pinning from multiple threads, while the cache keeps adding and evicting glyphs
+			std::atomic<UINT32> numActive(NUM_THREADS);
+			Vector<Thread> threads;
+			for(UINT32 i = 0; i < NUM_THREADS; i++)
+			{
+				threads.emplace_back([cache, i, &numActive]()
+				{
+					for(UINT32 j = 0; j < NUM_LOOKUPS; j++)
+					{
+						SmallVector<UINT32, 4> pinnedPages;
+						cache->getCharDesc('A' + (i + j) % 4, &pinnedPages);
+
+						for(auto& page : pinnedPages)
+							cache->unpinPage(page);
+					}
+
+					numActive--;
+				});
+			}
+
+			updateGlyphCaches([&numActive]() { return numActive == 0; }, std::numeric_limits<UINT32>::max());
+
+			for(auto& thread : threads)
+				thread.join();
+
+			// All pins got released, so the page can still be evicted
+			BS_TEST_ASSERT(updateGlyphCaches([cache, &hasGlyph]()
+			{
+				cache->getCharDesc('E');
+				return hasGlyph('E');
+			}));
+
+			for(UINT32 charId = 'A'; charId < 'E'; charId++)
+				BS_TEST_ASSERT(!hasGlyph(charId));
+		}
+
+		font = nullptr;
+		FontManager::instance().setRasterizerFactory(oldFactory);
+		FontManager::instance().setGlyphCacheDesc(oldCacheDesc);
+	}
+
+	void EngineTestSuite::testPrefabInstantiate()
+	{
+		HSceneObject source = createTestHierarchy("Original", 20);
+		HPrefab prefab = Prefab::create(source, false);
+		source->destroy(true);
+
+		// Every instance is a separate copy of the prefab hierarchy, linked to the prefab
+		HSceneObject first = prefab->instantiate();
+		HSceneObject second = prefab->instantiate();
+
+		BS_TEST_ASSERT(isSameHierarchy(prefab->_getRoot(), first));
+		BS_TEST_ASSERT(isSameHierarchy(prefab->_getRoot(), second));
+		BS_TEST_ASSERT(isSameHierarchy(first, second));
+		BS_TEST_ASSERT(first->getPrefabLink() == prefab.getUUID());
+		BS_TEST_ASSERT(first->getChild(0)->getComponent<CRenderable>() == nullptr);
+		BS_TEST_ASSERT(first->getComponent<CRenderable>() != nullptr);
+
+		// Instances don't share state with each other, or with the cached template
+		first->setPosition(Vector3(100.0f, 0.0f, 0.0f));
+		HSceneObject third = prefab->instantiate();
+		BS_TEST_ASSERT(isSameHierarchy(second, third));
+
+		// Instantiating after the prefab changes uses the new contents
+		HSceneObject updated = createTestHierarchy("Updated", 10);
+		prefab->update(updated);
+		updated->destroy(true);
+
+		HSceneObject fourth = prefab->instantiate();
+		BS_TEST_ASSERT(isSameHierarchy(prefab->_getRoot(), fourth));
+		BS_TEST_ASSERT(fourth->getName() == "Updated0");
+		BS_TEST_ASSERT(!isSameHierarchy(third, fourth));
+
+		first->destroy(true);
+		second->destroy(true);
+		third->destroy(true);
+		fourth->destroy(true);
+	}
+
+	void EngineTestSuite::testGameObjectTable()
+	{
+		static constexpr UINT32 NUM_OBJECTS = 3500;
+
+		GameObjectManager& gameObjectManager = GameObjectManager::instance();
+		gameObjectManager.destroyQueuedObjects();
+
+		const UINT32 numPagesBefore = gameObjectManager._getNumAllocatedPages();
+
+		// Objects can be looked up by their ID, even when spanning multiple pages
+		Vector<HSceneObject> objects;
+		Vector<UINT64> ids;
+		for(UINT32 i = 0; i < NUM_OBJECTS; i++)
+		{
+			objects.push_back(SceneObject::create("Object"));
+			ids.push_back(objects.back()->getInstanceId());
+		}
+
+		BS_TEST_ASSERT(gameObjectManager._getNumAllocatedPages() > numPagesBefore);
+
+		bool allFound = true;
+		for(UINT32 i = 0; i < NUM_OBJECTS; i++)
+			allFound &= gameObjectManager.getObject(ids[i])._getHandleData() == objects[i]._getHandleData();
+
+		BS_TEST_ASSERT(allFound);
+		BS_TEST_ASSERT(!gameObjectManager.objectExists(gameObjectManager.reserveId()));
+
+		// Remapping moves the object to a different slot
+		const UINT64 originalId = ids[0];
+		const UINT64 remappedId = gameObjectManager.reserveId();
+		gameObjectManager.remapId(originalId, remappedId);
+
+		BS_TEST_ASSERT(!gameObjectManager.objectExists(originalId));
+		BS_TEST_ASSERT(gameObjectManager.getObject(remappedId)._getHandleData() == objects[0]._getHandleData());
+
+		gameObjectManager.remapId(remappedId, originalId);
+		BS_TEST_ASSERT(gameObjectManager.objectExists(originalId));
+
+		// Destroying an object can queue more objects for destruction, which get destroyed during the same call
+		HSceneObject first = objects[0];
+		HSceneObject second = objects[1];
+		HEvent onDestroyedConn = gameObjectManager.onDestroyed.connect([first, second](const HGameObject& object)
+		{
+			if(object._getHandleData() == first._getHandleData())
+				second->destroy();
+		});
+
+		first->destroy();
+		gameObjectManager.destroyQueuedObjects();
+		onDestroyedConn.disconnect();
+
+		BS_TEST_ASSERT(first.isDestroyed(true));
+		BS_TEST_ASSERT(second.isDestroyed(true));
+
+		// Pages are released once all of their objects are gone, other than the one IDs are currently allocated from
+		for(auto& object : objects)
+		{
+			if(!object.isDestroyed(true))
+				object->destroy(true);
+		}
+
+		bool noneFound = true;
+		for(auto& id : ids)
+			noneFound &= !gameObjectManager.objectExists(id);
+
+		BS_TEST_ASSERT(noneFound);
+		BS_TEST_ASSERT(gameObjectManager._getNumAllocatedPages() <= numPagesBefore + 1);
+	}
+
+	void EngineTestSuite::testPrefabPool()
+	{
+		HSceneObject source = createTestHierarchy("Pooled", 5);
+		HPrefab prefab = Prefab::create(source, false);
+		source->destroy(true);
+
+		{
+			PrefabPool pool(prefab, 2);
+			BS_TEST_ASSERT(pool.getNumParked() == 2);
+
+			// Spawned instances are taken from the pool and activated in the scene
+			const Vector3 position(1.0f, 2.0f, 3.0f);
+			HSceneObject instance = pool.spawn(position);
+			BS_TEST_ASSERT(pool.getNumParked() == 1);
+			BS_TEST_ASSERT(instance->getActive());
+			BS_TEST_ASSERT(instance->getParent() == gSceneManager().getMainScene()->getRoot());
+			BS_TEST_ASSERT(instance->getLocalTransform().getPosition() == position);
+			BS_TEST_ASSERT(isSameHierarchy(prefab->_getRoot(), instance));
+
+			// Flags of the object parked instances are kept under don't carry over to spawned instances
+			const auto hasParkingFlags = [](const HSceneObject& object)
+			{
+				return object->hasFlag(SOF_Internal) || object->hasFlag(SOF_Persistent) || object->hasFlag(SOF_DontSave);
+			};
+
+			BS_TEST_ASSERT(!hasParkingFlags(instance));
+			BS_TEST_ASSERT(instance->getNumChildren() > 0 && !hasParkingFlags(instance->getChild(0)));
+
+			// Despawned instances are parked and reused, rather than destroyed
+			const UINT64 instanceId = instance->getInstanceId();
+			pool.despawn(instance);
+			BS_TEST_ASSERT(pool.getNumParked() == 2);
+			BS_TEST_ASSERT(!instance.isDestroyed(true));
+			BS_TEST_ASSERT(!instance->getActive());
+			BS_TEST_ASSERT(!instance->getChild(0)->getActive());
+
+			HSceneObject reused = pool.spawn();
+			BS_TEST_ASSERT(reused->getInstanceId() == instanceId);
+			BS_TEST_ASSERT(reused->getActive());
+			BS_TEST_ASSERT(!hasParkingFlags(reused));
+
+			// Spawning more instances than are parked instantiates new ones
+			HSceneObject other0 = pool.spawn();
+			HSceneObject other1 = pool.spawn();
+			BS_TEST_ASSERT(pool.getNumParked() == 0);
+			BS_TEST_ASSERT(other1 != nullptr && other1 != other0 && other1 != reused);
+
+			// Objects not originating from the pool's prefab are destroyed instead of parked
+			HSceneObject foreign = SceneObject::create("Foreign");
+			pool.despawn(foreign);
+			GameObjectManager::instance().destroyQueuedObjects();
+
+			BS_TEST_ASSERT(pool.getNumParked() == 0);
+			BS_TEST_ASSERT(foreign.isDestroyed(true));
+
+			pool.despawn(other0);
+			pool.despawn(other1);
+			pool.clear();
+			GameObjectManager::instance().destroyQueuedObjects();
+
+			BS_TEST_ASSERT(pool.getNumParked() == 0);
+			BS_TEST_ASSERT(other0.isDestroyed(true));
+
+			reused->destroy(true);
+		}
+	}
+
+	void EngineTestSuite::testComponentUpdateOrder()
+	{
+		static constexpr UINT32 NUM_PARALLEL = 1000;
+
+		Vector<UINT32> log;
+		HSceneObject root = SceneObject::create("UpdateOrderRoot");
+
+		const auto createObject = [&root](UINT32 idx)
+		{
+			HSceneObject so = SceneObject::create("UpdateOrder" + toString(idx));
+			so->setParent(root);
+
+			return so;
+		};
+
+		// Created interleaved, expected to be updated sorted by update order, then grouped by type, then in order of
+		// activation
+		createObject(0)->addComponent<TestUpdateComponentB>(&log, 1, 0);
+		createObject(1)->addComponent<TestUpdateComponentA>(&log, 2, 0);
+		createObject(2)->addComponent<TestUpdateComponentA>(&log, 3, -1);
+		createObject(3)->addComponent<TestUpdateComponentB>(&log, 4, 1);
+		HSceneObject toggled = createObject(4);
+		toggled->addComponent<TestUpdateComponentA>(&log, 5, 0);
+		createObject(5)->addComponent<TestUpdateComponentB>(&log, 6, 0);
+
+		gSceneManager()._update();
+		BS_TEST_ASSERT((log == Vector<UINT32>{ 3, 2, 5, 1, 6, 4 }));
+
+		// Buckets are rebuilt when the set of active components changes
+		log.clear();
+		toggled->setActive(false);
+		gSceneManager()._update();
+		BS_TEST_ASSERT((log == Vector<UINT32>{ 3, 2, 1, 6, 4 }));
+
+		log.clear();
+		toggled->setActive(true);
+		gSceneManager()._update();
+		BS_TEST_ASSERT((log == Vector<UINT32>{ 3, 2, 5, 1, 6, 4 }));
+
+		// Components that allow parallel updates are updated exactly once per update, even when split across tasks
+		HSceneObject parallelRoot = createObject(6);
+		Vector<GameObjectHandle<TestUpdateComponentC>> parallel;
+		for(UINT32 i = 0; i < NUM_PARALLEL; i++)
+			parallel.push_back(parallelRoot->addComponent<TestUpdateComponentC>(&log, 7, 0, true));
+
+		log.clear();
+		gSceneManager()._update();
+		gSceneManager()._fixedUpdate();
+		BS_TEST_ASSERT((log == Vector<UINT32>{ 3, 2, 5, 1, 6, 4 }));
+
+		bool allUpdatedOnce = true;
+		for(auto& component : parallel)
+			allUpdatedOnce &= component->numUpdates == 1 && component->numFixedUpdates == 1;
+
+		BS_TEST_ASSERT(allUpdatedOnce);
+
+		root->destroy(true);
+	}
+
+	void EngineTestSuite::testRenderQueueInstancing()
+	{
+		static constexpr UINT32 NUM_ELEMENTS = 11;
+		static constexpr UINT32 NUM_LARGE_GROUP = ct::RenderQueue::MAX_INSTANCES_PER_DRAW + 88;
+
+		const HShader shader = BuiltinResources::instance().getBuiltinShader(BuiltinShader::Standard);
+		const HMaterial materialA = Material::create(shader);
+		const HMaterial materialB = Material::create(shader);
+		const HMesh mesh = BuiltinResources::instance().getMesh(BuiltinMesh::Box);
+
+		// Wait until core objects are initialized
+		gCoreThread().submit(true);
+
+		const SPtr<ct::Mesh> coreMesh = mesh->getCore();
+		const SubMesh& subMesh = coreMesh->getProperties().getSubMesh(0);
+		const SubMesh otherSubMesh(subMesh.indexOffset + 3, subMesh.indexCount - 3, subMesh.drawOp);
+
+		const UINT32 numPasses = materialA->getCore()->getNumPasses(0);
+		BS_TEST_ASSERT(numPasses > 0);
+
+		Vector<TestRenderElement> elements(NUM_ELEMENTS);
+		const auto setupElement = [&](UINT32 idx, const HMaterial& material, const SubMesh& elemSubMesh, UINT32 key)
+		{
+			elements[idx].mesh = coreMesh;
+			elements[idx].subMesh = elemSubMesh;
+			elements[idx].material = material->getCore();
+			elements[idx].techniqueIdx = 0;
+			elements[idx].instancingKey = key;
+		};
+
+		for(UINT32 i = 0; i < 6; i++)
+			setupElement(i, materialA, subMesh, 1);
+
+		setupElement(6, materialA, subMesh, 0); // Doesn't support instancing
+		setupElement(7, materialB, subMesh, 1);
+		setupElement(8, materialB, subMesh, 1);
+		setupElement(9, materialA, otherSubMesh, 1);
+		setupElement(10, materialA, subMesh, 2);
+
+		// Compatible elements are interleaved with others, and must be grouped regardless
+		ct::RenderQueue queue;
+		queue.setInstancing(true);
+		for(UINT32 i = 0; i < NUM_ELEMENTS; i++)
+			queue.add(&elements[i], (float)((i * 7) % NUM_ELEMENTS), 0);
+
+		queue.sort();
+		BS_TEST_ASSERT(isValidInstancing(queue, elements, numPasses));
+
+		// Groups: materialA (6 elements), materialB (2), and single draws for the non-instanced element, the different
+		// sub-mesh and the different instancing key
+		BS_TEST_ASSERT(queue.getSortedElements().size() == 5 * numPasses);
+		BS_TEST_ASSERT(queue.getInstancedElements().size() == 8 * numPasses);
+
+		// No grouping with instancing disabled
+		queue.clear();
+		queue.setInstancing(false);
+		for(UINT32 i = 0; i < NUM_ELEMENTS; i++)
+			queue.add(&elements[i], (float)i, 0);
+
+		queue.sort();
+		BS_TEST_ASSERT(isValidInstancing(queue, elements, numPasses));
+		BS_TEST_ASSERT(queue.getSortedElements().size() == NUM_ELEMENTS * numPasses);
+
+		bool allSingle = true;
+		for(auto& entry : queue.getSortedElements())
+			allSingle &= entry.numInstances == 1;
+
+		BS_TEST_ASSERT(allSingle);
+
+		// Groups are split once they reach the maximum number of instances per draw
+		Vector<TestRenderElement> largeGroup(NUM_LARGE_GROUP);
+		for(auto& element : largeGroup)
+		{
+			element.mesh = coreMesh;
+			element.subMesh = subMesh;
+			element.material = materialA->getCore();
+			element.techniqueIdx = 0;
+			element.instancingKey = 1;
+		}
+
+		queue.clear();
+		queue.setInstancing(true);
+		for(auto& element : largeGroup)
+			queue.add(&element, 0.0f, 0);
+
+		queue.sort();
+		BS_TEST_ASSERT(isValidInstancing(queue, largeGroup, numPasses));
+
+		const Vector<ct::RenderQueueElement>& sorted = queue.getSortedElements();
+		BS_TEST_ASSERT(sorted.size() == 2 * numPasses);
+
+		UINT32 numFullGroups = 0;
+		for(auto& entry : sorted)
+		{
+			if(entry.numInstances == ct::RenderQueue::MAX_INSTANCES_PER_DRAW)
+				numFullGroups++;
+		}
+
+		BS_TEST_ASSERT(numFullGroups == numPasses);
+	}
+
+	void EngineTestSuite::testRenderQueueSort()
+	{
+		static constexpr UINT32 NUM_KEYS = 5000;
+		static constexpr ct::StateReduction MODES[] = 
+			{ ct::StateReduction::None, ct::StateReduction::Material, ct::StateReduction::Distance };
+
+		// Radix sort is stable and matches sorting by key only
+		Random random(1);
+		Vector<std::pair<UINT64, UINT32>> expected(NUM_KEYS);
+		Vector<UINT64> keys(NUM_KEYS);
+		Vector<UINT32> values(NUM_KEYS);
+		for(UINT32 i = 0; i < NUM_KEYS; i++)
+		{
+			// Mostly shared high bits, so some digits are skipped while others aren't
+			const UINT64 key = ((UINT64)(random.get() % 4) << 56) | ((UINT64)random.get() << 8) | (random.get() % 3);
+
+			keys[i] = key;
+			values[i] = i;
+			expected[i] = std::make_pair(key, i);
+		}
+
+		std::stable_sort(expected.begin(), expected.end(), 
+			[](const std::pair<UINT64, UINT32>& a, const std::pair<UINT64, UINT32>& b) { return a.first < b.first; });
+
+		Vector<UINT64> tmpKeys(NUM_KEYS);
+		Vector<UINT32> tmpValues(NUM_KEYS);
+		TestRenderQueue::radixSort(keys.data(), values.data(), tmpKeys.data(), tmpValues.data(), NUM_KEYS);
+
+		bool radixMatches = true;
+		for(UINT32 i = 0; i < NUM_KEYS; i++)
+			radixMatches &= keys[i] == expected[i].first && values[i] == expected[i].second;
+
+		BS_TEST_ASSERT(radixMatches);
+
+		// Sorting by keys yields the same order as the sorter callbacks, for random inputs of different sizes
+		const UINT32 sizes[] = { 1, 2, 17, 300, NUM_KEYS };
+		for(auto mode : MODES)
+		{
+			for(UINT32 i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+			{
+				TestRenderQueue queue(mode);
+				queue.addRandom(sizes[i], i + 1);
+
+				Vector<UINT32> keyOrder;
+				Vector<UINT32> callbackOrder;
+				BS_TEST_ASSERT(queue.sortWithKeys(keyOrder));
+				queue.sortWithCallbacks(callbackOrder);
+
+				BS_TEST_ASSERT(keyOrder == callbackOrder);
+			}
+		}
+
+		// Too many distinct priorities to encode in a key, sort() must fall back to the sorter callbacks
+		TestRenderQueue queue(ct::StateReduction::Distance);
+		queue.addRandom(NUM_KEYS, 10, 1000);
+
+		Vector<UINT32> keyOrder;
+		BS_TEST_ASSERT(!queue.sortWithKeys(keyOrder));
+	}
+
+	void EngineTestSuite::testMaterialParamUpdate()
+	{
+		static constexpr UINT32 NUM_DATA_PARAMS = TestGpuProgram::NUM_DATA_PARAMS;
+		static constexpr UINT32 NUM_TEXTURES = TestGpuProgram::NUM_TEXTURES;
+		static constexpr UINT32 RING_SIZE = MaterialParams::DIRTY_RING_SIZE;
+		static constexpr UINT32 NUM_ROUNDS = 10;
+
+		TestGpuProgramFactory factory;
+		gCoreThread().queueCommand([&factory]()
+		{
+			ct::GpuProgramManager::instance().addFactory(TEST_GPU_PROGRAM_LANGUAGE, &factory);
+		});
+		gCoreThread().submit(true);
+
+		HMaterial material = createParamTestMaterial();
+		SPtr<GpuParamsSet> paramsSet = material->createParamsSet();
+		material->updateParamsSet(paramsSet, 0.0f, true);
+
+		SPtr<GpuParamsSet> laggingParamsSet = material->createParamsSet();
+		material->updateParamsSet(laggingParamsSet, 0.0f, true);
+
+		Vector<HTexture> textures(NUM_TEXTURES);
+		for(auto& texture : textures)
+		{
+			TEXTURE_DESC textureDesc;
+			textureDesc.type = TEX_TYPE_2D;
+			textureDesc.width = 4;
+			textureDesc.height = 4;
+			textureDesc.format = PF_RGBA8;
+
+			texture = Texture::create(textureDesc);
+		}
+
+		// Checks that the GPU parameters of the set contain the most recent material parameter values
+		Vector<float> expectedValues(NUM_DATA_PARAMS, 0.0f);
+		Vector<HTexture> expectedTextures(NUM_TEXTURES);
+		const auto isUpToDate = [&expectedValues, &expectedTextures](const SPtr<GpuParamsSet>& set)
+		{
+			SPtr<GpuParams> gpuParams = set->getGpuParams(0);
+			for(UINT32 i = 0; i < NUM_DATA_PARAMS; i++)
+			{
+				GpuParamFloat param;
+				gpuParams->getParam(GPT_FRAGMENT_PROGRAM, "gValue" + toString(i), param);
+
+				if(param.get() != expectedValues[i])
+					return false;
+			}
+
+			for(UINT32 i = 0; i < NUM_TEXTURES; i++)
+			{
+				GpuParamTexture param;
+				gpuParams->getTextureParam(GPT_FRAGMENT_PROGRAM, "gTex" + toString(i), param);
+
+				if(param.get() != expectedTextures[i])
+					return false;
+			}
+
+			return true;
+		};
+
+		BS_TEST_ASSERT(isUpToDate(paramsSet));
+
+		// Number of modifications between updates: handled using the dirty ring up to and including its size, and with 
+		// a full update after that. Repeating them makes the ring wrap around many times.
+		const UINT32 numModifications[] = { 1, 5, RING_SIZE - 1, RING_SIZE, RING_SIZE + 1, 3 * RING_SIZE };
+
+		Random random(5);
+		float value = 1.0f;
+		bool allUpToDate = true;
+		for(UINT32 i = 0; i < NUM_ROUNDS; i++)
+		{
+			for(auto count : numModifications)
+			{
+				for(UINT32 j = 0; j < count; j++)
+				{
+					// Every fourth modification is a texture. Data modifications often hit the same few parameters, so 
+					// the ring contains entries superseded by later modifications.
+					if((j % 4) == 3)
+					{
+						const UINT32 idx = random.get() % NUM_TEXTURES;
+						const HTexture& texture = textures[random.get() % NUM_TEXTURES];
+
+						material->setTexture("tex" + toString(idx), texture);
+						expectedTextures[idx] = texture;
+					}
+					else
+					{
+						const UINT32 idx = random.get() % ((j % 2) == 0 ? 4 : NUM_DATA_PARAMS);
+
+						material->setFloat("value" + toString(idx), value);
+						expectedValues[idx] = value;
+						value += 1.0f;
+					}
+				}
+
+				material->updateParamsSet(paramsSet);
+				allUpToDate &= isUpToDate(paramsSet);
+			}
+
+			// Updated only once per round, so it always falls back to a full update
+			material->updateParamsSet(laggingParamsSet);
+			allUpToDate &= isUpToDate(laggingParamsSet);
+		}
+
+		BS_TEST_ASSERT(allUpToDate);
+
+		// Update without any modifications leaves everything as is
+		material->updateParamsSet(paramsSet);
+		BS_TEST_ASSERT(isUpToDate(paramsSet));
+
+		paramsSet = nullptr;
+		laggingParamsSet = nullptr;
+		material = nullptr;
+
+		gCoreThread().queueCommand([]()
+		{
+			ct::GpuProgramManager::instance().removeFactory(TEST_GPU_PROGRAM_LANGUAGE);
+		});
+		gCoreThread().submit(true);
+	}
+
+	void EngineTestSuite::testMaterialParamId()
+	{
+		// More shaders than could be remembered by a per-identifier cache
+		static constexpr UINT32 NUM_SHADERS = 8;
+		static constexpr UINT32 NUM_ROUNDS = 3;
+
+		static const TMaterialDataParamId<float> intensityId("intensity");
+		static const TMaterialDataParamId<Vector4> offsetsId("offsets");
+		static const MaterialTextureParamId albedoId("albedo");
+
+		// Lookup table built from a shader description, and from a shader loaded from disk
+		const HShader builtinShader = BuiltinResources::instance().getBuiltinShader(BuiltinShader::Standard);
+		BS_TEST_ASSERT(isParamLookupValid(Material::create(builtinShader)));
+
+		Vector<HMaterial> materials;
+		for(UINT32 i = 0; i < NUM_SHADERS; i++)
+		{
+			materials.push_back(Material::create(createParamIdTestShader()));
+
+			// Multiple materials share each shader
+			materials.push_back(Material::create(materials.back()->getShader()));
+		}
+
+		BS_TEST_ASSERT(isParamLookupValid(materials[0]));
+
+		// Identifiers are used with materials of different shaders in turn
+		bool allSet = true;
+		for(UINT32 i = 0; i < NUM_ROUNDS; i++)
+		{
+			for(UINT32 j = 0; j < (UINT32)materials.size(); j++)
+			{
+				const float value = (float)(i * materials.size() + j);
+				materials[j]->setParam(intensityId, value);
+				materials[j]->setParam(offsetsId, Vector4(value, 0.0f, 0.0f, 1.0f), 3);
+			}
+
+			for(UINT32 j = 0; j < (UINT32)materials.size(); j++)
+			{
+				const float value = (float)(i * materials.size() + j);
+				allSet &= materials[j]->getFloat("intensity") == value;
+				allSet &= materials[j]->getVec4("offsets", 3) == Vector4(value, 0.0f, 0.0f, 1.0f);
+			}
+		}
+
+		BS_TEST_ASSERT(allSet);
+
+		TEXTURE_DESC textureDesc;
+		textureDesc.type = TEX_TYPE_2D;
+		textureDesc.width = 4;
+		textureDesc.height = 4;
+		textureDesc.format = PF_RGBA8;
+
+		HTexture texture = Texture::create(textureDesc);
+		materials[1]->setParam(albedoId, texture);
+		BS_TEST_ASSERT(materials[1]->getTexture("albedo") == texture);
+		BS_TEST_ASSERT(materials[0]->getTexture("albedo") != texture);
+
+		// Identifiers with a wrong type, or referencing missing parameters, don't modify anything
+		static const TMaterialDataParamId<Vector2> wrongTypeId("intensity");
+		static const TMaterialDataParamId<float> missingId("missing");
+
+		const float oldValue = materials[0]->getFloat("intensity");
+		materials[0]->setParam(wrongTypeId, Vector2(-1.0f, -1.0f));
+		materials[0]->setParam(missingId, -1.0f);
+		BS_TEST_ASSERT(materials[0]->getFloat("intensity") == oldValue);
+
+		// Batch setter assigns all parameters
+		materials[2]->setParamBatch(intensityId, 100.0f, offsetsId, Vector4(1.0f, 2.0f, 3.0f, 4.0f));
+		BS_TEST_ASSERT(materials[2]->getFloat("intensity") == 100.0f);
+		BS_TEST_ASSERT(materials[2]->getVec4("offsets") == Vector4(1.0f, 2.0f, 3.0f, 4.0f));
+	}
+
+	void EngineTestSuite::testInstancedDrawCalls()
+	{
+		static constexpr UINT32 GRID_SIZE = 8;
+		static constexpr UINT32 NUM_RENDERABLES = GRID_SIZE * GRID_SIZE;
+
+		// Instancing is implemented by the renderer, so this only runs when the tests are started with RenderBeast. Draw
+		// calls are counted by the null render API.
+		SPtr<ct::Renderer> renderer = RendererManager::instance().getActive();
+		if(renderer == nullptr || renderer->getName() != StringID("RenderBeast"))
+			return;
+
+		HCamera camera = createTestCamera(64, 64);
+		camera->SO()->setPosition(Vector3(0.0f, 0.0f, GRID_SIZE * 3.0f));
+		camera->SO()->lookAt(Vector3::ZERO);
+
+		UINT64 numDrawCalls[2];
+		UINT64 numInstancedDrawCalls[2];
+		for(UINT32 i = 0; i < 2; i++)
+		{
+			const bool sharedMaterial = i == 0;
+			HSceneObject root = createInstancingScene(GRID_SIZE, sharedMaterial);
+
+			// Let the renderer register the renderables and their materials before counting
+			countDrawCalls(2, numDrawCalls[i], numInstancedDrawCalls[i]);
+			countDrawCalls(1, numDrawCalls[i], numInstancedDrawCalls[i]);
+
+			root->destroy();
+		}
+
+		// All boxes sharing a material are drawn with a single instanced draw call, instead of one draw call each
+		BS_TEST_ASSERT(numInstancedDrawCalls[0] >= 1);
+		BS_TEST_ASSERT(numInstancedDrawCalls[1] == 0);
+		BS_TEST_ASSERT(numDrawCalls[0] + NUM_RENDERABLES - 1 <= numDrawCalls[1]);
+
+		camera->SO()->destroy();
+		static_cast<EngineTestApplication&>(gApplication()).runFrames(1);
+	}
+
+	void EngineTestSuite::testStaticShadowCache()
+	{
+		// Static shadow maps are cached by the renderer, so this only runs when the tests are started with RenderBeast.
+		// The null render API doesn't produce any depth, so this checks the cached map gets restored into the shadow map
+		// without re-rendering the static casters.
+		SPtr<ct::Renderer> renderer = RendererManager::instance().getActive();
+		if(renderer == nullptr || renderer->getName() != StringID("RenderBeast"))
+			return;
+
+		HCamera camera = createTestCamera(512, 512);
+		camera->SO()->setPosition(Vector3(0.0f, 5.0f, 5.0f));
+		camera->SO()->lookAt(Vector3::ZERO);
+
+		HSceneObject lightSO = SceneObject::create("SpotLight");
+		lightSO->setPosition(Vector3(0.0f, 10.0f, 0.0f));
+		lightSO->lookAt(Vector3::ZERO);
+		lightSO->setMobility(ObjectMobility::Static);
+
+		HLight light = lightSO->addComponent<CLight>();
+		light->setType(LightType::Spot);
+		light->setCastsShadow(true);
+		light->setAttenuationRadius(20.0f);
+
+		const HShader shader = BuiltinResources::instance().getBuiltinShader(BuiltinShader::Standard);
+		const HMaterial material = Material::create(shader);
+
+		HSceneObject boxSO = SceneObject::create("Box");
+		boxSO->setMobility(ObjectMobility::Static);
+
+		HRenderable renderable = boxSO->addComponent<CRenderable>();
+		renderable->setMesh(BuiltinResources::instance().getMesh(BuiltinMesh::Box));
+		renderable->setMaterial(material);
+
+		// Static casters get rendered into the cache once, after which the cached map keeps being restored
+		UINT64 numHits, numMisses;
+		countShadowCacheAccesses(2, numHits, numMisses);
+		countShadowCacheAccesses(4, numHits, numMisses);
+
+		BS_TEST_ASSERT(numHits == 4);
+		BS_TEST_ASSERT(numMisses == 0);
+
+		// Moving the camera away changes the size of the light's shadow map, but not of the cached static map
+		camera->SO()->setPosition(Vector3(0.0f, 20.0f, 20.0f));
+		camera->SO()->lookAt(Vector3::ZERO);
+
+		countShadowCacheAccesses(4, numHits, numMisses);
+
+		BS_TEST_ASSERT(numHits == 4);
+		BS_TEST_ASSERT(numMisses == 0);
+
+		// Adding a static caster invalidates the cache
+		HSceneObject otherBoxSO = SceneObject::create("OtherBox");
+		otherBoxSO->setPosition(Vector3(2.0f, 0.0f, 0.0f));
+		otherBoxSO->setMobility(ObjectMobility::Static);
+
+		HRenderable otherRenderable = otherBoxSO->addComponent<CRenderable>();
+		otherRenderable->setMesh(BuiltinResources::instance().getMesh(BuiltinMesh::Box));
+		otherRenderable->setMaterial(material);
+
+		countShadowCacheAccesses(4, numHits, numMisses);
+
+		BS_TEST_ASSERT(numMisses == 1);
+		BS_TEST_ASSERT(numHits == 3);
+
+		otherBoxSO->destroy();
+		boxSO->destroy();
+		lightSO->destroy();
+		camera->SO()->destroy();
+		static_cast<EngineTestApplication&>(gApplication()).runFrames(1);
+	}
+
+	void EngineTestSuite::testParticleBounds()
+	{
+		static constexpr UINT32 NUM_FRAMES = 90;
+		static constexpr float FRAME_STEP = 1.0f / 30.0f;
+
+		const HMesh mesh = createParticleEmitterMesh();
+		const Vector<SPtr<ParticleEmitterShape>> shapes = createParticleBoundsShapes(mesh);
+		const Vector<Vector<SPtr<ParticleEvolver>>> evolverSets = createParticleBoundsEvolvers();
+
+		// Rotated and non-uniformly scaled, so world space evolvers need to account for the transform
+		const Transform transform(Vector3(1.0f, 2.0f, 3.0f), Quaternion(Vector3::normalize(Vector3(1.0f, 1.0f, 0.0f)), 
+			Degree(30.0f)), Vector3(1.0f, 2.0f, 0.5f));
+
+		for(UINT32 i = 0; i < (UINT32)shapes.size(); i++)
+		{
+			for(UINT32 j = 0; j < (UINT32)evolverSets.size(); j++)
+			{
+				SPtr<ParticleEmitter> emitter = ParticleEmitter::create();
+				emitter->setShape(shapes[i]);
+				emitter->setEmissionRate(200.0f);
+				emitter->setInitialLifetime(FloatDistribution(0.5f, 1.5f));
+				emitter->setInitialSpeed(j % 2 == 0 ? FloatDistribution(2.0f) : FloatDistribution(-1.0f, 3.0f));
+				emitter->setRandomOffset((i + j) % 2 == 0 ? 0.0f : 0.25f);
+
+				ParticleSystemSettings settings;
+				settings.simulationSpace = ParticleSimulationSpace::Local;
+				settings.useAutomaticSeed = false;
+				settings.manualSeed = i * 100 + j;
+
+				SPtr<ParticleSystem> system = ParticleSystem::create();
+				system->setTransform(transform);
+				system->setSettings(settings);
+				system->setEmitters({ emitter });
+				system->setEvolvers(evolverSets[j]);
+				system->play();
+
+				bool allContained = true;
+				bool anyParticles = false;
+				for(UINT32 k = 0; k < NUM_FRAMES; k++)
+				{
+					system->_simulate(FRAME_STEP, nullptr);
+
+					const AABox particleBounds = system->_calculateParticleBounds();
+					if(particleBounds == AABox::BOX_EMPTY)
+						continue;
+
+					anyParticles = true;
+
+					// Bounds must come from the emitter and evolver settings, and contain every simulated particle
+					BS_TEST_ASSERT(system->_hasAnalyticBounds());
+
+					const AABox bounds = system->_calculateBounds();
+					const float tolerance = bounds.getSize().length() * 0.0001f;
+					if(!bounds.contains(particleBounds.getMin(), tolerance) || 
+						!bounds.contains(particleBounds.getMax(), tolerance))
+					{
+						allContained = false;
+					}
+				}
+
+				BS_TEST_ASSERT(anyParticles);
+				BS_TEST_ASSERT(allContained);
+
+				system->destroy();
+			}
+		}
+
+		// Orbiting particles can't be bounded from settings alone, so their bounds come from the particles
+		SPtr<ParticleEmitter> emitter = ParticleEmitter::create();
+		emitter->setShape(shapes[0]);
+		emitter->setEmissionRate(200.0f);
+
+		ParticleSystemSettings settings;
+		settings.simulationSpace = ParticleSimulationSpace::Local;
+
+		SPtr<ParticleSystem> system = ParticleSystem::create();
+		system->setSettings(settings);
+		system->setEmitters({ emitter });
+		system->setEvolvers({ ParticleOrbit::create() });
+		system->play();
+		system->_simulate(FRAME_STEP, nullptr);
+
+		BS_TEST_ASSERT(!system->_hasAnalyticBounds());
+		BS_TEST_ASSERT(system->_calculateBounds() == system->_calculateParticleBounds());
+
+		system->destroy();
+	}
+
+	void EngineTestSuite::testFBXImportParallel()
+	{
+		static constexpr UINT32 NUM_MESHES = 32;
+		static constexpr UINT32 GRID_SIZE = 8;
+		static constexpr UINT32 NUM_KEYFRAMES = 60;
+
+		// Importer plugins are optional
+		if(!gImporter().supportsFileType("fbx"))
+			return;
+
+		const Path directory = FileSystem::getTempDirectoryPath() + "bsfEngineTestFBX/";
+		FileSystem::createDir(directory);
+
+		const Path path = directory + "Scene.fbx";
+		EngineTestAssets::writeFBXScene(path, NUM_MESHES, GRID_SIZE, NUM_KEYFRAMES);
+
+		SPtr<MeshImportOptions> options = MeshImportOptions::create();
+		options->cpuCached = true;
+		options->importAnimation = true;
+
+		// Meshes and animation curves are processed by as many workers as the task scheduler has
+		const Vector<SubResourceRaw> parallel = gImporter()._importAll(path, options);
+
+		// Without any workers, queued tasks only run while the importing thread waits for them. They then run one at a 
+		// time in the order they were queued, same as the serial fallback.
+		TaskScheduler& scheduler = TaskScheduler::instance();
+		const UINT32 numWorkers = scheduler.getNumWorkers();
+		for(UINT32 i = 0; i < numWorkers; i++)
+			scheduler.removeWorker();
+
+		const Vector<SubResourceRaw> serial = gImporter()._importAll(path, options);
+
+		for(UINT32 i = 0; i < numWorkers; i++)
+			scheduler.addWorker();
+
+		FileSystem::remove(directory, true);
+
+		// A mesh and a single animation clip
+		BS_TEST_ASSERT(parallel.size() == 2);
+		BS_TEST_ASSERT(serial.size() == parallel.size());
+		if(parallel.size() != 2 || serial.size() != 2)
+			return;
+
+		const SPtr<Mesh> parallelMesh = std::static_pointer_cast<Mesh>(parallel[0].value);
+		const SPtr<Mesh> serialMesh = std::static_pointer_cast<Mesh>(serial[0].value);
+
+		const SPtr<MeshData> parallelMeshData = parallelMesh->getCachedData();
+		BS_TEST_ASSERT(parallelMeshData != nullptr);
+		BS_TEST_ASSERT(parallelMeshData->getNumIndices() == NUM_MESHES * GRID_SIZE * GRID_SIZE * 6);
+		BS_TEST_ASSERT(isEqual(parallelMeshData, serialMesh->getCachedData()));
+
+		const MeshProperties& parallelProps = parallelMesh->getProperties();
+		const MeshProperties& serialProps = serialMesh->getProperties();
+		BS_TEST_ASSERT(parallelProps.getNumSubMeshes() == NUM_MESHES);
+		BS_TEST_ASSERT(serialProps.getNumSubMeshes() == parallelProps.getNumSubMeshes());
+		for(UINT32 i = 0; i < std::min(parallelProps.getNumSubMeshes(), serialProps.getNumSubMeshes()); i++)
+		{
+			const SubMesh& parallelSubMesh = parallelProps.getSubMesh(i);
+			const SubMesh& serialSubMesh = serialProps.getSubMesh(i);
+
+			BS_TEST_ASSERT(parallelSubMesh.indexOffset == serialSubMesh.indexOffset);
+			BS_TEST_ASSERT(parallelSubMesh.indexCount == serialSubMesh.indexCount);
+		}
+
+		const SPtr<AnimationCurves> parallelCurves = std::static_pointer_cast<AnimationClip>(parallel[1].value)->getCurves();
+		const SPtr<AnimationCurves> serialCurves = std::static_pointer_cast<AnimationClip>(serial[1].value)->getCurves();
+		BS_TEST_ASSERT(parallelCurves->position.size() == NUM_MESHES);
+		BS_TEST_ASSERT(parallelCurves->rotation.size() == NUM_MESHES);
+		BS_TEST_ASSERT(isEqual(parallelCurves->position, serialCurves->position));
+		BS_TEST_ASSERT(isEqual(parallelCurves->rotation, serialCurves->rotation));
+		BS_TEST_ASSERT(isEqual(parallelCurves->scale, serialCurves->scale));
+	}
+
+	EngineTestApplication::EngineTestApplication(const START_UP_DESC& desc)
+		:Application(desc)
+	{ }
+
+	void EngineTestApplication::runFrames(UINT32 count)
+	{
+		if(count == 0)
+			return;
+
+		mFramesRemaining = count;
+		runMainLoop();
+	}
+
+	void EngineTestApplication::postUpdate()
+	{
+		Application::postUpdate();
+
+		// The loop exits after the current frame completes
+		if(mFramesRemaining > 0 && --mFramesRemaining == 0)
+			stopMainLoop();
+	}
+}
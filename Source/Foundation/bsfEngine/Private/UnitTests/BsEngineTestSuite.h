@@ -0,0 +1,53 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsPrerequisites.h"
+#include "BsApplication.h"
+#include "Testing/BsTestSuite.h"
+
+namespace bs
+{
+	/** Application that can run the main loop for a fixed number of frames, so tests can inspect complete frames. */
+	class EngineTestApplication : public Application
+	{
+	public:
+		EngineTestApplication(const START_UP_DESC& desc);
+
+		/** Runs the main loop for the specified number of frames, then returns. */
+		void runFrames(UINT32 count);
+
+	protected:
+		/** @copydoc Application::postUpdate */
+		void postUpdate() override;
+
+		UINT32 mFramesRemaining = 0;
+	};
+
+	/**
+	 * Tests for systems that require the application to be running. Expects EngineTestApplication to be started, ideally
+	 * with the null render API, audio and physics plugins. Tests that depend on a specific renderer are skipped unless
+	 * that renderer is active.
+	 */
+	class EngineTestSuite : public TestSuite
+	{
+	public:
+		EngineTestSuite();
+
+	private:
+		void testGUIMeshUpdate();
+		void testGlyphCache();
+		void testPrefabInstantiate();
+		void testGameObjectTable();
+		void testPrefabPool();
+		void testComponentUpdateOrder();
+		void testRenderQueueInstancing();
+		void testRenderQueueSort();
+		void testMaterialParamUpdate();
+		void testMaterialParamId();
+		void testInstancedDrawCalls();
+		void testStaticShadowCache();
+		void testParticleBounds();
+		void testFBXImportParallel();
+	};
+}
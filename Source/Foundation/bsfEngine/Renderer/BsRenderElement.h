@@ -33,6 +33,13 @@ namespace bs { namespace ct
 		/** Renderer specific value that identifies the type of this renderable element. */
 		UINT32 type = 0;
 
+		/**
+		 * Renderer specific value that allows the element to be rendered together with other elements using a single
+		 * instanced draw call. Elements are grouped if they share the mesh, sub-mesh, material, technique and this key.
+		 * Zero if the element doesn't support instancing.
+		 */
+		UINT32 instancingKey = 0;
+
 		/** Executes the draw call for the render element. */
 		virtual void draw() const = 0;
 
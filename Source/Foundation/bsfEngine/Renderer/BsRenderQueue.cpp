@@ -22,11 +22,19 @@ namespace bs { namespace ct
 		mSortableElements.clear();
 		mSortableElementIdx.clear();
 		mElements.clear();
+		mSortKeys.clear();
 
 		mSortedRenderElements.clear();
+		mInstancedElements.clear();
 	}
 
 	void RenderQueue::add(const RenderElement* element, float distFromCamera, UINT32 techniqueIdx)
+	{
+		add(element, distFromCamera, techniqueIdx, element->subMesh);
+	}
+
+	void RenderQueue::add(const RenderElement* element, float distFromCamera, UINT32 techniqueIdx, 
+		const SubMesh& subMesh)
 	{
 		SPtr<Material> material = element->material;
 		SPtr<Shader> shader = material->getShader();
@@ -66,6 +74,7 @@ namespace bs { namespace ct
 			sortableElem.techniqueIdx = techniqueIdx;
 			sortableElem.passIdx = i;
 			sortableElem.distFromCamera = distFromCamera;
+			sortableElem.subMesh = subMesh;
 
 			mElements.push_back(element);
 		}
@@ -73,27 +82,41 @@ namespace bs { namespace ct
 
 	void RenderQueue::sort()
 	{
-		std::function<bool(UINT32, UINT32, const Vector<SortableElement>&)> sortMethod;
+		const auto numElements = (UINT32)mSortableElementIdx.size();
 
-		switch (mStateReductionMode)
+		// Sort only indices since we generate an entirely new data set anyway, it doesn't make sense to move sortable elements
+		if (generateSortKeys())
 		{
-		case StateReduction::None:
-			sortMethod = &elementSorterNoGroup;
-			break;
-		case StateReduction::Material:
-			sortMethod = &elementSorterPreferGroup;
-			break;
-		case StateReduction::Distance:
-			sortMethod = &elementSorterPreferDistance;
-			break;
+			mSortKeysTemp.resize(numElements);
+			mSortableElementIdxTemp.resize(numElements);
+
+			radixSort(mSortKeys.data(), mSortableElementIdx.data(), mSortKeysTemp.data(), mSortableElementIdxTemp.data(),
+				numElements);
 		}
+		else
+		{
+			std::function<bool(UINT32, UINT32, const Vector<SortableElement>&)> sortMethod;
 
-		// Sort only indices since we generate an entirely new data set anyway, it doesn't make sense to move sortable elements
-		std::sort(mSortableElementIdx.begin(), mSortableElementIdx.end(), std::bind(sortMethod, _1, _2, mSortableElements));
+			switch (mStateReductionMode)
+			{
+			case StateReduction::None:
+				sortMethod = &elementSorterNoGroup;
+				break;
+			case StateReduction::Material:
+				sortMethod = &elementSorterPreferGroup;
+				break;
+			case StateReduction::Distance:
+				sortMethod = &elementSorterPreferDistance;
+				break;
+			}
+
+			std::sort(mSortableElementIdx.begin(), mSortableElementIdx.end(), 
+				std::bind(sortMethod, _1, _2, std::cref(mSortableElements)));
+		}
 
-		UINT32 prevShaderId = (UINT32)-1;
-		UINT32 prevTechniqueIdx = (UINT32)-1;
-		UINT32 prevPassIdx = (UINT32)-1;
+		mPrevShaderId = (UINT32)-1;
+		mPrevTechniqueIdx = (UINT32)-1;
+		mPrevPassIdx = (UINT32)-1;
 		for (UINT32 i = 0; i < (UINT32)mSortableElementIdx.size(); i++)
 		{
 			const UINT32 idx = mSortableElementIdx[i];
@@ -103,48 +126,259 @@ namespace bs { namespace ct
 			const bool separablePasses = renderElem->material->getShader()->getAllowSeparablePasses();
 
 			if (separablePasses)
+				addSortedElement(renderElem, elem.subMesh, elem.shaderId, elem.techniqueIdx, elem.passIdx);
+			else
 			{
-				mSortedRenderElements.push_back(RenderQueueElement());
+				const UINT32 numPasses = renderElem->material->getNumPasses(elem.techniqueIdx);
+				for (UINT32 j = 0; j < numPasses; j++)
+					addSortedElement(renderElem, elem.subMesh, elem.shaderId, elem.techniqueIdx, j);
+			}
+		}
 
-				RenderQueueElement& sortedElem = mSortedRenderElements.back();
-				sortedElem.renderElem = renderElem;
-				sortedElem.techniqueIdx = elem.techniqueIdx;
-				sortedElem.passIdx = elem.passIdx;
+		if (mInstancingEnabled)
+			resolveInstanceGroups();
+	}
 
-				if (prevShaderId != elem.shaderId || prevTechniqueIdx != elem.techniqueIdx ||  prevPassIdx != elem.passIdx)
-				{
-					sortedElem.applyPass = true;
-					prevShaderId = elem.shaderId;
-					prevTechniqueIdx = elem.techniqueIdx;
-					prevPassIdx = elem.passIdx;
-				}
-				else
-					sortedElem.applyPass = false;
+	bool RenderQueue::generateSortKeys()
+	{
+		static constexpr UINT32 PRIORITY_BITS = 8;
+		static constexpr UINT32 STATE_BITS = 24;
+
+		const auto numElements = (UINT32)mSortableElements.size();
+		const bool sortByState = mStateReductionMode != StateReduction::None;
+
+		// Elements are compared by rank of their priority and render state (shader, technique and pass), which yields
+		// the same order as comparing the values directly, while requiring fewer bits
+		mPriorityRanks.clear();
+		mStateRanks.clear();
+		for (auto& entry : mSortableElements)
+		{
+			mPriorityRanks.push_back(entry.priority);
+
+			if (sortByState)
+			{
+				if (entry.techniqueIdx > 0xFFFF || entry.passIdx > 0xFFFF)
+					return false;
+
+				mStateRanks.push_back(((UINT64)entry.shaderId << 32) | (entry.techniqueIdx << 16) | entry.passIdx);
 			}
-			else
+		}
+
+		// Higher priority elements are rendered first
+		std::sort(mPriorityRanks.begin(), mPriorityRanks.end(), std::greater<INT32>());
+		mPriorityRanks.erase(std::unique(mPriorityRanks.begin(), mPriorityRanks.end()), mPriorityRanks.end());
+
+		std::sort(mStateRanks.begin(), mStateRanks.end());
+		mStateRanks.erase(std::unique(mStateRanks.begin(), mStateRanks.end()), mStateRanks.end());
+
+		if (mPriorityRanks.size() > (1ULL << PRIORITY_BITS) || mStateRanks.size() > (1ULL << STATE_BITS))
+			return false;
+
+		mSortKeys.resize(numElements);
+		for (UINT32 i = 0; i < numElements; i++)
+		{
+			const SortableElement& elem = mSortableElements[i];
+
+			const auto priorityRank = (UINT64)(std::lower_bound(mPriorityRanks.begin(), mPriorityRanks.end(), 
+				elem.priority, std::greater<INT32>()) - mPriorityRanks.begin());
+
+			UINT64 stateRank = 0;
+			if (sortByState)
 			{
-				const UINT32 numPasses = renderElem->material->getNumPasses(elem.techniqueIdx);
-				for (UINT32 j = 0; j < numPasses; j++)
+				const UINT64 state = ((UINT64)elem.shaderId << 32) | (elem.techniqueIdx << 16) | elem.passIdx;
+				stateRank = (UINT64)(std::lower_bound(mStateRanks.begin(), mStateRanks.end(), state) - 
+					mStateRanks.begin());
+			}
+
+			// Flip the float bits so unsigned integer order matches the floating point order. Negative zero is 
+			// treated the same as positive zero, same as in a float comparison.
+			const float distance = elem.distFromCamera == 0.0f ? 0.0f : elem.distFromCamera;
+
+			UINT32 distanceBits;
+			memcpy(&distanceBits, &distance, sizeof(distanceBits));
+			distanceBits ^= (distanceBits & 0x80000000) ? 0xFFFFFFFF : 0x80000000;
+
+			const UINT64 priorityKey = priorityRank << (64 - PRIORITY_BITS);
+			switch (mStateReductionMode)
+			{
+			default:
+			case StateReduction::None:
+				mSortKeys[i] = priorityKey | ((UINT64)distanceBits << STATE_BITS);
+				break;
+			case StateReduction::Material:
+				mSortKeys[i] = priorityKey | (stateRank << 32) | distanceBits;
+				break;
+			case StateReduction::Distance:
+				mSortKeys[i] = priorityKey | ((UINT64)distanceBits << STATE_BITS) | stateRank;
+				break;
+			}
+		}
+
+		// Element indices are used as values, and they start out in sequential order. Since the sort is stable this
+		// takes care of the final sequential index tie-breaker used by the sorter callbacks.
+		for (UINT32 i = 0; i < numElements; i++)
+			mSortableElementIdx[i] = i;
+
+		return true;
+	}
+
+	void RenderQueue::radixSort(UINT64* keys, UINT32* values, UINT64* tmpKeys, UINT32* tmpValues, UINT32 count)
+	{
+		static constexpr UINT32 NUM_DIGITS = sizeof(UINT64);
+		static constexpr UINT32 NUM_BUCKETS = 256;
+
+		if (count < 2)
+			return;
+
+		// Build histograms for all digits in a single pass
+		UINT32 histograms[NUM_DIGITS][NUM_BUCKETS];
+		memset(histograms, 0, sizeof(histograms));
+
+		for (UINT32 i = 0; i < count; i++)
+		{
+			const UINT64 key = keys[i];
+			for (UINT32 j = 0; j < NUM_DIGITS; j++)
+				histograms[j][(key >> (j * 8)) & 0xFF]++;
+		}
+
+		UINT64* srcKeys = keys;
+		UINT32* srcValues = values;
+		UINT64* dstKeys = tmpKeys;
+		UINT32* dstValues = tmpValues;
+
+		for (UINT32 i = 0; i < NUM_DIGITS; i++)
+		{
+			UINT32* histogram = histograms[i];
+			const UINT32 shift = i * 8;
+
+			// All keys share the same digit, nothing to sort (common for high bits of small queues)
+			if (histogram[(srcKeys[0] >> shift) & 0xFF] == count)
+				continue;
+
+			UINT32 offset = 0;
+			for (UINT32 j = 0; j < NUM_BUCKETS; j++)
+			{
+				const UINT32 bucketSize = histogram[j];
+				histogram[j] = offset;
+				offset += bucketSize;
+			}
+
+			for (UINT32 j = 0; j < count; j++)
+			{
+				const UINT32 dstIdx = histogram[(srcKeys[j] >> shift) & 0xFF]++;
+				dstKeys[dstIdx] = srcKeys[j];
+				dstValues[dstIdx] = srcValues[j];
+			}
+
+			std::swap(srcKeys, dstKeys);
+			std::swap(srcValues, dstValues);
+		}
+
+		if (srcKeys != keys)
+		{
+			memcpy(keys, srcKeys, count * sizeof(UINT64));
+			memcpy(values, srcValues, count * sizeof(UINT32));
+		}
+	}
+
+	void RenderQueue::addSortedElement(const RenderElement* renderElem, const SubMesh& subMesh, UINT32 shaderId, 
+		UINT32 techniqueIdx, UINT32 passIdx)
+	{
+		if (mInstancingEnabled && renderElem->instancingKey != 0)
+		{
+			InstanceGroupKey key;
+			key.mesh = renderElem->mesh.get();
+			key.indexOffset = subMesh.indexOffset;
+			key.indexCount = subMesh.indexCount;
+			key.material = renderElem->material.get();
+			key.techniqueIdx = techniqueIdx;
+			key.passIdx = passIdx;
+			key.instancingKey = renderElem->instancingKey;
+
+			auto iterFind = mInstanceGroupLookup.find(key);
+			if (iterFind != mInstanceGroupLookup.end())
+			{
+				RenderQueueElement& group = mSortedRenderElements[iterFind->second];
+				if (group.numInstances < MAX_INSTANCES_PER_DRAW)
 				{
-					mSortedRenderElements.push_back(RenderQueueElement());
-
-					RenderQueueElement& sortedElem = mSortedRenderElements.back();
-					sortedElem.renderElem = renderElem;
-					sortedElem.techniqueIdx = elem.techniqueIdx;
-					sortedElem.passIdx = j;
-
-					if (prevShaderId != elem.shaderId || prevTechniqueIdx != elem.techniqueIdx || prevPassIdx != j)
-					{
-						sortedElem.applyPass = true;
-						prevShaderId = elem.shaderId;
-						prevTechniqueIdx = elem.techniqueIdx;
-						prevPassIdx = j;
-					}
-					else
-						sortedElem.applyPass = false;
+					group.numInstances++;
+					mInstanceGroupMembers.push_back(std::make_pair(iterFind->second, renderElem));
+
+					return;
 				}
 			}
+
+			// Start a new group, or replace a full one
+			mInstanceGroupLookup[key] = (UINT32)mSortedRenderElements.size();
+		}
+
+		mSortedRenderElements.push_back(RenderQueueElement());
+
+		RenderQueueElement& sortedElem = mSortedRenderElements.back();
+		sortedElem.renderElem = renderElem;
+		sortedElem.subMesh = subMesh;
+		sortedElem.techniqueIdx = techniqueIdx;
+		sortedElem.passIdx = passIdx;
+
+		if (mPrevShaderId != shaderId || mPrevTechniqueIdx != techniqueIdx || mPrevPassIdx != passIdx)
+		{
+			sortedElem.applyPass = true;
+			mPrevShaderId = shaderId;
+			mPrevTechniqueIdx = techniqueIdx;
+			mPrevPassIdx = passIdx;
+		}
+		else
+			sortedElem.applyPass = false;
+	}
+
+	void RenderQueue::resolveInstanceGroups()
+	{
+		UINT32 numInstancedElements = 0;
+		for (auto& entry : mSortedRenderElements)
+		{
+			if (entry.numInstances < 2)
+				continue;
+
+			entry.firstInstance = numInstancedElements;
+			numInstancedElements += entry.numInstances;
 		}
+
+		mInstancedElements.resize(numInstancedElements);
+
+		// Group leaders are the elements that were added to the sorted list, followed by the members in sorted order. 
+		// Instance count is used as a write cursor, and ends up at its original value once all members are written.
+		for (auto& entry : mSortedRenderElements)
+		{
+			if (entry.numInstances < 2)
+				continue;
+
+			mInstancedElements[entry.firstInstance] = entry.renderElem;
+			entry.numInstances = 1;
+		}
+
+		for (auto& member : mInstanceGroupMembers)
+		{
+			RenderQueueElement& group = mSortedRenderElements[member.first];
+			mInstancedElements[group.firstInstance + group.numInstances] = member.second;
+			group.numInstances++;
+		}
+
+		mInstanceGroupMembers.clear();
+		mInstanceGroupLookup.clear();
+	}
+
+	size_t RenderQueue::InstanceGroupKeyHash::operator()(const InstanceGroupKey& key) const
+	{
+		size_t hash = 0;
+		bs_hash_combine(hash, key.mesh);
+		bs_hash_combine(hash, key.indexOffset);
+		bs_hash_combine(hash, key.indexCount);
+		bs_hash_combine(hash, key.material);
+		bs_hash_combine(hash, key.techniqueIdx);
+		bs_hash_combine(hash, key.passIdx);
+		bs_hash_combine(hash, key.instancingKey);
+
+		return hash;
 	}
 
 	bool RenderQueue::elementSorterNoGroup(UINT32 aIdx, UINT32 bIdx, const Vector<SortableElement>& lookup)
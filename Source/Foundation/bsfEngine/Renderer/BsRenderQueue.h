@@ -26,9 +26,25 @@ namespace bs { namespace ct
 	struct RenderQueueElement
 	{
 		const RenderElement* renderElem = nullptr;
+
+		/** 
+		 * Portion of the element's mesh to render. Same as RenderElement::subMesh unless a different one was provided 
+		 * when queuing the element (e.g. for a different level of detail).
+		 */
+		SubMesh subMesh;
+
 		UINT32 passIdx = 0;
 		UINT32 techniqueIdx = 0;
 		bool applyPass = true;
+
+		/** 
+		 * Number of elements to render using a single instanced draw call. If larger than one, the elements can be
+		 * retrieved through RenderQueue::getInstancedElements(), starting at @p firstInstance. 
+		 */
+		UINT32 numInstances = 1;
+
+		/** Index of the first element in the instanced element list. Only relevant if @p numInstances is larger than one. */
+		UINT32 firstInstance = 0;
 	};
 
 	/**
@@ -47,6 +63,32 @@ namespace bs { namespace ct
 			UINT32 shaderId;
 			UINT32 techniqueIdx;
 			UINT32 passIdx;
+			SubMesh subMesh;
+		};
+
+		/** Identifies a group of elements that can be rendered using a single instanced draw call. */
+		struct InstanceGroupKey
+		{
+			bool operator==(const InstanceGroupKey& rhs) const
+			{
+				return mesh == rhs.mesh && indexOffset == rhs.indexOffset && indexCount == rhs.indexCount &&
+					material == rhs.material && techniqueIdx == rhs.techniqueIdx && passIdx == rhs.passIdx &&
+					instancingKey == rhs.instancingKey;
+			}
+
+			const Mesh* mesh;
+			UINT32 indexOffset;
+			UINT32 indexCount;
+			const Material* material;
+			UINT32 techniqueIdx;
+			UINT32 passIdx;
+			UINT32 instancingKey;
+		};
+
+		/** Hash value generator for InstanceGroupKey. */
+		struct InstanceGroupKeyHash
+		{
+			size_t operator()(const InstanceGroupKey& key) const;
 		};
 
 	public:
@@ -63,6 +105,18 @@ namespace bs { namespace ct
 		 */
 		void add(const RenderElement* element, float distFromCamera, UINT32 techniqueIdx);
 
+		/**
+		 * Adds a new entry to the render queue, rendering a specific portion of the element's mesh.
+		 *
+		 * @param[in]	element			Renderable element to add to the queue.
+		 * @param[in]	distFromCamera	Distance of this object from the camera. Used for distance sorting.
+		 * @param[in]	techniqueIdx	Index of the technique within @p element's material that's to be used to render the 
+		 *								element with.
+		 * @param[in]	subMesh			Portion of the element's mesh to render, instead of RenderElement::subMesh. Usually
+		 *								a sub-mesh representing a different level of detail.
+		 */
+		void add(const RenderElement* element, float distFromCamera, UINT32 techniqueIdx, const SubMesh& subMesh);
+
 		/**	Clears all render operations from the queue. */
 		void clear();
 		
@@ -72,13 +126,61 @@ namespace bs { namespace ct
 		/** Returns a list of sorted render elements. Caller must ensure sort() is called before this method. */
 		const Vector<RenderQueueElement>& getSortedElements() const;
 
+		/** 
+		 * Returns a list of elements referenced by sorted elements that are to be rendered using instancing. See
+		 * RenderQueueElement::numInstances.
+		 */
+		const Vector<const RenderElement*>& getInstancedElements() const { return mInstancedElements; }
+
 		/**
 		 * Controls if and how a render queue groups renderable objects by material in order to reduce number of state 
 		 * changes.
 		 */
 		void setStateReduction(StateReduction mode) { mStateReductionMode = mode; }
 
+		/**
+		 * Determines should elements that support instancing (see RenderElement::instancingKey) be grouped together during
+		 * sorting. Grouped elements are moved to the position of the first element in the group, therefore this should
+		 * only be enabled on queues where the order of elements within the same group doesn't matter (e.g. opaque 
+		 * elements).
+		 */
+		void setInstancing(bool enabled) { mInstancingEnabled = enabled; }
+
+		/** Maximum number of elements that can be grouped into a single instanced draw call. */
+		static constexpr UINT32 MAX_INSTANCES_PER_DRAW = 512;
+
 	protected:
+		/** 
+		 * Generates a 64-bit sort key for each sortable element, according to the current state reduction mode. Keys
+		 * sort in the same order as the element sorter callbacks, with ties resolved by the sort being stable.
+		 * 
+		 * @return	True if the keys were generated, false if the queue contains too many distinct priorities or render
+		 *			states for them to be encoded in a key, in which case the element sorter callbacks should be used.
+		 */
+		bool generateSortKeys();
+
+		/** 
+		 * Sorts the provided keys and the values associated with them using a stable least significant digit radix 
+		 * sort. 
+		 *
+		 * @param[in, out]	keys		Keys to sort.
+		 * @param[in, out]	values		Values to reorder along with the keys.
+		 * @param[in]		tmpKeys		Scratch buffer with room for @p count keys.
+		 * @param[in]		tmpValues	Scratch buffer with room for @p count values.
+		 * @param[in]		count		Number of entries in the buffers.
+		 */
+		static void radixSort(UINT64* keys, UINT32* values, UINT64* tmpKeys, UINT32* tmpValues, UINT32 count);
+
+		/** 
+		 * Appends a new element to the sorted element list, or adds it to an existing instance group if instancing is
+		 * enabled and the element is compatible.
+		 */
+		void addSortedElement(const RenderElement* renderElem, const SubMesh& subMesh, UINT32 shaderId, 
+			UINT32 techniqueIdx, UINT32 passIdx);
+
+		/** Populates the instanced element list from the instance groups generated during addSortedElement(). */
+		void resolveInstanceGroups();
+
 		/**	Callback used for sorting elements with no material grouping. */
 		static bool elementSorterNoGroup(UINT32 aIdx, UINT32 bIdx, const Vector<SortableElement>& lookup);
 
@@ -92,8 +194,23 @@ namespace bs { namespace ct
 		Vector<UINT32> mSortableElementIdx;
 		Vector<const RenderElement*> mElements;
 
+		Vector<UINT64> mSortKeys;
+		Vector<UINT64> mSortKeysTemp;
+		Vector<UINT32> mSortableElementIdxTemp;
+		Vector<INT32> mPriorityRanks;
+		Vector<UINT64> mStateRanks;
+
 		Vector<RenderQueueElement> mSortedRenderElements;
 		StateReduction mStateReductionMode;
+
+		bool mInstancingEnabled = false;
+		Vector<const RenderElement*> mInstancedElements;
+		Vector<std::pair<UINT32, const RenderElement*>> mInstanceGroupMembers;
+		UnorderedMap<InstanceGroupKey, UINT32, InstanceGroupKeyHash> mInstanceGroupLookup;
+
+		UINT32 mPrevShaderId = (UINT32)-1;
+		UINT32 mPrevTechniqueIdx = (UINT32)-1;
+		UINT32 mPrevPassIdx = (UINT32)-1;
 	};
 
 	/** @} */
@@ -45,9 +45,9 @@ namespace bs { namespace ct
 		 * @param	msaaCount		Number of MSAA samples in the input texture. If larger than 1 the texture will be resolved
 		 *							before written to the destination.
 		 * @param	isColor			If true the input is assumed to be a 4-component color texture. If false it is assumed
-		 *							the input is a 1-component depth texture. This controls how is the texture resolve and is
-		 *							only relevant if @p msaaCount > 1. Color texture MSAA samples will be averaged, while for
-		 *							depth textures the minimum of all samples will be used.
+		 *							the input is a 1-component depth texture, which is written to the depth buffer of the
+		 *							bound render target. When @p msaaCount > 1 color texture MSAA samples will be averaged,
+		 *							while for depth textures the minimum of all samples will be used.
 		 */
 		static BlitMat* getVariation(UINT32 msaaCount, bool isColor);
 	private:
@@ -160,9 +160,10 @@ namespace bs { namespace ct
 		 * @param[in]	area	Area of the source texture to blit in pixels. If width or height is zero it is assumed
 		 *						the entire texture should be blitted.
 		 * @param[in]	flipUV	If true, vertical UV coordinate will be flipped upside down.
-		 * @param[in]	isDepth	If true, the input texture is assumed to be a depth texture (instead of a color one).
-		 *						Multisampled depth textures will be resolved by taking the minimum value of all samples,
-		 *						unlike color textures which wil be averaged.
+		 * @param[in]	isDepth	If true, the input texture is assumed to be a depth texture (instead of a color one), and
+		 *						is written to the depth buffer of the render target. Multisampled depth textures will be
+		 *						resolved by taking the minimum value of all samples, unlike color textures which wil be
+		 *						averaged.
 		 */
 		void blit(const SPtr<Texture>& texture, const Rect2I& area = Rect2I::EMPTY, bool flipUV = false, 
 			bool isDepth = false);
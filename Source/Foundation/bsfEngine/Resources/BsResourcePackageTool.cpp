@@ -0,0 +1,106 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "BsApplication.h"
+#include "BsEngineConfig.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsPath.h"
+#include "Resources/BsResourceManifest.h"
+#include "Resources/BsResourcePackage.h"
+#include "Debug/BsDebug.h"
+#include <iostream>
+
+/** Prints the command line usage of the tool. */
+static void printUsage()
+{
+	std::cout << "Packs all resources referenced by a resource manifest into a single resource package." << std::endl
+		<< std::endl
+		<< "Usage: bsfPackageTool <manifest path> <output package path> [--compress]" << std::endl
+		<< std::endl
+		<< "  <manifest path>         Resource manifest listing the resources to pack." << std::endl
+		<< "  <output package path>   Path of the package file to create. Existing file is overwritten." << std::endl
+		<< "  --compress              Compress uncompressed resources if it meaningfully reduces their size." << std::endl
+		<< "  --help                  Prints this message." << std::endl;
+}
+
+/**
+ * Packs all resources referenced by a resource manifest into a single resource package.
+ *
+ * Usage: bsfPackageTool <manifest path> <output package path> [--compress]
+ *
+ * Returns 0 on success, 1 if the package couldn't be written and 2 on invalid input.
+ */
+int main(int argc, char * argv[]) 
+{
+	using namespace bs;
+
+	bool compress = false;
+	Vector<const char*> positionalArgs;
+	for(int i = 1; i < argc; i++)
+	{
+		if(strcmp(argv[i], "--help") == 0 || strcmp(argv[i], "-h") == 0)
+		{
+			printUsage();
+			return 0;
+		}
+
+		if(strcmp(argv[i], "--compress") == 0)
+			compress = true;
+		else if(strncmp(argv[i], "--", 2) == 0)
+		{
+			std::cout << "Unknown argument: " << argv[i] << std::endl << std::endl;
+			printUsage();
+			return 2;
+		}
+		else
+			positionalArgs.push_back(argv[i]);
+	}
+
+	if(positionalArgs.size() != 2)
+	{
+		printUsage();
+		return 2;
+	}
+
+	START_UP_DESC desc;
+	desc.renderAPI = BS_RENDER_API_MODULE;
+	desc.renderer = BS_RENDERER_MODULE;
+	desc.audio = BS_AUDIO_MODULE;
+	desc.physics = BS_PHYSICS_MODULE;
+
+	desc.primaryWindowDesc.videoMode = VideoMode (64, 64);
+	desc.primaryWindowDesc.fullscreen = false;
+	desc.primaryWindowDesc.title = "bsf packager";
+	desc.primaryWindowDesc.hidden = true;
+
+	Application::startUp(desc);
+
+	Path manifestPath = positionalArgs[0];
+	Path outputPath = positionalArgs[1];
+
+	if (!FileSystem::isFile(manifestPath))
+	{
+		LOGERR("Resource manifest not found at: " + manifestPath.toString());
+
+		Application::shutDown();
+		return 2;
+	}
+
+	// Manifests store their paths relative to the folder they were saved in
+	SPtr<ResourceManifest> manifest = ResourceManifest::load(manifestPath, manifestPath.getDirectory());
+
+	Vector<std::pair<UUID, Path>> resources;
+	for(auto& entry : manifest->getEntries())
+		resources.push_back(entry);
+
+	// Keep the package layout deterministic
+	std::sort(resources.begin(), resources.end(), 
+		[](const std::pair<UUID, Path>& a, const std::pair<UUID, Path>& b)
+	{
+		return a.second.toString() < b.second.toString();
+	});
+
+	const bool success = ResourcePackage::create(outputPath, resources, compress);
+
+	Application::shutDown();
+	return success ? 0 : 1;
+}
@@ -57,6 +57,8 @@ set(BS_UTILITY_INC_DEBUG
 	"bsfUtility/Debug/BsBitmapWriter.h"
 	"bsfUtility/Debug/BsDebug.h"
 	"bsfUtility/Debug/BsLog.h"
+	"bsfUtility/Debug/BsLogSinks.h"
+	"bsfUtility/Debug/BsTraceCapture.h"
 )
 
 set(BS_UTILITY_INC_FILESYSTEM
@@ -123,6 +125,8 @@ set(BS_UTILITY_SRC_REFLECTION
 set(BS_UTILITY_SRC_DEBUG
 	"bsfUtility/Debug/BsBitmapWriter.cpp"
 	"bsfUtility/Debug/BsLog.cpp"
+	"bsfUtility/Debug/BsLogSinks.cpp"
+	"bsfUtility/Debug/BsTraceCapture.cpp"
 	"bsfUtility/Debug/BsDebug.cpp"
 )
 
@@ -174,22 +178,39 @@ set(BS_UTILITY_SRC_MATH
 	"bsfUtility/Math/BsTorus.cpp"
 	"bsfUtility/Math/BsRect3.cpp"
 	"bsfUtility/Math/BsRect2.cpp"
+	"bsfUtility/Math/BsBatchMath.cpp"
+	"bsfUtility/Math/BsBatchMathAVX.cpp"
 	"bsfUtility/Math/BsRect2I.cpp"
 	"bsfUtility/Math/BsLineSegment3.cpp"
 	"bsfUtility/Math/BsCapsule.cpp"
 	"bsfUtility/Math/BsLine2.cpp"
 )
 
+# Compiled with AVX enabled, but only called if the CPU supports it
+if(MSVC)
+	set(BS_UTILITY_AVX_FLAGS "/arch:AVX")
+else()
+	set(BS_UTILITY_AVX_FLAGS "-mavx")
+endif()
+
+set_source_files_properties ("bsfUtility/Math/BsBatchMathAVX.cpp" PROPERTIES
+		COMPILE_FLAGS ${BS_UTILITY_AVX_FLAGS}
+		COTIRE_EXCLUDED "True")
+
 set(BS_UTILITY_INC_TESTING
 	"bsfUtility/Testing/BsTestSuite.h"
 	"bsfUtility/Testing/BsTestOutput.h"
 	"bsfUtility/Testing/BsConsoleTestOutput.h"
+	"bsfUtility/Testing/BsBenchmark.h"
+	"bsfUtility/Testing/BsBenchmarkOutput.h"
 )
 
 set(BS_UTILITY_SRC_TESTING
 	"bsfUtility/Testing/BsTestSuite.cpp"
 	"bsfUtility/Testing/BsTestOutput.cpp"
 	"bsfUtility/Testing/BsConsoleTestOutput.cpp"
+	"bsfUtility/Testing/BsBenchmark.cpp"
+	"bsfUtility/Testing/BsBenchmarkOutput.cpp"
 )
 
 set(BS_UTILITY_SRC_SERIALIZATION
@@ -229,6 +250,8 @@ set(BS_UTILITY_INC_MATH
 	"bsfUtility/Math/BsMatrixNxM.h"
 	"bsfUtility/Math/BsLine2.h"
 	"bsfUtility/Math/BsSIMD.h"
+	"bsfUtility/Math/BsBatchMath.h"
+	"bsfUtility/Math/BsBatchMathKernels.h"
 	"bsfUtility/Math/BsRandom.h"
 	"bsfUtility/Math/BsComplex.h"
 )
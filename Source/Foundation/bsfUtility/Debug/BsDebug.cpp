@@ -2,63 +2,38 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "Debug/BsDebug.h"
 #include "Debug/BsLog.h"
+#include "Debug/BsLogSinks.h"
 #include "Error/BsException.h"
 #include "Debug/BsBitmapWriter.h"
 #include "FileSystem/BsFileSystem.h"
 #include "FileSystem/BsDataStream.h"
 #include "Utility/BsTime.h"
 
-#if BS_PLATFORM == BS_PLATFORM_WIN32 && BS_COMPILER == BS_COMPILER_MSVC
-#include <windows.h>
-#include <iostream>
-
-void logToIDEConsole(const bs::String& message, const char* channel)
-{
-	OutputDebugString("[");
-	OutputDebugString(channel);
-	OutputDebugString("] ");
-	OutputDebugString(message.c_str());
-	OutputDebugString("\n");
-
-	// Also default output in case we're running without debugger attached
-	std::cout << "[" << channel << "] " << message << std::endl;
-}
-#else
-void logToIDEConsole(const bs::String& message, const char* channel)
-{
-	std::cout << "[" << channel << "] " << message << std::endl;
-}
-#endif
-
 namespace bs
 {
+	Debug::Debug()
+	{
+		mLog.addSink(bs_shared_ptr_new<ConsoleLogSink>());
+	}
+
 	void Debug::logDebug(const String& msg)
 	{
 		mLog.logMsg(msg, (UINT32)DebugChannel::Debug);
-		logToIDEConsole(msg, "DEBUG");
 	}
 
 	void Debug::logWarning(const String& msg)
 	{
 		mLog.logMsg(msg, (UINT32)DebugChannel::Warning);
-		logToIDEConsole(msg, "WARNING");
 	}
 
 	void Debug::logError(const String& msg)
 	{
 		mLog.logMsg(msg, (UINT32)DebugChannel::Error);
-		logToIDEConsole(msg, "ERROR");
 	}
 
 	void Debug::log(const String& msg, UINT32 channel)
 	{
 		mLog.logMsg(msg, channel);
-		if (channel == (UINT32)DebugChannel::Debug)
-			logToIDEConsole(msg, "DEBUG");
-		if (channel == (UINT32)DebugChannel::Warning || channel == (UINT32)DebugChannel::CompilerWarning)
-			logToIDEConsole(msg, "WARNING");
-		if (channel == (UINT32)DebugChannel::Error || channel == (UINT32)DebugChannel::CompilerError)
-			logToIDEConsole(msg, "ERROR");
 	}
 
 	void Debug::writeAsBMP(UINT8* rawPixels, UINT32 bytesPerPixel, UINT32 width, UINT32 height, const Path& filePath, 
@@ -27,7 +27,8 @@ namespace bs
 	class BS_UTILITY_EXPORT Debug
 	{
 	public:
-		Debug() = default;
+		/** Creates the debug module, with a ConsoleLogSink registered with its log. */
+		Debug();
 
 		/** Adds a log entry in the "Debug" channel. */
 		void logDebug(const String& msg);
@@ -49,7 +50,8 @@ namespace bs
 			bool overwrite = true) const;
 
 		/**
-		 * Saves a log about the current state of the application to the specified location.
+		 * Saves a log about the current state of the application to the specified location. If the log is running
+		 * asynchronously, call Log::flush() beforehand to make sure the most recent entries are included.
 		 * 
 		 * @param	path	Absolute path to the log filename.
 		 */
@@ -90,23 +92,57 @@ namespace bs
 	/** A simpler way of accessing the Debug module. */
 	BS_UTILITY_EXPORT Debug& gDebug();
 
+/** @name Log levels
+ *  Values for BS_LOG_LEVEL.
+ *  @{
+ */
+#define BS_LOG_LEVEL_DEBUG 0
+#define BS_LOG_LEVEL_WARNING 1
+#define BS_LOG_LEVEL_ERROR 2
+#define BS_LOG_LEVEL_NONE 3
+/** @} */
+
+/**
+ * Lowest level of messages that get logged by the LOG* macros. Macros for lower levels compile to nothing and their
+ * arguments are not evaluated. Define it before this header is included (e.g. through the build system) to override.
+ * Like the enabled macros, the disabled ones include the trailing semicolon, as some call sites omit it.
+ */
+#ifndef BS_LOG_LEVEL
+#define BS_LOG_LEVEL BS_LOG_LEVEL_DEBUG
+#endif
+
+#if BS_LOG_LEVEL <= BS_LOG_LEVEL_DEBUG
 /** Shortcut for logging a message in the debug channel. */
 #define LOGDBG(x) bs::gDebug().logDebug((x) + String("\n\t\t in ") + __PRETTY_FUNCTION__ + " [" + __FILE__ + ":" + toString(__LINE__) + "]\n");
 
-/** Shortcut for logging a message in the warning channel. */
-#define LOGWRN(x) bs::gDebug().logWarning((x) + String("\n\t\t in ") + __PRETTY_FUNCTION__ + " [" + __FILE__ + ":" + toString(__LINE__) + "]\n");
-
-/** Shortcut for logging a message in the error channel. */
-#define LOGERR(x) bs::gDebug().logError((x) + String("\n\t\t in ") + __PRETTY_FUNCTION__ + " [" + __FILE__ + ":" + toString(__LINE__) + "]\n");
-
 /** Shortcut for logging a message in the debug channel, with support for formatting through StringUtil::format(). */
 #define LOGDBG_FMT(...) bs::gDebug().logDebug(StringUtil::format(__VA_ARGS__) + String("\n\t\t in ") + __PRETTY_FUNCTION__ + " [" + __FILE__ + ":" + toString(__LINE__) + "]\n");
+#else
+#define LOGDBG(x) ((void)0);
+#define LOGDBG_FMT(...) ((void)0);
+#endif
+
+#if BS_LOG_LEVEL <= BS_LOG_LEVEL_WARNING
+/** Shortcut for logging a message in the warning channel. */
+#define LOGWRN(x) bs::gDebug().logWarning((x) + String("\n\t\t in ") + __PRETTY_FUNCTION__ + " [" + __FILE__ + ":" + toString(__LINE__) + "]\n");
 
 /** Shortcut for logging a message in the warning channel, with support for formatting through StringUtil::format(). */
 #define LOGWRN_FMT(...) bs::gDebug().logWarning(StringUtil::format(__VA_ARGS__) + String("\n\t\t in ") + __PRETTY_FUNCTION__ + " [" + __FILE__ + ":" + toString(__LINE__) + "]\n");
+#else
+#define LOGWRN(x) ((void)0);
+#define LOGWRN_FMT(...) ((void)0);
+#endif
+
+#if BS_LOG_LEVEL <= BS_LOG_LEVEL_ERROR
+/** Shortcut for logging a message in the error channel. */
+#define LOGERR(x) bs::gDebug().logError((x) + String("\n\t\t in ") + __PRETTY_FUNCTION__ + " [" + __FILE__ + ":" + toString(__LINE__) + "]\n");
 
 /** Shortcut for logging a message in the error channel, with support for formatting through StringUtil::format(). */
 #define LOGERR_FMT(...) bs::gDebug().logError(StringUtil::format(__VA_ARGS__) + String("\n\t\t in ") + __PRETTY_FUNCTION__ + " [" + __FILE__ + ":" + toString(__LINE__) + "]\n");
+#else
+#define LOGERR(x) ((void)0);
+#define LOGERR_FMT(...) ((void)0);
+#endif
 
 /** Shortcut for logging a verbose message in the debug channel. Verbose messages can be ignored unlike other log messages. */
 #define LOGDBG_VERBOSE(x) ((void)0)
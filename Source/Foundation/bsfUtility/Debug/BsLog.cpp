@@ -5,16 +5,90 @@
 
 namespace bs
 {
+	/** Maximum time the background thread waits before processing queued entries, in milliseconds. */
+	static constexpr UINT32 FLUSH_INTERVAL_MS = 10;
+
+	/** Source of unique identifiers for Log instances, so thread local caches can tell them apart. */
+	static std::atomic<UINT64> sNextLogId { 1 };
+
+	/** Identifier of the log whose ring buffer is cached in sThreadRingBuffer. */
+	static BS_THREADLOCAL UINT64 sThreadLogId = 0;
+
+	/** Ring buffer owned by the current thread, for the log identified by sThreadLogId. */
+	static BS_THREADLOCAL void* sThreadRingBuffer = nullptr;
+
+	/**
+	 * Single producer, single consumer ring buffer of log entries. The owning thread is the only producer and the log's
+	 * background thread is the only consumer.
+	 */
+	struct Log::ThreadRingBuffer
+	{
+		ThreadId threadId;
+		QueuedEntry entries[RING_BUFFER_SIZE];
+
+		// Written by the producer. Padded so the producer and consumer don't share a cache line.
+		std::atomic<UINT32> head { 0 };
+		UINT8 padding[64 - sizeof(std::atomic<UINT32>)];
+
+		// Written by the consumer
+		std::atomic<UINT32> tail { 0 };
+	};
+
+	Log::Log()
+		:mId(sNextLogId++)
+	{ }
+
 	Log::~Log()
 	{
+		stopAsync();
 		clear();
 	}
 
 	void Log::logMsg(const String& message, UINT32 channel)
 	{
-		RecursiveLock lock(mMutex);
+		LogEntry entry(message, channel);
+
+		// Writers register themselves before checking the async flag, so stopAsync() can wait for in-progress writes
+		// before processing the remaining entries
+		mNumActiveWriters++;
+		if(mAsync)
+		{
+			ThreadRingBuffer* ringBuffer = getThreadRingBuffer();
+			const UINT32 head = ringBuffer->head.load(std::memory_order_relaxed);
+
+			bool full = false;
+			while((head - ringBuffer->tail.load(std::memory_order_acquire)) >= RING_BUFFER_SIZE)
+			{
+				// The background thread can't wait on itself. This only happens if sinks log large amounts of messages.
+				if(BS_THREAD_CURRENT_ID == mFlushThread->get_id())
+				{
+					mNumDropped.fetch_add(1, std::memory_order_relaxed);
+					full = true;
+					break;
+				}
+
+				mFlushSignal.notify_one();
+				std::this_thread::yield();
+			}
+
+			if(!full)
+			{
+				// The sequence number is reserved before the entry is published. Until it is, the background thread holds
+				// back all entries with higher sequence numbers.
+				QueuedEntry& slot = ringBuffer->entries[head % RING_BUFFER_SIZE];
+				slot.sequence = mNextSequence.fetch_add(1, std::memory_order_relaxed);
+				slot.entry = std::move(entry);
+
+				ringBuffer->head.store(head + 1, std::memory_order_release);
+			}
+
+			mNumActiveWriters--;
+			return;
+		}
+		mNumActiveWriters--;
 
-		mUnreadEntries.push(LogEntry(message, channel));
+		RecursiveLock lock(mMutex);
+		processEntry(std::move(entry));
 	}
 
 	void Log::clear()
@@ -33,7 +107,7 @@ namespace bs
 	{
 		RecursiveLock lock(mMutex);
 
-		Vector<LogEntry> newEntries;
+		Deque<LogEntry> newEntries;
 		for(auto& entry : mEntries)
 		{
 			if (entry.getChannel() == channel)
@@ -77,6 +151,8 @@ namespace bs
 
 	bool Log::getLastEntry(LogEntry& entry)
 	{
+		RecursiveLock lock(mMutex);
+
 		if (mEntries.size() == 0)
 			return false;
 
@@ -88,7 +164,7 @@ namespace bs
 	{
 		RecursiveLock lock(mMutex);
 
-		return mEntries;
+		return Vector<LogEntry>(mEntries.begin(), mEntries.end());
 	}
 
 	Vector<LogEntry> Log::getAllEntries() const
@@ -109,4 +185,285 @@ namespace bs
 		}
 		return entries;
 	}
+
+	void Log::addSink(const SPtr<LogSink>& sink)
+	{
+		RecursiveLock lock(mMutex);
+
+		mSinks.push_back(sink);
+	}
+
+	void Log::removeSink(const SPtr<LogSink>& sink)
+	{
+		RecursiveLock lock(mMutex);
+
+		auto iterFind = std::find(mSinks.begin(), mSinks.end(), sink);
+		if(iterFind != mSinks.end())
+			mSinks.erase(iterFind);
+	}
+
+	void Log::setMaxEntries(UINT32 maxEntries)
+	{
+		RecursiveLock lock(mMutex);
+
+		mMaxEntries = maxEntries;
+		enforceMaxEntries();
+	}
+
+	void Log::startAsync()
+	{
+		if(mFlushThread != nullptr)
+			return;
+
+		mStopFlushThread = false;
+		mFlushThread = bs_new<Thread>(std::bind(&Log::flushThreadMain, this));
+
+		mAsync = true;
+	}
+
+	void Log::stopAsync()
+	{
+		if(mFlushThread == nullptr)
+			return;
+
+		// Make sure no thread is in the middle of writing to a ring buffer, so the background thread processes all the
+		// remaining entries before it exits
+		mAsync = false;
+		while(mNumActiveWriters > 0)
+			std::this_thread::yield();
+
+		{
+			Lock lock(mFlushMutex);
+			mStopFlushThread = true;
+		}
+
+		mFlushSignal.notify_one();
+		mFlushThread->join();
+
+		bs_delete(mFlushThread);
+		mFlushThread = nullptr;
+	}
+
+	void Log::flush()
+	{
+		if(!mAsync)
+		{
+			RecursiveLock lock(mMutex);
+			for(auto& sink : mSinks)
+				sink->flush();
+
+			return;
+		}
+
+		// The background thread can't wait on itself
+		if(BS_THREAD_CURRENT_ID == mFlushThread->get_id())
+			return;
+
+		const UINT64 sequence = mNextSequence.load(std::memory_order_acquire);
+
+		Lock lock(mFlushMutex);
+		mFlushSequence = std::max(mFlushSequence, sequence);
+		mFlushRequested = true;
+		mFlushSignal.notify_one();
+
+		mFlushedSignal.wait(lock, [this, sequence]()
+		{
+			return mFlushedSequence >= sequence || mStopFlushThread;
+		});
+	}
+
+	bool Log::drain(UINT32 timeoutMs)
+	{
+		if(!mAsync)
+			return true;
+
+		const UINT64 sequence = mNextSequence.load(std::memory_order_acquire);
+		const bool isFlushThread = BS_THREAD_CURRENT_ID == mFlushThread->get_id();
+		const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+
+		// Polls instead of waiting on mFlushedSignal, as the crashed thread might be holding mFlushMutex
+		while(mProcessedSequence.load(std::memory_order_acquire) < sequence)
+		{
+			if(isFlushThread || std::chrono::steady_clock::now() >= deadline)
+				return false;
+
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+
+		return true;
+	}
+
+	Log::ThreadRingBuffer* Log::getThreadRingBuffer()
+	{
+		if(sThreadLogId == mId)
+			return (ThreadRingBuffer*)sThreadRingBuffer;
+
+		Lock lock(mRingBufferMutex);
+
+		// Thread IDs may be reused once a thread exits, in which case its ring buffer is reused as well
+		ThreadId threadId = BS_THREAD_CURRENT_ID;
+		ThreadRingBuffer* ringBuffer = nullptr;
+		for(auto& entry : mRingBuffers)
+		{
+			if(entry->threadId == threadId)
+			{
+				ringBuffer = entry.get();
+				break;
+			}
+		}
+
+		if(ringBuffer == nullptr)
+		{
+			SPtr<ThreadRingBuffer> newRingBuffer = bs_shared_ptr_new<ThreadRingBuffer>();
+			newRingBuffer->threadId = threadId;
+
+			mRingBuffers.push_back(newRingBuffer);
+			ringBuffer = newRingBuffer.get();
+		}
+
+		sThreadLogId = mId;
+		sThreadRingBuffer = ringBuffer;
+
+		return ringBuffer;
+	}
+
+	void Log::processEntry(LogEntry&& entry)
+	{
+		for(auto& sink : mSinks)
+			sink->write(entry);
+
+		mUnreadEntries.push(std::move(entry));
+		enforceMaxEntries();
+	}
+
+	void Log::processQueuedEntries()
+	{
+		Vector<SPtr<ThreadRingBuffer>> ringBuffers;
+		{
+			Lock lock(mRingBufferMutex);
+			ringBuffers = mRingBuffers;
+		}
+
+		// Ring buffers are always emptied, even if their entries can't be processed yet, so writers never wait on each 
+		// other
+		for(auto& ringBuffer : ringBuffers)
+		{
+			UINT32 tail = ringBuffer->tail.load(std::memory_order_relaxed);
+			const UINT32 head = ringBuffer->head.load(std::memory_order_acquire);
+
+			for(; tail != head; tail++)
+				mPendingEntries.push_back(std::move(ringBuffer->entries[tail % RING_BUFFER_SIZE]));
+
+			ringBuffer->tail.store(tail, std::memory_order_release);
+		}
+
+		if(mPendingEntries.empty())
+			return;
+
+		// Restore the order in which the entries were logged across all threads
+		std::sort(mPendingEntries.begin(), mPendingEntries.end(),
+			[](const QueuedEntry& a, const QueuedEntry& b)
+		{
+			return a.sequence < b.sequence;
+		});
+
+		// A writer might have reserved a sequence number without publishing its entry yet. Entries past such a gap are
+		// kept pending, as the missing entry needs to be processed before them.
+		UINT64 nextSequence = mProcessedSequence.load(std::memory_order_relaxed);
+		UINT32 numReady = 0;
+		while(numReady < (UINT32)mPendingEntries.size() && mPendingEntries[numReady].sequence == nextSequence)
+		{
+			numReady++;
+			nextSequence++;
+		}
+
+		if(numReady == 0)
+			return;
+
+		{
+			RecursiveLock lock(mMutex);
+
+			for(UINT32 i = 0; i < numReady; i++)
+				processEntry(std::move(mPendingEntries[i].entry));
+		}
+
+		mPendingEntries.erase(mPendingEntries.begin(), mPendingEntries.begin() + numReady);
+		mProcessedSequence.store(nextSequence, std::memory_order_release);
+	}
+
+	void Log::enforceMaxEntries()
+	{
+		if(mMaxEntries == 0)
+			return;
+
+		bool modified = false;
+		while((mEntries.size() + mUnreadEntries.size()) > mMaxEntries)
+		{
+			if(!mEntries.empty())
+				mEntries.pop_front();
+			else
+				mUnreadEntries.pop();
+
+			mNumDropped++;
+			modified = true;
+		}
+
+		if(modified)
+			mHash++;
+	}
+
+	void Log::flushThreadMain()
+	{
+		while(true)
+		{
+			bool stop;
+			{
+				Lock lock(mFlushMutex);
+				mFlushSignal.wait_for(lock, std::chrono::milliseconds(FLUSH_INTERVAL_MS),
+					[this]() { return mFlushRequested || mStopFlushThread; });
+
+				stop = mStopFlushThread;
+			}
+
+			processQueuedEntries();
+
+			// Sinks are flushed once all the entries logged before the flush request are processed. If a writer hasn't 
+			// published its entry yet, the request stays active until the next iteration.
+			const UINT64 processedSequence = mProcessedSequence.load(std::memory_order_relaxed);
+			bool flushSinks;
+			bool flushPending;
+			{
+				Lock lock(mFlushMutex);
+				flushSinks = stop || (mFlushRequested && processedSequence >= mFlushSequence);
+
+				if(flushSinks)
+					mFlushRequested = false;
+
+				flushPending = mFlushRequested;
+			}
+
+			if(flushSinks)
+			{
+				RecursiveLock lock(mMutex);
+				for(auto& sink : mSinks)
+					sink->flush();
+			}
+
+			{
+				Lock lock(mFlushMutex);
+
+				if(flushSinks)
+					mFlushedSequence = processedSequence;
+
+				mFlushedSignal.notify_all();
+			}
+
+			if(stop)
+				break;
+
+			// Waiting for a writer to publish its entry, which should happen shortly
+			if(flushPending)
+				std::this_thread::yield();
+		}
+	}
 }
@@ -4,6 +4,7 @@
 
 #include "Prerequisites/BsPrerequisitesUtil.h"
 #include "Utility/BsTime.h"
+#include <atomic>
 
 namespace bs
 {
@@ -35,20 +36,50 @@ namespace bs
 		String mLocalTime;
 	};
 
+	/**
+	 * Receives entries recorded by a Log, in the order they were logged. Used for outputting the log to the console, a file
+	 * or similar.
+	 *
+	 * Sinks are never called concurrently. When the log is running asynchronously they're called from the log's
+	 * background thread, otherwise from the thread that logged the message.
+	 */
+	class BS_UTILITY_EXPORT LogSink
+	{
+	public:
+		virtual ~LogSink() = default;
+
+		/** Outputs a new log entry. */
+		virtual void write(const LogEntry& entry) = 0;
+
+		/** Makes sure all entries passed to write() so far are fully output (e.g. written to disk). */
+		virtual void flush() { }
+	};
+
 	/**
 	 * Used for logging messages. Can categorize messages according to channels, save the log to a file
 	 * and send out callbacks when a new message is added.
-	 * 			
+	 *
+	 * By default messages are processed on the thread that logs them, under a lock. After startAsync() is called each
+	 * thread instead writes its messages into its own lock-free ring buffer, and a background thread moves them into the
+	 * log and forwards them to the registered sinks. Every message gets a sequence number when logged, and the background
+	 * thread processes messages from all threads strictly in that order.
+	 *
 	 * @note	Thread safe.
 	 */
 	class BS_UTILITY_EXPORT Log
 	{
 	public:
-		Log() = default;
+		/** Number of entries each thread can have queued before it has to wait for the background thread. */
+		static constexpr UINT32 RING_BUFFER_SIZE = 1024;
+
+		/** Default value for setMaxEntries(). */
+		static constexpr UINT32 DEFAULT_MAX_ENTRIES = 16384;
+
+		Log();
 		~Log();
 
 		/**
-		 * Logs a new message. 
+		 * Logs a new message.
 		 *
 		 * @param[in]	message	The message describing the log entry.
 		 * @param[in]	channel Channel in which to store the log entry.
@@ -66,8 +97,8 @@ namespace bs
 
 		/**
 		 * Returns the latest unread entry from the log queue, and removes the entry from the unread entries list.
-		 * 			
-		 * @param[out]	entry	Entry that was retrieved, or undefined if no entries exist.		
+		 *
+		 * @param[out]	entry	Entry that was retrieved, or undefined if no entries exist.
 		 * @return				True if an unread entry was retrieved, false otherwise.
 		 */
 		bool getUnreadEntry(LogEntry& entry);
@@ -86,16 +117,118 @@ namespace bs
 		 */
 		UINT64 getHash() const { return mHash; }
 
+		/** Registers a sink that will receive all entries logged from this point on. */
+		void addSink(const SPtr<LogSink>& sink);
+
+		/** Unregisters a sink previously registered with addSink(). */
+		void removeSink(const SPtr<LogSink>& sink);
+
+		/**
+		 * Sets the maximum number of entries kept in the log (both read and unread). When exceeded the oldest entries
+		 * are removed. Sinks receive all entries regardless of this limit. Zero means no limit.
+		 */
+		void setMaxEntries(UINT32 maxEntries);
+
+		/** @copydoc setMaxEntries */
+		UINT32 getMaxEntries() const { return mMaxEntries; }
+
+		/**
+		 * Returns the number of entries lost since creation. Entries are lost when removed because the entry limit was
+		 * exceeded, or when logged by a sink while the background thread's own ring buffer is full.
+		 */
+		UINT64 getNumDroppedEntries() const { return mNumDropped.load(std::memory_order_relaxed); }
+
+		/**
+		 * Starts a background thread that processes logged messages. From this point on logMsg() doesn't lock, and
+		 * entries become visible in the log and sinks with a small delay.
+		 */
+		void startAsync();
+
+		/**
+		 * Processes all pending entries and stops the background thread started by startAsync(). Messages are then
+		 * processed on the thread that logs them again.
+		 */
+		void stopAsync();
+
+		/** Returns true if the background thread started by startAsync() is running. */
+		bool isAsync() const { return mAsync.load(std::memory_order_acquire); }
+
+		/**
+		 * Blocks until all entries logged before the call, by any thread, are processed, and flushes all sinks. Entries
+		 * being logged concurrently by other threads might not be included.
+		 */
+		void flush();
+
+		/**
+		 * Waits until the background thread processes all entries logged before the call, or until @p timeoutMs
+		 * milliseconds pass. Doesn't take any locks and doesn't flush the sinks, so it can be used from a crash handler
+		 * even if the crashed thread holds the log's locks or is the background thread itself.
+		 *
+		 * @return	True if all entries were processed, false if the timeout expired first.
+		 */
+		bool drain(UINT32 timeoutMs);
+
 	private:
 		friend class Debug;
 
+		/** Entry along with its position in the global log order. */
+		struct QueuedEntry
+		{
+			UINT64 sequence = 0;
+			LogEntry entry;
+		};
+
+		struct ThreadRingBuffer;
+
 		/** Returns all log entries, including those marked as unread. */
 		Vector<LogEntry> getAllEntries() const;
 
-		Vector<LogEntry> mEntries;
+		/** Returns the ring buffer owned by the calling thread, creating it if needed. */
+		ThreadRingBuffer* getThreadRingBuffer();
+
+		/** Stores a new entry in the log and forwards it to the sinks. Caller must hold mMutex. */
+		void processEntry(LogEntry&& entry);
+
+		/**
+		 * Moves all entries queued in the ring buffers into the pending list, and processes pending entries in sequence
+		 * order, up to the first sequence number that was reserved but not yet published. Background thread only.
+		 */
+		void processQueuedEntries();
+
+		/** Removes the oldest entries until the total count doesn't exceed mMaxEntries. Caller must hold mMutex. */
+		void enforceMaxEntries();
+
+		/** Main method of the background thread started by startAsync(). */
+		void flushThreadMain();
+
+		Deque<LogEntry> mEntries;
 		Queue<LogEntry> mUnreadEntries;
 		UINT64 mHash = 0;
+		UINT32 mMaxEntries = DEFAULT_MAX_ENTRIES;
+		std::atomic<UINT64> mNumDropped { 0 };
+		Vector<SPtr<LogSink>> mSinks;
 		mutable RecursiveMutex mMutex;
+
+		// Async logging
+		UINT64 mId;
+		std::atomic<bool> mAsync { false };
+		std::atomic<UINT32> mNumActiveWriters { 0 };
+		std::atomic<UINT64> mNextSequence { 0 };
+		std::atomic<UINT64> mProcessedSequence { 0 }; // Lowest sequence number not yet processed
+
+		Vector<SPtr<ThreadRingBuffer>> mRingBuffers;
+		Mutex mRingBufferMutex;
+
+		Vector<QueuedEntry> mPendingEntries; // Background thread only
+
+		Thread* mFlushThread = nullptr;
+		bool mFlushRequested = false;
+		bool mStopFlushThread = false;
+		UINT64 mFlushSequence = 0; // Sinks need flushing once all entries below this are processed
+		UINT64 mFlushedSequence = 0; // All entries below this were processed when sinks were last flushed
+		Mutex mFlushMutex;
+		Signal mFlushSignal;
+		Signal mFlushedSignal;
 	};
 
 	/** @} */
@@ -0,0 +1,144 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Debug/BsLogSinks.h"
+#include "Debug/BsDebug.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+
+#if BS_PLATFORM == BS_PLATFORM_WIN32 && BS_COMPILER == BS_COMPILER_MSVC
+#include <windows.h>
+#include <iostream>
+
+void logToIDEConsole(const bs::String& message, const char* channel)
+{
+	OutputDebugString("[");
+	OutputDebugString(channel);
+	OutputDebugString("] ");
+	OutputDebugString(message.c_str());
+	OutputDebugString("\n");
+
+	// Also default output in case we're running without debugger attached
+	std::cout << "[" << channel << "] " << message << std::endl;
+}
+#else
+#include <iostream>
+
+void logToIDEConsole(const bs::String& message, const char* channel)
+{
+	std::cout << "[" << channel << "] " << message << std::endl;
+}
+#endif
+
+namespace bs
+{
+	/** Returns a readable name of one of the built-in channels, or null if the channel is a custom one. */
+	static const char* getChannelName(UINT32 channel)
+	{
+		switch((DebugChannel)channel)
+		{
+		case DebugChannel::Debug:
+			return "DEBUG";
+		case DebugChannel::Warning:
+		case DebugChannel::CompilerWarning:
+			return "WARNING";
+		case DebugChannel::Error:
+		case DebugChannel::CompilerError:
+			return "ERROR";
+		default:
+			return nullptr;
+		}
+	}
+
+	void ConsoleLogSink::write(const LogEntry& entry)
+	{
+		const char* channelName = getChannelName(entry.getChannel());
+		if(channelName == nullptr)
+			return;
+
+		logToIDEConsole(entry.getMessage(), channelName);
+	}
+
+	void ConsoleLogSink::flush()
+	{
+		std::cout.flush();
+	}
+
+	FileLogSink::FileLogSink(const Path& path)
+		:mStream(FileSystem::createAndOpenFile(path))
+	{ }
+
+	FileLogSink::~FileLogSink()
+	{
+		if(mStream)
+			mStream->close();
+	}
+
+	void FileLogSink::write(const LogEntry& entry)
+	{
+		if(!mStream)
+			return;
+
+		const char* channelName = getChannelName(entry.getChannel());
+
+		StringStream line;
+		line << "[" << entry.getLocalTime() << "] [";
+
+		if(channelName != nullptr)
+			line << channelName;
+		else
+			line << entry.getChannel();
+
+		line << "] " << entry.getMessage() << "\n";
+
+		String lineStr = line.str();
+		mStream->write(lineStr.data(), lineStr.size());
+	}
+
+	void FileLogSink::flush()
+	{
+		if(mStream)
+			mStream->flush();
+	}
+
+	BinaryLogSink::BinaryLogSink(const Path& path)
+		:mStream(FileSystem::createAndOpenFile(path))
+	{
+		if(!mStream)
+			return;
+
+		const char identifier[4] = { 'B', 'S', 'L', 'G' };
+		mStream->write(identifier, sizeof(identifier));
+		const UINT32 version = VERSION;
+		mStream->write(&version, sizeof(version));
+	}
+
+	BinaryLogSink::~BinaryLogSink()
+	{
+		if(mStream)
+			mStream->close();
+	}
+
+	void BinaryLogSink::write(const LogEntry& entry)
+	{
+		if(!mStream)
+			return;
+
+		const String& time = entry.getLocalTime();
+		const String& message = entry.getMessage();
+
+		UINT32 header[3];
+		header[0] = entry.getChannel();
+		header[1] = (UINT32)time.size();
+		header[2] = (UINT32)message.size();
+
+		mStream->write(header, sizeof(header));
+		mStream->write(time.data(), time.size());
+		mStream->write(message.data(), message.size());
+	}
+
+	void BinaryLogSink::flush()
+	{
+		if(mStream)
+			mStream->flush();
+	}
+}
@@ -0,0 +1,72 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "Prerequisites/BsPrerequisitesUtil.h"
+#include "Debug/BsLog.h"
+
+namespace bs
+{
+	/** @addtogroup Debug
+	 *  @{
+	 */
+
+	/**
+	 * Outputs entries in the debug, warning and error channels (as defined by DebugChannel) to the standard output, and to
+	 * the IDE output window if supported by the platform. Entries in custom channels are ignored.
+	 */
+	class BS_UTILITY_EXPORT ConsoleLogSink : public LogSink
+	{
+	public:
+		/** @copydoc LogSink::write */
+		void write(const LogEntry& entry) override;
+
+		/** @copydoc LogSink::flush */
+		void flush() override;
+	};
+
+	/** Writes all entries into a text file, one entry per line, prefixed with its time and channel. */
+	class BS_UTILITY_EXPORT FileLogSink : public LogSink
+	{
+	public:
+		/** Creates a sink writing into a file at the provided path. Any existing file is overwritten. */
+		FileLogSink(const Path& path);
+		~FileLogSink();
+
+		/** @copydoc LogSink::write */
+		void write(const LogEntry& entry) override;
+
+		/** @copydoc LogSink::flush */
+		void flush() override;
+
+	private:
+		SPtr<DataStream> mStream;
+	};
+
+	/**
+	 * Writes all entries into a compact binary file, suitable for processing by external tools. The file starts with the
+	 * 4-byte identifier 'BSLG' followed by a UINT32 format version. Each entry is then stored as its UINT32 channel, UINT32
+	 * time string length, UINT32 message length, followed by the time and message characters.
+	 */
+	class BS_UTILITY_EXPORT BinaryLogSink : public LogSink
+	{
+	public:
+		/** Version of the format written by the sink. */
+		static constexpr UINT32 VERSION = 1;
+
+		/** Creates a sink writing into a file at the provided path. Any existing file is overwritten. */
+		BinaryLogSink(const Path& path);
+		~BinaryLogSink();
+
+		/** @copydoc LogSink::write */
+		void write(const LogEntry& entry) override;
+
+		/** @copydoc LogSink::flush */
+		void flush() override;
+
+	private:
+		SPtr<DataStream> mStream;
+	};
+
+	/** @} */
+}
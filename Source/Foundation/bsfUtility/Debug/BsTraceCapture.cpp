@@ -0,0 +1,373 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Debug/BsTraceCapture.h"
+#include "Debug/BsDebug.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+#include <iomanip>
+
+namespace bs
+{
+	/** Thread identifier under which GPU events are displayed in the exported trace. */
+	static constexpr UINT32 GPU_THREAD_ID = 0;
+
+	/** Source of unique identifiers for TraceCapture instances, so thread local caches can tell them apart. */
+	static std::atomic<UINT64> sNextCaptureId { 1 };
+
+	/** Identifier of the capture whose buffer is cached in sThreadBuffer. */
+	static BS_THREADLOCAL UINT64 sThreadCaptureId = 0;
+
+	/** Buffer owned by the current thread, for the capture identified by sThreadCaptureId. */
+	static BS_THREADLOCAL void* sThreadBuffer = nullptr;
+
+	/**
+	 * Ring buffer of events recorded by a single thread. Written only by its owning thread. Buffers are never freed
+	 * before the capture object itself, so a thread can safely keep a cached pointer to its buffer.
+	 */
+	struct TraceCapture::ThreadBuffer
+	{
+		struct Event
+		{
+			UINT64 timestamp;
+			UINT64 duration;
+			EventType type;
+			char name[MAX_NAME_LENGTH];
+		};
+
+		ThreadId threadId;
+		UINT32 index = 0;
+		String name;
+
+		Event* events = nullptr;
+		UINT32 capacity = 0;
+		UINT64 count = 0;
+
+		/** Set while the owning thread is recording an event, so stopCapture() can wait for it to finish. */
+		std::atomic<bool> writing { false };
+	};
+
+	/** Writes a JSON string literal, escaping characters as needed. */
+	static void writeJsonString(StringStream& output, const char* str)
+	{
+		output << '"';
+		for(; *str != '\0'; ++str)
+		{
+			const char ch = *str;
+			switch(ch)
+			{
+			case '"': output << "\\\""; break;
+			case '\\': output << "\\\\"; break;
+			case '\n': output << "\\n"; break;
+			case '\r': output << "\\r"; break;
+			case '\t': output << "\\t"; break;
+			default:
+				if((UINT8)ch < 0x20)
+				{
+					char escaped[8];
+					snprintf(escaped, sizeof(escaped), "\\u%04x", (UINT32)ch);
+					output << escaped;
+				}
+				else
+					output << ch;
+				break;
+			}
+		}
+		output << '"';
+	}
+
+	/** Writes the timestamp, thread and process fields shared by all events. Timestamps are in microseconds. */
+	static void writeEventHeader(StringStream& output, const char* name, char phase, UINT64 timestamp, UINT32 threadId)
+	{
+		output << "{\"name\":";
+		writeJsonString(output, name);
+		output << ",\"ph\":\"" << phase << "\",\"ts\":" << (timestamp / 1000) << "." << std::setfill('0') <<
+			std::setw(3) << (timestamp % 1000) << ",\"pid\":1,\"tid\":" << threadId;
+	}
+
+	/** Writes a metadata event assigning a name to a thread. */
+	static void writeThreadName(StringStream& output, UINT32 threadId, const char* name)
+	{
+		output << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << threadId << ",\"args\":{\"name\":";
+		writeJsonString(output, name);
+		output << "}}";
+	}
+
+	TraceCapture::TraceCapture()
+		:mId(sNextCaptureId++)
+	{ }
+
+	TraceCapture::~TraceCapture()
+	{
+		stopCapture();
+
+		for(auto& buffer : mBuffers)
+		{
+			if(buffer->events != nullptr)
+				bs_free(buffer->events);
+
+			bs_delete(buffer);
+		}
+	}
+
+	void TraceCapture::startCapture(UINT32 eventsPerThread)
+	{
+		Lock lock(mMutex);
+
+		if(mCapturing)
+			return;
+
+		eventsPerThread = std::max(eventsPerThread, 2U);
+
+		// Threads won't touch their event storage until the capture starts, so it can be safely reset here
+		for(auto& buffer : mBuffers)
+		{
+			if(buffer->capacity != eventsPerThread)
+			{
+				if(buffer->events != nullptr)
+					bs_free(buffer->events);
+
+				buffer->events = (ThreadBuffer::Event*)bs_alloc(eventsPerThread * sizeof(ThreadBuffer::Event));
+				buffer->capacity = eventsPerThread;
+			}
+
+			buffer->count = 0;
+		}
+
+		mEventsPerThread = eventsPerThread;
+		mCaptureStart = getTimestamp();
+		mCapturing = true;
+	}
+
+	void TraceCapture::stopCapture()
+	{
+		Lock lock(mMutex);
+
+		if(!mCapturing)
+			return;
+
+		mCapturing = false;
+
+		// Wait for threads in the middle of recording an event, so the buffers aren't modified during export
+		for(auto& buffer : mBuffers)
+		{
+			while(buffer->writing)
+				std::this_thread::yield();
+		}
+	}
+
+	void TraceCapture::beginEvent(const char* name)
+	{
+		if(!isCapturing())
+			return;
+
+		record(EventType::Begin, name, getTimestamp(), 0);
+	}
+
+	void TraceCapture::endEvent()
+	{
+		if(!isCapturing())
+			return;
+
+		record(EventType::End, nullptr, getTimestamp(), 0);
+	}
+
+	void TraceCapture::recordGpuEvent(const char* name, UINT64 startTimestamp, UINT64 durationNs)
+	{
+		if(!isCapturing())
+			return;
+
+		record(EventType::GpuComplete, name, startTimestamp, durationNs);
+	}
+
+	void TraceCapture::setThreadName(const char* name)
+	{
+		if(!isCapturing())
+			return;
+
+		ThreadBuffer* buffer = getThreadBuffer();
+
+		Lock lock(mMutex);
+		if(buffer->name.empty())
+			buffer->name = name;
+	}
+
+	bool TraceCapture::writeChromeTrace(const SPtr<DataStream>& stream) const
+	{
+		Lock lock(mMutex);
+
+		if(mCapturing)
+		{
+			LOGWRN("Cannot write a trace while the capture is active. Call stopCapture() first.");
+			return false;
+		}
+
+		StringStream output;
+		output << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+		bool first = true;
+		const auto beginEntry = [&output, &first]()
+		{
+			if(!first)
+				output << ",\n";
+
+			first = false;
+		};
+
+		bool hasGpuEvents = false;
+		for(auto& buffer : mBuffers)
+		{
+			if(buffer->count == 0)
+				continue;
+
+			const UINT32 threadId = buffer->index + 1;
+
+			String threadName = buffer->name;
+			if(threadName.empty())
+				threadName = "Thread " + toString(buffer->index);
+
+			beginEntry();
+			writeThreadName(output, threadId, threadName.c_str());
+
+			// Older events were overwritten if the buffer wrapped around
+			const UINT64 numEvents = std::min(buffer->count, (UINT64)buffer->capacity);
+			const UINT64 firstEvent = buffer->count - numEvents;
+
+			UINT32 depth = 0;
+			for(UINT64 i = firstEvent; i < buffer->count; i++)
+			{
+				const ThreadBuffer::Event& event = buffer->events[i % buffer->capacity];
+				const UINT64 timestamp = event.timestamp > mCaptureStart ? event.timestamp - mCaptureStart : 0;
+
+				switch(event.type)
+				{
+				case EventType::Begin:
+					beginEntry();
+					writeEventHeader(output, event.name, 'B', timestamp, threadId);
+					output << "}";
+					depth++;
+					break;
+				case EventType::End:
+					// Skip ends whose begin was overwritten or recorded before the capture started
+					if(depth == 0)
+						break;
+
+					beginEntry();
+					writeEventHeader(output, "", 'E', timestamp, threadId);
+					output << "}";
+					depth--;
+					break;
+				case EventType::GpuComplete:
+					beginEntry();
+					writeEventHeader(output, event.name, 'X', timestamp, GPU_THREAD_ID);
+					output << ",\"dur\":" << (event.duration / 1000) << "." << std::setfill('0') << std::setw(3) <<
+						(event.duration % 1000) << "}";
+					hasGpuEvents = true;
+					break;
+				}
+			}
+		}
+
+		if(hasGpuEvents)
+		{
+			beginEntry();
+			writeThreadName(output, GPU_THREAD_ID, "GPU");
+		}
+
+		output << "\n]}\n";
+
+		const String outputStr = output.str();
+		stream->write(outputStr.data(), outputStr.size());
+
+		return true;
+	}
+
+	bool TraceCapture::saveChromeTrace(const Path& path) const
+	{
+		SPtr<DataStream> stream = FileSystem::createAndOpenFile(path);
+		if(stream == nullptr)
+		{
+			LOGERR("Unable to open the trace file for writing: " + path.toString());
+			return false;
+		}
+
+		const bool written = writeChromeTrace(stream);
+		stream->close();
+
+		return written;
+	}
+
+	UINT64 TraceCapture::getTimestamp()
+	{
+		using namespace std::chrono;
+		return (UINT64)duration_cast<nanoseconds>(high_resolution_clock::now().time_since_epoch()).count();
+	}
+
+	void TraceCapture::record(EventType type, const char* name, UINT64 timestamp, UINT64 durationNs)
+	{
+		ThreadBuffer* buffer = getThreadBuffer();
+
+		// Check the capture state again after announcing the write, as stopCapture() might have started waiting before
+		buffer->writing.store(true);
+		if(mCapturing.load())
+		{
+			ThreadBuffer::Event& event = buffer->events[buffer->count % buffer->capacity];
+			event.timestamp = timestamp;
+			event.duration = durationNs;
+			event.type = type;
+
+			if(name != nullptr)
+			{
+				strncpy(event.name, name, MAX_NAME_LENGTH - 1);
+				event.name[MAX_NAME_LENGTH - 1] = '\0';
+			}
+			else
+				event.name[0] = '\0';
+
+			buffer->count++;
+		}
+
+		buffer->writing.store(false, std::memory_order_release);
+	}
+
+	TraceCapture::ThreadBuffer* TraceCapture::getThreadBuffer()
+	{
+		if(sThreadCaptureId == mId)
+			return (ThreadBuffer*)sThreadBuffer;
+
+		Lock lock(mMutex);
+
+		// Thread IDs may be reused once a thread exits, in which case its buffer is reused as well
+		const ThreadId threadId = BS_THREAD_CURRENT_ID;
+		ThreadBuffer* buffer = nullptr;
+		for(auto& entry : mBuffers)
+		{
+			if(entry->threadId == threadId)
+			{
+				buffer = entry;
+				break;
+			}
+		}
+
+		if(buffer == nullptr)
+		{
+			buffer = bs_new<ThreadBuffer>();
+			buffer->threadId = threadId;
+			buffer->index = (UINT32)mBuffers.size();
+			buffer->events = (ThreadBuffer::Event*)bs_alloc(mEventsPerThread * sizeof(ThreadBuffer::Event));
+			buffer->capacity = mEventsPerThread;
+
+			mBuffers.push_back(buffer);
+		}
+
+		sThreadCaptureId = mId;
+		sThreadBuffer = buffer;
+
+		return buffer;
+	}
+
+	TraceCapture& gTraceCapture()
+	{
+		static TraceCapture traceCapture;
+		return traceCapture;
+	}
+}
@@ -0,0 +1,146 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "Prerequisites/BsPrerequisitesUtil.h"
+#include <atomic>
+
+namespace bs
+{
+	/** @addtogroup Debug
+	 *  @{
+	 */
+
+	/**
+	 * Records a timeline of timestamped begin/end events on every thread, which can be exported in the Chrome trace event
+	 * format and viewed in chrome://tracing or the Perfetto UI. Unlike ProfilerCPU, which aggregates samples into a
+	 * per-frame hierarchy, the capture preserves the exact time and thread of every event, making it suitable for finding
+	 * stalls and synchronization issues between threads.
+	 *
+	 * Each thread records into its own fixed-size ring buffer, so recording doesn't lock and the capture always contains
+	 * the most recent events. Recording methods are no-ops while no capture is active.
+	 *
+	 * @note	Thread safe.
+	 */
+	class BS_UTILITY_EXPORT TraceCapture
+	{
+	public:
+		/** Maximum length of an event name, including the null terminator. Longer names are truncated. */
+		static constexpr UINT32 MAX_NAME_LENGTH = 64;
+
+		/** Default number of events each thread can store before the oldest events start being overwritten. */
+		static constexpr UINT32 DEFAULT_EVENTS_PER_THREAD = 32768;
+
+		TraceCapture();
+		~TraceCapture();
+
+		/**
+		 * Starts a new capture, discarding any events from the previous one.
+		 *
+		 * @param[in]	eventsPerThread		Number of most recent events kept for each thread.
+		 */
+		void startCapture(UINT32 eventsPerThread = DEFAULT_EVENTS_PER_THREAD);
+
+		/** Stops the active capture. Recorded events remain available for export until the next capture is started. */
+		void stopCapture();
+
+		/** Returns true if a capture is currently active. */
+		bool isCapturing() const { return mCapturing.load(std::memory_order_relaxed); }
+
+		/** Records the start of a named event on the calling thread. Must be followed by a matching endEvent(). */
+		void beginEvent(const char* name);
+
+		/** Records the end of the event most recently started on the calling thread. */
+		void endEvent();
+
+		/**
+		 * Records an event on the GPU timeline.
+		 *
+		 * @param[in]	name			Name of the event.
+		 * @param[in]	startTimestamp	Time at which the event started, as returned by getTimestamp().
+		 * @param[in]	durationNs		Duration of the event, in nanoseconds.
+		 */
+		void recordGpuEvent(const char* name, UINT64 startTimestamp, UINT64 durationNs);
+
+		/**
+		 * Assigns a name to the calling thread, displayed in the exported trace. Threads that are never named are displayed
+		 * using their index. Only the first name assigned to a thread is kept.
+		 */
+		void setThreadName(const char* name);
+
+		/**
+		 * Writes the events recorded by the last capture in the Chrome trace event JSON format. The capture must be
+		 * stopped.
+		 *
+		 * @param[in]	stream	Stream to write the trace to.
+		 * @return				True if the trace was written, false if a capture is still active.
+		 */
+		bool writeChromeTrace(const SPtr<DataStream>& stream) const;
+
+		/**
+		 * Writes the events recorded by the last capture into a file in the Chrome trace event JSON format. The capture
+		 * must be stopped.
+		 *
+		 * @param[in]	path	Path to the file to write. Any existing file is overwritten.
+		 * @return				True if the trace was written.
+		 */
+		bool saveChromeTrace(const Path& path) const;
+
+		/** Returns the current time in nanoseconds, in the same time base used for recorded events. */
+		static UINT64 getTimestamp();
+
+	private:
+		struct ThreadBuffer;
+
+		/** Type of a recorded event. */
+		enum class EventType : UINT8
+		{
+			Begin,
+			End,
+			GpuComplete
+		};
+
+		/** Stores a new event in the calling thread's buffer. Caller must check isCapturing() first. */
+		void record(EventType type, const char* name, UINT64 timestamp, UINT64 durationNs);
+
+		/** Returns the buffer owned by the calling thread, creating it if needed. */
+		ThreadBuffer* getThreadBuffer();
+
+		UINT64 mId;
+		std::atomic<bool> mCapturing { false };
+		UINT32 mEventsPerThread = DEFAULT_EVENTS_PER_THREAD;
+		UINT64 mCaptureStart = 0;
+
+		Vector<ThreadBuffer*> mBuffers;
+		mutable Mutex mMutex;
+	};
+
+	/** Provides global access to the TraceCapture instance. */
+	BS_UTILITY_EXPORT TraceCapture& gTraceCapture();
+
+	/**
+	 * Records a trace event for the lifetime of the current scope, if a capture is active.
+	 *
+	 * @note	The name is only read when the event begins, so it may refer to temporary storage.
+	 */
+	struct TraceScope
+	{
+		TraceScope(const char* name)
+			:mActive(gTraceCapture().isCapturing())
+		{
+			if(mActive)
+				gTraceCapture().beginEvent(name);
+		}
+
+		~TraceScope()
+		{
+			if(mActive)
+				gTraceCapture().endEvent();
+		}
+
+	private:
+		bool mActive;
+	};
+
+	/** @} */
+}
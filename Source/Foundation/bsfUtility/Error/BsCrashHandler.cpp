@@ -56,6 +56,8 @@ namespace bs
 
 	void CrashHandler::saveCrashLog() const
 	{
+		// The crashed thread might hold the log's locks or be its background thread, so flush() could block forever
+		gDebug().getLog().drain(LOG_DRAIN_TIMEOUT_MS);
 		gDebug().saveLog(getCrashFolder() + sCrashLogName);
 	}
 }
@@ -104,6 +104,8 @@ namespace bs
 		static const String sCrashLogName;
 		/** Error message to display on program failure. */
 		static const String sFatalErrorMsg;
+		/** Maximum time to wait for the log's background thread to process queued entries, in milliseconds. */
+		static constexpr UINT32 LOG_DRAIN_TIMEOUT_MS = 500;
 
 #if BS_PLATFORM == BS_PLATFORM_WIN32
 		struct Data;
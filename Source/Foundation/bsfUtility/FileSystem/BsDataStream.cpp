@@ -309,6 +309,47 @@ namespace bs
 		}
 	}
 
+	constexpr UINT64 MappedFileDataStream::MIN_MAPPED_FILE_SIZE;
+
+	MappedFileDataStream::MappedFileDataStream(const Path& filePath)
+		: MemoryDataStream(nullptr, 0, false), mPath(filePath)
+	{
+		mAccess = READ;
+		mMapping = mapFile(filePath);
+
+		if(mMapping)
+		{
+			mData = mPos = mMapping->data;
+			mSize = mMapping->size;
+			mEnd = mData + mSize;
+		}
+	}
+
+	MappedFileDataStream::MappedFileDataStream(const MappedFileDataStream& parent, size_t offset, size_t size)
+		: MemoryDataStream(parent.mData + offset, size, false), mPath(parent.mPath), mMapping(parent.mMapping)
+		, mFileOffset(parent.mFileOffset + offset)
+	{
+		assert(offset + size <= parent.mSize);
+
+		mAccess = READ;
+	}
+
+	MappedFileDataStream::~MappedFileDataStream()
+	{
+		close();
+	}
+
+	SPtr<DataStream> MappedFileDataStream::clone(bool copyData) const
+	{
+		return bs_shared_ptr_new<MappedFileDataStream>(*this, 0, mSize);
+	}
+
+	void MappedFileDataStream::close()
+	{
+		MemoryDataStream::close();
+		mMapping = nullptr;
+	}
+
 	FileDataStream::FileDataStream(const Path& path, AccessMode accessMode, bool freeOnClose)
 		: DataStream(accessMode), mPath(path), mFreeOnClose(freeOnClose)
 	{
@@ -397,6 +438,12 @@ namespace bs
 		return bs_shared_ptr_new<FileDataStream>(mPath, (AccessMode)getAccessMode(), true);
 	}
 
+	void FileDataStream::flush()
+	{
+		if (mFStream)
+			mFStream->flush();
+	}
+
 	void FileDataStream::close()
 	{
 		if (mInStream)
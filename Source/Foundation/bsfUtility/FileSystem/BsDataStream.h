@@ -50,6 +50,12 @@ namespace bs
 		virtual bool isWriteable() const { return (mAccess & WRITE) != 0; }
 		virtual bool isFile() const = 0;
 
+		/** 
+		 * Returns true if the stream contents are memory mapped from a file. Such streams are always memory streams and
+		 * their data can be referenced directly instead of being copied.
+		 */
+		virtual bool isMapped() const { return false; }
+
 		/** Reads data from the buffer and copies it to the specified value. */
 		template<typename T> DataStream& operator>>(T& val);
 
@@ -142,6 +148,9 @@ namespace bs
 
 		/** Close the stream. This makes further operations invalid. */
 		virtual void close() = 0;
+
+		/** Makes sure all data written to the stream so far is passed to the underlying device. */
+		virtual void flush() { }
 		
 	protected:
 		static const UINT32 StreamTempSize;
@@ -229,6 +238,83 @@ namespace bs
 		bool mFreeOnClose;
 	};
 
+	/**
+	 * Data stream providing read-only access to a file mapped into the process address space. Reads are served directly
+	 * from the mapping and the data can be referenced through getPtr() without copying. The mapping is copy-on-write, 
+	 * meaning any modifications made through the returned pointers are private to the process and never reach the file.
+	 */
+	class BS_UTILITY_EXPORT MappedFileDataStream : public MemoryDataStream
+	{
+		/** Owns the OS mapping of a file and releases it on destruction. Shared by all streams referencing the file. */
+		struct FileMapping
+		{
+			FileMapping(UINT8* data, size_t size)
+				:data(data), size(size)
+			{ }
+
+			~FileMapping();
+
+			UINT8* data;
+			size_t size;
+		};
+
+	public:
+		/**
+		 * Maps the file at the provided path. The stream will be empty if the file doesn't exist or cannot be mapped.
+		 *
+		 * @param[in]	filePath	Path of the file to map.
+		 */
+		MappedFileDataStream(const Path& filePath);
+
+		/**
+		 * Creates a stream referencing a sub-range of the data mapped by another stream. No data is copied and the mapping
+		 * is kept alive for as long as any stream references it.
+		 *
+		 * @param[in]	parent		Stream whose mapping to reference.
+		 * @param[in]	offset		Offset relative to the start of @p parent, in bytes.
+		 * @param[in]	size		Size of the referenced range, in bytes.
+		 */
+		MappedFileDataStream(const MappedFileDataStream& parent, size_t offset, size_t size);
+
+		~MappedFileDataStream();
+
+		/** @copydoc DataStream::isMapped */
+		bool isMapped() const override { return true; }
+
+		/** @copydoc DataStream::write */
+		size_t write(const void* buf, size_t count) override { return 0; }
+
+		/** 
+		 * @copydoc DataStream::clone
+		 *
+		 * @note	Mapped data is immutable so the clone always references the same mapping, regardless of @p copyData.
+		 */
+		SPtr<DataStream> clone(bool copyData = true) const override;
+
+		/** @copydoc DataStream::close */
+		void close() override;
+
+		/** Returns the path of the mapped file. */
+		const Path& getPath() const { return mPath; }
+
+		/** Returns the offset of the start of this stream, relative to the start of the mapped file, in bytes. */
+		size_t getFileOffset() const { return mFileOffset; }
+
+		/** 
+		 * Files smaller than this many bytes are read through FileDataStream by FileSystem::openFile(), as mapping them 
+		 * doesn't pay off.
+		 */
+		static constexpr UINT64 MIN_MAPPED_FILE_SIZE = 64 * 1024;
+
+	protected:
+		/** Maps the file at the provided path. Returns null if the file cannot be mapped. */
+		static SPtr<FileMapping> mapFile(const Path& filePath);
+
+		Path mPath;
+		SPtr<FileMapping> mMapping;
+		size_t mFileOffset = 0;
+	};
+
 	/** Data stream for handling data from standard streams. */
 	class BS_UTILITY_EXPORT FileDataStream : public DataStream
 	{
@@ -271,6 +357,9 @@ namespace bs
 		/** @copydoc DataStream::close */
 		void close() override;
 
+		/** @copydoc DataStream::flush */
+		void flush() override;
+
 		/** Returns the path of the file opened by the stream. */
 		const Path& getPath() const { return mPath; }
 
@@ -282,6 +371,42 @@ namespace bs
 		bool mFreeOnClose;	
 	};
 
+	/**
+	 * Read-only handle to a file that reads from explicitly provided offsets instead of a shared read position. This 
+	 * allows multiple threads to read from the same handle in parallel without synchronization.
+	 */
+	class BS_UTILITY_EXPORT PositionalFileReader
+	{
+	public:
+		/** Opens the file at the provided path for reading. Check isOpen() to see if the file was opened successfully. */
+		PositionalFileReader(const Path& filePath);
+		~PositionalFileReader();
+
+		PositionalFileReader(const PositionalFileReader&) = delete;
+		PositionalFileReader& operator=(const PositionalFileReader&) = delete;
+
+		/** Checks if the file was successfully opened. */
+		bool isOpen() const { return mHandle != -1; }
+
+		/**
+		 * Reads data from the specified offset in the file.
+		 *
+		 * @param[out]	buf		Buffer to read the data into. Must be at least @p count bytes in size.
+		 * @param[in]	count	Number of bytes to read.
+		 * @param[in]	offset	Offset from the start of the file to read from, in bytes.
+		 * @return				Number of bytes read. Less than @p count if the end of the file was reached or an error 
+		 *						occurred.
+		 */
+		size_t read(void* buf, size_t count, UINT64 offset) const;
+
+		/** Returns the path of the opened file. */
+		const Path& getPath() const { return mPath; }
+
+	private:
+		Path mPath;
+		INT64 mHandle = -1;
+	};
+
 	/** @} */
 }
 
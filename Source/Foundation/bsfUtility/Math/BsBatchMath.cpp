@@ -0,0 +1,175 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Math/BsBatchMath.h"
+#include "Math/BsMatrix4.h"
+#include "Math/BsConvexVolume.h"
+#include "Utility/BsSmallVector.h"
+
+#ifndef SIMDPP_ARCH_X86_SSE4_1
+#define SIMDPP_ARCH_X86_SSE4_1
+#endif
+
+#define BS_BATCH_MATH_KERNELS_IMPL
+#include "Math/BsBatchMathKernels.h"
+#include "ThirdParty/simdpp/dispatch/get_arch_raw_cpuid.h"
+
+namespace bs
+{
+	static_assert(sizeof(Matrix4) == sizeof(float) * 16, "BatchMath expects Matrix4 to be a tightly packed 4x4 array.");
+
+	/** Returns the matrix elements as 16 floats in row-major order. */
+	static const float* getData(const Matrix4& matrix)
+	{
+		return reinterpret_cast<const float*>(&matrix);
+	}
+
+	const BatchMathKernels& getBatchMathKernelsSSE4_1()
+	{
+		static const BatchMathKernels kernels = SIMDPP_ARCH_NAMESPACE::getBatchMathKernels();
+		return kernels;
+	}
+
+	/** Checks which of the instruction sets are supported by the CPU the application is running on. */
+	static bool isSupportedByCPU(SIMDInstructionSet instructionSet)
+	{
+		switch(instructionSet)
+		{
+		case SIMDInstructionSet::SSE4_1:
+			return true;
+		case SIMDInstructionSet::AVX:
+#if SIMDPP_HAS_GET_ARCH_RAW_CPUID
+			return (simdpp::get_arch_raw_cpuid() & simdpp::Arch::X86_AVX) != simdpp::Arch::NONE_NULL;
+#else
+			return false;
+#endif
+		}
+
+		return false;
+	}
+
+	/** Picks the best instruction set supported by the CPU. */
+	static SIMDInstructionSet findBestInstructionSet()
+	{
+		if(isSupportedByCPU(SIMDInstructionSet::AVX))
+			return SIMDInstructionSet::AVX;
+
+		return SIMDInstructionSet::SSE4_1;
+	}
+
+	/** Returns the instruction set the operations are executed with. Initialized on first use. */
+	static std::atomic<SIMDInstructionSet>& getActiveInstructionSet()
+	{
+		static std::atomic<SIMDInstructionSet> instructionSet(findBestInstructionSet());
+		return instructionSet;
+	}
+
+	/** Returns the table of operations for the active instruction set. */
+	static const BatchMathKernels& getKernels()
+	{
+		switch(getActiveInstructionSet().load(std::memory_order_relaxed))
+		{
+		case SIMDInstructionSet::AVX:
+			return getBatchMathKernelsAVX();
+		default:
+		case SIMDInstructionSet::SSE4_1:
+			return getBatchMathKernelsSSE4_1();
+		}
+	}
+
+	/** Copies the volume's planes into a flat array, with four floats per plane (normal followed by distance). */
+	static void getPlaneData(const ConvexVolume& volume, SmallVector<float, 24>& output)
+	{
+		const Vector<Plane> planes = volume.getPlanes();
+
+		output.resize((UINT32)planes.size() * 4);
+		for(UINT32 i = 0; i < (UINT32)planes.size(); i++)
+		{
+			output[i * 4 + 0] = planes[i].normal.x;
+			output[i * 4 + 1] = planes[i].normal.y;
+			output[i * 4 + 2] = planes[i].normal.z;
+			output[i * 4 + 3] = planes[i].d;
+		}
+	}
+
+	void BatchMath::transformPoints(const Matrix4& matrix, const Vector3SoA& input, const Vector3SoA& output, UINT32 count)
+	{
+		getKernels().transformPoints(getData(matrix), input, output, count);
+	}
+
+	void BatchMath::transformAABoxes(const Matrix4& matrix, const AABoxSoA& input, const AABoxSoA& output, UINT32 count)
+	{
+		getKernels().transformAABoxes(getData(matrix), input, output, count);
+	}
+
+	void BatchMath::multiply(const Matrix4* lhs, const Matrix4* rhs, Matrix4* output, UINT32 count)
+	{
+		if(count == 0)
+			return;
+
+		getKernels().multiply(getData(lhs[0]), 16, getData(rhs[0]), reinterpret_cast<float*>(output), count);
+	}
+
+	void BatchMath::multiply(const Matrix4& lhs, const Matrix4* rhs, Matrix4* output, UINT32 count)
+	{
+		if(count == 0)
+			return;
+
+		getKernels().multiply(getData(lhs), 0, getData(rhs[0]), reinterpret_cast<float*>(output), count);
+	}
+
+	void BatchMath::composeTRS(const Vector3SoA& translations, const QuaternionSoA& rotations, const Vector3SoA& scales,
+		Matrix4* output, UINT32 count)
+	{
+		if(count == 0)
+			return;
+
+		getKernels().composeTRS(translations, rotations, scales, reinterpret_cast<float*>(output), count);
+	}
+
+	void BatchMath::slerp(const float* t, const QuaternionSoA& from, const QuaternionSoA& to, const QuaternionSoA& output,
+		UINT32 count)
+	{
+		getKernels().slerp(t, from, to, output, count);
+	}
+
+	void BatchMath::nlerp(const float* t, const QuaternionSoA& from, const QuaternionSoA& to, const QuaternionSoA& output,
+		UINT32 count)
+	{
+		getKernels().nlerp(t, from, to, output, count);
+	}
+
+	void BatchMath::intersects(const ConvexVolume& volume, const SphereSoA& spheres, bool* output, UINT32 count)
+	{
+		SmallVector<float, 24> planes;
+		getPlaneData(volume, planes);
+
+		getKernels().intersectsSpheres(planes.data(), planes.size() / 4, spheres, output, count);
+	}
+
+	void BatchMath::intersects(const ConvexVolume& volume, const AABoxSoA& boxes, bool* output, UINT32 count)
+	{
+		SmallVector<float, 24> planes;
+		getPlaneData(volume, planes);
+
+		getKernels().intersectsAABoxes(planes.data(), planes.size() / 4, boxes, output, count);
+	}
+
+	SIMDInstructionSet BatchMath::getInstructionSet()
+	{
+		return getActiveInstructionSet().load(std::memory_order_relaxed);
+	}
+
+	bool BatchMath::isSupported(SIMDInstructionSet instructionSet)
+	{
+		return isSupportedByCPU(instructionSet);
+	}
+
+	bool BatchMath::setInstructionSet(SIMDInstructionSet instructionSet)
+	{
+		if(!isSupportedByCPU(instructionSet))
+			return false;
+
+		getActiveInstructionSet().store(instructionSet, std::memory_order_relaxed);
+		return true;
+	}
+}
@@ -0,0 +1,188 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "Prerequisites/BsPrerequisitesUtil.h"
+
+namespace bs
+{
+	/** @addtogroup Math
+	 *  @{
+	 */
+
+	/**
+	 * View over an array of 3D vectors stored in structure-of-arrays layout, with a separate array for each component.
+	 * Does not own the memory.
+	 */
+	struct Vector3SoA
+	{
+		float* x = nullptr;
+		float* y = nullptr;
+		float* z = nullptr;
+	};
+
+	/** View over an array of quaternions stored in structure-of-arrays layout. Does not own the memory. */
+	struct QuaternionSoA
+	{
+		float* x = nullptr;
+		float* y = nullptr;
+		float* z = nullptr;
+		float* w = nullptr;
+	};
+
+	/** View over an array of spheres stored in structure-of-arrays layout. Does not own the memory. */
+	struct SphereSoA
+	{
+		Vector3SoA center;
+		float* radius = nullptr;
+	};
+
+	/**
+	 * View over an array of axis aligned boxes stored in structure-of-arrays layout, as centers and extents (half-sizes).
+	 * Does not own the memory.
+	 */
+	struct AABoxSoA
+	{
+		Vector3SoA center;
+		Vector3SoA extents;
+	};
+
+	/** Instruction sets that BatchMath operations can be executed with. */
+	enum class SIMDInstructionSet
+	{
+		SSE4_1, /**< Four elements processed at once. Baseline required by the framework. */
+		AVX /**< Eight elements processed at once. Used only if supported by the CPU. */
+	};
+
+	/**
+	 * Math operations performed on many elements at once using SIMD instructions. Elements are provided in
+	 * structure-of-arrays layout (or as plain arrays of matrices), and the best instruction set supported by the CPU
+	 * is picked at runtime.
+	 *
+	 * Results match the scalar equivalents in Matrix4, Quaternion, AABox and ConvexVolume, within floating point
+	 * precision. Output arrays may alias input arrays only if they are the exact same arrays.
+	 */
+	class BS_UTILITY_EXPORT BatchMath
+	{
+	public:
+		/**
+		 * Transforms 3D points by an affine matrix. Equivalent to Matrix4::multiplyAffine(const Vector3&).
+		 *
+		 * @param[in]	matrix		Affine matrix to transform the points with.
+		 * @param[in]	input		Points to transform.
+		 * @param[out]	output		Transformed points.
+		 * @param[in]	count		Number of points in the input and output arrays.
+		 */
+		static void transformPoints(const Matrix4& matrix, const Vector3SoA& input, const Vector3SoA& output,
+			UINT32 count);
+
+		/**
+		 * Transforms axis aligned boxes by an affine matrix, returning the axis aligned boxes enclosing the transformed
+		 * boxes. Equivalent to AABox::transformAffine().
+		 *
+		 * @param[in]	matrix		Affine matrix to transform the boxes with.
+		 * @param[in]	input		Boxes to transform.
+		 * @param[out]	output		Transformed boxes.
+		 * @param[in]	count		Number of boxes in the input and output arrays.
+		 */
+		static void transformAABoxes(const Matrix4& matrix, const AABoxSoA& input, const AABoxSoA& output,
+			UINT32 count);
+
+		/**
+		 * Multiplies matrices pairwise, so that output[i] = lhs[i] * rhs[i].
+		 *
+		 * @param[in]	lhs			Matrices on the left side of the multiplication.
+		 * @param[in]	rhs			Matrices on the right side of the multiplication.
+		 * @param[out]	output		Resulting matrices.
+		 * @param[in]	count		Number of matrices in each of the arrays.
+		 */
+		static void multiply(const Matrix4* lhs, const Matrix4* rhs, Matrix4* output, UINT32 count);
+
+		/**
+		 * Multiplies a single matrix with an array of matrices, so that output[i] = lhs * rhs[i]. Useful for
+		 * transforming many local transforms into the same space (e.g. bone matrices into world space).
+		 *
+		 * @param[in]	lhs			Matrix on the left side of the multiplication.
+		 * @param[in]	rhs			Matrices on the right side of the multiplication.
+		 * @param[out]	output		Resulting matrices.
+		 * @param[in]	count		Number of matrices in the @p rhs and @p output arrays.
+		 */
+		static void multiply(const Matrix4& lhs, const Matrix4* rhs, Matrix4* output, UINT32 count);
+
+		/**
+		 * Builds transform matrices from translation, rotation and scale. Equivalent to Matrix4::setTRS().
+		 *
+		 * @param[in]	translations	Translation of each transform.
+		 * @param[in]	rotations		Rotation of each transform. Quaternions must be normalized.
+		 * @param[in]	scales			Scale of each transform.
+		 * @param[out]	output			Resulting matrices.
+		 * @param[in]	count			Number of transforms.
+		 */
+		static void composeTRS(const Vector3SoA& translations, const QuaternionSoA& rotations, const Vector3SoA& scales,
+			Matrix4* output, UINT32 count);
+
+		/**
+		 * Performs spherical interpolation between pairs of quaternions, always along the shortest path. Equivalent to
+		 * Quaternion::slerp().
+		 *
+		 * @param[in]	t			Interpolation factor for each pair, in [0, 1] range.
+		 * @param[in]	from		Quaternions interpolated from (t = 0).
+		 * @param[in]	to			Quaternions interpolated to (t = 1).
+		 * @param[out]	output		Interpolated quaternions.
+		 * @param[in]	count		Number of quaternion pairs.
+		 */
+		static void slerp(const float* t, const QuaternionSoA& from, const QuaternionSoA& to,
+			const QuaternionSoA& output, UINT32 count);
+
+		/**
+		 * Performs normalized linear interpolation between pairs of quaternions. Cheaper but less accurate than slerp().
+		 * Equivalent to Quaternion::lerp().
+		 *
+		 * @copydetails BatchMath::slerp
+		 */
+		static void nlerp(const float* t, const QuaternionSoA& from, const QuaternionSoA& to,
+			const QuaternionSoA& output, UINT32 count);
+
+		/**
+		 * Checks which of the provided spheres intersect the convex volume (e.g. a frustum). Equivalent to
+		 * ConvexVolume::intersects(const Sphere&).
+		 *
+		 * @param[in]	volume		Volume to test against.
+		 * @param[in]	spheres		Spheres to test.
+		 * @param[out]	output		True for each sphere intersecting or inside the volume, false otherwise.
+		 * @param[in]	count		Number of spheres.
+		 */
+		static void intersects(const ConvexVolume& volume, const SphereSoA& spheres, bool* output, UINT32 count);
+
+		/**
+		 * Checks which of the provided boxes intersect the convex volume (e.g. a frustum). Equivalent to
+		 * ConvexVolume::intersects(const AABox&).
+		 *
+		 * @param[in]	volume		Volume to test against.
+		 * @param[in]	boxes		Boxes to test.
+		 * @param[out]	output		True for each box intersecting or inside the volume, false otherwise.
+		 * @param[in]	count		Number of boxes.
+		 */
+		static void intersects(const ConvexVolume& volume, const AABoxSoA& boxes, bool* output, UINT32 count);
+
+		/** Returns the instruction set currently used for executing the operations. */
+		static SIMDInstructionSet getInstructionSet();
+
+		/**
+		 * Returns true if the provided instruction set is supported by the CPU (and the platform the framework was
+		 * built for).
+		 */
+		static bool isSupported(SIMDInstructionSet instructionSet);
+
+		/**
+		 * Overrides the instruction set picked at start-up. Primarily useful for testing and benchmarking the different
+		 * implementations.
+		 *
+		 * @param[in]	instructionSet	Instruction set to use. Ignored if not supported.
+		 * @return						True if the instruction set was changed.
+		 */
+		static bool setInstructionSet(SIMDInstructionSet instructionSet);
+	};
+
+	/** @} */
+}
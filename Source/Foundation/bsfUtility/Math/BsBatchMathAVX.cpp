@@ -0,0 +1,24 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+
+// This file is compiled with AVX enabled, and its functions are only called after checking the CPU supports it. It must
+// not contain any code (including inline functions from other headers) that could get called on CPUs without AVX.
+#ifndef SIMDPP_ARCH_X86_SSE4_1
+#define SIMDPP_ARCH_X86_SSE4_1
+#endif
+
+#ifndef SIMDPP_ARCH_X86_AVX
+#define SIMDPP_ARCH_X86_AVX
+#endif
+
+#define BS_BATCH_MATH_KERNELS_IMPL
+#include "Math/BsBatchMathKernels.h"
+
+namespace bs
+{
+	const BatchMathKernels& getBatchMathKernelsAVX()
+	{
+		static const BatchMathKernels kernels = SIMDPP_ARCH_NAMESPACE::getBatchMathKernels();
+		return kernels;
+	}
+}
@@ -0,0 +1,567 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "Prerequisites/BsPrerequisitesUtil.h"
+#include "Math/BsBatchMath.h"
+
+namespace bs
+{
+	/** @addtogroup Implementation
+	 *  @{
+	 */
+
+	/**
+	 * Table of BatchMath operations compiled for a single instruction set. Operations only work on raw data, so that
+	 * no inline functions are compiled with an instruction set the CPU might not support. Matrices are provided as
+	 * 16 floats in row-major order, and planes as 4 floats (normal followed by distance).
+	 */
+	struct BatchMathKernels
+	{
+		void(*transformPoints)(const float* matrix, const Vector3SoA& input, const Vector3SoA& output, UINT32 count);
+		void(*transformAABoxes)(const float* matrix, const AABoxSoA& input, const AABoxSoA& output, UINT32 count);
+		void(*multiply)(const float* lhs, UINT32 lhsStride, const float* rhs, float* output, UINT32 count);
+		void(*composeTRS)(const Vector3SoA& translations, const QuaternionSoA& rotations, const Vector3SoA& scales,
+			float* output, UINT32 count);
+		void(*slerp)(const float* t, const QuaternionSoA& from, const QuaternionSoA& to, const QuaternionSoA& output,
+			UINT32 count);
+		void(*nlerp)(const float* t, const QuaternionSoA& from, const QuaternionSoA& to, const QuaternionSoA& output,
+			UINT32 count);
+		void(*intersectsSpheres)(const float* planes, UINT32 numPlanes, const SphereSoA& spheres, bool* output,
+			UINT32 count);
+		void(*intersectsAABoxes)(const float* planes, UINT32 numPlanes, const AABoxSoA& boxes, bool* output,
+			UINT32 count);
+	};
+
+	/** Returns BatchMath operations compiled for SSE4.1. */
+	const BatchMathKernels& getBatchMathKernelsSSE4_1();
+
+	/** Returns BatchMath operations compiled for AVX. */
+	const BatchMathKernels& getBatchMathKernelsAVX();
+
+	/** @} */
+}
+
+// Everything below is compiled once per instruction set, selected by the SIMDPP_ARCH_* macros defined by the including
+// file. simdpp places its functions in a namespace unique to the instruction set, and the kernels do the same.
+#ifdef BS_BATCH_MATH_KERNELS_IMPL
+
+#if BS_COMPILER == BS_COMPILER_MSVC
+#pragma warning(disable: 4244)
+#endif
+
+#include "ThirdParty/simdpp/simd.h"
+
+#if BS_COMPILER == BS_COMPILER_MSVC
+#pragma warning(default: 4244)
+#endif
+
+namespace bs
+{
+	namespace SIMDPP_ARCH_NAMESPACE
+	{
+		using namespace simdpp;
+
+		/** @addtogroup Implementation
+		 *  @{
+		 */
+
+		/** Number of elements processed at once. */
+		static constexpr UINT32 BATCH_WIDTH = SIMDPP_FAST_FLOAT32_SIZE;
+
+		typedef float32<BATCH_WIDTH> FloatN;
+		typedef uint32<BATCH_WIDTH> UIntN;
+
+		/** Maximum dot product between two quaternions for which slerp is used. Matches Quaternion::EPSILON. */
+		static constexpr float SLERP_THRESHOLD = 1.0f - 1e-03f;
+
+		/**
+		 * Calls @p block for each group of BATCH_WIDTH elements in the provided arrays. The last group is copied to
+		 * temporary storage and padded by repeating the last element, so the block can always read full groups.
+		 *
+		 * @param[in]	inputs		Arrays to read the elements from.
+		 * @param[in]	count		Number of elements in each of the arrays.
+		 * @param[in]	block		Function called for every group, receiving the pointers to the group's elements
+		 *							(one per input array), index of the first element in the group and number of valid
+		 *							elements in the group.
+		 */
+		template<UINT32 NumInputs, class T>
+		void forEachBlock(const float* const (&inputs)[NumInputs], UINT32 count, T block)
+		{
+			const float* blockInputs[NumInputs];
+			float padded[NumInputs][BATCH_WIDTH];
+
+			for(UINT32 i = 0; i < count; i += BATCH_WIDTH)
+			{
+				const UINT32 numValid = (count - i) < BATCH_WIDTH ? (count - i) : BATCH_WIDTH;
+				for(UINT32 j = 0; j < NumInputs; j++)
+				{
+					if(numValid == BATCH_WIDTH)
+						blockInputs[j] = inputs[j] + i;
+					else
+					{
+						for(UINT32 k = 0; k < BATCH_WIDTH; k++)
+							padded[j][k] = inputs[j][i + (k < numValid ? k : numValid - 1)];
+
+						blockInputs[j] = padded[j];
+					}
+				}
+
+				block(blockInputs, i, numValid);
+			}
+		}
+
+		/** Stores the first @p numValid elements of @p value. */
+		inline void storeBlock(float* output, const FloatN& value, UINT32 numValid)
+		{
+			if(numValid == BATCH_WIDTH)
+			{
+				store_u(output, value);
+				return;
+			}
+
+			float temp[BATCH_WIDTH];
+			store_u(temp, value);
+
+			for(UINT32 i = 0; i < numValid; i++)
+				output[i] = temp[i];
+		}
+
+		/** Stores the first @p numValid elements of the mask as booleans, true for lanes with all bits cleared. */
+		inline void storeBlockInverted(bool* output, const UIntN& mask, UINT32 numValid)
+		{
+			uint32_t temp[BATCH_WIDTH];
+			store_u(temp, mask);
+
+			for(UINT32 i = 0; i < numValid; i++)
+				output[i] = temp[i] == 0;
+		}
+
+		/** Approximates sine for values in [-pi, pi] range. Maximum error is around 6e-8. */
+		inline FloatN sinApprox(const FloatN& value)
+		{
+			const FloatN pi = splat<FloatN>(3.14159265358979f);
+			const FloatN halfPi = splat<FloatN>(1.57079632679490f);
+
+			// Reflect into [-pi/2, pi/2], where sin(x) == sin(pi - x) == sin(-pi - x)
+			FloatN x = value;
+			x = blend(sub(pi, x), x, cmp_gt(x, halfPi));
+			x = blend(sub(neg(pi), x), x, cmp_lt(x, neg(halfPi)));
+
+			// Taylor series up to x^11
+			const FloatN x2 = mul(x, x);
+			FloatN poly = splat<FloatN>(-2.5052108385e-08f);
+			poly = add(mul(poly, x2), splat<FloatN>(2.7557319224e-06f));
+			poly = add(mul(poly, x2), splat<FloatN>(-1.9841269841e-04f));
+			poly = add(mul(poly, x2), splat<FloatN>(8.3333333333e-03f));
+			poly = add(mul(poly, x2), splat<FloatN>(-1.6666666667e-01f));
+			poly = add(mul(poly, x2), splat<FloatN>(1.0f));
+
+			return mul(poly, x);
+		}
+
+		/**
+		 * Approximates arc cosine for values in [0, 1] range, using the Abramowitz & Stegun 4.4.46 polynomial. Maximum
+		 * error is around 2e-8.
+		 */
+		inline FloatN acosApprox(const FloatN& value)
+		{
+			const FloatN x = min(max(value, splat<FloatN>(0.0f)), splat<FloatN>(1.0f));
+
+			FloatN poly = splat<FloatN>(-0.0012624911f);
+			poly = add(mul(poly, x), splat<FloatN>(0.0066700901f));
+			poly = add(mul(poly, x), splat<FloatN>(-0.0170881256f));
+			poly = add(mul(poly, x), splat<FloatN>(0.0308918810f));
+			poly = add(mul(poly, x), splat<FloatN>(-0.0501743046f));
+			poly = add(mul(poly, x), splat<FloatN>(0.0889789874f));
+			poly = add(mul(poly, x), splat<FloatN>(-0.2145988016f));
+			poly = add(mul(poly, x), splat<FloatN>(1.5707963050f));
+
+			return mul(sqrt(sub(splat<FloatN>(1.0f), x)), poly);
+		}
+
+		/** Scales the quaternion so its length is one. */
+		inline void normalizeQuaternion(FloatN& x, FloatN& y, FloatN& z, FloatN& w)
+		{
+			const FloatN sqrdLength = add(add(add(mul(w, w), mul(x, x)), mul(y, y)), mul(z, z));
+			const FloatN factor = div(splat<FloatN>(1.0f), sqrt(sqrdLength));
+
+			x = mul(x, factor);
+			y = mul(y, factor);
+			z = mul(z, factor);
+			w = mul(w, factor);
+		}
+
+		/** Returns the 12 elements of the top three matrix rows, each splat across a full register. */
+		inline void splatAffineRows(const float* matrix, FloatN (&rows)[12])
+		{
+			for(UINT32 i = 0; i < 12; i++)
+				rows[i] = splat<FloatN>(matrix[i]);
+		}
+
+		/** @copydoc BatchMath::transformPoints */
+		inline void transformPoints(const float* matrix, const Vector3SoA& input, const Vector3SoA& output, UINT32 count)
+		{
+			FloatN m[12];
+			splatAffineRows(matrix, m);
+
+			const float* inputs[] = { input.x, input.y, input.z };
+			forEachBlock(inputs, count, [&m, &output](const float* const* in, UINT32 idx, UINT32 numValid)
+			{
+				const FloatN x = load_u<FloatN>(in[0]);
+				const FloatN y = load_u<FloatN>(in[1]);
+				const FloatN z = load_u<FloatN>(in[2]);
+
+				const FloatN outX = add(add(add(mul(m[0], x), mul(m[1], y)), mul(m[2], z)), m[3]);
+				const FloatN outY = add(add(add(mul(m[4], x), mul(m[5], y)), mul(m[6], z)), m[7]);
+				const FloatN outZ = add(add(add(mul(m[8], x), mul(m[9], y)), mul(m[10], z)), m[11]);
+
+				storeBlock(output.x + idx, outX, numValid);
+				storeBlock(output.y + idx, outY, numValid);
+				storeBlock(output.z + idx, outZ, numValid);
+			});
+		}
+
+		/** @copydoc BatchMath::transformAABoxes */
+		inline void transformAABoxes(const float* matrix, const AABoxSoA& input, const AABoxSoA& output, UINT32 count)
+		{
+			FloatN m[12];
+			splatAffineRows(matrix, m);
+
+			// Extents are transformed by the absolute value of the rotation/scale part
+			FloatN absM[12];
+			for(UINT32 i = 0; i < 12; i++)
+				absM[i] = abs(m[i]);
+
+			const float* inputs[] = {
+				input.center.x, input.center.y, input.center.z,
+				input.extents.x, input.extents.y, input.extents.z
+			};
+
+			forEachBlock(inputs, count, [&m, &absM, &output](const float* const* in, UINT32 idx, UINT32 numValid)
+			{
+				const FloatN cx = load_u<FloatN>(in[0]);
+				const FloatN cy = load_u<FloatN>(in[1]);
+				const FloatN cz = load_u<FloatN>(in[2]);
+				const FloatN ex = abs(load_u<FloatN>(in[3]));
+				const FloatN ey = abs(load_u<FloatN>(in[4]));
+				const FloatN ez = abs(load_u<FloatN>(in[5]));
+
+				const FloatN outCX = add(add(add(mul(m[0], cx), mul(m[1], cy)), mul(m[2], cz)), m[3]);
+				const FloatN outCY = add(add(add(mul(m[4], cx), mul(m[5], cy)), mul(m[6], cz)), m[7]);
+				const FloatN outCZ = add(add(add(mul(m[8], cx), mul(m[9], cy)), mul(m[10], cz)), m[11]);
+
+				const FloatN outEX = add(add(mul(absM[0], ex), mul(absM[1], ey)), mul(absM[2], ez));
+				const FloatN outEY = add(add(mul(absM[4], ex), mul(absM[5], ey)), mul(absM[6], ez));
+				const FloatN outEZ = add(add(mul(absM[8], ex), mul(absM[9], ey)), mul(absM[10], ez));
+
+				storeBlock(output.center.x + idx, outCX, numValid);
+				storeBlock(output.center.y + idx, outCY, numValid);
+				storeBlock(output.center.z + idx, outCZ, numValid);
+				storeBlock(output.extents.x + idx, outEX, numValid);
+				storeBlock(output.extents.y + idx, outEY, numValid);
+				storeBlock(output.extents.z + idx, outEZ, numValid);
+			});
+		}
+
+		/**
+		 * Multiplies matrices pairwise. Each output row is a linear combination of the right hand side rows, so a single
+		 * matrix is processed at a time, one row per register.
+		 *
+		 * @param[in]	lhs			Matrices on the left side of the multiplication.
+		 * @param[in]	lhsStride	Number of floats between two consecutive left side matrices. Zero if the same matrix
+		 *							is used for all multiplications.
+		 * @param[in]	rhs			Matrices on the right side of the multiplication.
+		 * @param[out]	output		Resulting matrices.
+		 * @param[in]	count		Number of matrices to output.
+		 */
+		inline void multiply(const float* lhs, UINT32 lhsStride, const float* rhs, float* output, UINT32 count)
+		{
+			for(UINT32 i = 0; i < count; i++)
+			{
+				const float* a = lhs + i * lhsStride;
+				const float* b = rhs + i * 16;
+				float* out = output + i * 16;
+
+				const float32x4 row0 = load_u<float32x4>(b + 0);
+				const float32x4 row1 = load_u<float32x4>(b + 4);
+				const float32x4 row2 = load_u<float32x4>(b + 8);
+				const float32x4 row3 = load_u<float32x4>(b + 12);
+
+				// Read all of the left side first, in case it is the same as the output
+				float32x4 lhsRows[4][4];
+				for(UINT32 j = 0; j < 4; j++)
+				{
+					for(UINT32 k = 0; k < 4; k++)
+						lhsRows[j][k] = splat<float32x4>(a[j * 4 + k]);
+				}
+
+				for(UINT32 j = 0; j < 4; j++)
+				{
+					const float32x4 result = add(add(add(
+						mul(lhsRows[j][0], row0),
+						mul(lhsRows[j][1], row1)),
+						mul(lhsRows[j][2], row2)),
+						mul(lhsRows[j][3], row3));
+
+					store_u(out + j * 4, result);
+				}
+			}
+		}
+
+		/** @copydoc BatchMath::composeTRS */
+		inline void composeTRS(const Vector3SoA& translations, const QuaternionSoA& rotations, const Vector3SoA& scales,
+			float* output, UINT32 count)
+		{
+			const float* inputs[] = {
+				translations.x, translations.y, translations.z,
+				rotations.x, rotations.y, rotations.z, rotations.w,
+				scales.x, scales.y, scales.z
+			};
+
+			forEachBlock(inputs, count, [output](const float* const* in, UINT32 idx, UINT32 numValid)
+			{
+				const FloatN qx = load_u<FloatN>(in[3]);
+				const FloatN qy = load_u<FloatN>(in[4]);
+				const FloatN qz = load_u<FloatN>(in[5]);
+				const FloatN qw = load_u<FloatN>(in[6]);
+
+				const FloatN sx = load_u<FloatN>(in[7]);
+				const FloatN sy = load_u<FloatN>(in[8]);
+				const FloatN sz = load_u<FloatN>(in[9]);
+
+				// Same as Quaternion::toRotationMatrix()
+				const FloatN tx = add(qx, qx);
+				const FloatN ty = add(qy, qy);
+				const FloatN tz = add(qz, qz);
+				const FloatN twx = mul(tx, qw);
+				const FloatN twy = mul(ty, qw);
+				const FloatN twz = mul(tz, qw);
+				const FloatN txx = mul(tx, qx);
+				const FloatN txy = mul(ty, qx);
+				const FloatN txz = mul(tz, qx);
+				const FloatN tyy = mul(ty, qy);
+				const FloatN tyz = mul(tz, qy);
+				const FloatN tzz = mul(tz, qz);
+				const FloatN one = splat<FloatN>(1.0f);
+
+				// Top three rows of each matrix, component by component
+				FloatN elements[12];
+				elements[0] = mul(sx, sub(one, add(tyy, tzz)));
+				elements[1] = mul(sy, sub(txy, twz));
+				elements[2] = mul(sz, add(txz, twy));
+				elements[3] = load_u<FloatN>(in[0]);
+				elements[4] = mul(sx, add(txy, twz));
+				elements[5] = mul(sy, sub(one, add(txx, tzz)));
+				elements[6] = mul(sz, sub(tyz, twx));
+				elements[7] = load_u<FloatN>(in[1]);
+				elements[8] = mul(sx, sub(txz, twy));
+				elements[9] = mul(sy, add(tyz, twx));
+				elements[10] = mul(sz, sub(one, add(txx, tyy)));
+				elements[11] = load_u<FloatN>(in[2]);
+
+				float soa[12][BATCH_WIDTH];
+				for(UINT32 i = 0; i < 12; i++)
+					store_u(soa[i], elements[i]);
+
+				// Transpose groups of four matrices at once, from one register per element to one register per row
+				for(UINT32 group = 0; group < numValid; group += 4)
+				{
+					for(UINT32 row = 0; row < 3; row++)
+					{
+						float32x4 columns[4];
+						for(UINT32 i = 0; i < 4; i++)
+							columns[i] = load_u<float32x4>(&soa[row * 4 + i][group]);
+
+						transpose4(columns[0], columns[1], columns[2], columns[3]);
+
+						for(UINT32 i = 0; i < 4 && (group + i) < numValid; i++)
+							store_u(output + (idx + group + i) * 16 + row * 4, columns[i]);
+					}
+				}
+
+				// No projection term
+				const float32x4 lastRow = make_float(0.0f, 0.0f, 0.0f, 1.0f);
+				for(UINT32 i = 0; i < numValid; i++)
+					store_u(output + (idx + i) * 16 + 12, lastRow);
+			});
+		}
+
+		/** @copydoc BatchMath::slerp */
+		inline void slerp(const float* t, const QuaternionSoA& from, const QuaternionSoA& to, const QuaternionSoA& output,
+			UINT32 count)
+		{
+			const float* inputs[] = { t, from.x, from.y, from.z, from.w, to.x, to.y, to.z, to.w };
+			forEachBlock(inputs, count, [&output](const float* const* in, UINT32 idx, UINT32 numValid)
+			{
+				const FloatN factor = load_u<FloatN>(in[0]);
+				const FloatN ax = load_u<FloatN>(in[1]);
+				const FloatN ay = load_u<FloatN>(in[2]);
+				const FloatN az = load_u<FloatN>(in[3]);
+				const FloatN aw = load_u<FloatN>(in[4]);
+				FloatN bx = load_u<FloatN>(in[5]);
+				FloatN by = load_u<FloatN>(in[6]);
+				FloatN bz = load_u<FloatN>(in[7]);
+				FloatN bw = load_u<FloatN>(in[8]);
+
+				FloatN cos = add(add(add(mul(aw, bw), mul(ax, bx)), mul(ay, by)), mul(az, bz));
+
+				// Take the shortest path
+				const auto flip = cmp_lt(cos, splat<FloatN>(0.0f));
+				cos = abs(cos);
+				bx = blend(neg(bx), bx, flip);
+				by = blend(neg(by), by, flip);
+				bz = blend(neg(bz), bz, flip);
+				bw = blend(neg(bw), bw, flip);
+
+				const FloatN one = splat<FloatN>(1.0f);
+				const FloatN invFactor = sub(one, factor);
+
+				// Standard case (slerp). Lanes that are too close for it have their results discarded below.
+				const FloatN sin = sqrt(max(sub(one, mul(cos, cos)), splat<FloatN>(0.0f)));
+				const FloatN angle = acosApprox(cos);
+				const FloatN invSin = div(one, sin);
+				const FloatN coeff0 = mul(sinApprox(mul(invFactor, angle)), invSin);
+				const FloatN coeff1 = mul(sinApprox(mul(factor, angle)), invSin);
+
+				// Quaternions very close (or opposite), use linear interpolation
+				FloatN lx = add(mul(invFactor, ax), mul(factor, bx));
+				FloatN ly = add(mul(invFactor, ay), mul(factor, by));
+				FloatN lz = add(mul(invFactor, az), mul(factor, bz));
+				FloatN lw = add(mul(invFactor, aw), mul(factor, bw));
+				normalizeQuaternion(lx, ly, lz, lw);
+
+				const auto useSlerp = cmp_lt(cos, splat<FloatN>(SLERP_THRESHOLD));
+				const FloatN outX = blend(add(mul(coeff0, ax), mul(coeff1, bx)), lx, useSlerp);
+				const FloatN outY = blend(add(mul(coeff0, ay), mul(coeff1, by)), ly, useSlerp);
+				const FloatN outZ = blend(add(mul(coeff0, az), mul(coeff1, bz)), lz, useSlerp);
+				const FloatN outW = blend(add(mul(coeff0, aw), mul(coeff1, bw)), lw, useSlerp);
+
+				storeBlock(output.x + idx, outX, numValid);
+				storeBlock(output.y + idx, outY, numValid);
+				storeBlock(output.z + idx, outZ, numValid);
+				storeBlock(output.w + idx, outW, numValid);
+			});
+		}
+
+		/** @copydoc BatchMath::nlerp */
+		inline void nlerp(const float* t, const QuaternionSoA& from, const QuaternionSoA& to, const QuaternionSoA& output,
+			UINT32 count)
+		{
+			const float* inputs[] = { t, from.x, from.y, from.z, from.w, to.x, to.y, to.z, to.w };
+			forEachBlock(inputs, count, [&output](const float* const* in, UINT32 idx, UINT32 numValid)
+			{
+				const FloatN factor = load_u<FloatN>(in[0]);
+				const FloatN ax = load_u<FloatN>(in[1]);
+				const FloatN ay = load_u<FloatN>(in[2]);
+				const FloatN az = load_u<FloatN>(in[3]);
+				const FloatN aw = load_u<FloatN>(in[4]);
+				const FloatN bx = load_u<FloatN>(in[5]);
+				const FloatN by = load_u<FloatN>(in[6]);
+				const FloatN bz = load_u<FloatN>(in[7]);
+				const FloatN bw = load_u<FloatN>(in[8]);
+
+				// Same as Quaternion::lerp(), which flips the source quaternion to take the shortest path
+				const FloatN dot = add(add(add(mul(aw, bw), mul(ax, bx)), mul(ay, by)), mul(az, bz));
+				const FloatN invFactor = sub(splat<FloatN>(1.0f), factor);
+				const FloatN fromFactor = blend(invFactor, neg(invFactor), cmp_ge(dot, splat<FloatN>(0.0f)));
+
+				FloatN x = add(mul(fromFactor, ax), mul(factor, bx));
+				FloatN y = add(mul(fromFactor, ay), mul(factor, by));
+				FloatN z = add(mul(fromFactor, az), mul(factor, bz));
+				FloatN w = add(mul(fromFactor, aw), mul(factor, bw));
+				normalizeQuaternion(x, y, z, w);
+
+				storeBlock(output.x + idx, x, numValid);
+				storeBlock(output.y + idx, y, numValid);
+				storeBlock(output.z + idx, z, numValid);
+				storeBlock(output.w + idx, w, numValid);
+			});
+		}
+
+		/** Tests spheres against the provided planes. See BatchMath::intersects(const ConvexVolume&, const SphereSoA&). */
+		inline void intersectsSpheres(const float* planes, UINT32 numPlanes, const SphereSoA& spheres, bool* output,
+			UINT32 count)
+		{
+			const float* inputs[] = { spheres.center.x, spheres.center.y, spheres.center.z, spheres.radius };
+			forEachBlock(inputs, count, [planes, numPlanes, output](const float* const* in, UINT32 idx, UINT32 numValid)
+			{
+				const FloatN cx = load_u<FloatN>(in[0]);
+				const FloatN cy = load_u<FloatN>(in[1]);
+				const FloatN cz = load_u<FloatN>(in[2]);
+				const FloatN negRadius = neg(load_u<FloatN>(in[3]));
+
+				UIntN outside = splat<UIntN>(0);
+				for(UINT32 i = 0; i < numPlanes; i++)
+				{
+					const float* plane = planes + i * 4;
+					const FloatN dist = sub(add(add(
+						mul(cx, splat<FloatN>(plane[0])),
+						mul(cy, splat<FloatN>(plane[1]))),
+						mul(cz, splat<FloatN>(plane[2]))),
+						splat<FloatN>(plane[3]));
+
+					outside = bit_or(outside, bit_cast<UIntN>(cmp_lt(dist, negRadius)));
+				}
+
+				storeBlockInverted(output + idx, outside, numValid);
+			});
+		}
+
+		/** Tests boxes against the provided planes. See BatchMath::intersects(const ConvexVolume&, const AABoxSoA&). */
+		inline void intersectsAABoxes(const float* planes, UINT32 numPlanes, const AABoxSoA& boxes, bool* output,
+			UINT32 count)
+		{
+			const float* inputs[] = {
+				boxes.center.x, boxes.center.y, boxes.center.z,
+				boxes.extents.x, boxes.extents.y, boxes.extents.z
+			};
+
+			forEachBlock(inputs, count, [planes, numPlanes, output](const float* const* in, UINT32 idx, UINT32 numValid)
+			{
+				const FloatN cx = load_u<FloatN>(in[0]);
+				const FloatN cy = load_u<FloatN>(in[1]);
+				const FloatN cz = load_u<FloatN>(in[2]);
+				const FloatN ex = abs(load_u<FloatN>(in[3]));
+				const FloatN ey = abs(load_u<FloatN>(in[4]));
+				const FloatN ez = abs(load_u<FloatN>(in[5]));
+
+				UIntN outside = splat<UIntN>(0);
+				for(UINT32 i = 0; i < numPlanes; i++)
+				{
+					const float* plane = planes + i * 4;
+					const FloatN nx = splat<FloatN>(plane[0]);
+					const FloatN ny = splat<FloatN>(plane[1]);
+					const FloatN nz = splat<FloatN>(plane[2]);
+
+					const FloatN dist = sub(add(add(mul(cx, nx), mul(cy, ny)), mul(cz, nz)), splat<FloatN>(plane[3]));
+					const FloatN effectiveRadius = add(add(mul(ex, abs(nx)), mul(ey, abs(ny))), mul(ez, abs(nz)));
+
+					outside = bit_or(outside, bit_cast<UIntN>(cmp_lt(dist, neg(effectiveRadius))));
+				}
+
+				storeBlockInverted(output + idx, outside, numValid);
+			});
+		}
+
+		/** Returns the table of operations compiled for the current instruction set. */
+		inline BatchMathKernels getBatchMathKernels()
+		{
+			BatchMathKernels kernels;
+			kernels.transformPoints = &transformPoints;
+			kernels.transformAABoxes = &transformAABoxes;
+			kernels.multiply = &multiply;
+			kernels.composeTRS = &composeTRS;
+			kernels.slerp = &slerp;
+			kernels.nlerp = &nlerp;
+			kernels.intersectsSpheres = &intersectsSpheres;
+			kernels.intersectsAABoxes = &intersectsAABoxes;
+
+			return kernels;
+		}
+
+		/** @} */
+	}
+}
+
+#endif
@@ -126,6 +126,7 @@ namespace bs
 	class Ray;
 	class Capsule;
 	class Sphere;
+	class ConvexVolume;
 	class Vector2;
 	class Vector3;
 	class Vector4;
@@ -139,10 +140,13 @@ namespace bs
 	class DataStream;
 	class MemoryDataStream;
 	class FileDataStream;
+	class MappedFileDataStream;
+	class PositionalFileReader;
 	class MeshData;
 	class FileSystem;
 	class Timer;
 	class Task;
+	class BoundedTaskQueue;
 	class GpuResourceData;
 	class PixelData;
 	class HString;
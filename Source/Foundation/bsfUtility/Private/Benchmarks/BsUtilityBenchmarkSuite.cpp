@@ -0,0 +1,468 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Private/Benchmarks/BsUtilityBenchmarkSuite.h"
+#include "Allocators/BsFrameAlloc.h"
+#include "Allocators/BsPoolAlloc.h"
+#include "Allocators/BsStackAlloc.h"
+#include "Threading/BsTaskScheduler.h"
+#include "Math/BsBatchMath.h"
+#include "Math/BsMatrix4.h"
+#include "Math/BsQuaternion.h"
+#include "Math/BsAABox.h"
+#include "Math/BsConvexVolume.h"
+#include "Math/BsRandom.h"
+#include "Utility/BsCompression.h"
+#include "FileSystem/BsDataStream.h"
+#include "Debug/BsLog.h"
+
+namespace bs
+{
+	/** Number of allocations performed by a single iteration of the allocator benchmarks. */
+	static constexpr UINT32 NUM_ALLOCATIONS = 256;
+
+	/** Size of a single allocation in the allocator benchmarks, in bytes. */
+	static constexpr UINT32 ALLOCATION_SIZE = 64;
+
+	/** Number of work items executed by a single iteration of the task benchmarks. */
+	static constexpr UINT32 NUM_TASK_ITEMS = 64;
+
+	/** Number of elements processed by a single iteration of the math benchmarks. */
+	static constexpr UINT32 NUM_MATH_ELEMENTS = 4096;
+
+	/** Size of the data compressed by a single iteration of the compression benchmarks, in bytes. */
+	static constexpr UINT32 COMPRESSION_DATA_SIZE = 4 * 1024 * 1024;
+
+	/** Number of threads logging at the same time in the log contention benchmarks. */
+	static constexpr UINT32 NUM_LOG_THREADS = 16;
+
+	/** Number of messages logged by each thread in a single iteration of the log contention benchmarks. */
+	static constexpr UINT32 NUM_LOG_MESSAGES = 1024;
+
+	/** Transforms and bounds in structure-of-arrays layout, shared by the scalar and batch math benchmarks. */
+	struct MathBenchmarkData
+	{
+		MathBenchmarkData()
+		{
+			for(auto* array : { &tx, &ty, &tz, &rx, &ry, &rz, &rw, &sx, &sy, &sz, &cx, &cy, &cz, &ex, &ey, &ez })
+				array->resize(NUM_MATH_ELEMENTS);
+
+			Random random(1234);
+			for(UINT32 i = 0; i < NUM_MATH_ELEMENTS; i++)
+			{
+				const Vector3 translation = random.getUnitVector() * 100.0f;
+				const Quaternion rotation(random.getUnitVector(), Radian(random.getSNorm() * Math::PI));
+				const float scale = 0.5f + random.getUNorm();
+
+				tx[i] = translation.x; ty[i] = translation.y; tz[i] = translation.z;
+				rx[i] = rotation.x; ry[i] = rotation.y; rz[i] = rotation.z; rw[i] = rotation.w;
+				sx[i] = scale; sy[i] = scale; sz[i] = scale;
+
+				cx[i] = random.getSNorm() * 150.0f; cy[i] = random.getSNorm() * 150.0f; cz[i] = random.getSNorm() * 150.0f;
+				ex[i] = random.getUNorm() * 10.0f; ey[i] = random.getUNorm() * 10.0f; ez[i] = random.getUNorm() * 10.0f;
+			}
+		}
+
+		Vector<float> tx, ty, tz, rx, ry, rz, rw, sx, sy, sz;
+		Vector<float> cx, cy, cz, ex, ey, ez;
+		ConvexVolume frustum = ConvexVolume(Matrix4::projectionPerspective(Degree(90.0f), 1.0f, 1.0f, 100.0f));
+	};
+
+	/** Performs a small amount of work on behalf of a task, so the benchmark doesn't only measure synchronization. */
+	static UINT32 doTaskWork(UINT32 seed)
+	{
+		UINT32 value = seed;
+		for(UINT32 i = 0; i < 1024; i++)
+			value = value * 1664525 + 1013904223;
+
+		return value;
+	}
+
+	/** 
+	 * Creates data resembling serialized vertex data: smoothly varying floats with quantization noise, followed by runs
+	 * of repeated values.
+	 */
+	static Vector<UINT8> createCompressionData()
+	{
+		Vector<UINT8> data(COMPRESSION_DATA_SIZE);
+
+		Random random(1234);
+		const UINT32 numFloats = COMPRESSION_DATA_SIZE / 2 / sizeof(float);
+		float* floats = (float*)data.data();
+		for(UINT32 i = 0; i < numFloats; i++)
+			floats[i] = Math::round((Math::sin(i * 0.01f) + random.getSNorm() * 0.01f) * 1024.0f) / 1024.0f;
+
+		for(UINT32 i = numFloats * sizeof(float); i < COMPRESSION_DATA_SIZE; i++)
+			data[i] = (UINT8)((i / 64) % 7);
+
+		return data;
+	}
+
+	/** Measures compression of the benchmark data using the specified method. Skipped if the method isn't available. */
+	static void benchCompress(Benchmark& bench, CompressionMethod method)
+	{
+		if(!Compression::isSupported(method))
+			return;
+
+		Vector<UINT8> data = createCompressionData();
+
+		// Uncompressed size divided by the compressed size
+		SPtr<DataStream> input = bs_shared_ptr_new<MemoryDataStream>(data.data(), data.size(), false);
+		SPtr<MemoryDataStream> compressed = Compression::compress(input, method);
+		bench.setCounter("ratio", COMPRESSION_DATA_SIZE / (double)std::max(compressed->size(), (size_t)1));
+
+		bench.setItemsPerIteration(COMPRESSION_DATA_SIZE);
+		bench.measure([&data, method]()
+		{
+			SPtr<DataStream> input = bs_shared_ptr_new<MemoryDataStream>(data.data(), data.size(), false);
+			SPtr<MemoryDataStream> output = Compression::compress(input, method);
+			Benchmark::doNotOptimize(output);
+		});
+	}
+
+	/** Measures decompression of the benchmark data using the specified method. Skipped if the method isn't available. */
+	static void benchDecompress(Benchmark& bench, CompressionMethod method)
+	{
+		if(!Compression::isSupported(method))
+			return;
+
+		Vector<UINT8> data = createCompressionData();
+		SPtr<DataStream> input = bs_shared_ptr_new<MemoryDataStream>(data.data(), data.size(), false);
+		SPtr<MemoryDataStream> compressed = Compression::compress(input, method);
+		bench.setCounter("ratio", COMPRESSION_DATA_SIZE / (double)std::max(compressed->size(), (size_t)1));
+
+		bench.setItemsPerIteration(COMPRESSION_DATA_SIZE);
+		bench.measure([&compressed, method]()
+		{
+			SPtr<DataStream> input = bs_shared_ptr_new<MemoryDataStream>(compressed->getPtr(), compressed->size(), false);
+			SPtr<MemoryDataStream> output = Compression::decompress(input, method);
+			Benchmark::doNotOptimize(output);
+		});
+	}
+
+	/** Log sink that discards all entries, so the log contention benchmarks only measure the log itself. */
+	class NullLogSink : public LogSink
+	{
+	public:
+		void write(const LogEntry& entry) override { }
+	};
+
+	/** 
+	 * Measures logging from many threads at once. Messages are pre-formatted so only the log is measured. The default
+	 * retention limit keeps the log from growing between iterations.
+	 */
+	static void benchLog(Benchmark& bench, bool async)
+	{
+		Log log;
+		log.addSink(bs_shared_ptr_new<NullLogSink>());
+
+		if(async)
+			log.startAsync();
+
+		Vector<String> messages;
+		for(UINT32 i = 0; i < NUM_LOG_MESSAGES; i++)
+			messages.push_back("Benchmark message " + toString(i));
+
+		bench.setItemsPerIteration(NUM_LOG_THREADS * NUM_LOG_MESSAGES);
+		bench.measure([&log, &messages]()
+		{
+			Vector<Thread> threads;
+			for(UINT32 i = 0; i < NUM_LOG_THREADS; i++)
+			{
+				threads.push_back(Thread([&log, &messages, i]()
+				{
+					for(auto& message : messages)
+						log.logMsg(message, i);
+				}));
+			}
+
+			for(auto& thread : threads)
+				thread.join();
+
+			// Includes the time the background thread needs to catch up
+			log.flush();
+		});
+
+		if(async)
+			log.stopAsync();
+	}
+
+	UtilityBenchmarkSuite::UtilityBenchmarkSuite()
+	{
+		BS_ADD_BENCHMARK(UtilityBenchmarkSuite::benchGeneralAlloc)
+		BS_ADD_BENCHMARK(UtilityBenchmarkSuite::benchFrameAlloc)
+		BS_ADD_BENCHMARK(UtilityBenchmarkSuite::benchPoolAlloc)
+		BS_ADD_BENCHMARK(UtilityBenchmarkSuite::benchStackAlloc)
+		BS_ADD_BENCHMARK(UtilityBenchmarkSuite::benchTaskGroup)
+		BS_ADD_BENCHMARK(UtilityBenchmarkSuite::benchTaskDependencies)
+		BS_ADD_BENCHMARK(UtilityBenchmarkSuite::benchBoundedTaskQueue)
+		BS_ADD_BENCHMARK(UtilityBenchmarkSuite::benchComposeTRS)
+		BS_ADD_BENCHMARK(UtilityBenchmarkSuite::benchBatchComposeTRS)
+		BS_ADD_BENCHMARK(UtilityBenchmarkSuite::benchCullAABoxes)
+		BS_ADD_BENCHMARK(UtilityBenchmarkSuite::benchBatchCullAABoxes)
+		BS_ADD_BENCHMARK(UtilityBenchmarkSuite::benchCompressSnappy)
+		BS_ADD_BENCHMARK(UtilityBenchmarkSuite::benchCompressLZ4)
+		BS_ADD_BENCHMARK(UtilityBenchmarkSuite::benchCompressZstd)
+		BS_ADD_BENCHMARK(UtilityBenchmarkSuite::benchDecompressSnappy)
+		BS_ADD_BENCHMARK(UtilityBenchmarkSuite::benchDecompressLZ4)
+		BS_ADD_BENCHMARK(UtilityBenchmarkSuite::benchDecompressZstd)
+		BS_ADD_BENCHMARK(UtilityBenchmarkSuite::benchLogContention)
+		BS_ADD_BENCHMARK(UtilityBenchmarkSuite::benchLogContentionSync)
+	}
+
+	void UtilityBenchmarkSuite::benchGeneralAlloc(Benchmark& bench)
+	{
+		void* allocations[NUM_ALLOCATIONS];
+
+		bench.setItemsPerIteration(NUM_ALLOCATIONS);
+		bench.measure([&allocations]()
+		{
+			for(UINT32 i = 0; i < NUM_ALLOCATIONS; i++)
+			{
+				allocations[i] = bs_alloc(ALLOCATION_SIZE);
+				Benchmark::doNotOptimize(allocations[i]);
+			}
+
+			for(UINT32 i = 0; i < NUM_ALLOCATIONS; i++)
+				bs_free(allocations[i]);
+		});
+	}
+
+	void UtilityBenchmarkSuite::benchFrameAlloc(Benchmark& bench)
+	{
+		FrameAlloc frameAlloc;
+		UINT8* allocations[NUM_ALLOCATIONS];
+
+		bench.setItemsPerIteration(NUM_ALLOCATIONS);
+		bench.measure([&frameAlloc, &allocations]()
+		{
+			for(UINT32 i = 0; i < NUM_ALLOCATIONS; i++)
+			{
+				allocations[i] = frameAlloc.alloc(ALLOCATION_SIZE);
+				Benchmark::doNotOptimize(allocations[i]);
+			}
+
+			// Only tracked in debug builds, but required before clear()
+			for(UINT32 i = 0; i < NUM_ALLOCATIONS; i++)
+				frameAlloc.free(allocations[i]);
+
+			frameAlloc.clear();
+		});
+	}
+
+	void UtilityBenchmarkSuite::benchPoolAlloc(Benchmark& bench)
+	{
+		PoolAlloc<ALLOCATION_SIZE> poolAlloc;
+		UINT8* allocations[NUM_ALLOCATIONS];
+
+		bench.setItemsPerIteration(NUM_ALLOCATIONS);
+		bench.measure([&poolAlloc, &allocations]()
+		{
+			for(UINT32 i = 0; i < NUM_ALLOCATIONS; i++)
+			{
+				allocations[i] = poolAlloc.alloc();
+				Benchmark::doNotOptimize(allocations[i]);
+			}
+
+			for(UINT32 i = 0; i < NUM_ALLOCATIONS; i++)
+				poolAlloc.free(allocations[i]);
+		});
+	}
+
+	void UtilityBenchmarkSuite::benchStackAlloc(Benchmark& bench)
+	{
+		void* allocations[NUM_ALLOCATIONS];
+
+		bench.setItemsPerIteration(NUM_ALLOCATIONS);
+		bench.measure([&allocations]()
+		{
+			for(UINT32 i = 0; i < NUM_ALLOCATIONS; i++)
+			{
+				allocations[i] = bs_stack_alloc(ALLOCATION_SIZE);
+				Benchmark::doNotOptimize(allocations[i]);
+			}
+
+			// Stack allocations must be freed in reverse order
+			for(INT32 i = NUM_ALLOCATIONS - 1; i >= 0; i--)
+				bs_stack_free(allocations[i]);
+		});
+	}
+
+	void UtilityBenchmarkSuite::benchTaskGroup(Benchmark& bench)
+	{
+		UINT32 results[NUM_TASK_ITEMS];
+
+		bench.setItemsPerIteration(NUM_TASK_ITEMS);
+		bench.measure([&results]()
+		{
+			SPtr<TaskGroup> taskGroup = TaskGroup::create("BenchTaskGroup", [&results](UINT32 idx)
+			{
+				results[idx] = doTaskWork(idx);
+			}, NUM_TASK_ITEMS);
+
+			TaskScheduler::instance().addTaskGroup(taskGroup);
+			taskGroup->wait();
+
+			Benchmark::doNotOptimize(results);
+		});
+	}
+
+	void UtilityBenchmarkSuite::benchTaskDependencies(Benchmark& bench)
+	{
+		UINT32 results[NUM_TASK_ITEMS];
+
+		// Each task depends on the previous one, measuring the latency of scheduling dependent work
+		bench.setItemsPerIteration(NUM_TASK_ITEMS);
+		bench.measure([&results]()
+		{
+			SPtr<Task> previous;
+			for(UINT32 i = 0; i < NUM_TASK_ITEMS; i++)
+			{
+				SPtr<Task> task = Task::create("BenchTaskChain", [&results, i]()
+				{
+					results[i] = doTaskWork(i);
+				}, TaskPriority::Normal, previous);
+
+				TaskScheduler::instance().addTask(task);
+				previous = task;
+			}
+
+			previous->wait();
+			Benchmark::doNotOptimize(results);
+		});
+	}
+
+	void UtilityBenchmarkSuite::benchBoundedTaskQueue(Benchmark& bench)
+	{
+		UINT32 results[NUM_TASK_ITEMS];
+		BoundedTaskQueue queue("BenchTaskQueue", 4);
+
+		bench.setItemsPerIteration(NUM_TASK_ITEMS);
+		bench.measure([&results, &queue]()
+		{
+			for(UINT32 i = 0; i < NUM_TASK_ITEMS; i++)
+				queue.push([&results, i]() { results[i] = doTaskWork(i); });
+
+			queue.waitUntilEmpty();
+			Benchmark::doNotOptimize(results);
+		});
+	}
+
+	void UtilityBenchmarkSuite::benchComposeTRS(Benchmark& bench)
+	{
+		MathBenchmarkData data;
+		Vector<Matrix4> output(NUM_MATH_ELEMENTS);
+
+		bench.setItemsPerIteration(NUM_MATH_ELEMENTS);
+		bench.measure([&data, &output]()
+		{
+			for(UINT32 i = 0; i < NUM_MATH_ELEMENTS; i++)
+			{
+				output[i].setTRS(
+					Vector3(data.tx[i], data.ty[i], data.tz[i]),
+					Quaternion(data.rw[i], data.rx[i], data.ry[i], data.rz[i]),
+					Vector3(data.sx[i], data.sy[i], data.sz[i]));
+			}
+
+			Benchmark::doNotOptimize(output[0]);
+		});
+	}
+
+	void UtilityBenchmarkSuite::benchBatchComposeTRS(Benchmark& bench)
+	{
+		MathBenchmarkData data;
+		Vector<Matrix4> output(NUM_MATH_ELEMENTS);
+
+		Vector3SoA translations;
+		translations.x = data.tx.data(); translations.y = data.ty.data(); translations.z = data.tz.data();
+
+		QuaternionSoA rotations;
+		rotations.x = data.rx.data(); rotations.y = data.ry.data(); rotations.z = data.rz.data(); rotations.w = data.rw.data();
+
+		Vector3SoA scales;
+		scales.x = data.sx.data(); scales.y = data.sy.data(); scales.z = data.sz.data();
+
+		bench.setItemsPerIteration(NUM_MATH_ELEMENTS);
+		bench.measure([&translations, &rotations, &scales, &output]()
+		{
+			BatchMath::composeTRS(translations, rotations, scales, output.data(), NUM_MATH_ELEMENTS);
+			Benchmark::doNotOptimize(output[0]);
+		});
+	}
+
+	void UtilityBenchmarkSuite::benchCullAABoxes(Benchmark& bench)
+	{
+		MathBenchmarkData data;
+		Vector<bool> output(NUM_MATH_ELEMENTS);
+
+		bench.setItemsPerIteration(NUM_MATH_ELEMENTS);
+		bench.measure([&data, &output]()
+		{
+			for(UINT32 i = 0; i < NUM_MATH_ELEMENTS; i++)
+			{
+				const Vector3 center(data.cx[i], data.cy[i], data.cz[i]);
+				const Vector3 extents(data.ex[i], data.ey[i], data.ez[i]);
+
+				output[i] = data.frustum.intersects(AABox(center - extents, center + extents));
+			}
+
+			Benchmark::doNotOptimize(output);
+		});
+	}
+
+	void UtilityBenchmarkSuite::benchBatchCullAABoxes(Benchmark& bench)
+	{
+		MathBenchmarkData data;
+		bool output[NUM_MATH_ELEMENTS];
+
+		AABoxSoA boxes;
+		boxes.center.x = data.cx.data(); boxes.center.y = data.cy.data(); boxes.center.z = data.cz.data();
+		boxes.extents.x = data.ex.data(); boxes.extents.y = data.ey.data(); boxes.extents.z = data.ez.data();
+
+		bench.setItemsPerIteration(NUM_MATH_ELEMENTS);
+		bench.measure([&data, &boxes, &output]()
+		{
+			BatchMath::intersects(data.frustum, boxes, output, NUM_MATH_ELEMENTS);
+			Benchmark::doNotOptimize(output);
+		});
+	}
+
+	void UtilityBenchmarkSuite::benchCompressSnappy(Benchmark& bench)
+	{
+		benchCompress(bench, CompressionMethod::Snappy);
+	}
+
+	void UtilityBenchmarkSuite::benchCompressLZ4(Benchmark& bench)
+	{
+		benchCompress(bench, CompressionMethod::LZ4);
+	}
+
+	void UtilityBenchmarkSuite::benchCompressZstd(Benchmark& bench)
+	{
+		benchCompress(bench, CompressionMethod::Zstd);
+	}
+
+	void UtilityBenchmarkSuite::benchDecompressSnappy(Benchmark& bench)
+	{
+		benchDecompress(bench, CompressionMethod::Snappy);
+	}
+
+	void UtilityBenchmarkSuite::benchDecompressLZ4(Benchmark& bench)
+	{
+		benchDecompress(bench, CompressionMethod::LZ4);
+	}
+
+	void UtilityBenchmarkSuite::benchDecompressZstd(Benchmark& bench)
+	{
+		benchDecompress(bench, CompressionMethod::Zstd);
+	}
+
+	void UtilityBenchmarkSuite::benchLogContention(Benchmark& bench)
+	{
+		benchLog(bench, true);
+	}
+
+	void UtilityBenchmarkSuite::benchLogContentionSync(Benchmark& bench)
+	{
+		benchLog(bench, false);
+	}
+}
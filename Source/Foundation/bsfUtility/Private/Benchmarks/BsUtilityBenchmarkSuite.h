@@ -0,0 +1,35 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "Testing/BsBenchmark.h"
+
+namespace bs
+{
+	class UtilityBenchmarkSuite : public BenchmarkSuite
+	{
+	public:
+		UtilityBenchmarkSuite();
+
+	private:
+		void benchGeneralAlloc(Benchmark& bench);
+		void benchFrameAlloc(Benchmark& bench);
+		void benchPoolAlloc(Benchmark& bench);
+		void benchStackAlloc(Benchmark& bench);
+		void benchTaskGroup(Benchmark& bench);
+		void benchTaskDependencies(Benchmark& bench);
+		void benchBoundedTaskQueue(Benchmark& bench);
+		void benchComposeTRS(Benchmark& bench);
+		void benchBatchComposeTRS(Benchmark& bench);
+		void benchCullAABoxes(Benchmark& bench);
+		void benchBatchCullAABoxes(Benchmark& bench);
+		void benchCompressSnappy(Benchmark& bench);
+		void benchCompressLZ4(Benchmark& bench);
+		void benchCompressZstd(Benchmark& bench);
+		void benchDecompressSnappy(Benchmark& bench);
+		void benchDecompressLZ4(Benchmark& bench);
+		void benchDecompressZstd(Benchmark& bench);
+		void benchLogContention(Benchmark& bench);
+		void benchLogContentionSync(Benchmark& bench);
+	};
+}
@@ -5,6 +5,8 @@
 #include "Debug/BsDebug.h"
 #include "Error/BsException.h"
 #include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+#include "Threading/BsThreading.h"
 
 #include <algorithm>
 #include <fstream>
@@ -84,6 +86,8 @@ namespace bs
 		BS_ADD_TEST(FileSystemTestSuite::testGetChildren);
 		BS_ADD_TEST(FileSystemTestSuite::testGetLastModifiedTime);
 		BS_ADD_TEST(FileSystemTestSuite::testGetTempDirectoryPath);
+		BS_ADD_TEST(FileSystemTestSuite::testOpenFile_mapped);
+		BS_ADD_TEST(FileSystemTestSuite::testPositionalFileReader);
 	}
 
 	void FileSystemTestSuite::testExists_yes_file()
@@ -299,4 +303,102 @@ namespace bs
 		/* No judging. */
 		BS_TEST_ASSERT(!path.toString().empty());
 	}
+
+	void FileSystemTestSuite::testOpenFile_mapped()
+	{
+		Path path = mTestDirectory + "mapped-file";
+
+		String content;
+		for (UINT32 i = 0; i < (UINT32)MappedFileDataStream::MIN_MAPPED_FILE_SIZE; i++)
+			content += (char)('a' + (i % 26));
+
+		createFile(path, content);
+
+		SPtr<DataStream> stream = FileSystem::openFile(path, true);
+		BS_TEST_ASSERT(stream->isMapped());
+		BS_TEST_ASSERT(!stream->isFile());
+		BS_TEST_ASSERT(stream->size() == content.size());
+
+		char buffer[4];
+		stream->seek(26);
+		BS_TEST_ASSERT(stream->read(buffer, sizeof(buffer)) == sizeof(buffer));
+		BS_TEST_ASSERT(memcmp(buffer, "abcd", sizeof(buffer)) == 0);
+
+		// Views reference the same mapping and remain valid after the original stream is closed
+		const auto& mappedStream = static_cast<const MappedFileDataStream&>(*stream);
+		SPtr<DataStream> view = bs_shared_ptr_new<MappedFileDataStream>(mappedStream, 27, 3);
+		stream->close();
+
+		BS_TEST_ASSERT(view->size() == 3);
+		BS_TEST_ASSERT(view->getAsString() == "bcd");
+
+		// Writes are copy-on-write and never reach the file
+		SPtr<MemoryDataStream> memView = std::static_pointer_cast<MemoryDataStream>(view);
+		memView->getPtr()[0] = 'X';
+		view = nullptr;
+		BS_TEST_ASSERT(readFile(path) == content);
+
+		SPtr<DataStream> writeStream = FileSystem::openFile(path, false);
+		BS_TEST_ASSERT(!writeStream->isMapped());
+		writeStream->close();
+
+		FileSystem::remove(path);
+	}
+
+	void FileSystemTestSuite::testPositionalFileReader()
+	{
+		static constexpr UINT32 NUM_THREADS = 8;
+		static constexpr UINT32 NUM_READS = 256;
+		static constexpr UINT32 READ_SIZE = 13;
+
+		Path path = mTestDirectory + "positional-file";
+
+		String content;
+		for (UINT32 i = 0; i < 4096; i++)
+			content += (char)('a' + (i % 26));
+
+		createFile(path, content);
+
+		PositionalFileReader reader(path);
+		BS_TEST_ASSERT(reader.isOpen());
+
+		char buffer[READ_SIZE];
+		BS_TEST_ASSERT(reader.read(buffer, 4, 26) == 4);
+		BS_TEST_ASSERT(memcmp(buffer, "abcd", 4) == 0);
+
+		// Reads past the end return only the available data
+		BS_TEST_ASSERT(reader.read(buffer, 4, content.size() - 2) == 2);
+		BS_TEST_ASSERT(reader.read(buffer, 4, content.size() + 10) == 0);
+
+		// Threads reading different offsets through the same reader must not affect each other
+		std::atomic<UINT32> numMismatches(0);
+		Vector<Thread> threads;
+		for (UINT32 i = 0; i < NUM_THREADS; i++)
+		{
+			threads.emplace_back([&reader, &content, &numMismatches, i]()
+			{
+				char threadBuffer[READ_SIZE];
+				for (UINT32 j = 0; j < NUM_READS; j++)
+				{
+					const UINT32 offset = ((i * NUM_READS + j) * 7) % ((UINT32)content.size() - READ_SIZE);
+					if (reader.read(threadBuffer, READ_SIZE, offset) != READ_SIZE ||
+						memcmp(threadBuffer, content.data() + offset, READ_SIZE) != 0)
+					{
+						numMismatches++;
+					}
+				}
+			});
+		}
+
+		for (auto& thread : threads)
+			thread.join();
+
+		BS_TEST_ASSERT(numMismatches == 0);
+
+		PositionalFileReader missingReader(mTestDirectory + "missing-file");
+		BS_TEST_ASSERT(!missingReader.isOpen());
+		BS_TEST_ASSERT(missingReader.read(buffer, 4, 0) == 0);
+
+		FileSystem::remove(path);
+	}
 }
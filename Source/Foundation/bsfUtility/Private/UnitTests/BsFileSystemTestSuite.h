@@ -35,6 +35,8 @@ namespace bs
 		void testGetChildren();
 		void testGetLastModifiedTime();
 		void testGetTempDirectoryPath();
+		void testOpenFile_mapped();
+		void testPositionalFileReader();
 
 		Path mTestDirectory;
 	};
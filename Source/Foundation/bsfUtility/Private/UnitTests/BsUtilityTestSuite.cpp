@@ -10,9 +10,50 @@
 #include "Utility/BsQuadtree.h"
 #include "Utility/BsBitstream.h"
 #include "Utility/BsUSPtr.h"
+#include "Utility/BsCompression.h"
+#include "FileSystem/BsDataStream.h"
+#include "Debug/BsLog.h"
+#include "Debug/BsTraceCapture.h"
+#include "Math/BsBatchMath.h"
+#include "Math/BsConvexVolume.h"
+#include "Math/BsRandom.h"
+#include "Threading/BsTaskScheduler.h"
+#include "Threading/BsThreadPool.h"
 
 namespace bs
 {
+	/** 
+	 * Trivial codec that only compresses blocks filled with a single value. Used for testing block compression
+	 * independently of which codecs are available.
+	 */
+	class DebugCompressionCodec : public CompressionCodec
+	{
+	public:
+		CompressionMethod getMethod() const override { return CompressionMethod::User; }
+		size_t getMaxCompressedSize(size_t size) const override { return size / 2 + 1; }
+
+		size_t compress(const UINT8* input, size_t inputSize, UINT8* output, size_t outputSize) const override
+		{
+			for(size_t i = 1; i < inputSize; i++)
+			{
+				if(input[i] != input[0])
+					return 0;
+			}
+
+			output[0] = input[0];
+			return 1;
+		}
+
+		bool decompress(const UINT8* input, size_t inputSize, UINT8* output, size_t outputSize) const override
+		{
+			if(inputSize != 1)
+				return false;
+
+			memset(output, input[0], outputSize);
+			return true;
+		}
+	};
+
 	struct DebugOctreeElem
 	{
 		AABox box;
@@ -78,6 +119,125 @@ namespace bs
 	};
 
 	typedef Quadtree<UINT32, DebugQuadtreeOptions> DebugQuadtree;
+
+	/** Log sink that keeps a copy of all received entries. */
+	class DebugLogSink : public LogSink
+	{
+	public:
+		void write(const LogEntry& entry) override
+		{
+			Lock lock(mutex);
+			entries.push_back(entry);
+		}
+
+		/** Returns the number of received entries on the specified channel. */
+		UINT32 count(UINT32 channel) const
+		{
+			Lock lock(mutex);
+			return (UINT32)std::count_if(entries.begin(), entries.end(),
+				[channel](const LogEntry& entry) { return entry.getChannel() == channel; });
+		}
+
+		// Written by the log's background thread while async, so reads need to lock while writers are active
+		Vector<LogEntry> entries;
+		mutable Mutex mutex;
+	};
+
+	/** Log sink that logs a number of messages into the same log whenever it receives an entry on a trigger channel. */
+	class FloodingLogSink : public LogSink
+	{
+	public:
+		FloodingLogSink(Log& log, UINT32 triggerChannel, UINT32 floodChannel, UINT32 numMessages)
+			:mLog(log), mTriggerChannel(triggerChannel), mFloodChannel(floodChannel), mNumMessages(numMessages)
+		{ }
+
+		void write(const LogEntry& entry) override
+		{
+			if(entry.getChannel() != mTriggerChannel)
+				return;
+
+			for(UINT32 i = 0; i < mNumMessages; i++)
+				mLog.logMsg(toString(i), mFloodChannel);
+		}
+
+	private:
+		Log& mLog;
+		UINT32 mTriggerChannel;
+		UINT32 mFloodChannel;
+		UINT32 mNumMessages;
+	};
+
+	/** Stores 3D vectors in structure-of-arrays layout, for use with BatchMath. */
+	struct DebugVector3SoA
+	{
+		DebugVector3SoA(UINT32 count)
+			:x(count), y(count), z(count)
+		{ }
+
+		void set(UINT32 idx, const Vector3& value)
+		{
+			x[idx] = value.x;
+			y[idx] = value.y;
+			z[idx] = value.z;
+		}
+
+		Vector3 get(UINT32 idx) const { return Vector3(x[idx], y[idx], z[idx]); }
+
+		Vector3SoA view()
+		{
+			Vector3SoA output;
+			output.x = x.data();
+			output.y = y.data();
+			output.z = z.data();
+
+			return output;
+		}
+
+		Vector<float> x, y, z;
+	};
+
+	/** Stores quaternions in structure-of-arrays layout, for use with BatchMath. */
+	struct DebugQuaternionSoA
+	{
+		DebugQuaternionSoA(UINT32 count)
+			:x(count), y(count), z(count), w(count)
+		{ }
+
+		void set(UINT32 idx, const Quaternion& value)
+		{
+			x[idx] = value.x;
+			y[idx] = value.y;
+			z[idx] = value.z;
+			w[idx] = value.w;
+		}
+
+		Quaternion get(UINT32 idx) const { return Quaternion(w[idx], x[idx], y[idx], z[idx]); }
+
+		QuaternionSoA view()
+		{
+			QuaternionSoA output;
+			output.x = x.data();
+			output.y = y.data();
+			output.z = z.data();
+			output.w = w.data();
+
+			return output;
+		}
+
+		Vector<float> x, y, z, w;
+	};
+
+	static bool approxEquals(const Matrix4& a, const Matrix4& b, float tolerance)
+	{
+		for(UINT32 i = 0; i < 4; i++)
+		{
+			if(!Math::approxEquals(a[i], b[i], tolerance))
+				return false;
+		}
+
+		return true;
+	}
+
 	void UtilityTestSuite::startUp()
 	{
 		SPtr<TestSuite> fileSystemTests = create<FileSystemTestSuite>();
@@ -99,6 +259,11 @@ namespace bs
 		BS_ADD_TEST(UtilityTestSuite::testQuadtree)
 		BS_ADD_TEST(UtilityTestSuite::testVarInt)
 		BS_ADD_TEST(UtilityTestSuite::testBitStream)
+		BS_ADD_TEST(UtilityTestSuite::testCompression)
+		BS_ADD_TEST(UtilityTestSuite::testAsyncLog)
+		BS_ADD_TEST(UtilityTestSuite::testTraceCapture)
+		BS_ADD_TEST(UtilityTestSuite::testBatchMath)
+		BS_ADD_TEST(UtilityTestSuite::testBoundedTaskQueue)
 	}
 
 	void UtilityTestSuite::testBitfield()
@@ -844,4 +1009,601 @@ namespace bs
 		bs.read(ulv);
 		BS_TEST_ASSERT(ulv == v11);
 	}
+
+	void UtilityTestSuite::testCompression()
+	{
+		Compression::registerCodec(bs_shared_ptr_new<DebugCompressionCodec>());
+
+		// Spans multiple blocks, with the first and the last block being uniform and the rest semi-random. Semi-random 
+		// blocks are stored uncompressed by the debug codec, in which case they are larger than its maximum compressed
+		// size.
+		const UINT32 dataSize = Compression::BLOCK_SIZE * 3 + 1234;
+		Vector<UINT8> data(dataSize);
+		UINT32 seed = 12345;
+		for(UINT32 i = 0; i < dataSize; i++)
+		{
+			if(i < Compression::BLOCK_SIZE || i >= Compression::BLOCK_SIZE * 3)
+				data[i] = 7;
+			else
+			{
+				seed = seed * 1103515245 + 12345;
+				data[i] = (UINT8)((seed >> 16) % 16);
+			}
+		}
+
+		const CompressionMethod methods[] = 
+		{
+			CompressionMethod::Snappy, CompressionMethod::LZ4, CompressionMethod::Zstd, CompressionMethod::User
+		};
+
+		for(auto& method : methods)
+		{
+			if(!Compression::isSupported(method))
+				continue;
+
+			SPtr<DataStream> input = bs_shared_ptr_new<MemoryDataStream>(data.data(), dataSize, false);
+			SPtr<DataStream> compressed = Compression::compress(input, method);
+			BS_TEST_ASSERT(compressed != nullptr && compressed->size() < dataSize);
+
+			if(compressed == nullptr)
+				continue;
+
+			SPtr<DataStream> decompressed = Compression::decompress(compressed, method);
+			BS_TEST_ASSERT(decompressed != nullptr && decompressed->size() == dataSize);
+
+			if(decompressed != nullptr && decompressed->size() == dataSize)
+			{
+				auto decompressedData = std::static_pointer_cast<MemoryDataStream>(decompressed);
+				BS_TEST_ASSERT(memcmp(decompressedData->getPtr(), data.data(), dataSize) == 0);
+			}
+		}
+
+		Compression::unregisterCodec(CompressionMethod::User);
+		BS_TEST_ASSERT(!Compression::isSupported(CompressionMethod::User));
+	}
+
+	void UtilityTestSuite::testAsyncLog()
+	{
+		bool startedTime = false;
+		if(!Time::isStarted())
+		{
+			Time::startUp();
+			startedTime = true;
+		}
+
+		Log log;
+		SPtr<DebugLogSink> sink = bs_shared_ptr_new<DebugLogSink>();
+		log.addSink(sink);
+		log.setMaxEntries(0);
+		log.startAsync();
+
+		// Enough messages per thread to wrap around the ring buffers multiple times
+		const UINT32 numThreads = 16;
+		const UINT32 numMessages = Log::RING_BUFFER_SIZE * 3;
+
+		// Threads take turns logging markers on their own channel, so marker k is logged only after marker k - 1 was.
+		// Each message records the number of logged markers before and after it was logged. Any marker logged before the
+		// message started must be processed before it, and any marker started after it returned must be processed after.
+		const UINT32 markerChannel = numThreads;
+		std::atomic<UINT32> numMarkers { 0 };
+		Vector<Vector<UINT32>> markersBefore(numThreads, Vector<UINT32>(numMessages));
+		Vector<Vector<UINT32>> markersAfter(numThreads, Vector<UINT32>(numMessages));
+
+		// Number of messages each thread finished logging
+		Vector<std::atomic<UINT32>> numLogged(numThreads);
+		for(auto& entry : numLogged)
+			entry = 0;
+
+		std::atomic<bool> writersDone { false };
+		Vector<Thread> threads;
+		for(UINT32 i = 0; i < numThreads; i++)
+		{
+			threads.push_back(Thread([&, i]()
+			{
+				for(UINT32 j = 0; j < numMessages; j++)
+				{
+					markersBefore[i][j] = numMarkers.load();
+					log.logMsg(toString(j), i);
+					markersAfter[i][j] = numMarkers.load();
+
+					numLogged[i].store(j + 1);
+
+					const UINT32 marker = numMarkers.load();
+					if((marker % numThreads) == i)
+					{
+						log.logMsg(toString(marker), markerChannel);
+						numMarkers.store(marker + 1);
+					}
+				}
+			}));
+		}
+
+		// Everything a thread finished logging before flush() was called must be processed once it returns, even while
+		// other threads keep logging
+		bool flushComplete = true;
+		for(UINT32 i = 0; i < 50; i++)
+		{
+			Vector<UINT32> numLoggedBefore(numThreads);
+			for(UINT32 j = 0; j < numThreads; j++)
+				numLoggedBefore[j] = numLogged[j].load();
+
+			log.flush();
+
+			for(UINT32 j = 0; j < numThreads; j++)
+			{
+				if(sink->count(j) < numLoggedBefore[j])
+					flushComplete = false;
+			}
+		}
+
+		BS_TEST_ASSERT(flushComplete);
+
+		for(auto& thread : threads)
+			thread.join();
+
+		log.flush();
+
+		const UINT32 totalMarkers = numMarkers.load();
+		BS_TEST_ASSERT(sink->entries.size() == numThreads * numMessages + totalMarkers);
+		BS_TEST_ASSERT(totalMarkers > 0);
+
+		// Entries logged by the same thread must arrive in order, as must the markers
+		Vector<UINT32> nextMessage(numThreads + 1, 0);
+		Vector<Vector<UINT32>> messagePositions(numThreads, Vector<UINT32>(numMessages, 0));
+		Vector<UINT32> markerPositions(totalMarkers, 0);
+		bool inOrder = true;
+		for(UINT32 i = 0; i < (UINT32)sink->entries.size(); i++)
+		{
+			const LogEntry& entry = sink->entries[i];
+
+			UINT32 channel = entry.getChannel();
+			if(channel > markerChannel || entry.getMessage() != toString(nextMessage[channel]))
+			{
+				inOrder = false;
+				break;
+			}
+
+			if(channel == markerChannel)
+				markerPositions[nextMessage[channel]] = i;
+			else
+				messagePositions[channel][nextMessage[channel]] = i;
+
+			nextMessage[channel]++;
+		}
+
+		BS_TEST_ASSERT(inOrder);
+
+		// Order across threads must match the order in which the messages were logged
+		bool globalOrder = true;
+		for(UINT32 i = 0; i < numThreads && inOrder; i++)
+		{
+			for(UINT32 j = 0; j < numMessages; j++)
+			{
+				const UINT32 position = messagePositions[i][j];
+				const UINT32 before = markersBefore[i][j];
+				const UINT32 after = markersAfter[i][j];
+
+				if(before > 0 && markerPositions[before - 1] > position)
+					globalOrder = false;
+
+				if((after + 1) < totalMarkers && markerPositions[after + 1] < position)
+					globalOrder = false;
+			}
+		}
+
+		BS_TEST_ASSERT(globalOrder);
+
+		// Once stopped messages are processed right away
+		const UINT32 numAsyncEntries = numThreads * numMessages + totalMarkers;
+		log.stopAsync();
+		log.logMsg("sync", 0);
+		BS_TEST_ASSERT(sink->entries.size() == numAsyncEntries + 1);
+
+		LogEntry unreadEntry;
+		UINT32 numUnread = 0;
+		while(log.getUnreadEntry(unreadEntry))
+			numUnread++;
+
+		BS_TEST_ASSERT(numUnread == numAsyncEntries + 1);
+
+		// Retention limit removes the oldest entries
+		log.setMaxEntries(100);
+
+		Vector<LogEntry> entries = log.getEntries();
+		BS_TEST_ASSERT(entries.size() == 100);
+		BS_TEST_ASSERT(entries.back().getMessage() == "sync");
+		BS_TEST_ASSERT(log.getNumDroppedEntries() == numAsyncEntries + 1 - 100);
+
+		// Entries logged by sinks once the background thread's own ring buffer is full are dropped and counted
+		{
+			Log floodedLog;
+			SPtr<DebugLogSink> floodedSink = bs_shared_ptr_new<DebugLogSink>();
+			floodedLog.addSink(floodedSink);
+			floodedLog.addSink(bs_shared_ptr_new<FloodingLogSink>(floodedLog, 0, 1, Log::RING_BUFFER_SIZE * 2));
+			floodedLog.setMaxEntries(0);
+			floodedLog.startAsync();
+
+			floodedLog.logMsg("trigger", 0);
+			floodedLog.flush();
+
+			// Processes the entries logged by the sink
+			floodedLog.flush();
+
+			BS_TEST_ASSERT(floodedSink->count(1) == Log::RING_BUFFER_SIZE);
+			BS_TEST_ASSERT(floodedLog.getNumDroppedEntries() == Log::RING_BUFFER_SIZE);
+
+			floodedLog.stopAsync();
+		}
+
+		// Draining waits for processing without flushing or locking
+		{
+			Log drainedLog;
+			SPtr<DebugLogSink> drainedSink = bs_shared_ptr_new<DebugLogSink>();
+			drainedLog.addSink(drainedSink);
+			drainedLog.startAsync();
+
+			for(UINT32 i = 0; i < 100; i++)
+				drainedLog.logMsg(toString(i), 0);
+
+			BS_TEST_ASSERT(drainedLog.drain(5000));
+			BS_TEST_ASSERT(drainedSink->count(0) == 100);
+
+			drainedLog.stopAsync();
+		}
+
+		if(startedTime)
+			Time::shutDown();
+	}
+
+	void UtilityTestSuite::testTraceCapture()
+	{
+		/** Counts the non-overlapping occurrences of a substring. */
+		const auto countOccurrences = [](const String& str, const String& pattern)
+		{
+			UINT32 count = 0;
+			for(size_t pos = str.find(pattern); pos != String::npos; pos = str.find(pattern, pos + pattern.size()))
+				count++;
+
+			return count;
+		};
+
+		/** Exports the last capture to a string. */
+		const auto exportTrace = [](const TraceCapture& capture)
+		{
+			auto stream = bs_shared_ptr_new<MemoryDataStream>(16 * 1024 * 1024);
+			if(!capture.writeChromeTrace(stream))
+				return String();
+
+			return String((const char*)stream->getPtr(), stream->tell());
+		};
+
+		TraceCapture capture;
+
+		// Nothing is recorded outside of a capture
+		capture.beginEvent("Ignored");
+		capture.endEvent();
+
+		capture.startCapture();
+		BS_TEST_ASSERT(capture.isCapturing());
+
+		const UINT32 numThreads = 4;
+		const UINT32 numEvents = 100;
+
+		Vector<Thread> threads;
+		for(UINT32 i = 0; i < numThreads; i++)
+		{
+			threads.push_back(Thread([&capture, i, numEvents]()
+			{
+				capture.setThreadName(("Worker \"" + toString(i) + "\"").c_str());
+
+				for(UINT32 j = 0; j < numEvents; j++)
+				{
+					capture.beginEvent("Outer");
+					capture.beginEvent("Inner");
+					capture.endEvent();
+					capture.endEvent();
+				}
+			}));
+		}
+
+		for(auto& thread : threads)
+			thread.join();
+
+		capture.recordGpuEvent("Frame", TraceCapture::getTimestamp(), 1000);
+
+		// Export is not allowed during a capture
+		BS_TEST_ASSERT(exportTrace(capture).empty());
+
+		capture.stopCapture();
+		BS_TEST_ASSERT(!capture.isCapturing());
+
+		String trace = exportTrace(capture);
+		BS_TEST_ASSERT(trace.find("\"traceEvents\"") != String::npos);
+		BS_TEST_ASSERT(trace.find("Ignored") == String::npos);
+		BS_TEST_ASSERT(countOccurrences(trace, "\"name\":\"Outer\",\"ph\":\"B\"") == numThreads * numEvents);
+		BS_TEST_ASSERT(countOccurrences(trace, "\"name\":\"Inner\",\"ph\":\"B\"") == numThreads * numEvents);
+		BS_TEST_ASSERT(countOccurrences(trace, "\"ph\":\"E\"") == numThreads * numEvents * 2);
+		BS_TEST_ASSERT(countOccurrences(trace, "\"ph\":\"X\"") == 1);
+		BS_TEST_ASSERT(countOccurrences(trace, "\"thread_name\"") == numThreads + 2);
+		BS_TEST_ASSERT(trace.find("\"name\":\"Worker \\\"0\\\"\"") != String::npos);
+
+		// When the ring buffer wraps around only the most recent events are kept, and ends whose begin was overwritten
+		// are dropped
+		capture.startCapture(3);
+		capture.beginEvent("First");
+		capture.beginEvent("Second");
+		capture.endEvent();
+		capture.endEvent();
+		capture.stopCapture();
+
+		trace = exportTrace(capture);
+		BS_TEST_ASSERT(trace.find("First") == String::npos);
+		BS_TEST_ASSERT(trace.find("Outer") == String::npos);
+		BS_TEST_ASSERT(countOccurrences(trace, "\"name\":\"Second\",\"ph\":\"B\"") == 1);
+		BS_TEST_ASSERT(countOccurrences(trace, "\"ph\":\"E\"") == 1);
+	}
+
+	void UtilityTestSuite::testBatchMath()
+	{
+		// Not a multiple of any SIMD width, so the remainder is handled as well
+		static constexpr UINT32 COUNT = 45;
+
+		Random random(1234);
+		auto randomRange = [&random](float min, float max) { return Math::lerp(random.getUNorm(), min, max); };
+		auto randomRotation = [&random, &randomRange]()
+		{
+			return Quaternion(random.getUnitVector(), Radian(randomRange(-Math::PI, Math::PI)));
+		};
+
+		const Matrix4 matrix = Matrix4::TRS(Vector3(1.0f, -2.0f, 3.0f), randomRotation(), Vector3(2.0f, 0.5f, 1.5f));
+		const ConvexVolume frustum(Matrix4::projectionPerspective(Degree(90.0f), 1.0f, 1.0f, 100.0f));
+
+		DebugVector3SoA points(COUNT);
+		DebugVector3SoA centers(COUNT);
+		DebugVector3SoA extents(COUNT);
+		Vector<float> radii(COUNT);
+
+		DebugVector3SoA translations(COUNT);
+		DebugQuaternionSoA rotations(COUNT);
+		DebugVector3SoA scales(COUNT);
+		Vector<Matrix4> lhs(COUNT);
+		Vector<Matrix4> rhs(COUNT);
+
+		DebugQuaternionSoA from(COUNT);
+		DebugQuaternionSoA to(COUNT);
+		Vector<float> factors(COUNT);
+
+		for(UINT32 i = 0; i < COUNT; i++)
+		{
+			points.set(i, random.getUnitVector() * randomRange(0.0f, 50.0f));
+			centers.set(i, Vector3(randomRange(-120.0f, 120.0f), randomRange(-120.0f, 120.0f), randomRange(-120.0f, 20.0f)));
+			extents.set(i, Vector3(randomRange(0.0f, 20.0f), randomRange(0.0f, 20.0f), randomRange(0.0f, 20.0f)));
+			radii[i] = randomRange(0.0f, 20.0f);
+
+			translations.set(i, random.getUnitVector() * randomRange(0.0f, 50.0f));
+			rotations.set(i, randomRotation());
+			scales.set(i, Vector3(randomRange(0.1f, 3.0f), randomRange(0.1f, 3.0f), randomRange(0.1f, 3.0f)));
+			lhs[i] = Matrix4::TRS(translations.get(i), rotations.get(i), scales.get(i));
+			rhs[i] = Matrix4::TRS(random.getUnitVector(), randomRotation(), Vector3::ONE * randomRange(0.1f, 3.0f));
+
+			// Include nearly identical and opposite rotations, which take the linear interpolation path in slerp
+			const Quaternion rotation = randomRotation();
+			from.set(i, rotation);
+
+			if(i % 5 == 0)
+				to.set(i, i % 10 == 0 ? rotation : -rotation);
+			else
+				to.set(i, randomRotation());
+
+			factors[i] = random.getUNorm();
+		}
+
+		SphereSoA spheres;
+		spheres.center = centers.view();
+		spheres.radius = radii.data();
+
+		AABoxSoA boxes;
+		boxes.center = centers.view();
+		boxes.extents = extents.view();
+
+		const SIMDInstructionSet originalInstructionSet = BatchMath::getInstructionSet();
+		for(auto instructionSet : { SIMDInstructionSet::SSE4_1, SIMDInstructionSet::AVX })
+		{
+			if(!BatchMath::isSupported(instructionSet))
+				continue;
+
+			BS_TEST_ASSERT(BatchMath::setInstructionSet(instructionSet));
+			BS_TEST_ASSERT(BatchMath::getInstructionSet() == instructionSet);
+
+			DebugVector3SoA transformedPoints(COUNT);
+			BatchMath::transformPoints(matrix, points.view(), transformedPoints.view(), COUNT);
+
+			for(UINT32 i = 0; i < COUNT; i++)
+				BS_TEST_ASSERT(Math::approxEquals(transformedPoints.get(i), matrix.multiplyAffine(points.get(i)), 1e-4f));
+
+			DebugVector3SoA transformedCenters(COUNT);
+			DebugVector3SoA transformedExtents(COUNT);
+
+			AABoxSoA transformedBoxes;
+			transformedBoxes.center = transformedCenters.view();
+			transformedBoxes.extents = transformedExtents.view();
+			BatchMath::transformAABoxes(matrix, boxes, transformedBoxes, COUNT);
+
+			for(UINT32 i = 0; i < COUNT; i++)
+			{
+				AABox box(centers.get(i) - extents.get(i), centers.get(i) + extents.get(i));
+				box.transformAffine(matrix);
+
+				BS_TEST_ASSERT(Math::approxEquals(transformedCenters.get(i), box.getCenter(), 1e-3f));
+				BS_TEST_ASSERT(Math::approxEquals(transformedExtents.get(i), box.getHalfSize(), 1e-3f));
+			}
+
+			Vector<Matrix4> products(COUNT);
+			BatchMath::multiply(lhs.data(), rhs.data(), products.data(), COUNT);
+
+			for(UINT32 i = 0; i < COUNT; i++)
+				BS_TEST_ASSERT(approxEquals(products[i], lhs[i] * rhs[i], 1e-4f));
+
+			// Output is allowed to be the same as the input
+			products = rhs;
+			BatchMath::multiply(matrix, products.data(), products.data(), COUNT);
+
+			for(UINT32 i = 0; i < COUNT; i++)
+				BS_TEST_ASSERT(approxEquals(products[i], matrix * rhs[i], 1e-4f));
+
+			Vector<Matrix4> transforms(COUNT);
+			BatchMath::composeTRS(translations.view(), rotations.view(), scales.view(), transforms.data(), COUNT);
+
+			for(UINT32 i = 0; i < COUNT; i++)
+				BS_TEST_ASSERT(approxEquals(transforms[i], lhs[i], 1e-5f));
+
+			DebugQuaternionSoA interpolated(COUNT);
+			BatchMath::slerp(factors.data(), from.view(), to.view(), interpolated.view(), COUNT);
+
+			for(UINT32 i = 0; i < COUNT; i++)
+			{
+				const Quaternion expected = Quaternion::slerp(factors[i], from.get(i), to.get(i), true);
+				BS_TEST_ASSERT(Math::approxEquals(interpolated.get(i), expected, 1e-4f));
+			}
+
+			BatchMath::nlerp(factors.data(), from.view(), to.view(), interpolated.view(), COUNT);
+
+			for(UINT32 i = 0; i < COUNT; i++)
+			{
+				const Quaternion expected = Quaternion::lerp(factors[i], from.get(i), to.get(i));
+				BS_TEST_ASSERT(Math::approxEquals(interpolated.get(i), expected, 1e-5f));
+			}
+
+			bool visible[COUNT];
+			UINT32 numVisible = 0;
+			BatchMath::intersects(frustum, spheres, visible, COUNT);
+
+			for(UINT32 i = 0; i < COUNT; i++)
+			{
+				BS_TEST_ASSERT(visible[i] == frustum.intersects(Sphere(centers.get(i), radii[i])));
+				numVisible += visible[i] ? 1 : 0;
+			}
+
+			BatchMath::intersects(frustum, boxes, visible, COUNT);
+
+			for(UINT32 i = 0; i < COUNT; i++)
+			{
+				const AABox box(centers.get(i) - extents.get(i), centers.get(i) + extents.get(i));
+				BS_TEST_ASSERT(visible[i] == frustum.intersects(box));
+			}
+
+			// Make sure both outcomes were tested
+			BS_TEST_ASSERT(numVisible > 0 && numVisible < COUNT);
+		}
+
+		BatchMath::setInstructionSet(originalInstructionSet);
+	}
+
+	void UtilityTestSuite::testBoundedTaskQueue()
+	{
+		// The queue runs its items on the task scheduler, which isn't otherwise started by the utility tests
+		const bool startScheduler = !TaskScheduler::isStarted();
+		if(startScheduler)
+		{
+			ThreadPool::startUp<TThreadPool<ThreadNoPolicy>>(4);
+			TaskScheduler::startUp();
+		}
+
+		static constexpr UINT32 NUM_ITEMS = 64;
+
+		// Items never exceed the concurrency limit, and all of them execute
+		{
+			static constexpr UINT32 MAX_CONCURRENT = 2;
+
+			std::atomic<UINT32> numActive(0);
+			std::atomic<UINT32> maxActive(0);
+			std::atomic<UINT32> numExecuted(0);
+
+			BoundedTaskQueue queue("TestTaskQueue", MAX_CONCURRENT);
+			for(UINT32 i = 0; i < NUM_ITEMS; i++)
+			{
+				queue.push([&numActive, &maxActive, &numExecuted]()
+				{
+					UINT32 active = ++numActive;
+
+					UINT32 prevMax = maxActive.load();
+					while(active > prevMax && !maxActive.compare_exchange_weak(prevMax, active))
+					{ }
+
+					BS_THREAD_SLEEP(1);
+
+					numActive--;
+					numExecuted++;
+				});
+			}
+
+			queue.waitUntilEmpty();
+
+			BS_TEST_ASSERT(numExecuted == NUM_ITEMS);
+			BS_TEST_ASSERT(numActive == 0);
+			BS_TEST_ASSERT(maxActive <= MAX_CONCURRENT);
+		}
+
+		// With a single item allowed at a time, items execute in the order they were queued
+		{
+			Vector<UINT32> order;
+			order.reserve(NUM_ITEMS);
+
+			BoundedTaskQueue queue("TestTaskQueue", 1);
+			for(UINT32 i = 0; i < NUM_ITEMS; i++)
+				queue.push([&order, i]() { order.push_back(i); });
+
+			queue.waitUntilEmpty();
+
+			BS_TEST_ASSERT(order.size() == NUM_ITEMS);
+			for(UINT32 i = 0; i < (UINT32)order.size(); i++)
+				BS_TEST_ASSERT(order[i] == i);
+		}
+
+		// Raising the limit starts pending items, and the destructor waits for the remaining ones
+		{
+			std::atomic<UINT32> numStarted(0);
+			std::atomic<UINT32> numExecuted(0);
+			std::atomic<bool> release(false);
+
+			{
+				BoundedTaskQueue queue("TestTaskQueue", 1);
+				for(UINT32 i = 0; i < 8; i++)
+				{
+					queue.push([&numStarted, &numExecuted, &release]()
+					{
+						numStarted++;
+						while(!release)
+							BS_THREAD_SLEEP(1);
+
+						numExecuted++;
+					});
+				}
+
+				// The scheduler can't run more items than it has workers, regardless of the queue's limit
+				const UINT32 expectedStarted = std::min(4U, TaskScheduler::instance().getNumWorkers());
+				queue.setMaxConcurrent(4);
+
+				for(UINT32 i = 0; i < 5000 && numStarted < expectedStarted; i++)
+					BS_THREAD_SLEEP(1);
+
+				BS_TEST_ASSERT(numStarted == expectedStarted);
+				release = true;
+			}
+
+			BS_TEST_ASSERT(numExecuted == 8);
+		}
+
+		// Waiting on an empty queue returns immediately
+		{
+			BoundedTaskQueue queue("TestTaskQueue");
+			queue.waitUntilEmpty();
+		}
+
+		if(startScheduler)
+		{
+			TaskScheduler::shutDown();
+			ThreadPool::shutDown();
+		}
+	}
 }
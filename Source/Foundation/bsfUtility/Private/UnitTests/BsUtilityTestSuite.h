@@ -23,5 +23,10 @@ namespace bs
 		void testQuadtree();
 		void testVarInt();
 		void testBitStream();
+		void testCompression();
+		void testAsyncLog();
+		void testTraceCapture();
+		void testBatchMath();
+		void testBoundedTaskQueue();
 	};
 }
@@ -8,6 +8,8 @@
 
 #include <dirent.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -138,6 +140,18 @@ namespace bs
 	{
 		String pathString = path.toString();
 
+		if (readOnly)
+		{
+			struct stat st_buf;
+			if (stat(pathString.c_str(), &st_buf) == 0 && S_ISREG(st_buf.st_mode) &&
+				(UINT64)st_buf.st_size >= MappedFileDataStream::MIN_MAPPED_FILE_SIZE)
+			{
+				SPtr<MappedFileDataStream> mappedStream = bs_shared_ptr_new<MappedFileDataStream>(path);
+				if (mappedStream->getPtr() != nullptr)
+					return mappedStream;
+			}
+		}
+
 		DataStream::AccessMode accessMode = DataStream::READ;
 		if (!readOnly)
 			accessMode = (DataStream::AccessMode)((UINT32)accessMode | (UINT32)DataStream::WRITE);
@@ -349,4 +363,84 @@ namespace bs
 
 		return Path(String(directoryName) + "/");
 	}
+
+	SPtr<MappedFileDataStream::FileMapping> MappedFileDataStream::mapFile(const Path& filePath)
+	{
+		String pathString = filePath.toString();
+
+		int fd = ::open(pathString.c_str(), O_RDONLY);
+		if (fd == -1)
+		{
+			HANDLE_PATH_ERROR(pathString, errno);
+			return nullptr;
+		}
+
+		struct stat st_buf;
+		if (fstat(fd, &st_buf) != 0 || st_buf.st_size == 0)
+		{
+			::close(fd);
+			return nullptr;
+		}
+
+		// Private mapping so writes through the mapped pointer are copy-on-write and never modify the file
+		const size_t size = (size_t)st_buf.st_size;
+		void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+
+		// Mapping remains valid after the descriptor is closed
+		::close(fd);
+
+		if (data == MAP_FAILED)
+		{
+			HANDLE_PATH_ERROR(pathString, errno);
+			return nullptr;
+		}
+
+		return bs_shared_ptr_new<FileMapping>((UINT8*)data, size);
+	}
+
+	MappedFileDataStream::FileMapping::~FileMapping()
+	{
+		if (data != nullptr)
+			munmap(data, size);
+	}
+
+	PositionalFileReader::PositionalFileReader(const Path& filePath)
+		:mPath(filePath)
+	{
+		String pathString = filePath.toString();
+
+		mHandle = ::open(pathString.c_str(), O_RDONLY);
+		if (mHandle == -1)
+			HANDLE_PATH_ERROR(pathString, errno);
+	}
+
+	PositionalFileReader::~PositionalFileReader()
+	{
+		if (mHandle != -1)
+			::close((int)mHandle);
+	}
+
+	size_t PositionalFileReader::read(void* buf, size_t count, UINT64 offset) const
+	{
+		if (mHandle == -1)
+			return 0;
+
+		// pread() doesn't modify the descriptor's file offset, so concurrent reads don't interfere
+		size_t numRead = 0;
+		while (numRead < count)
+		{
+			const ssize_t result = ::pread((int)mHandle, (UINT8*)buf + numRead, count - numRead, 
+				(off_t)(offset + numRead));
+
+			if (result < 0 && errno == EINTR)
+				continue;
+
+			if (result <= 0)
+				break;
+
+			numRead += (size_t)result;
+		}
+
+		return numRead;
+	}
 }
@@ -281,6 +281,13 @@ namespace bs
 			return nullptr;
 		}
 
+		if (readOnly && win32_getFileSize(pathWString) >= MappedFileDataStream::MIN_MAPPED_FILE_SIZE)
+		{
+			SPtr<MappedFileDataStream> mappedStream = bs_shared_ptr_new<MappedFileDataStream>(fullPath);
+			if (mappedStream->getPtr() != nullptr)
+				return mappedStream;
+		}
+
 		DataStream::AccessMode accessMode = DataStream::READ;
 		if (!readOnly)
 			accessMode = (DataStream::AccessMode)(accessMode | (UINT32)DataStream::WRITE);
@@ -474,4 +481,102 @@ namespace bs
 		const String utf8dir = UTF8::fromWide(win32_getTempDirectory());
 		return Path(utf8dir);
 	}
+
+	SPtr<MappedFileDataStream::FileMapping> MappedFileDataStream::mapFile(const Path& filePath)
+	{
+		WString pathWString = UTF8::toWide(filePath.toString());
+
+		HANDLE file = CreateFileW(pathWString.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+			FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+		{
+			win32_handleError(GetLastError(), pathWString);
+			return nullptr;
+		}
+
+		LARGE_INTEGER fileSize;
+		if (GetFileSizeEx(file, &fileSize) == FALSE || fileSize.QuadPart == 0)
+		{
+			CloseHandle(file);
+			return nullptr;
+		}
+
+		// Copy-on-write mapping so writes through the mapped pointer never modify the file
+		HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+		void* data = nullptr;
+		if (mapping != nullptr)
+		{
+			data = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+
+			// The view keeps the mapping and the file open on its own
+			CloseHandle(mapping);
+		}
+
+		CloseHandle(file);
+
+		if (data == nullptr)
+		{
+			win32_handleError(GetLastError(), pathWString);
+			return nullptr;
+		}
+
+		return bs_shared_ptr_new<FileMapping>((UINT8*)data, (size_t)fileSize.QuadPart);
+	}
+
+	MappedFileDataStream::FileMapping::~FileMapping()
+	{
+		if (data != nullptr)
+			UnmapViewOfFile(data);
+	}
+
+	PositionalFileReader::PositionalFileReader(const Path& filePath)
+		:mPath(filePath)
+	{
+		WString pathWString = UTF8::toWide(filePath.toString());
+
+		HANDLE file = CreateFileW(pathWString.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+			FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+		{
+			win32_handleError(GetLastError(), pathWString);
+			return;
+		}
+
+		mHandle = (INT64)(intptr_t)file;
+	}
+
+	PositionalFileReader::~PositionalFileReader()
+	{
+		if (mHandle != -1)
+			CloseHandle((HANDLE)(intptr_t)mHandle);
+	}
+
+	size_t PositionalFileReader::read(void* buf, size_t count, UINT64 offset) const
+	{
+		if (mHandle == -1)
+			return 0;
+
+		// Each read provides its own offset through the OVERLAPPED structure, so concurrent reads don't interfere
+		size_t numRead = 0;
+		while (numRead < count)
+		{
+			const UINT64 readOffset = offset + numRead;
+
+			OVERLAPPED overlapped = {};
+			overlapped.Offset = (DWORD)(readOffset & 0xFFFFFFFF);
+			overlapped.OffsetHigh = (DWORD)(readOffset >> 32);
+
+			const DWORD toRead = (DWORD)std::min(count - numRead, (size_t)std::numeric_limits<DWORD>::max());
+			DWORD result = 0;
+			if (ReadFile((HANDLE)(intptr_t)mHandle, (UINT8*)buf + numRead, toRead, &result, &overlapped) == FALSE || 
+				result == 0)
+			{
+				break;
+			}
+
+			numRead += result;
+		}
+
+		return numRead;
+	}
 }
@@ -885,6 +885,16 @@ mTotalBytesRead -= size;												\
 							// Seek past the data (use original offset in case the field read from the stream)
 							data->seek(dataBlockOffset + dataBlockSize);
 						}
+						else if (data->isMapped()) // Reference the data directly from the mapping, avoiding a copy
+						{
+							const auto& mappedData = static_cast<const MappedFileDataStream&>(*data);
+
+							SPtr<DataStream> stream = bs_shared_ptr_new<MappedFileDataStream>(mappedData, 
+								mappedData.tell(), dataBlockSize);
+							curField->setValue(rttiInstance, output.get(), stream, dataBlockSize);
+
+							SKIP_READ(dataBlockSize)
+						}
 						else
 						{
 							UINT8* dataBlockBuffer = (UINT8*)bs_alloc(dataBlockSize);
@@ -76,6 +76,10 @@ namespace bs
 		}
 	}
 
+	FileDecoder::FileDecoder(const SPtr<DataStream>& stream)
+		:mInputStream(stream)
+	{ }
+
 	SPtr<IReflectable> FileDecoder::decode(SerializationContext* context)
 	{
 		if (mInputStream->eof())
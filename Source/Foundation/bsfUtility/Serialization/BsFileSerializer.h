@@ -47,6 +47,9 @@ namespace bs
 	public:
 		FileDecoder(const Path& fileLocation);
 
+		/** Decodes objects from an already open stream, starting at its current read position. */
+		FileDecoder(const SPtr<DataStream>& stream);
+
 		/**	
 		 * Deserializes an IReflectable object by reading the binary data at the provided file location. 
 		 *
@@ -0,0 +1,97 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Testing/BsBenchmark.h"
+#include "Testing/BsBenchmarkOutput.h"
+
+namespace bs
+{
+	Benchmark::Benchmark(const BenchmarkSettings& settings, const String& name)
+		: mSettings(settings), mMinRepetitionTimeNs((UINT64)(std::max(settings.minRepetitionTimeMs, 0.0) * 1000000.0))
+	{
+		mResult.name = name;
+	}
+
+	void Benchmark::calculateResult(Vector<double>& samples, UINT64 iterations)
+	{
+		std::sort(samples.begin(), samples.end());
+
+		const size_t count = samples.size();
+
+		double sum = 0.0;
+		for(auto& sample : samples)
+			sum += sample;
+
+		const double mean = sum / count;
+
+		double variance = 0.0;
+		for(auto& sample : samples)
+			variance += (sample - mean) * (sample - mean);
+
+		mResult.repetitions = (UINT32)count;
+		mResult.iterations = iterations;
+		mResult.minNs = samples.front();
+		mResult.maxNs = samples.back();
+		mResult.meanNs = mean;
+		mResult.medianNs = (count % 2) ? samples[count / 2] : (samples[count / 2 - 1] + samples[count / 2]) * 0.5;
+		mResult.stdDevNs = count > 1 ? std::sqrt(variance / (count - 1)) : 0.0;
+
+		if(mItemsPerIteration > 0 && mResult.medianNs > 0.0)
+			mResult.itemsPerSecond = mItemsPerIteration * 1000000000.0 / mResult.medianNs;
+	}
+
+	UINT64 Benchmark::getTimeNs()
+	{
+		using namespace std::chrono;
+		return (UINT64)duration_cast<nanoseconds>(high_resolution_clock::now().time_since_epoch()).count();
+	}
+
+	void Benchmark::escape(const void* ptr)
+	{
+		static volatile const void* sink = nullptr;
+		sink = ptr;
+	}
+
+	BenchmarkSuite::BenchmarkEntry::BenchmarkEntry(Func benchmark, const String& name)
+		:benchmark(benchmark), name(name)
+	{ }
+
+	void BenchmarkSuite::run(const BenchmarkSettings& settings, BenchmarkOutput& output)
+	{
+		// Skip set up entirely if nothing in the suite would run
+		bool anyMatch = settings.filter.empty() || !mSuites.empty();
+		for(auto& entry : mBenchmarks)
+			anyMatch |= entry.name.find(settings.filter) != String::npos;
+
+		if(!anyMatch)
+			return;
+
+		startUp();
+
+		for (auto& entry : mBenchmarks)
+		{
+			if(!settings.filter.empty() && entry.name.find(settings.filter) == String::npos)
+				continue;
+
+			Benchmark benchmark(settings, entry.name);
+			(this->*(entry.benchmark))(benchmark);
+
+			if(benchmark.hasResult())
+				output.outputResult(benchmark.getResult());
+		}
+
+		for (auto& suite : mSuites)
+			suite->run(settings, output);
+
+		shutDown();
+	}
+
+	void BenchmarkSuite::add(const SPtr<BenchmarkSuite>& suite)
+	{
+		mSuites.push_back(suite);
+	}
+
+	void BenchmarkSuite::addBenchmark(Func benchmark, const String& name)
+	{
+		mBenchmarks.push_back(BenchmarkEntry(benchmark, name));
+	}
+}
@@ -0,0 +1,224 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "Prerequisites/BsPrerequisitesUtil.h"
+
+namespace bs
+{
+	class BenchmarkOutput;
+
+	/** @addtogroup Testing
+	 *  @{
+	 */
+
+	/** Controls how are benchmarks executed. */
+	struct BenchmarkSettings
+	{
+		/** Number of untimed repetitions to run before measuring, so caches and allocators reach a steady state. */
+		UINT32 warmupRepetitions = 2;
+
+		/** Number of timed repetitions. Statistics are calculated over the per-iteration time of each repetition. */
+		UINT32 repetitions = 10;
+
+		/**
+		 * Minimum duration of a single repetition, in milliseconds. The number of iterations per repetition is
+		 * increased until a repetition takes at least this long, so that timer resolution doesn't affect the results.
+		 */
+		double minRepetitionTimeMs = 20.0;
+
+		/** If not empty, only benchmarks whose name contains this string are executed. */
+		String filter;
+	};
+
+	/** Statistics gathered from all the timed repetitions of a single benchmark. All times are per iteration. */
+	struct BenchmarkResult
+	{
+		String name; /**< Name of the benchmark, in the "Suite::benchmark" format. */
+		UINT32 repetitions = 0; /**< Number of timed repetitions. */
+		UINT64 iterations = 0; /**< Number of iterations in each repetition. */
+
+		double minNs = 0.0; /**< Time of the fastest repetition, in nanoseconds. */
+		double maxNs = 0.0; /**< Time of the slowest repetition, in nanoseconds. */
+		double meanNs = 0.0; /**< Mean time across all repetitions, in nanoseconds. */
+		double medianNs = 0.0; /**< Median time across all repetitions, in nanoseconds. */
+		double stdDevNs = 0.0; /**< Standard deviation of the time across all repetitions, in nanoseconds. */
+
+		/** Number of processed items per second, based on the median time. Zero if the benchmark doesn't report items. */
+		double itemsPerSecond = 0.0;
+
+		/** Additional values reported by the benchmark that aren't timings (e.g. a compression ratio), by name. */
+		Map<String, double> counters;
+	};
+
+	/**
+	 * Provided to each benchmark, and used for timing the code being benchmarked. Each benchmark performs its set up
+	 * and then calls measure() exactly once with the code to time.
+	 */
+	class BS_UTILITY_EXPORT Benchmark
+	{
+	public:
+		Benchmark(const BenchmarkSettings& settings, const String& name);
+
+		/**
+		 * Runs the provided function repeatedly, first to determine how many iterations are needed for a single
+		 * repetition, then for the warm-up repetitions and finally for the timed repetitions.
+		 *
+		 * @param[in]	func	Function to benchmark. Executed once per iteration.
+		 */
+		template<class T>
+		void measure(T func)
+		{
+			UINT64 iterations = 1;
+			while(true)
+			{
+				const UINT64 elapsedNs = runIterations(func, iterations);
+				if(elapsedNs >= mMinRepetitionTimeNs || iterations >= MAX_ITERATIONS)
+					break;
+
+				// Grow geometrically, but aim straight for the target if the estimate is already reliable
+				UINT64 estimate = elapsedNs > 1000 ? (mMinRepetitionTimeNs * iterations) / elapsedNs + 1 : iterations * 10;
+				iterations = std::min(std::max(estimate, iterations * 2), MAX_ITERATIONS);
+			}
+
+			for(UINT32 i = 0; i < mSettings.warmupRepetitions; i++)
+				runIterations(func, iterations);
+
+			Vector<double> samples(std::max(mSettings.repetitions, 1U));
+			for(auto& sample : samples)
+				sample = runIterations(func, iterations) / (double)iterations;
+
+			calculateResult(samples, iterations);
+		}
+
+		/**
+		 * Sets the number of items (e.g. elements, bytes or objects) processed by a single iteration, so throughput can
+		 * be reported.
+		 */
+		void setItemsPerIteration(UINT64 items) { mItemsPerIteration = items; }
+
+		/**
+		 * Reports an additional value along with the timings. The value is not compared against baselines. Calling the
+		 * method again with the same name overwrites the previous value.
+		 */
+		void setCounter(const String& name, double value) { mResult.counters[name] = value; }
+
+		/** Returns the results of the benchmark. Only valid after measure() was called. */
+		const BenchmarkResult& getResult() const { return mResult; }
+
+		/** Returns true if measure() was called. */
+		bool hasResult() const { return mResult.repetitions > 0; }
+
+		/**
+		 * Ensures the compiler doesn't optimize away the calculation of the provided value, in case the value isn't
+		 * otherwise used.
+		 */
+		template<class T>
+		static void doNotOptimize(const T& value)
+		{
+#if BS_COMPILER == BS_COMPILER_GNUC || BS_COMPILER == BS_COMPILER_CLANG
+			asm volatile("" : : "r,m"(value) : "memory");
+#else
+			escape(&value);
+#endif
+		}
+
+	private:
+		/** Maximum number of iterations in a single repetition. */
+		static constexpr UINT64 MAX_ITERATIONS = 1ULL << 32;
+
+		/** Runs the provided function the specified number of times, and returns the elapsed time in nanoseconds. */
+		template<class T>
+		UINT64 runIterations(T& func, UINT64 count)
+		{
+			const UINT64 start = getTimeNs();
+			for(UINT64 i = 0; i < count; i++)
+				func();
+
+			return getTimeNs() - start;
+		}
+
+		/** Fills out the benchmark result from per-iteration times of each repetition. */
+		void calculateResult(Vector<double>& samples, UINT64 iterations);
+
+		/** Returns the current time of a high resolution clock, in nanoseconds. */
+		static UINT64 getTimeNs();
+
+		/** Forces the value at the provided address to be considered used, on compilers without inline assembly. */
+		static void escape(const void* ptr);
+
+		const BenchmarkSettings& mSettings;
+		UINT64 mMinRepetitionTimeNs;
+		UINT64 mItemsPerIteration = 0;
+		BenchmarkResult mResult;
+	};
+
+	/**
+	 * Primary class for benchmarking. Override and register benchmarks in constructor then run the benchmarks using the
+	 * desired method of output.
+	 */
+	class BS_UTILITY_EXPORT BenchmarkSuite
+	{
+	public:
+		typedef void(BenchmarkSuite::*Func)(Benchmark&);
+
+	private:
+		/** Contains data about a single benchmark. */
+		struct BenchmarkEntry
+		{
+			BenchmarkEntry(Func benchmark, const String& name);
+
+			Func benchmark;
+			String name;
+		};
+
+	public:
+		virtual ~BenchmarkSuite() = default;
+
+		/**
+		 * Runs all the benchmarks in the suite (and sub-suites). Results are reported to the provided output class.
+		 *
+		 * @param[in]	settings	Settings controlling how are the benchmarks executed.
+		 * @param[in]	output		Output to report the results to.
+		 */
+		void run(const BenchmarkSettings& settings, BenchmarkOutput& output);
+
+		/** Adds a new child suite to this suite. This method allows you to group suites and execute them all at once. */
+		void add(const SPtr<BenchmarkSuite>& suite);
+
+		/**	Creates a new suite of a particular type. */
+		template <class T>
+		static SPtr<BenchmarkSuite> create()
+		{
+			static_assert((std::is_base_of<BenchmarkSuite, T>::value),
+				"Invalid benchmark suite type. It needs to derive from bs::BenchmarkSuite.");
+
+			return std::static_pointer_cast<BenchmarkSuite>(bs_shared_ptr_new<T>());
+		}
+
+	protected:
+		BenchmarkSuite() = default;
+
+		/** Called right before any benchmarks are ran. */
+		virtual void startUp() {}
+
+		/**	Called after all benchmarks and child suite's benchmarks are ran. */
+		virtual void shutDown() {}
+
+		/**
+		 * Register a new benchmark.
+		 *
+		 * @param[in]	benchmark	Function to call in order to execute the benchmark.
+		 * @param[in]	name		Name of the benchmark, used for identifying it in the output and when filtering.
+		 */
+		void addBenchmark(Func benchmark, const String& name);
+
+		Vector<BenchmarkEntry> mBenchmarks;
+		Vector<SPtr<BenchmarkSuite>> mSuites;
+	};
+
+/** Registers a new benchmark within an implementation of BenchmarkSuite. */
+#define BS_ADD_BENCHMARK(func) addBenchmark(static_cast<Func>(&func), #func);
+
+	/** @} */
+}
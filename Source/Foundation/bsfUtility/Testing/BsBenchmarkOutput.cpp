@@ -0,0 +1,189 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Testing/BsBenchmarkOutput.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+#include "ThirdParty/json.hpp"
+#include <iostream>
+#include <iomanip>
+
+namespace bs
+{
+	/** Version of the JSON format written by BenchmarkUtility::saveResults(). */
+	static constexpr UINT32 RESULTS_VERSION = 1;
+
+	/** Formats a time in nanoseconds using the most readable unit. */
+	static String formatTime(double timeNs)
+	{
+		StringStream output;
+		output << std::fixed << std::setprecision(2);
+
+		if(timeNs >= 1000000000.0)
+			output << timeNs / 1000000000.0 << " s";
+		else if(timeNs >= 1000000.0)
+			output << timeNs / 1000000.0 << " ms";
+		else if(timeNs >= 1000.0)
+			output << timeNs / 1000.0 << " us";
+		else
+			output << timeNs << " ns";
+
+		return output.str();
+	}
+
+	void ConsoleBenchmarkOutput::outputResult(const BenchmarkResult& result)
+	{
+		mResults.push_back(result);
+
+		const double relativeStdDev = result.meanNs > 0.0 ? result.stdDevNs / result.meanNs * 100.0 : 0.0;
+
+		std::cout << std::left << std::setw(60) << result.name << std::right <<
+			" median " << std::setw(12) << formatTime(result.medianNs) <<
+			" min " << std::setw(12) << formatTime(result.minNs) <<
+			" +/- " << std::fixed << std::setprecision(1) << std::setw(5) << relativeStdDev << "%";
+
+		if(result.itemsPerSecond > 0.0)
+			std::cout << " " << std::setprecision(2) << std::setw(10) << result.itemsPerSecond / 1000000.0 << " M items/s";
+
+		for(auto& entry : result.counters)
+			std::cout << " " << entry.first << " " << std::setprecision(3) << entry.second;
+
+		std::cout << " (" << result.repetitions << " x " << result.iterations << ")" << std::endl;
+	}
+
+	bool BenchmarkUtility::saveResults(const Path& path, const Vector<BenchmarkResult>& results)
+	{
+		nlohmann::json resultsJSON = nlohmann::json::array();
+		for(auto& result : results)
+		{
+			nlohmann::json entryJSON = {
+				{ "name", result.name.c_str() },
+				{ "repetitions", result.repetitions },
+				{ "iterations", result.iterations },
+				{ "minNs", result.minNs },
+				{ "maxNs", result.maxNs },
+				{ "meanNs", result.meanNs },
+				{ "medianNs", result.medianNs },
+				{ "stdDevNs", result.stdDevNs },
+				{ "itemsPerSecond", result.itemsPerSecond }
+			};
+
+			if(!result.counters.empty())
+			{
+				nlohmann::json countersJSON = nlohmann::json::object();
+				for(auto& entry : result.counters)
+					countersJSON[entry.first.c_str()] = entry.second;
+
+				entryJSON["counters"] = countersJSON;
+			}
+
+			resultsJSON.push_back(entryJSON);
+		}
+
+		nlohmann::json rootJSON = {
+			{ "version", RESULTS_VERSION },
+			{ "results", resultsJSON }
+		};
+
+		SPtr<DataStream> stream = FileSystem::createAndOpenFile(path);
+		if(stream == nullptr)
+			return false;
+
+		const String jsonString = rootJSON.dump(1, '\t').c_str();
+		stream->writeString(jsonString);
+		stream->close();
+
+		return true;
+	}
+
+	bool BenchmarkUtility::loadResults(const Path& path, Vector<BenchmarkResult>& results)
+	{
+		SPtr<DataStream> stream = FileSystem::openFile(path);
+		if(stream == nullptr)
+			return false;
+
+		const String jsonString = stream->getAsString();
+		stream->close();
+
+		nlohmann::json rootJSON = nlohmann::json::parse(jsonString.c_str(), nullptr, false);
+		if(rootJSON.is_discarded() || !rootJSON.is_object() || rootJSON.find("results") == rootJSON.end())
+			return false;
+
+		for(auto& entryJSON : rootJSON["results"])
+		{
+			BenchmarkResult result;
+			result.name = entryJSON.value("name", std::string()).c_str();
+			result.repetitions = entryJSON.value("repetitions", 0U);
+			result.iterations = entryJSON.value("iterations", (UINT64)0);
+			result.minNs = entryJSON.value("minNs", 0.0);
+			result.maxNs = entryJSON.value("maxNs", 0.0);
+			result.meanNs = entryJSON.value("meanNs", 0.0);
+			result.medianNs = entryJSON.value("medianNs", 0.0);
+			result.stdDevNs = entryJSON.value("stdDevNs", 0.0);
+			result.itemsPerSecond = entryJSON.value("itemsPerSecond", 0.0);
+
+			auto iterFindCounters = entryJSON.find("counters");
+			if(iterFindCounters != entryJSON.end() && iterFindCounters->is_object())
+			{
+				for(auto iter = iterFindCounters->begin(); iter != iterFindCounters->end(); ++iter)
+				{
+					if(iter.value().is_number())
+						result.counters[iter.key().c_str()] = iter.value().get<double>();
+				}
+			}
+
+			results.push_back(result);
+		}
+
+		return true;
+	}
+
+	UINT32 BenchmarkUtility::compareResults(const Vector<BenchmarkResult>& results, const Vector<BenchmarkResult>& baseline,
+		double tolerance)
+	{
+		UnorderedMap<String, const BenchmarkResult*> baselineLookup;
+		for(auto& entry : baseline)
+			baselineLookup[entry.name] = &entry;
+
+		UINT32 numRegressions = 0;
+		for(auto& result : results)
+		{
+			std::cout << std::left << std::setw(60) << result.name << std::right;
+
+			auto iterFind = baselineLookup.find(result.name);
+			if(iterFind == baselineLookup.end())
+			{
+				std::cout << " " << std::setw(12) << formatTime(result.medianNs) << " (not in baseline)" << std::endl;
+				continue;
+			}
+
+			const BenchmarkResult& baselineResult = *iterFind->second;
+			baselineLookup.erase(iterFind);
+
+			const double change = baselineResult.medianNs > 0.0 ?
+				(result.medianNs - baselineResult.medianNs) / baselineResult.medianNs : 0.0;
+
+			std::cout << " " << std::setw(12) << formatTime(baselineResult.medianNs) << " -> " << std::setw(12) <<
+				formatTime(result.medianNs) << " " << std::showpos << std::fixed << std::setprecision(1) << std::setw(7) <<
+				change * 100.0 << "%" << std::noshowpos;
+
+			if(change > tolerance)
+			{
+				std::cout << "  REGRESSION";
+				numRegressions++;
+			}
+
+			std::cout << std::endl;
+		}
+
+		for(auto& entry : baseline)
+		{
+			if(baselineLookup.find(entry.name) != baselineLookup.end())
+				std::cout << std::left << std::setw(60) << entry.name << std::right << " (missing from results)" << std::endl;
+		}
+
+		std::cout << numRegressions << " regression(s) beyond " << std::fixed << std::setprecision(1) <<
+			tolerance * 100.0 << "% tolerance." << std::endl;
+
+		return numRegressions;
+	}
+}
@@ -0,0 +1,69 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "Prerequisites/BsPrerequisitesUtil.h"
+#include "Testing/BsBenchmark.h"
+
+namespace bs
+{
+	/** @addtogroup Testing
+	 *  @{
+	 */
+
+	/** Abstract interface used for outputting benchmark results. */
+	class BS_UTILITY_EXPORT BenchmarkOutput
+	{
+	public:
+		virtual ~BenchmarkOutput() = default;
+
+		/** Triggered when a benchmark finishes running. */
+		virtual void outputResult(const BenchmarkResult& result) = 0;
+	};
+
+	/** Outputs benchmark results to stdout as they complete, and keeps them so they can be saved or compared later. */
+	class BS_UTILITY_EXPORT ConsoleBenchmarkOutput : public BenchmarkOutput
+	{
+	public:
+		/** @copydoc BenchmarkOutput::outputResult */
+		void outputResult(const BenchmarkResult& result) final override;
+
+		/** Returns all the results output so far. */
+		const Vector<BenchmarkResult>& getResults() const { return mResults; }
+
+	private:
+		Vector<BenchmarkResult> mResults;
+	};
+
+	/** Helper methods for storing benchmark results and comparing them against a baseline. */
+	class BS_UTILITY_EXPORT BenchmarkUtility
+	{
+	public:
+		/** Writes the provided results to a JSON file. */
+		static bool saveResults(const Path& path, const Vector<BenchmarkResult>& results);
+
+		/**
+		 * Reads results previously written by saveResults().
+		 *
+		 * @param[in]	path		Path to the JSON file to read.
+		 * @param[out]	results		Results read from the file.
+		 * @return					True if the file was read successfully.
+		 */
+		static bool loadResults(const Path& path, Vector<BenchmarkResult>& results);
+
+		/**
+		 * Compares the median times of the provided results against the baseline results, and outputs the comparison
+		 * to stdout. Benchmarks not present in both sets are listed but not compared.
+		 *
+		 * @param[in]	results		Results of the current run.
+		 * @param[in]	baseline	Results to compare against.
+		 * @param[in]	tolerance	Relative slowdown allowed before a benchmark is considered to have regressed, e.g.
+		 *							0.1 allows benchmarks to be up to 10% slower than the baseline.
+		 * @return					Number of benchmarks that regressed.
+		 */
+		static UINT32 compareResults(const Vector<BenchmarkResult>& results, const Vector<BenchmarkResult>& baseline,
+			double tolerance);
+	};
+
+	/** @} */
+}
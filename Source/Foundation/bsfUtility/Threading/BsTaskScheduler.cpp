@@ -2,6 +2,7 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "Threading/BsTaskScheduler.h"
 #include "Threading/BsThreadPool.h"
+#include "Debug/BsTraceCapture.h"
 
 namespace bs
 {
@@ -218,7 +219,10 @@ namespace bs
 
 	void TaskScheduler::runTask(SPtr<Task> task)
 	{
-		task->mTaskWorker();
+		{
+			TraceScope traceScope(task->mName.c_str());
+			task->mTaskWorker();
+		}
 
 		{
 			Lock lock(mReadyMutex);
@@ -282,4 +286,71 @@ namespace bs
 		// Otherwise the task with the higher priority always goes first
 		return lhs->mPriority > rhs->mPriority;
 	}
+
+	BoundedTaskQueue::BoundedTaskQueue(String name, UINT32 maxConcurrent, TaskPriority priority)
+		: mName(std::move(name)), mPriority(priority), mMaxConcurrent(maxConcurrent)
+	{ }
+
+	BoundedTaskQueue::~BoundedTaskQueue()
+	{
+		waitUntilEmpty();
+	}
+
+	void BoundedTaskQueue::push(std::function<void()> work)
+	{
+		Lock lock(mMutex);
+
+		mPending.push(std::move(work));
+		startPending();
+	}
+
+	void BoundedTaskQueue::setMaxConcurrent(UINT32 maxConcurrent)
+	{
+		Lock lock(mMutex);
+
+		mMaxConcurrent = maxConcurrent;
+		startPending();
+	}
+
+	void BoundedTaskQueue::waitUntilEmpty()
+	{
+		Lock lock(mMutex);
+
+		while(mNumActive > 0 || !mPending.empty())
+			mEmptyCond.wait(lock);
+	}
+
+	void BoundedTaskQueue::startPending()
+	{
+		UINT32 maxConcurrent = mMaxConcurrent;
+		if(maxConcurrent == 0)
+			maxConcurrent = std::max(TaskScheduler::instance().getNumWorkers(), 1U);
+
+		while(mNumActive < maxConcurrent && !mPending.empty())
+		{
+			std::function<void()> work = std::move(mPending.front());
+			mPending.pop();
+
+			mNumActive++;
+
+			const auto worker = [this, work]
+			{
+				work();
+				onItemFinished();
+			};
+
+			TaskScheduler::instance().addTask(Task::create(mName, worker, mPriority));
+		}
+	}
+
+	void BoundedTaskQueue::onItemFinished()
+	{
+		Lock lock(mMutex);
+
+		mNumActive--;
+		startPending();
+
+		if(mNumActive == 0 && mPending.empty())
+			mEmptyCond.notify_all();
+	}
 }
@@ -194,5 +194,56 @@ namespace bs
 		Signal mTaskCompleteCond;
 	};
 
+	/**
+	 * Queues work items on the TaskScheduler, while limiting how many of them may execute at the same time. Items are
+	 * started in the order they were queued. Useful for splitting work into stages with separate concurrency limits.
+	 *
+	 * @note	Thread safe.
+	 */
+	class BS_UTILITY_EXPORT BoundedTaskQueue
+	{
+	public:
+		/**
+		 * Creates a new task queue.
+		 *
+		 * @param[in]	name			Name of the tasks created by the queue.
+		 * @param[in]	maxConcurrent	Maximum number of items that may execute at the same time. If zero, the number of
+		 *								TaskScheduler workers is used.
+		 * @param[in]	priority		Priority of the tasks created by the queue.
+		 */
+		BoundedTaskQueue(String name, UINT32 maxConcurrent = 0, TaskPriority priority = TaskPriority::Normal);
+
+		/** Blocks until all queued items finish executing. */
+		~BoundedTaskQueue();
+
+		/** Queues a new work item. The item is started immediately if below the concurrency limit. */
+		void push(std::function<void()> work);
+
+		/** 
+		 * Changes the maximum number of items that may execute at the same time. If zero, the number of TaskScheduler 
+		 * workers is used. 
+		 */
+		void setMaxConcurrent(UINT32 maxConcurrent);
+
+		/** Blocks the calling thread until all queued items finish executing. */
+		void waitUntilEmpty();
+
+	private:
+		/** Starts as many pending items as the concurrency limit allows. Caller must hold the mutex. */
+		void startPending();
+
+		/** Called from the worker thread after an item finishes executing. */
+		void onItemFinished();
+
+		String mName;
+		TaskPriority mPriority;
+		UINT32 mMaxConcurrent;
+		UINT32 mNumActive = 0;
+		Queue<std::function<void()>> mPending;
+
+		Mutex mMutex;
+		Signal mEmptyCond;
+	};
+
 	/** @} */
 }
@@ -2,11 +2,21 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "Utility/BsCompression.h"
 #include "FileSystem/BsDataStream.h"
+#include "Threading/BsTaskScheduler.h"
+#include "Debug/BsDebug.h"
 
 // Third party
 #include "snappy.h"
 #include "snappy-sinksource.h"
-#include "Debug/BsDebug.h"
+
+#if BS_LZ4_COMPRESSION
+#include "lz4.h"
+#endif
+
+#if BS_ZSTD_COMPRESSION
+#include "zstd.h"
+#include "zdict.h"
+#endif
 
 namespace bs
 {
@@ -22,6 +32,12 @@ namespace bs
 
 			if (mStream->isFile())
 				mReadBuffer = (char*)bs_alloc(32768);
+			else
+			{
+				// Read directly from memory (including mapped files), starting at the current stream position
+				SPtr<MemoryDataStream> memStream = std::static_pointer_cast<MemoryDataStream>(mStream);
+				mMemoryData = (char*)memStream->getCurrentPtr();
+			}
 		}
 
 		virtual ~DataStreamSource()
@@ -39,10 +55,8 @@ namespace bs
 		{
 			if (!mStream->isFile())
 			{
-				SPtr<MemoryDataStream> memStream = std::static_pointer_cast<MemoryDataStream>(mStream);
-
 				*len = Available();
-				return (char*)memStream->getPtr() + mBufferOffset;
+				return mMemoryData + mBufferOffset;
 			}
 			else
 			{
@@ -76,6 +90,9 @@ namespace bs
 		size_t mTotal;
 		size_t mBufferOffset = 0;
 
+		// Memory streams only
+		char* mMemoryData = nullptr;
+
 		// File streams only
 		char* mReadBuffer = nullptr;
 		size_t mReadBufferContentSize = 0;
@@ -173,6 +190,417 @@ namespace bs
 		Vector<BufferPiece> mBufferPieces;
 	};
 
+#if BS_LZ4_COMPRESSION
+	/** Block codec using the LZ4 compression library. */
+	class LZ4CompressionCodec : public CompressionCodec
+	{
+	public:
+		CompressionMethod getMethod() const override { return CompressionMethod::LZ4; }
+
+		size_t getMaxCompressedSize(size_t size) const override
+		{
+			return (size_t)LZ4_compressBound((int)size);
+		}
+
+		size_t compress(const UINT8* input, size_t inputSize, UINT8* output, size_t outputSize) const override
+		{
+			int numBytes = LZ4_compress_default((const char*)input, (char*)output, (int)inputSize, (int)outputSize);
+			return numBytes > 0 ? (size_t)numBytes : 0;
+		}
+
+		bool decompress(const UINT8* input, size_t inputSize, UINT8* output, size_t outputSize) const override
+		{
+			int numBytes = LZ4_decompress_safe((const char*)input, (char*)output, (int)inputSize, (int)outputSize);
+			return numBytes == (int)outputSize;
+		}
+	};
+#endif
+
+#if BS_ZSTD_COMPRESSION
+	/** Block codec using the Zstandard compression library, with support for trained dictionaries. */
+	class ZstdCompressionCodec : public CompressionCodec
+	{
+		/** Dictionary digested for use by both the compressor and the decompressor. */
+		struct Dictionary
+		{
+			Dictionary(const SPtr<MemoryDataStream>& data, int compressionLevel)
+			{
+				compressDict = ZSTD_createCDict(data->getPtr(), data->size(), compressionLevel);
+				decompressDict = ZSTD_createDDict(data->getPtr(), data->size());
+			}
+
+			~Dictionary()
+			{
+				ZSTD_freeCDict(compressDict);
+				ZSTD_freeDDict(decompressDict);
+			}
+
+			ZSTD_CDict* compressDict;
+			ZSTD_DDict* decompressDict;
+		};
+
+	public:
+		CompressionMethod getMethod() const override { return CompressionMethod::Zstd; }
+
+		size_t getMaxCompressedSize(size_t size) const override
+		{
+			return ZSTD_compressBound(size);
+		}
+
+		size_t compress(const UINT8* input, size_t inputSize, UINT8* output, size_t outputSize) const override
+		{
+			SPtr<Dictionary> dictionary;
+			{
+				Lock lock(mMutex);
+				dictionary = mCompressionDictionary;
+			}
+
+			size_t numBytes;
+			if(dictionary)
+			{
+				ZSTD_CCtx* context = ZSTD_createCCtx();
+				numBytes = ZSTD_compress_usingCDict(context, output, outputSize, input, inputSize, 
+					dictionary->compressDict);
+				ZSTD_freeCCtx(context);
+			}
+			else
+				numBytes = ZSTD_compress(output, outputSize, input, inputSize, COMPRESSION_LEVEL);
+
+			return ZSTD_isError(numBytes) ? 0 : numBytes;
+		}
+
+		bool decompress(const UINT8* input, size_t inputSize, UINT8* output, size_t outputSize) const override
+		{
+			SPtr<Dictionary> dictionary;
+
+			const UINT32 dictionaryId = ZSTD_getDictID_fromFrame(input, inputSize);
+			if(dictionaryId != 0)
+			{
+				Lock lock(mMutex);
+
+				auto iterFind = mDictionaries.find(dictionaryId);
+				if(iterFind == mDictionaries.end())
+				{
+					LOGERR("Decompression failed, data was compressed using a dictionary that isn't registered: " + 
+						toString(dictionaryId));
+					return false;
+				}
+
+				dictionary = iterFind->second;
+			}
+
+			ZSTD_DCtx* context = ZSTD_createDCtx();
+
+			size_t numBytes;
+			if(dictionary)
+			{
+				numBytes = ZSTD_decompress_usingDDict(context, output, outputSize, input, inputSize, 
+					dictionary->decompressDict);
+			}
+			else
+				numBytes = ZSTD_decompressDCtx(context, output, outputSize, input, inputSize);
+
+			ZSTD_freeDCtx(context);
+			return !ZSTD_isError(numBytes) && numBytes == outputSize;
+		}
+
+		void addDictionary(const SPtr<MemoryDataStream>& data, bool useForCompression) override
+		{
+			// Dictionaries without an ID can't be identified when decompressing
+			const UINT32 dictionaryId = ZDICT_getDictID(data->getPtr(), data->size());
+			if(dictionaryId == 0)
+			{
+				LOGWRN("Provided compression dictionary is not a valid Zstandard dictionary. Ignoring.");
+				return;
+			}
+
+			SPtr<Dictionary> dictionary = bs_shared_ptr_new<Dictionary>(data, COMPRESSION_LEVEL);
+
+			Lock lock(mMutex);
+			mDictionaries[dictionaryId] = dictionary;
+
+			if(useForCompression)
+				mCompressionDictionary = dictionary;
+		}
+
+		SPtr<MemoryDataStream> trainDictionary(const Vector<SPtr<DataStream>>& samples, size_t maxSize) const override
+		{
+			size_t totalSize = 0;
+			for(auto& entry : samples)
+				totalSize += entry->size() - entry->tell();
+
+			Vector<size_t> sampleSizes;
+			sampleSizes.reserve(samples.size());
+
+			UINT8* sampleData = (UINT8*)bs_alloc(totalSize);
+			UINT8* writePtr = sampleData;
+			for(auto& entry : samples)
+			{
+				const size_t numBytes = entry->read(writePtr, entry->size() - entry->tell());
+				sampleSizes.push_back(numBytes);
+				writePtr += numBytes;
+			}
+
+			UINT8* dictionaryData = (UINT8*)bs_alloc(maxSize);
+			const size_t dictionarySize = ZDICT_trainFromBuffer(dictionaryData, maxSize, sampleData, sampleSizes.data(),
+				(unsigned)sampleSizes.size());
+
+			bs_free(sampleData);
+
+			if(ZDICT_isError(dictionarySize))
+			{
+				LOGWRN("Unable to train a compression dictionary: " + String(ZDICT_getErrorName(dictionarySize)));
+
+				bs_free(dictionaryData);
+				return nullptr;
+			}
+
+			SPtr<MemoryDataStream> output = bs_shared_ptr_new<MemoryDataStream>(dictionarySize);
+			output->write(dictionaryData, dictionarySize);
+			output->seek(0);
+
+			bs_free(dictionaryData);
+			return output;
+		}
+
+	private:
+		// Resources are compressed offline and decompression speed barely depends on the level, so favor the ratio
+		static constexpr int COMPRESSION_LEVEL = 9;
+
+		mutable Mutex mMutex;
+		UnorderedMap<UINT32, SPtr<Dictionary>> mDictionaries;
+		SPtr<Dictionary> mCompressionDictionary;
+	};
+
+	constexpr int ZstdCompressionCodec::COMPRESSION_LEVEL;
+#endif
+
+	/** Keeps track of all available block compression codecs. */
+	struct CompressionCodecRegistry
+	{
+		CompressionCodecRegistry()
+		{
+#if BS_LZ4_COMPRESSION
+			codecs[(UINT32)CompressionMethod::LZ4] = bs_shared_ptr_new<LZ4CompressionCodec>();
+#endif
+
+#if BS_ZSTD_COMPRESSION
+			codecs[(UINT32)CompressionMethod::Zstd] = bs_shared_ptr_new<ZstdCompressionCodec>();
+#endif
+		}
+
+		Mutex mutex;
+		UnorderedMap<UINT32, SPtr<CompressionCodec>> codecs;
+	};
+
+	static CompressionCodecRegistry& getCodecRegistry()
+	{
+		static CompressionCodecRegistry registry;
+		return registry;
+	}
+
+	/** 
+	 * Header written at the start of data compressed by block codecs. Followed by a table of compressed block sizes (one
+	 * UINT32 per block), followed by the compressed blocks themselves.
+	 */
+	struct CompressedBlockHeader
+	{
+		UINT64 uncompressedSize;
+		UINT32 blockSize;
+		UINT32 numBlocks;
+	};
+
+	/** Set on entries in the block size table for blocks that didn't compress and are stored as is. */
+	static constexpr UINT32 UNCOMPRESSED_BLOCK_FLAG = 0x80000000;
+
+	/** 
+	 * Returns a pointer to the remaining contents of the stream and advances the stream to its end. Contents of memory
+	 * streams are referenced directly, while other streams are read into the provided buffer.
+	 */
+	static const UINT8* readRemainingData(const SPtr<DataStream>& input, SPtr<MemoryDataStream>& buffer, size_t& size)
+	{
+		size = input->size() - input->tell();
+
+		if(!input->isFile())
+		{
+			SPtr<MemoryDataStream> memStream = std::static_pointer_cast<MemoryDataStream>(input);
+			const UINT8* data = memStream->getCurrentPtr();
+			memStream->skip(size);
+
+			return data;
+		}
+
+		buffer = bs_shared_ptr_new<MemoryDataStream>(size);
+		size = input->read(buffer->getPtr(), size);
+
+		return buffer->getPtr();
+	}
+
+	/** 
+	 * Executes the worker once for each of the blocks. Multiple blocks are processed in parallel on the TaskScheduler
+	 * if it is available.
+	 */
+	static void processBlocks(const String& name, UINT32 numBlocks, const std::function<void(UINT32)>& worker,
+		const std::function<void(float)>& reportProgress)
+	{
+		if(numBlocks > 1 && TaskScheduler::isStarted())
+		{
+			SPtr<TaskGroup> taskGroup = TaskGroup::create(name, worker, numBlocks);
+			TaskScheduler::instance().addTaskGroup(taskGroup);
+			taskGroup->wait();
+
+			if(reportProgress)
+				reportProgress(1.0f);
+		}
+		else
+		{
+			for(UINT32 i = 0; i < numBlocks; i++)
+			{
+				worker(i);
+
+				if(reportProgress)
+					reportProgress((i + 1) / (float)numBlocks);
+			}
+		}
+	}
+
+	/** Compresses the stream in independent blocks using the provided block codec. */
+	static SPtr<MemoryDataStream> compressBlocks(const CompressionCodec& codec, const SPtr<DataStream>& input,
+		const std::function<void(float)>& reportProgress)
+	{
+		SPtr<MemoryDataStream> inputBuffer;
+		size_t inputSize;
+		const UINT8* inputData = readRemainingData(input, inputBuffer, inputSize);
+
+		const UINT32 blockSize = Compression::BLOCK_SIZE;
+		const auto numBlocks = (UINT32)((inputSize + blockSize - 1) / blockSize);
+
+		// Blocks that don't compress are stored as is, so each slot must also be able to hold an uncompressed block
+		const size_t maxCompressedBlockSize = std::max(codec.getMaxCompressedSize(blockSize), (size_t)blockSize);
+
+		UINT8* scratch = (UINT8*)bs_alloc(maxCompressedBlockSize * numBlocks);
+		Vector<UINT32> blockSizes(numBlocks);
+
+		auto worker = [&](UINT32 idx)
+		{
+			const size_t offset = idx * (size_t)blockSize;
+			const size_t size = std::min((size_t)blockSize, inputSize - offset);
+
+			UINT8* output = scratch + idx * maxCompressedBlockSize;
+			size_t compressedSize = codec.compress(inputData + offset, size, output, maxCompressedBlockSize);
+
+			// Store the block as is if it doesn't compress
+			if(compressedSize == 0 || compressedSize >= size)
+			{
+				memcpy(output, inputData + offset, size);
+				blockSizes[idx] = (UINT32)size | UNCOMPRESSED_BLOCK_FLAG;
+			}
+			else
+				blockSizes[idx] = (UINT32)compressedSize;
+		};
+
+		processBlocks("Compress", numBlocks, worker, reportProgress);
+
+		CompressedBlockHeader header;
+		header.uncompressedSize = inputSize;
+		header.blockSize = blockSize;
+		header.numBlocks = numBlocks;
+
+		size_t outputSize = sizeof(header) + numBlocks * sizeof(UINT32);
+		for(auto& entry : blockSizes)
+			outputSize += entry & ~UNCOMPRESSED_BLOCK_FLAG;
+
+		SPtr<MemoryDataStream> output = bs_shared_ptr_new<MemoryDataStream>(outputSize);
+		output->write(&header, sizeof(header));
+		output->write(blockSizes.data(), numBlocks * sizeof(UINT32));
+
+		for(UINT32 i = 0; i < numBlocks; i++)
+			output->write(scratch + i * maxCompressedBlockSize, blockSizes[i] & ~UNCOMPRESSED_BLOCK_FLAG);
+
+		bs_free(scratch);
+
+		output->seek(0);
+		return output;
+	}
+
+	/** Decompresses a stream compressed by compressBlocks() using the provided block codec. */
+	static SPtr<MemoryDataStream> decompressBlocks(const CompressionCodec& codec, const SPtr<DataStream>& input,
+		const std::function<void(float)>& reportProgress)
+	{
+		SPtr<MemoryDataStream> inputBuffer;
+		size_t inputSize;
+		const UINT8* inputData = readRemainingData(input, inputBuffer, inputSize);
+
+		CompressedBlockHeader header;
+		if(inputSize < sizeof(header))
+		{
+			LOGERR("Decompression failed, corrupt data.");
+			return nullptr;
+		}
+
+		memcpy(&header, inputData, sizeof(header));
+
+		const size_t tableSize = header.numBlocks * sizeof(UINT32);
+		const UINT64 expectedNumBlocks = (header.uncompressedSize + header.blockSize - 1) / std::max(header.blockSize, 1U);
+		if(header.blockSize == 0 || header.numBlocks != expectedNumBlocks || inputSize < sizeof(header) + tableSize)
+		{
+			LOGERR("Decompression failed, corrupt data.");
+			return nullptr;
+		}
+
+		Vector<UINT32> blockSizes(header.numBlocks);
+		memcpy(blockSizes.data(), inputData + sizeof(header), tableSize);
+
+		Vector<size_t> blockOffsets(header.numBlocks);
+		size_t offset = sizeof(header) + tableSize;
+		for(UINT32 i = 0; i < header.numBlocks; i++)
+		{
+			blockOffsets[i] = offset;
+			offset += blockSizes[i] & ~UNCOMPRESSED_BLOCK_FLAG;
+		}
+
+		if(offset > inputSize)
+		{
+			LOGERR("Decompression failed, corrupt data.");
+			return nullptr;
+		}
+
+		SPtr<MemoryDataStream> output = bs_shared_ptr_new<MemoryDataStream>((size_t)header.uncompressedSize);
+		UINT8* outputData = output->getPtr();
+
+		std::atomic<bool> failed{false};
+		auto worker = [&](UINT32 idx)
+		{
+			const size_t outputOffset = idx * (size_t)header.blockSize;
+			const size_t size = std::min((size_t)header.blockSize, (size_t)header.uncompressedSize - outputOffset);
+
+			const UINT8* blockData = inputData + blockOffsets[idx];
+			const UINT32 blockSize = blockSizes[idx] & ~UNCOMPRESSED_BLOCK_FLAG;
+
+			if((blockSizes[idx] & UNCOMPRESSED_BLOCK_FLAG) != 0)
+			{
+				if(blockSize == size)
+					memcpy(outputData + outputOffset, blockData, size);
+				else
+					failed = true;
+			}
+			else if(!codec.decompress(blockData, blockSize, outputData + outputOffset, size))
+				failed = true;
+		};
+
+		processBlocks("Decompress", header.numBlocks, worker, reportProgress);
+
+		if(failed)
+		{
+			LOGERR("Decompression failed, corrupt data.");
+			return nullptr;
+		}
+
+		return output;
+	}
+
+	constexpr UINT32 Compression::BLOCK_SIZE;
+
 	SPtr<MemoryDataStream> Compression::compress(SPtr<DataStream>& input, std::function<void(float)> reportProgress)
 	{
 		DataStreamSource src(input, std::move(reportProgress));
@@ -198,4 +626,90 @@ namespace bs
 
 		return dst.GetOutput();
 	}
+
+	SPtr<MemoryDataStream> Compression::compress(SPtr<DataStream>& input, CompressionMethod method,
+		std::function<void(float)> reportProgress)
+	{
+		if(method == CompressionMethod::Snappy)
+			return compress(input, std::move(reportProgress));
+
+		SPtr<CompressionCodec> codec = getCodec(method);
+		if(codec == nullptr)
+		{
+			LOGERR("Compression failed, unsupported compression method: " + toString((UINT32)method));
+			return nullptr;
+		}
+
+		return compressBlocks(*codec, input, reportProgress);
+	}
+
+	SPtr<MemoryDataStream> Compression::decompress(SPtr<DataStream>& input, CompressionMethod method,
+		std::function<void(float)> reportProgress)
+	{
+		if(method == CompressionMethod::Snappy)
+			return decompress(input, std::move(reportProgress));
+
+		SPtr<CompressionCodec> codec = getCodec(method);
+		if(codec == nullptr)
+		{
+			LOGERR("Decompression failed, unsupported compression method: " + toString((UINT32)method));
+			return nullptr;
+		}
+
+		return decompressBlocks(*codec, input, reportProgress);
+	}
+
+	bool Compression::isSupported(CompressionMethod method)
+	{
+		if(method == CompressionMethod::None || method == CompressionMethod::Snappy)
+			return true;
+
+		return getCodec(method) != nullptr;
+	}
+
+	void Compression::registerCodec(const SPtr<CompressionCodec>& codec)
+	{
+		CompressionCodecRegistry& registry = getCodecRegistry();
+
+		Lock lock(registry.mutex);
+		registry.codecs[(UINT32)codec->getMethod()] = codec;
+	}
+
+	void Compression::unregisterCodec(CompressionMethod method)
+	{
+		CompressionCodecRegistry& registry = getCodecRegistry();
+
+		Lock lock(registry.mutex);
+		registry.codecs.erase((UINT32)method);
+	}
+
+	SPtr<CompressionCodec> Compression::getCodec(CompressionMethod method)
+	{
+		CompressionCodecRegistry& registry = getCodecRegistry();
+
+		Lock lock(registry.mutex);
+		auto iterFind = registry.codecs.find((UINT32)method);
+		if(iterFind != registry.codecs.end())
+			return iterFind->second;
+
+		return nullptr;
+	}
+
+	SPtr<MemoryDataStream> Compression::trainDictionary(CompressionMethod method, 
+		const Vector<SPtr<DataStream>>& samples, size_t maxSize)
+	{
+		SPtr<CompressionCodec> codec = getCodec(method);
+		if(codec == nullptr)
+			return nullptr;
+
+		return codec->trainDictionary(samples, maxSize);
+	}
+
+	void Compression::addDictionary(CompressionMethod method, const SPtr<MemoryDataStream>& data, 
+		bool useForCompression)
+	{
+		SPtr<CompressionCodec> codec = getCodec(method);
+		if(codec != nullptr)
+			codec->addDictionary(data, useForCompression);
+	}
 }
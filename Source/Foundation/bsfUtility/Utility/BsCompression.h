@@ -10,24 +10,145 @@ namespace bs
 	 *  @{
 	 */
 
+	/**
+	 * Identifies a compression method. Values are stored alongside compressed data and must never change. Values starting
+	 * at User are reserved for custom codecs registered through Compression::registerCodec().
+	 */
+	enum class CompressionMethod : UINT32
+	{
+		/** Data is not compressed. */
+		None = 0,
+		/** Snappy compression over the entire stream. */
+		Snappy = 1,
+		/** LZ4 compression in independent blocks. Fastest decompression. */
+		LZ4 = 2,
+		/** Zstandard compression in independent blocks, optionally using a trained dictionary. Best ratio. */
+		Zstd = 3,
+		/** First value available for custom codecs. */
+		User = 100
+	};
+
+	/**
+	 * Interface for a compression codec that compresses independent blocks of memory. Codecs are used by Compression
+	 * which splits streams into blocks, and processes those blocks in parallel.
+	 *
+	 * @note	Implementations must be thread safe, as multiple blocks are processed simultaneously.
+	 */
+	class BS_UTILITY_EXPORT CompressionCodec
+	{
+	public:
+		virtual ~CompressionCodec() = default;
+
+		/** Returns the method identifier stored alongside data compressed with this codec. */
+		virtual CompressionMethod getMethod() const = 0;
+
+		/** Returns the maximum number of bytes compress() can output for an input block of the specified size. */
+		virtual size_t getMaxCompressedSize(size_t size) const = 0;
+
+		/**
+		 * Compresses a single block of memory.
+		 *
+		 * @param[in]	input			Data to compress.
+		 * @param[in]	inputSize		Size of the data to compress, in bytes.
+		 * @param[out]	output			Buffer to write the compressed data to.
+		 * @param[in]	outputSize		Size of the output buffer, at least getMaxCompressedSize(inputSize) bytes.
+		 * @return						Number of bytes written to the output buffer, or 0 if compression failed.
+		 */
+		virtual size_t compress(const UINT8* input, size_t inputSize, UINT8* output, size_t outputSize) const = 0;
+
+		/**
+		 * Decompresses a single block of memory previously compressed with compress().
+		 *
+		 * @param[in]	input			Compressed data.
+		 * @param[in]	inputSize		Size of the compressed data, in bytes.
+		 * @param[out]	output			Buffer to write the decompressed data to.
+		 * @param[in]	outputSize		Exact size of the decompressed data, in bytes.
+		 * @return						True if the data was successfully decompressed.
+		 */
+		virtual bool decompress(const UINT8* input, size_t inputSize, UINT8* output, size_t outputSize) const = 0;
+
+		/**
+		 * Registers a dictionary that can be used for compressing and decompressing small blocks with better ratios.
+		 * Data compressed with a dictionary can only be decompressed while the same dictionary is registered. Codecs
+		 * that don't support dictionaries ignore this call.
+		 *
+		 * @param[in]	data				Dictionary contents, as returned by trainDictionary().
+		 * @param[in]	useForCompression	If true, the dictionary will be used for compressing any further blocks.
+		 *									Otherwise it is only used for decompressing data that references it.
+		 */
+		virtual void addDictionary(const SPtr<MemoryDataStream>& data, bool useForCompression) { }
+
+		/**
+		 * Trains a dictionary from a set of samples representative of the data that will be compressed. Returns null if
+		 * the codec doesn't support dictionaries or training failed.
+		 */
+		virtual SPtr<MemoryDataStream> trainDictionary(const Vector<SPtr<DataStream>>& samples, size_t maxSize) const
+		{
+			return nullptr;
+		}
+	};
+
 	/** Performs generic compression and decompression on raw data. */
 	class BS_UTILITY_EXPORT Compression
 	{
 	public:
-		/** 
+		/**
 		 * Compresses the data from the provided data stream and outputs the new stream with compressed data. Accepts
 		 * an optional callback to be triggered during the process to report progress in range [0, 1].
 		 */
-		static SPtr<MemoryDataStream> compress(SPtr<DataStream>& input, 
+		static SPtr<MemoryDataStream> compress(SPtr<DataStream>& input,
+			std::function<void(float)> reportProgress = nullptr);
+
+		/**
+		 * Compresses the data from the provided data stream using the specified method, and outputs the new stream with
+		 * compressed data. Large streams compressed by block codecs are split into blocks that are compressed in
+		 * parallel on the TaskScheduler. Accepts an optional callback to be triggered during the process to report
+		 * progress in range [0, 1]. Returns null if the method isn't supported.
+		 */
+		static SPtr<MemoryDataStream> compress(SPtr<DataStream>& input, CompressionMethod method,
 			std::function<void(float)> reportProgress = nullptr);
 
-		/** 
+		/**
 		 * Decompresses the data from the provided data stream and outputs the new stream with decompressed data. Accepts
-		 * an optional callback to be triggered during the process to report progress in range [0, 1]. 
+		 * an optional callback to be triggered during the process to report progress in range [0, 1].
+		 */
+		static SPtr<MemoryDataStream> decompress(SPtr<DataStream>& input,
+			std::function<void(float)> reportProgress = nullptr);
+
+		/**
+		 * Decompresses the data from the provided data stream previously compressed with the specified method, and
+		 * outputs the new stream with decompressed data. Accepts an optional callback to be triggered during the process
+		 * to report progress in range [0, 1]. Returns null if the method isn't supported or the data is corrupt.
 		 */
-		static SPtr<MemoryDataStream> decompress(SPtr<DataStream>& input, 
+		static SPtr<MemoryDataStream> decompress(SPtr<DataStream>& input, CompressionMethod method,
 			std::function<void(float)> reportProgress = nullptr);
+
+		/** Checks if the specified compression method can be used on this platform. */
+		static bool isSupported(CompressionMethod method);
+
+		/**
+		 * Registers a new block compression codec, or replaces an existing codec using the same method. Allows custom
+		 * compression methods to be used with compress() and decompress().
+		 */
+		static void registerCodec(const SPtr<CompressionCodec>& codec);
+
+		/** Unregisters a codec previously registered with registerCodec(). */
+		static void unregisterCodec(CompressionMethod method);
+
+		/** Returns a codec registered for the specified method, or null if none is registered. */
+		static SPtr<CompressionCodec> getCodec(CompressionMethod method);
+
+		/** @copydoc CompressionCodec::trainDictionary */
+		static SPtr<MemoryDataStream> trainDictionary(CompressionMethod method, const Vector<SPtr<DataStream>>& samples,
+			size_t maxSize = 112640);
+
+		/** @copydoc CompressionCodec::addDictionary */
+		static void addDictionary(CompressionMethod method, const SPtr<MemoryDataStream>& data,
+			bool useForCompression = true);
+
+		/** Size of the blocks (in bytes) block codecs split the input stream into. */
+		static constexpr UINT32 BLOCK_SIZE = 256 * 1024;
 	};
 
 	/** @} */
-}
\ No newline at end of file
+}
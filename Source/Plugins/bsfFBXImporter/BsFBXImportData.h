@@ -100,6 +100,9 @@ namespace bs
 		TAnimationCurve<Vector3> translation;
 		TAnimationCurve<Quaternion> rotation;
 		TAnimationCurve<Vector3> scale;
+
+		/** Rotation as read from the file, in euler angles. Converted into @p rotation once all clips are imported. */
+		TAnimationCurve<Vector3> eulerRotation;
 	};
 
 	/**	Animation curve required to animate a blend shape. */
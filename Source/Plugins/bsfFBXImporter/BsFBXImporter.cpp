@@ -23,9 +23,30 @@
 #include "Animation/BsMorphShapes.h"
 #include "Physics/BsPhysics.h"
 #include "FileSystem/BsFileSystem.h"
+#include "Threading/BsTaskScheduler.h"
 
 namespace bs
 {
+	/**
+	 * Executes @p worker once for each index in [0, @p count). If the task scheduler is running the calls are distributed
+	 * over worker threads, otherwise they're executed serially on the calling thread. Workers must only write to data
+	 * owned by their own index.
+	 */
+	static void forEachParallel(const String& name, UINT32 count, const std::function<void(UINT32)>& worker)
+	{
+		if(count > 1 && TaskScheduler::isStarted())
+		{
+			SPtr<TaskGroup> taskGroup = TaskGroup::create(name, worker, count);
+			TaskScheduler::instance().addTaskGroup(taskGroup);
+			taskGroup->wait();
+		}
+		else
+		{
+			for(UINT32 i = 0; i < count; i++)
+				worker(i);
+		}
+	}
+
 	Matrix4 FBXToNativeType(const FbxAMatrix& value)
 	{
 		Matrix4 native;
@@ -111,7 +132,13 @@ namespace bs
 		if (meshImportOptions->cpuCached)
 			desc.usage |= MU_CPUCACHED;
 
-		SPtr<Mesh> mesh = Mesh::_createPtr(rendererMeshData->getData(), desc);
+		SPtr<MeshData> meshData = MeshUtility::generateLODs(rendererMeshData->getData(), desc.subMeshes, 
+			meshImportOptions->lodScreenSizes, meshImportOptions->lodReduction, desc.lods);
+
+		if (meshImportOptions->compressVertices)
+			meshData = MeshUtility::compressVertices(meshData);
+
+		SPtr<Mesh> mesh = Mesh::_createPtr(meshData, desc);
 
 		const String fileName = filePath.getFilename(false);
 		mesh->setName(fileName);
@@ -133,7 +160,13 @@ namespace bs
 		if (meshImportOptions->cpuCached)
 			desc.usage |= MU_CPUCACHED;
 
-		SPtr<Mesh> mesh = Mesh::_createPtr(rendererMeshData->getData(), desc);
+		SPtr<MeshData> meshData = MeshUtility::generateLODs(rendererMeshData->getData(), desc.subMeshes, 
+			meshImportOptions->lodScreenSizes, meshImportOptions->lodReduction, desc.lods);
+
+		if (meshImportOptions->compressVertices)
+			meshData = MeshUtility::compressVertices(meshData);
+
+		SPtr<Mesh> mesh = Mesh::_createPtr(meshData, desc);
 
 		const String fileName = filePath.getFilename(false);
 		mesh->setName(fileName);
@@ -233,7 +266,26 @@ namespace bs
 			convertAnimations(importedScene.clips, splits, skeleton, meshImportOptions->importRootMotion, animation);
 		}
 
-		// TODO - Later: Optimize mesh: Remove bad and degenerate polygons, weld nearby vertices, optimize for vertex cache
+		if (meshImportOptions->optimizeMesh)
+		{
+			const SPtr<MeshData>& meshData = rendererMeshData->getData();
+
+			// Measuring the cache efficiency requires an extra pass over the indices, so only do it if it gets logged
+#if BS_LOG_LEVEL <= BS_LOG_LEVEL_DEBUG
+			const float acmrBefore = MeshUtility::calculateACMR(*meshData, subMeshes);
+			const UINT32 numVerticesBefore = meshData->getNumVertices();
+#endif
+
+			// Morph shapes reference vertices by index, so vertices can only be welded and reordered if there are none
+			SPtr<MeshData> optimizedMeshData = MeshUtility::optimize(meshData, subMeshes, morphShapes == nullptr);
+			rendererMeshData = RendererMeshData::create(optimizedMeshData);
+
+#if BS_LOG_LEVEL <= BS_LOG_LEVEL_DEBUG
+			LOGDBG_FMT("Optimized mesh \"{0}\": ACMR {1} -> {2}, vertices {3} -> {4}.", filePath.toString(), 
+				acmrBefore, MeshUtility::calculateACMR(*optimizedMeshData, subMeshes), numVerticesBefore, 
+				optimizedMeshData->getNumVertices());
+#endif
+		}
 
 		shutDownSdk();
 
@@ -654,20 +706,25 @@ namespace bs
 
 	void FBXImporter::splitMeshVertices(FBXImportScene& scene)
 	{
-		Vector<FBXImportMesh*> splitMeshes;
+		Vector<FBXImportMesh*> splitMeshes(scene.meshes.size());
 
-		for (auto& mesh : scene.meshes)
+		auto worker = [&scene, &splitMeshes](UINT32 idx)
 		{
+			FBXImportMesh* mesh = scene.meshes[idx];
+
 			FBXImportMesh* splitMesh = bs_new<FBXImportMesh>();
 			splitMesh->fbxMesh = mesh->fbxMesh;
 			splitMesh->referencedBy = mesh->referencedBy;
 			splitMesh->bones = mesh->bones;
 
 			FBXUtility::splitVertices(*mesh, *splitMesh);
-			splitMeshes.push_back(splitMesh);
+			splitMeshes[idx] = splitMesh;
+		};
+
+		forEachParallel("FBXSplitVertices", (UINT32)scene.meshes.size(), worker);
 
+		for (auto& mesh : scene.meshes)
 			bs_delete(mesh);
-		}
 
 		scene.meshes = splitMeshes;
 	}
@@ -857,9 +914,11 @@ namespace bs
 	SPtr<RendererMeshData> FBXImporter::generateMeshData(const FBXImportScene& scene, const FBXImportOptions& options, 
 		Vector<SubMesh>& outputSubMeshes)
 	{
-		Vector<SPtr<MeshData>> allMeshData;
-		Vector<Vector<SubMesh>> allSubMeshes;
-		UINT32 boneIndexOffset = 0;
+		// Each mesh outputs one mesh data object per node referencing it. They're stored per mesh and flattened
+		// afterwards, so the output order doesn't depend on the order the meshes were processed in.
+		UINT32 numMeshes = (UINT32)scene.meshes.size();
+		Vector<Vector<SPtr<MeshData>>> meshDataPerMesh(numMeshes);
+		Vector<Vector<Vector<SubMesh>>> subMeshesPerMesh(numMeshes);
 
 		// Generate unique indices for all the bones. This is mirrored in createSkeleton().
 		UnorderedMap<FBXImportNode*, UINT32> boneMap;
@@ -878,8 +937,10 @@ namespace bs
 			}
 		}
 
-		for (auto& mesh : scene.meshes)
+		auto worker = [&](UINT32 meshIdx)
 		{
+			FBXImportMesh* mesh = scene.meshes[meshIdx];
+
 			Vector<Vector<UINT32>> indicesPerMaterial;
 			for (UINT32 i = 0; i < (UINT32)mesh->indices.size(); i++)
 			{
@@ -1090,14 +1151,21 @@ namespace bs
 					bs_stack_free(weights);
 				}
 
-				allMeshData.push_back(meshData->getData());
-				allSubMeshes.push_back(subMeshes);
+				meshDataPerMesh[meshIdx].push_back(meshData->getData());
+				subMeshesPerMesh[meshIdx].push_back(subMeshes);
 			}
 
 			bs_free(orderedIndices);
+		};
+
+		forEachParallel("FBXGenerateMeshData", numMeshes, worker);
 
-			UINT32 numBones = (UINT32)mesh->bones.size();
-			boneIndexOffset += numBones;
+		Vector<SPtr<MeshData>> allMeshData;
+		Vector<Vector<SubMesh>> allSubMeshes;
+		for (UINT32 i = 0; i < numMeshes; i++)
+		{
+			allMeshData.insert(allMeshData.end(), meshDataPerMesh[i].begin(), meshDataPerMesh[i].end());
+			allSubMeshes.insert(allSubMeshes.end(), subMeshesPerMesh[i].begin(), subMeshesPerMesh[i].end());
 		}
 
 		if (allMeshData.size() > 1)
@@ -1673,8 +1741,10 @@ namespace bs
 
 	void FBXImporter::generateMissingTangentSpace(FBXImportScene& scene, const FBXImportOptions& options)
 	{
-		for (auto& mesh : scene.meshes)
+		auto worker = [&scene, &options](UINT32 idx)
 		{
+			FBXImportMesh* mesh = scene.meshes[idx];
+
 			UINT32 numVertices = (UINT32)mesh->positions.size();
 			UINT32 numIndices = (UINT32)mesh->indices.size();
 
@@ -1715,7 +1785,9 @@ namespace bs
 					}
 				}
 			}
-		}
+		};
+
+		forEachParallel("FBXGenerateTangentSpace", (UINT32)scene.meshes.size(), worker);
 	}
 
 	void FBXImporter::importAnimations(FbxScene* scene, FBXImportOptions& importOptions, FBXImportScene& importScene)
@@ -1771,6 +1843,39 @@ namespace bs
 				importAnimations(animLayer, root, importOptions, clip, importScene);
 			}
 		}
+
+		processBoneAnimations(importOptions, importScene);
+	}
+
+	void FBXImporter::processBoneAnimations(const FBXImportOptions& importOptions, FBXImportScene& importScene)
+	{
+		// Curves of every bone in every clip are independent, so process them all as a single flat list
+		Vector<FBXBoneAnimation*> boneAnimations;
+		for (auto& clip : importScene.clips)
+		{
+			for (auto& boneAnim : clip.boneAnimations)
+				boneAnimations.push_back(&boneAnim);
+		}
+
+		auto worker = [this, &importOptions, &boneAnimations](UINT32 idx)
+		{
+			FBXBoneAnimation& boneAnim = *boneAnimations[idx];
+
+			SPtr<TAnimationCurve<Vector3>> eulerAnimation =
+				bs_shared_ptr_new<TAnimationCurve<Vector3>>(std::move(boneAnim.eulerRotation));
+			boneAnim.eulerRotation = TAnimationCurve<Vector3>();
+
+			if(importOptions.reduceKeyframes)
+			{
+				boneAnim.translation = reduceKeyframes(boneAnim.translation);
+				boneAnim.scale = reduceKeyframes(boneAnim.scale);
+				*eulerAnimation = reduceKeyframes(*eulerAnimation);
+			}
+
+			boneAnim.rotation = *AnimationUtility::eulerToQuaternionCurve(eulerAnimation, EulerAngleOrder::XYZ);
+		};
+
+		forEachParallel("FBXProcessAnimations", (UINT32)boneAnimations.size(), worker);
 	}
 
 	void FBXImporter::importAnimations(FbxAnimLayer* layer, FbxNode* node, FBXImportOptions& importOptions,
@@ -1848,13 +1953,13 @@ namespace bs
 				boneAnim.scale = TAnimationCurve<Vector3>(keyframes);
 			}
 
-			SPtr<TAnimationCurve<Vector3>> eulerAnimation = bs_shared_ptr_new<TAnimationCurve<Vector3>>();
 			if (hasCurveValues(rotation))
 			{
 				float defaultValues[3];
 				memcpy(defaultValues, &defaultRotation, sizeof(defaultValues));
 
-				*eulerAnimation = importCurve<Vector3, 3>(rotation, defaultValues, importOptions, clip.start, clip.end);
+				boneAnim.eulerRotation = importCurve<Vector3, 3>(rotation, defaultValues, importOptions, clip.start, 
+					clip.end);
 			}
 			else
 			{
@@ -1863,17 +1968,10 @@ namespace bs
 				keyframes[0].inTangent = Vector3::ZERO;
 				keyframes[0].outTangent = Vector3::ZERO;
 
-				*eulerAnimation = TAnimationCurve<Vector3>(keyframes);
+				boneAnim.eulerRotation = TAnimationCurve<Vector3>(keyframes);
 			}
 
-			if(importOptions.reduceKeyframes)
-			{
-				boneAnim.translation = reduceKeyframes(boneAnim.translation);
-				boneAnim.scale = reduceKeyframes(boneAnim.scale);
-				*eulerAnimation = reduceKeyframes(*eulerAnimation);
-			}
-
-			boneAnim.rotation = *AnimationUtility::eulerToQuaternionCurve(eulerAnimation, EulerAngleOrder::XYZ);
+			// Keyframe reduction and conversion of the rotation curve are deferred to processBoneAnimations()
 		}
 
 		if (importOptions.importBlendShapes)
@@ -102,6 +102,12 @@ namespace bs
 		void importAnimations(FbxAnimLayer* layer, FbxNode* node, FBXImportOptions& importOptions, 
 			FBXAnimationClip& clip, FBXImportScene& importScene);
 
+		/**
+		 * Reduces keyframes (if enabled) and converts euler rotation curves into quaternion curves for all bone animations
+		 * in the scene. Each bone animation is processed independently, in parallel if the task scheduler is running.
+		 */
+		void processBoneAnimations(const FBXImportOptions& importOptions, FBXImportScene& importScene);
+
 		/** Bakes all FBX node transforms into standard translation-rotation-scale transform components. */
 		void bakeTransforms(FbxScene* scene);
 
@@ -0,0 +1,146 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "BsFontGlyphRasterizer.h"
+#include "FileSystem/BsDataStream.h"
+#include "Debug/BsDebug.h"
+
+namespace bs
+{
+	FT_Int32 getFreeTypeLoadFlags(FontRenderMode renderMode)
+	{
+		switch (renderMode)
+		{
+		case FontRenderMode::Smooth:
+			return FT_LOAD_TARGET_NORMAL | FT_LOAD_NO_HINTING;
+		case FontRenderMode::Raster:
+			return FT_LOAD_TARGET_MONO | FT_LOAD_NO_HINTING;
+		case FontRenderMode::HintedSmooth:
+			return FT_LOAD_TARGET_NORMAL | FT_LOAD_NO_AUTOHINT;
+		case FontRenderMode::HintedRaster:
+			return FT_LOAD_TARGET_MONO | FT_LOAD_NO_AUTOHINT;
+		default:
+			return FT_LOAD_TARGET_NORMAL;
+		}
+	}
+
+	FreeTypeGlyphRasterizer::FreeTypeGlyphRasterizer(const SPtr<MemoryDataStream>& fontData, UINT32 size, UINT32 dpi,
+		FontRenderMode renderMode)
+		: mFontData(fontData), mLoadFlags(getFreeTypeLoadFlags(renderMode))
+	{
+		// Each rasterizer gets its own library instance, as a library can't be used from multiple threads at once
+		if (FT_Init_FreeType(&mLibrary))
+		{
+			LOGERR("Error occurred during FreeType library initialization.");
+			mLibrary = nullptr;
+			return;
+		}
+
+		if (FT_New_Memory_Face(mLibrary, mFontData->getPtr(), (FT_Long)mFontData->size(), 0, &mFace))
+		{
+			LOGERR("Failed to load font data for glyph rasterization.");
+			mFace = nullptr;
+			return;
+		}
+
+		FT_F26Dot6 ftSize = (FT_F26Dot6)(size * (1 << 6));
+		if (FT_Set_Char_Size(mFace, ftSize, 0, dpi, dpi))
+		{
+			LOGERR("Could not set character size for glyph rasterization.");
+
+			FT_Done_Face(mFace);
+			mFace = nullptr;
+		}
+	}
+
+	FreeTypeGlyphRasterizer::~FreeTypeGlyphRasterizer()
+	{
+		if (mFace != nullptr)
+			FT_Done_Face(mFace);
+
+		if (mLibrary != nullptr)
+			FT_Done_FreeType(mLibrary);
+	}
+
+	bool FreeTypeGlyphRasterizer::rasterize(UINT32 charId, RasterizedGlyph& output)
+	{
+		if (mFace == nullptr)
+			return false;
+
+		FT_UInt glyphIdx = FT_Get_Char_Index(mFace, (FT_ULong)charId);
+		if (glyphIdx == 0)
+			return false;
+
+		if (FT_Load_Glyph(mFace, glyphIdx, mLoadFlags))
+			return false;
+
+		if (FT_Render_Glyph(mFace->glyph, FT_LOAD_TARGET_MODE(mLoadFlags)))
+			return false;
+
+		FT_GlyphSlot slot = mFace->glyph;
+		if (slot->bitmap.buffer == nullptr && slot->bitmap.rows > 0 && slot->bitmap.width > 0)
+			return false;
+
+		const UINT32 width = (UINT32)slot->bitmap.width;
+		const UINT32 height = (UINT32)slot->bitmap.rows;
+
+		output.pixels.resize(width * height);
+		UINT8* dstBuffer = output.pixels.data();
+		UINT8* sourceBuffer = slot->bitmap.buffer;
+
+		if (slot->bitmap.pixel_mode == ft_pixel_mode_grays)
+		{
+			for (UINT32 bitmapRow = 0; bitmapRow < height; bitmapRow++)
+			{
+				memcpy(dstBuffer, sourceBuffer, width);
+
+				dstBuffer += width;
+				sourceBuffer += slot->bitmap.pitch;
+			}
+		}
+		else if (slot->bitmap.pixel_mode == ft_pixel_mode_mono)
+		{
+			// 8 pixels are packed into a byte, so do some unpacking
+			for (UINT32 bitmapRow = 0; bitmapRow < height; bitmapRow++)
+			{
+				for (UINT32 bitmapColumn = 0; bitmapColumn < width; bitmapColumn++)
+				{
+					UINT8 srcValue = sourceBuffer[bitmapColumn >> 3];
+					dstBuffer[bitmapColumn] = (srcValue & (128 >> (bitmapColumn & 7))) != 0 ? 255 : 0;
+				}
+
+				dstBuffer += width;
+				sourceBuffer += slot->bitmap.pitch;
+			}
+		}
+		else if (width > 0 && height > 0)
+			return false;
+
+		CharDesc& charDesc = output.desc;
+		charDesc.charId = charId;
+		charDesc.width = width;
+		charDesc.height = height;
+		charDesc.page = 0;
+		charDesc.uvX = 0.0f;
+		charDesc.uvY = 0.0f;
+		charDesc.uvWidth = 0.0f;
+		charDesc.uvHeight = 0.0f;
+		charDesc.xOffset = slot->bitmap_left;
+		charDesc.yOffset = slot->bitmap_top;
+		charDesc.xAdvance = slot->advance.x >> 6;
+		charDesc.yAdvance = slot->advance.y >> 6;
+
+		return true;
+	}
+
+	SPtr<GlyphRasterizer> FreeTypeGlyphRasterizerFactory::create(const SPtr<MemoryDataStream>& fontData, UINT32 size,
+		UINT32 dpi, FontRenderMode renderMode)
+	{
+		SPtr<FreeTypeGlyphRasterizer> rasterizer = bs_shared_ptr_new<FreeTypeGlyphRasterizer>(fontData, size, dpi,
+			renderMode);
+
+		if (!rasterizer->isValid())
+			return nullptr;
+
+		return rasterizer;
+	}
+}
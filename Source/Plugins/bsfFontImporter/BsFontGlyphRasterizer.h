@@ -0,0 +1,51 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsFontPrerequisites.h"
+#include "Text/BsGlyphCache.h"
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+namespace bs
+{
+	/** @addtogroup Font
+	 *  @{
+	 */
+
+	/** Returns FreeType glyph load flags corresponding to the provided render mode. */
+	FT_Int32 getFreeTypeLoadFlags(FontRenderMode renderMode);
+
+	/** Glyph rasterizer that renders glyphs from a font file kept in memory, using the FreeType library. */
+	class FreeTypeGlyphRasterizer : public GlyphRasterizer
+	{
+	public:
+		FreeTypeGlyphRasterizer(const SPtr<MemoryDataStream>& fontData, UINT32 size, UINT32 dpi,
+			FontRenderMode renderMode);
+		~FreeTypeGlyphRasterizer();
+
+		/** Returns true if the font file was successfully loaded. */
+		bool isValid() const { return mFace != nullptr; }
+
+		/** @copydoc GlyphRasterizer::rasterize */
+		bool rasterize(UINT32 charId, RasterizedGlyph& output) override;
+
+	private:
+		SPtr<MemoryDataStream> mFontData;
+		FT_Library mLibrary = nullptr;
+		FT_Face mFace = nullptr;
+		FT_Int32 mLoadFlags = 0;
+	};
+
+	/** Creates FreeTypeGlyphRasterizer instances. */
+	class FreeTypeGlyphRasterizerFactory : public GlyphRasterizerFactory
+	{
+	public:
+		/** @copydoc GlyphRasterizerFactory::create */
+		SPtr<GlyphRasterizer> create(const SPtr<MemoryDataStream>& fontData, UINT32 size, UINT32 dpi,
+			FontRenderMode renderMode) override;
+	};
+
+	/** @} */
+}
@@ -1,6 +1,7 @@
 //************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "BsFontImporter.h"
+#include "BsFontGlyphRasterizer.h"
 #include "Text/BsFontImportOptions.h"
 #include "Image/BsPixelData.h"
 #include "Image/BsTexture.h"
@@ -12,6 +13,7 @@
 #include <freetype/freetype.h>
 #include FT_FREETYPE_H
 #include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
 
 using namespace std::placeholders;
 
@@ -73,26 +75,7 @@ namespace bs
 		Vector<UINT32> fontSizes = fontImportOptions->fontSizes;
 		UINT32 dpi = fontImportOptions->dpi;
 
-		FT_Int32 loadFlags;
-		switch (fontImportOptions->renderMode)
-		{
-		case FontRenderMode::Smooth:
-			loadFlags = FT_LOAD_TARGET_NORMAL | FT_LOAD_NO_HINTING;
-			break;
-		case FontRenderMode::Raster:
-			loadFlags = FT_LOAD_TARGET_MONO | FT_LOAD_NO_HINTING;
-			break;
-		case FontRenderMode::HintedSmooth:
-			loadFlags = FT_LOAD_TARGET_NORMAL | FT_LOAD_NO_AUTOHINT;
-			break;
-		case FontRenderMode::HintedRaster:
-			loadFlags = FT_LOAD_TARGET_MONO | FT_LOAD_NO_AUTOHINT;
-			break;
-		default:
-			loadFlags = FT_LOAD_TARGET_NORMAL;
-			break;
-		}
-
+		FT_Int32 loadFlags = getFreeTypeLoadFlags(fontImportOptions->renderMode);
 		FT_Render_Mode renderMode = FT_LOAD_TARGET_MODE(loadFlags);
 
 		Vector<SPtr<FontBitmap>> dataPerSize;
@@ -348,6 +331,13 @@ namespace bs
 				pageIdx++;
 			}
 
+			// Glyphs rasterized at runtime can be larger than the imported ones, so use the metrics of the entire face
+			if (fontImportOptions->dynamicGlyphs)
+			{
+				baselineOffset = std::max(baselineOffset, (INT32)(face->size->metrics.ascender >> 6));
+				lineHeight = std::max(lineHeight, (UINT32)(face->size->metrics.height >> 6));
+			}
+
 			fontData->size = fontSizes[i];
 			fontData->baselineOffset = baselineOffset;
 			fontData->lineHeight = lineHeight;
@@ -363,7 +353,17 @@ namespace bs
 			dataPerSize.push_back(fontData);
 		}
 
-		SPtr<Font> newFont = Font::_createPtr(dataPerSize);
+		FontGlyphSource glyphSource;
+		if (fontImportOptions->dynamicGlyphs)
+		{
+			Lock fileLock = FileScheduler::getLock(filePath);
+
+			glyphSource.data = bs_shared_ptr_new<MemoryDataStream>(FileSystem::openFile(filePath));
+			glyphSource.dpi = dpi;
+			glyphSource.renderMode = fontImportOptions->renderMode;
+		}
+
+		SPtr<Font> newFont = Font::_createPtr(dataPerSize, glyphSource);
 
 		FT_Done_FreeType(library);
 
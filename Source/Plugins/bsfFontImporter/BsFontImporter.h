@@ -25,6 +25,9 @@ namespace bs
 		/** @copydoc SpecificImporter::isMagicNumberSupported */
 		bool isMagicNumberSupported(const UINT8* magicNumPtr, UINT32 numBytes) const override;
 
+		/** @copydoc SpecificImporter::getAsyncMode */
+		ImporterAsyncMode getAsyncMode() const override { return ImporterAsyncMode::Multi; }
+
 		/** @copydoc SpecificImporter::import */
 		SPtr<Resource> import(const Path& filePath, SPtr<const ImportOptions> importOptions) override;
 
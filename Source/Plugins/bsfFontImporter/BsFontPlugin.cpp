@@ -3,6 +3,8 @@
 #include "BsFontPrerequisites.h"
 #include "Importer/BsImporter.h"
 #include "BsFontImporter.h"
+#include "BsFontGlyphRasterizer.h"
+#include "Text/BsFontManager.h"
 
 namespace bs
 {
@@ -19,6 +21,9 @@ namespace bs
 		FontImporter* importer = bs_new<FontImporter>();
 		Importer::instance()._registerAssetImporter(importer);
 
+		if (FontManager::isStarted())
+			FontManager::instance().setRasterizerFactory(bs_shared_ptr_new<FreeTypeGlyphRasterizerFactory>());
+
 		return nullptr;
 	}
 }
\ No newline at end of file
@@ -1,11 +1,13 @@
 set(BS_FONTIMPORTER_INC_NOFILTER
 	"BsFontPrerequisites.h"
 	"BsFontImporter.h"
+	"BsFontGlyphRasterizer.h"
 )
 
 set(BS_FONTIMPORTER_SRC_NOFILTER
 	"BsFontPlugin.cpp"
 	"BsFontImporter.cpp"
+	"BsFontGlyphRasterizer.cpp"
 )
 
 if(WIN32)
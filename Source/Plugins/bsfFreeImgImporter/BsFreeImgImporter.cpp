@@ -74,7 +74,8 @@ namespace bs
 			}
 		}
 
-		// Set error handler
+		// Set error handler. This is global FreeImage state, so it's only set once here rather than on every import, as
+		// multiple imports can run at the same time.
 		FreeImage_SetOutputMessage(FreeImageLoadErrorHandler);
 	}
 
@@ -100,9 +101,6 @@ namespace bs
 
 	String FreeImgImporter::magicNumToExtension(const UINT8* magic, UINT32 maxBytes) const
 	{
-		// Set error handler
-		FreeImage_SetOutputMessage(FreeImageLoadErrorHandler);
-
 		FIMEMORY* fiMem = 
 			FreeImage_OpenMemory((BYTE*)magic, static_cast<DWORD>(maxBytes));
 
@@ -244,9 +242,6 @@ namespace bs
 
 			imageFormat = (FREE_IMAGE_FORMAT)findFormat->second;
 
-			// Set error handler
-			FreeImage_SetOutputMessage(FreeImageLoadErrorHandler);
-
 			// Buffer stream into memory (TODO: override IO functions instead?)
 			memStream = bs_unique_ptr_new<MemoryDataStream>(fileData);
 			fileData->close();
@@ -90,9 +90,13 @@ namespace bs { namespace ct
 			case VET_FLOAT3:
 			case VET_FLOAT4:
 				return GL_FLOAT;
+			case VET_HALF2:
+				return GL_HALF_FLOAT;
 			case VET_SHORT1:
 			case VET_SHORT2:
 			case VET_SHORT4:
+			case VET_SHORT2_NORM:
+			case VET_SHORT4_NORM:
 				return GL_SHORT;
 			case VET_USHORT1:
 			case VET_USHORT2:
@@ -1208,7 +1208,7 @@ namespace bs { namespace ct
 		{
 			executeRef(startIndex, indexCount, vertexOffset, vertexCount, instanceCount);
 
-			primCount = vertexCountToPrimCount(mCurrentDrawOperation, vertexCount);
+			primCount = vertexCountToPrimCount(mCurrentDrawOperation, indexCount);
 		}
 		else
 		{
@@ -1217,7 +1217,7 @@ namespace bs { namespace ct
 			SPtr<GLCommandBuffer> cb = std::static_pointer_cast<GLCommandBuffer>(commandBuffer);
 			cb->queueCommand(execute);
 
-			primCount = vertexCountToPrimCount(cb->mCurrentDrawOperation, vertexCount);
+			primCount = vertexCountToPrimCount(cb->mCurrentDrawOperation, indexCount);
 		}
 
 		BS_INC_RENDER_STAT(NumDrawCalls);
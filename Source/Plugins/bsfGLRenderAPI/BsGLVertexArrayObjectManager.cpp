@@ -174,6 +174,8 @@ namespace bs { namespace ct
 			case VET_COLOR_ABGR:
 			case VET_COLOR_ARGB:
 			case VET_UBYTE4_NORM:
+			case VET_SHORT2_NORM:
+			case VET_SHORT4_NORM:
 				normalized = GL_TRUE;
 				isInteger = false;
 				break;
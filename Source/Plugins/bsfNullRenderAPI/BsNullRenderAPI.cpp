@@ -12,6 +12,7 @@
 #include "BsNullRenderTargets.h"
 #include "BsNullRenderStates.h"
 #include "BsNullQueries.h"
+#include "Profiling/BsRenderStats.h"
 
 namespace bs { namespace ct
 {
@@ -93,6 +94,23 @@ namespace bs { namespace ct
 		RenderAPI::destroyCore();
 	}
 
+	void NullRenderAPI::draw(UINT32 vertexOffset, UINT32 vertexCount, UINT32 instanceCount,
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		// Nothing is rendered, but statistics are still recorded so rendering workload can be measured without a GPU
+		BS_INC_RENDER_STAT(NumDrawCalls);
+		BS_ADD_RENDER_STAT(NumVertices, vertexCount);
+		BS_ADD_RENDER_STAT(NumPrimitives, vertexCountToPrimCount(mDrawOp, vertexCount));
+	}
+
+	void NullRenderAPI::drawIndexed(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount,
+		UINT32 instanceCount, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		BS_INC_RENDER_STAT(NumDrawCalls);
+		BS_ADD_RENDER_STAT(NumVertices, vertexCount);
+		BS_ADD_RENDER_STAT(NumPrimitives, vertexCountToPrimCount(mDrawOp, indexCount));
+	}
+
 	void NullRenderAPI::convertProjectionMatrix(const Matrix4& matrix, Matrix4& dest)
 	{
 		dest = matrix;
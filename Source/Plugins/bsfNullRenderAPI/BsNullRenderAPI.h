@@ -68,15 +68,15 @@ namespace bs { namespace ct
 
 		/** @copydoc RenderAPI::setDrawOperation */
 		void setDrawOperation(DrawOperationType op,
-			const SPtr<CommandBuffer>& commandBuffer = nullptr) override { }
+			const SPtr<CommandBuffer>& commandBuffer = nullptr) override { mDrawOp = op; }
 
 		/** @copydoc RenderAPI::draw */
 		void draw(UINT32 vertexOffset, UINT32 vertexCount, UINT32 instanceCount = 0,
-			const SPtr<CommandBuffer>& commandBuffer = nullptr) override { }
+			const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
 
 		/** @copydoc RenderAPI::drawIndexed */
 		void drawIndexed(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount, 
-			UINT32 instanceCount = 0, const SPtr<CommandBuffer>& commandBuffer = nullptr) override { }
+			UINT32 instanceCount = 0, const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
 
 		/** @copydoc RenderAPI::dispatchCompute */
 		void dispatchCompute(UINT32 numGroupsX, UINT32 numGroupsY = 1, UINT32 numGroupsZ = 1,
@@ -110,6 +110,7 @@ namespace bs { namespace ct
 		void destroyCore() override;
 
 		NullProgramFactory* mNullProgramFactory = nullptr;
+		DrawOperationType mDrawOp = DOT_TRIANGLE_LIST;
 	};
 
 	/** @} */
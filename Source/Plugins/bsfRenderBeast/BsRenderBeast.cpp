@@ -172,6 +172,9 @@ namespace bs { namespace ct
 	void RenderBeast::notifyLightRemoved(Light* light)
 	{
 		mScene->unregisterLight(light);
+
+		if(mMainViewGroup != nullptr)
+			mMainViewGroup->getShadowRenderer().notifyLightRemoved(light);
 	}
 
 	void RenderBeast::notifyCameraAdded(Camera* camera)
@@ -405,6 +408,9 @@ namespace bs { namespace ct
 			mScene->prepareDecal(i, frameInfo);
 		}
 
+		// Upload bone matrices of all skinned renderables at once, before anything (including shadow casters) is drawn
+		mScene->updateBoneMatrices(frameInfo);
+
 		// Gather all views
 		for (auto& rtInfo : sceneInfo.renderTargets)
 		{
@@ -439,10 +445,6 @@ namespace bs { namespace ct
 		const SceneInfo& sceneInfo = mScene->getSceneInfo();
 		const VisibilityInfo& visibility = viewGroup.getVisibilityInfo();
 
-		// Render shadow maps
-		ShadowRendering& shadowRenderer = viewGroup.getShadowRenderer();
-		shadowRenderer.renderShadowMaps(*mScene, viewGroup, frameInfo);
-
 		// Update various buffers required by each renderable
 		UINT32 numRenderables = (UINT32)sceneInfo.renderables.size();
 		for (UINT32 i = 0; i < numRenderables; i++)
@@ -453,6 +455,10 @@ namespace bs { namespace ct
 			mScene->prepareRenderable(i, frameInfo);
 		}
 
+		// Render shadow maps
+		ShadowRendering& shadowRenderer = viewGroup.getShadowRenderer();
+		shadowRenderer.renderShadowMaps(*mScene, viewGroup, frameInfo);
+
 		UINT32 numViews = viewGroup.getNumViews();
 		for (UINT32 i = 0; i < numViews; i++)
 		{
@@ -2,6 +2,7 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "Testing/BsTestSuite.h"
 #include "Utility/BsTextureRowAllocator.h"
+#include "Shading/BsShadowRendering.h"
 
 namespace bs
 {
@@ -13,11 +14,13 @@ namespace bs
 
 	private:
 		void testTextureRowAllocator();
+		void testStaticShadowMapCache();
 	};
 
 	RenderBeastTestSuite::RenderBeastTestSuite()
 	{
 		BS_ADD_TEST(RenderBeastTestSuite::testTextureRowAllocator);
+		BS_ADD_TEST(RenderBeastTestSuite::testStaticShadowMapCache);
 	}
 
 	void RenderBeastTestSuite::testTextureRowAllocator()
@@ -71,4 +74,46 @@ namespace bs
 		auto a13 = alloc.alloc(0);
 		BS_TEST_ASSERT(a13.length == 0);
 	}
+
+	void RenderBeastTestSuite::testStaticShadowMapCache()
+	{
+		static constexpr UINT32 MAX_UNUSED_FRAMES = 3;
+
+		// Lights are only used as keys and never accessed
+		UINT8 lightStorage[2];
+		const auto* lightA = reinterpret_cast<const ct::Light*>(&lightStorage[0]);
+		const auto* lightB = reinterpret_cast<const ct::Light*>(&lightStorage[1]);
+
+		ct::StaticShadowMapCache cache;
+
+		// Maps are only compatible with the size and type they were allocated for
+		ct::StaticShadowMap& mapA = cache.get(lightA);
+		mapA.mapSize = 256;
+		mapA.cube = false;
+
+		BS_TEST_ASSERT(mapA.isCompatible(256, false));
+		BS_TEST_ASSERT(!mapA.isCompatible(256, true));
+		BS_TEST_ASSERT(!mapA.isCompatible(512, false));
+		BS_TEST_ASSERT(&cache.get(lightA) == &mapA);
+
+		// Removing a light releases its map, so a light created in its place starts from scratch
+		cache.get(lightB);
+		BS_TEST_ASSERT(cache.getNumMaps() == 2);
+
+		cache.remove(lightA);
+		BS_TEST_ASSERT(cache.getNumMaps() == 1);
+		BS_TEST_ASSERT(cache.get(lightA).mapSize == 0);
+
+		// Maps that stay unused get released, while ones that keep being used stay around
+		for(UINT32 i = 0; i <= MAX_UNUSED_FRAMES; i++)
+		{
+			cache.get(lightB);
+			cache.releaseUnused(MAX_UNUSED_FRAMES);
+		}
+
+		BS_TEST_ASSERT(cache.getNumMaps() == 1);
+
+		cache.clear();
+		BS_TEST_ASSERT(cache.getNumMaps() == 0);
+	}
 }
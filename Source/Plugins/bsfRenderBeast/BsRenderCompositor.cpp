@@ -32,18 +32,88 @@ namespace bs { namespace ct
 {
 	UnorderedMap<StringID, RenderCompositor::NodeType*> RenderCompositor::mNodeTypes;
 
-	/** Renders all elements in a render queue. */
-	void renderQueueElements(const Vector<RenderQueueElement>& elements)
+	/** 
+	 * Renders all elements in a render queue. Groups of elements the queue marked for instancing are rendered using a
+	 * single instanced draw call each, with their per-object data provided through a structured buffer.
+	 */
+	void renderQueueElements(const RenderQueue& queue)
 	{
-		for(auto& entry : elements)
+		const Vector<RenderQueueElement>& elements = queue.getSortedElements();
+		const Vector<const RenderElement*>& instancedElements = queue.getInstancedElements();
+
+		GpuResourcePool& resPool = GpuResourcePool::instance();
+		const bool transposeMatrices = gCaps().conventions.matrixOrder == Conventions::MatrixOrder::ColumnMajor;
+
+		bs_frame_mark();
 		{
-			if (entry.applyPass)
-				gRendererUtility().setPass(entry.renderElem->material, entry.passIdx, entry.techniqueIdx);
+			FrameVector<SPtr<PooledStorageBuffer>> instanceBuffers;
+			FrameVector<PerInstanceData> instanceData;
+
+			// Instanced draws use a different technique, so the pass needs to be re-applied after them
+			bool forceApplyPass = false;
+			for(auto& entry : elements)
+			{
+				if (entry.numInstances > 1)
+				{
+					assert(entry.renderElem->type == (UINT32)RenderElementType::Renderable);
+					const auto* renderElem = static_cast<const RenderableElement*>(entry.renderElem);
+
+					instanceData.resize(entry.numInstances);
+					for (UINT32 i = 0; i < entry.numInstances; i++)
+					{
+						const auto* instanceElem = static_cast<const RenderableElement*>(
+							instancedElements[entry.firstInstance + i]);
+
+						PerInstanceData& data = instanceData[i];
+						data = *instanceElem->instanceData;
+
+						if (transposeMatrices)
+						{
+							data.worldTransform = data.worldTransform.transpose();
+							data.worldNoScaleTransform = data.worldNoScaleTransform.transpose();
+						}
+					}
+
+					// Round up the size so buffers can be reused between groups of different size
+					const UINT32 numElements = Bitwise::nextPow2(entry.numInstances);
+					SPtr<PooledStorageBuffer> instanceBuffer = resPool.get(POOLED_STORAGE_BUFFER_DESC::createStructured(
+						sizeof(PerInstanceData), numElements, GBU_DYNAMIC));
+					instanceBuffer->buffer->writeData(0, entry.numInstances * sizeof(PerInstanceData), 
+						instanceData.data(), BWT_DISCARD);
+
+					instanceBuffers.push_back(instanceBuffer);
+
+					if (entry.passIdx < (UINT32)renderElem->instancedDataParams.size())
+						renderElem->instancedDataParams[entry.passIdx].set(instanceBuffer->buffer);
+
+					gRendererUtility().setPass(renderElem->material, entry.passIdx, renderElem->instancedTechniqueIdx);
+					gRendererUtility().setPassParams(renderElem->instancedParams, entry.passIdx);
+
+					renderElem->drawInstanced(entry.numInstances, entry.subMesh);
+					BS_INC_RENDER_STAT(NumInstancedDrawCalls);
 
-			gRendererUtility().setPassParams(entry.renderElem->params, entry.passIdx);
+					forceApplyPass = true;
+					continue;
+				}
+
+				if (entry.applyPass || forceApplyPass)
+					gRendererUtility().setPass(entry.renderElem->material, entry.passIdx, entry.techniqueIdx);
 
-			entry.renderElem->draw();
+				gRendererUtility().setPassParams(entry.renderElem->params, entry.passIdx);
+
+				// Renderables might be rendered using a different level of detail than their default sub-mesh
+				if (entry.renderElem->type == (UINT32)RenderElementType::Renderable)
+					static_cast<const RenderableElement*>(entry.renderElem)->draw(entry.subMesh);
+				else
+					entry.renderElem->draw();
+
+				forceApplyPass = false;
+			}
+
+			for (auto& entry : instanceBuffers)
+				resPool.release(entry);
 		}
+		bs_frame_clear();
 	}
 
 	RenderCompositor::~RenderCompositor()
@@ -331,6 +401,20 @@ namespace bs { namespace ct
 					if(binding.slot != (UINT32)-1)
 						gpuParams->setParamBlockBuffer(binding.set, binding.slot, inputs.view.getPerViewBuffer());
 				}
+
+				if(element.instancedParams != nullptr)
+				{
+					SPtr<GpuParams> instancedGpuParams = element.instancedParams->getGpuParams();
+					for(UINT32 j = 0; j < GPT_COUNT; j++)
+					{
+						const GpuParamBinding& binding = element.instancedPerCameraBindings[j];
+						if(binding.slot != (UINT32)-1)
+						{
+							instancedGpuParams->setParamBlockBuffer(binding.set, binding.slot, 
+								inputs.view.getPerViewBuffer());
+						}
+					}
+				}
 			}
 		}
 
@@ -424,8 +508,7 @@ namespace bs { namespace ct
 		}
 
 		// Render all visible opaque elements that use the deferred pipeline
-		const Vector<RenderQueueElement>& opaqueElements = inputs.view.getOpaqueQueue(false)->getSortedElements();
-		renderQueueElements(opaqueElements);
+		renderQueueElements(*inputs.view.getOpaqueQueue(false));
 
 		// Determine MSAA coverage if required
 		if (viewProps.target.numSamples > 1)
@@ -450,8 +533,7 @@ namespace bs { namespace ct
 		// Render decals after all normal objects, using a read-only depth buffer
 		rapi.setRenderTarget(renderTargetNoMask, FBT_DEPTH, RT_ALL);
 
-		const Vector<RenderQueueElement>& decalElements = inputs.view.getDecalQueue()->getSortedElements();
-		renderQueueElements(decalElements);
+		renderQueueElements(*inputs.view.getDecalQueue());
 
 		// Make sure that any compute shaders are able to read g-buffer by unbinding it
 		rapi.setRenderTarget(nullptr);
@@ -1467,6 +1549,15 @@ namespace bs { namespace ct
 				}
 
 				bindCommonIBLParams(*gpuParams, element.imageBasedParams);
+
+				// Instanced parameters are only created when clustered forward rendering is supported
+				if(element.instancedParams != nullptr)
+				{
+					const SPtr<GpuParams> instancedGpuParams = element.instancedParams->getGpuParams();
+					bindParamsForClustered(*instancedGpuParams, element.instancedForwardLightingParams, 
+						element.instancedImageBasedParams);
+					bindCommonIBLParams(*instancedGpuParams, element.instancedImageBasedParams);
+				}
 			}
 		}
 
@@ -1524,10 +1615,10 @@ namespace bs { namespace ct
 		RenderQueue* transparentQueue = inputs.view.getTransparentQueue().get();
 
 		rapi.setRenderTarget(renderTarget, 0, RT_ALL);
-		renderQueueElements(opaqueQueue->getSortedElements());
+		renderQueueElements(*opaqueQueue);
 
 		rapi.setRenderTarget(renderTarget, FBT_DEPTH, RT_ALL);
-		renderQueueElements(transparentQueue->getSortedElements());
+		renderQueueElements(*transparentQueue);
 
 		// Note: Perhaps delay clearing this one frame, so previous frame textures have a better chance of being done
 		ParticleRenderer::instance().getTexturePool().clear();
@@ -215,6 +215,12 @@ namespace bs { namespace ct
 		/** Matrix that transforms the particle system to world space. */
 		Matrix4 localToWorld = Matrix4::IDENTITY;
 
+		/** Bounds of the particle system in simulation space, that were used for calculating the current world bounds. */
+		AABox localBounds = AABox::BOX_EMPTY;
+
+		/** True if world bounds need to be recalculated even if the local bounds didn't change (e.g. after a move). */
+		bool boundsDirty = true;
+
 		/** Element used for sorting and rendering the particle system. */
 		mutable ParticlesRenderElement renderElement;
 
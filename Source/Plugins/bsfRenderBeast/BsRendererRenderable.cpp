@@ -3,6 +3,7 @@
 #include "BsRendererRenderable.h"
 #include "Renderer/BsRendererUtility.h"
 #include "Mesh/BsMesh.h"
+#include "RenderAPI/BsVertexDataDesc.h"
 #include "Utility/BsBitwise.h"
 
 namespace bs { namespace ct
@@ -19,9 +20,41 @@ namespace bs { namespace ct
 		gPerObjectParamDef.gMatInvWorldNoScale.set(buffer, tfrmNoScale.inverseAffine());
 		gPerObjectParamDef.gWorldDeterminantSign.set(buffer, tfrm.determinant3x3() >= 0.0f ? 1.0f : -1.0f);
 		gPerObjectParamDef.gLayer.set(buffer, (INT32)layer);
+		gPerObjectParamDef.gOctahedralNormals.set(buffer, 0);
+		gPerObjectParamDef.gVertexPositionScale.set(buffer, Vector3::ONE);
+		gPerObjectParamDef.gVertexPositionOffset.set(buffer, Vector3::ZERO);
+	}
+
+	void PerObjectBuffer::updateVertexFormat(SPtr<GpuParamBlockBuffer>& buffer, const Mesh& mesh)
+	{
+		const SPtr<VertexDataDesc>& vertexDesc = mesh.getVertexDesc();
+
+		const VertexElement* normalElement = vertexDesc->getElement(VES_NORMAL);
+		const bool octahedralNormals = normalElement != nullptr && normalElement->getType() == VET_SHORT2_NORM;
+		gPerObjectParamDef.gOctahedralNormals.set(buffer, octahedralNormals ? 1 : 0);
+
+		// Quantized positions are in [-1, 1] range relative to the position bounds
+		const VertexElement* positionElement = vertexDesc->getElement(VES_POSITION);
+		if (positionElement != nullptr && positionElement->getType() == VET_SHORT4_NORM)
+		{
+			const AABox& positionBounds = mesh.getProperties().getPositionBounds();
+
+			gPerObjectParamDef.gVertexPositionScale.set(buffer, positionBounds.getHalfSize());
+			gPerObjectParamDef.gVertexPositionOffset.set(buffer, positionBounds.getCenter());
+		}
+		else
+		{
+			gPerObjectParamDef.gVertexPositionScale.set(buffer, Vector3::ONE);
+			gPerObjectParamDef.gVertexPositionOffset.set(buffer, Vector3::ZERO);
+		}
 	}
 
 	void RenderableElement::draw() const
+	{
+		draw(subMesh);
+	}
+
+	void RenderableElement::draw(const SubMesh& subMesh) const
 	{
 		if (morphVertexDeclaration == nullptr)
 			gRendererUtility().draw(mesh, subMesh);
@@ -29,6 +62,11 @@ namespace bs { namespace ct
 			gRendererUtility().drawMorph(mesh, subMesh, morphShapeBuffer, morphVertexDeclaration);
 	}
 
+	void RenderableElement::drawInstanced(UINT32 numInstances, const SubMesh& subMesh) const
+	{
+		gRendererUtility().draw(mesh, subMesh, numInstances);
+	}
+
 	RendererRenderable::RendererRenderable()
 	{
 		perObjectParamBuffer = gPerObjectParamDef.createBuffer();
@@ -42,6 +80,22 @@ namespace bs { namespace ct
 		const UINT32 layer = Bitwise::mostSignificantBit(renderable->getLayer());
 
 		PerObjectBuffer::update(perObjectParamBuffer, worldTransform, worldNoScaleTransform, layer);
+		gPerObjectParamDef.gBoneOffset.set(perObjectParamBuffer, 
+			boneMatrixOffset != (UINT32)-1 ? (INT32)boneMatrixOffset : 0);
+
+		const SPtr<Mesh>& mesh = renderable->getMesh();
+		if (mesh != nullptr)
+			PerObjectBuffer::updateVertexFormat(perObjectParamBuffer, *mesh);
+
+		instanceData.worldTransform = worldTransform;
+		instanceData.worldNoScaleTransform = worldNoScaleTransform;
+		instanceData.worldDeterminantSign = worldTransform.determinant3x3() >= 0.0f ? 1.0f : -1.0f;
+
+		for (auto& element : elements)
+		{
+			if (element.instancedParams != nullptr)
+				element.instancingKey = layer + 1;
+		}
 	}
 
 	void RendererRenderable::updatePerCallBuffer(const Matrix4& viewProj, bool flush)
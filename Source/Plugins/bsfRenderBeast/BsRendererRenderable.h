@@ -23,6 +23,10 @@ namespace bs { namespace ct
 		BS_PARAM_BLOCK_ENTRY(Matrix4, gMatInvWorldNoScale)
 		BS_PARAM_BLOCK_ENTRY(float, gWorldDeterminantSign)
 		BS_PARAM_BLOCK_ENTRY(INT32, gLayer)
+		BS_PARAM_BLOCK_ENTRY(INT32, gBoneOffset)
+		BS_PARAM_BLOCK_ENTRY(INT32, gOctahedralNormals)
+		BS_PARAM_BLOCK_ENTRY(Vector3, gVertexPositionScale)
+		BS_PARAM_BLOCK_ENTRY(Vector3, gVertexPositionOffset)
 	BS_PARAM_BLOCK_END
 
 	extern PerObjectParamDef gPerObjectParamDef;
@@ -37,9 +41,30 @@ namespace bs { namespace ct
 	class PerObjectBuffer
 	{
 	public:
-		/** Updates the provided buffer with the data from the provided matrices. */
+		/** 
+		 * Updates the provided buffer with the data from the provided matrices. Vertex format parameters are reset to
+		 * values expecting uncompressed vertices.
+		 */
 		static void update(SPtr<GpuParamBlockBuffer>& buffer, const Matrix4& tfrm, const Matrix4& tfrmNoScale, 
 			UINT32 layer);
+
+		/** 
+		 * Updates the parameters used for decoding compressed vertex formats (see MeshUtility::compressVertices()) of the
+		 * provided mesh.
+		 */
+		static void updateVertexFormat(SPtr<GpuParamBlockBuffer>& buffer, const Mesh& mesh);
+	};
+
+	/** 
+	 * Per-object data of a single instance rendered using an instanced draw call. Mirrors the PerInstanceData structure
+	 * in PerObjectData.bslinc.
+	 */
+	struct PerInstanceData
+	{
+		Matrix4 worldTransform;
+		Matrix4 worldNoScaleTransform;
+		float worldDeterminantSign;
+		float padding[3];
 	};
 
 	struct MaterialSamplerOverrides;
@@ -72,7 +97,10 @@ namespace bs { namespace ct
 		/** Collection of parameters used for image based lighting. */
 		ImageBasedLightingParams imageBasedParams;
 		
-		/** GPU buffer containing element's bone matrices, if it requires any. */
+		/** 
+		 * GPU buffer containing element's bone matrices, if it requires any. The buffer is shared between all skinned
+		 * renderables, with each renderable's matrices starting at RendererRenderable::boneMatrixOffset.
+		 */
 		SPtr<GpuBuffer> boneMatrixBuffer;
 
 		/** Vertex buffer containing element's morph shape vertices, if it has any. */
@@ -87,8 +115,50 @@ namespace bs { namespace ct
 		/** Version of the morph shape vertices in the buffer. */
 		mutable UINT32 morphShapeVersion;
 
+		/** 
+		 * Index of the technique used when rendering the element as a part of an instanced draw call. Only valid if 
+		 * @p instancedParams is not null.
+		 */
+		UINT32 instancedTechniqueIdx = (UINT32)-1;
+
+		/** GPU parameters used when rendering the element using instancing. Null if the element doesn't support it. */
+		SPtr<GpuParamsSet> instancedParams;
+
+		/** Optional overrides for material sampler states, for the parameters in @p instancedParams. */
+		MaterialSamplerOverrides* instancedSamplerOverrides = nullptr;
+
+		/** Binding indices for the per-camera param block buffer, for the parameters in @p instancedParams. */
+		GpuParamBinding instancedPerCameraBindings[GPT_COUNT];
+
+		/** Forward lighting parameters, for the parameters in @p instancedParams. */
+		ForwardLightingParams instancedForwardLightingParams;
+
+		/** Image based lighting parameters, for the parameters in @p instancedParams. */
+		ImageBasedLightingParams instancedImageBasedParams;
+
+		/** Handles to the per-instance data buffer, for each pass in @p instancedParams. */
+		Vector<GpuParamBuffer> instancedDataParams;
+
+		/** Per-instance data of the renderable the element belongs to. */
+		const PerInstanceData* instanceData = nullptr;
+
+		/** Index of the mesh's sub-mesh the element renders. Used for looking up the sub-mesh at other levels of detail. */
+		UINT32 subMeshIdx = 0;
+
 		/** @copydoc RenderElement::draw */
 		void draw() const override;
+
+		/** 
+		 * Executes the draw call for the render element, rendering the provided portion of the element's mesh instead of
+		 * @p subMesh. Used for rendering the element at a different level of detail.
+		 */
+		void draw(const SubMesh& subMesh) const;
+
+		/** 
+		 * Draws the provided portion of the element's mesh the specified number of times using a single instanced draw
+		 * call.
+		 */
+		void drawInstanced(UINT32 numInstances, const SubMesh& subMesh) const;
 	};
 
 	 /** Contains information about a Renderable, used by the Renderer. */
@@ -112,6 +182,16 @@ namespace bs { namespace ct
 
 		SPtr<GpuParamBlockBuffer> perObjectParamBuffer;
 		SPtr<GpuParamBlockBuffer> perCallParamBuffer;
+		PerInstanceData instanceData;
+
+		/** Offset of the renderable's bones in the shared bone matrix buffer, or -1 if the renderable isn't skinned. */
+		UINT32 boneMatrixOffset = (UINT32)-1;
+
+		/** Number of bones allocated for the renderable in the shared bone matrix buffer. */
+		UINT32 numBones = 0;
+
+		/** Version of the animation pose last written into the bone matrix buffer. 0 if none was written. */
+		UINT64 boneMatrixVersion = 0;
 	};
 
 	/** @} */
@@ -8,6 +8,8 @@
 #include "Renderer/BsRenderer.h"
 #include "Particles/BsParticleManager.h"
 #include "Mesh/BsMesh.h"
+#include "Animation/BsSkeleton.h"
+#include "Animation/BsAnimationManager.h"
 #include "Material/BsPass.h"
 #include "Material/BsGpuParamsSet.h"
 #include "Utility/BsSamplerOverrides.h"
@@ -37,8 +39,10 @@ namespace bs {	namespace ct
 		}
 	};
 
+	constexpr float RendererScene::RENDERABLE_OCTREE_EXTENT;
+
 	RendererScene::RendererScene(const SPtr<RenderBeastOptions>& options)
-		:mOptions(options)
+		:mRenderableOctree(Vector3::ZERO, RENDERABLE_OCTREE_EXTENT, &mInfo), mOptions(options)
 	{
 		mPerFrameParamBuffer = gPerFrameParamDef.createBuffer();
 	}
@@ -245,12 +249,40 @@ namespace bs {	namespace ct
 
 		mInfo.renderables.push_back(bs_new<RendererRenderable>());
 		mInfo.renderableCullInfos.push_back(CullInfo(renderable->getBounds(), renderable->getLayer(), renderable->getCullDistanceFactor()));
+		mInfo.renderableOctreeIds.push_back(OctreeElementId());
+
+		mRenderableOctree.addElement(renderableId);
+
+		if (renderable->getMobility() != ObjectMobility::Movable)
+			mInfo.staticRenderablesVersion++;
 
 		RendererRenderable* rendererRenderable = mInfo.renderables.back();
 		rendererRenderable->renderable = renderable;
-		rendererRenderable->updatePerObjectBuffer();
 
 		SPtr<Mesh> mesh = renderable->getMesh();
+
+		// Bones of all skinned renderables are stored in a single buffer, referenced through an offset in per-object data
+		RenderableAnimType renderableAnimType = renderable->getAnimType();
+		if (mesh != nullptr && (renderableAnimType == RenderableAnimType::Skinned || 
+			renderableAnimType == RenderableAnimType::SkinnedMorph))
+		{
+			SPtr<Skeleton> skeleton = mesh->getSkeleton();
+			UINT32 numBones = skeleton != nullptr ? skeleton->getNumBones() : 0;
+
+			if (numBones > 0)
+			{
+				SPtr<GpuBuffer> prevBoneBuffer = mBoneMatrices.getBuffer();
+
+				rendererRenderable->boneMatrixOffset = mBoneMatrices.alloc(numBones);
+				rendererRenderable->numBones = numBones;
+
+				if (prevBoneBuffer != nullptr && prevBoneBuffer != mBoneMatrices.getBuffer())
+					rebindBoneMatrices();
+			}
+		}
+
+		rendererRenderable->updatePerObjectBuffer();
+
 		if (mesh != nullptr)
 		{
 			const MeshProperties& meshProps = mesh->getProperties();
@@ -264,11 +296,12 @@ namespace bs {	namespace ct
 				renElement.type = (UINT32)RenderElementType::Renderable;
 				renElement.mesh = mesh;
 				renElement.subMesh = meshProps.getSubMesh(i);
+				renElement.subMeshIdx = i;
 				renElement.animType = renderable->getAnimType();
 				renElement.animationId = renderable->getAnimationId();
 				renElement.morphShapeVersion = 0;
 				renElement.morphShapeBuffer = renderable->getMorphShapeBuffer();
-				renElement.boneMatrixBuffer = renderable->getBoneMatrixBuffer();
+				renElement.boneMatrixBuffer = rendererRenderable->numBones > 0 ? mBoneMatrices.getBuffer() : nullptr;
 				renElement.morphVertexDeclaration = renderable->getMorphVertexDeclaration();
 
 				renElement.material = renderable->getMaterial(i);
@@ -386,20 +419,50 @@ namespace bs {	namespace ct
 
 				// Generate or assign sampler state overrides
 				renElement.samplerOverrides = allocSamplerStateOverrides(renElement);
+
+				// Elements of non-animated renderables can be grouped and rendered using instancing, if their shader
+				// supports it. Per-instance data is provided through a structured buffer.
+				const bool supportsInstancing = gRenderBeast()->getFeatureSet() == RenderBeastFeatureSet::Desktop;
+				if (supportsInstancing && animType == RenderableAnimType::None && 
+					!shaderFlags.isSet(ShaderFlag::Transparent))
+				{
+					const ShaderVariation* instancedVariation;
+					if (useForwardRendering)
+						instancedVariation = &getInstancedForwardRenderingVariation<true>();
+					else
+						instancedVariation = &getInstancedVertexInputVariation();
+
+					FIND_TECHNIQUE_DESC instancedFindDesc;
+					instancedFindDesc.variation = instancedVariation;
+					instancedFindDesc.override = true;
+
+					const UINT32 instancedTechniqueIdx = renElement.material->findTechnique(instancedFindDesc);
+					const SPtr<Technique> instancedTechnique = instancedTechniqueIdx != (UINT32)-1 ? 
+						renElement.material->getTechnique(instancedTechniqueIdx) : nullptr;
+
+					// Technique search ignores parameters unknown to the shader, so make sure it is actually instanced
+					if (instancedTechnique && instancedTechnique->getVariation().matches(*instancedVariation, false))
+					{
+						instancedTechnique->compile();
+
+						renElement.instancedTechniqueIdx = instancedTechniqueIdx;
+						renElement.instancedParams = renElement.material->createParamsSet(instancedTechniqueIdx);
+						renElement.material->updateParamsSet(renElement.instancedParams, 0.0f, true);
+						renElement.instancedSamplerOverrides = allocSamplerStateOverrides(renElement.material,
+							instancedTechniqueIdx, renElement.instancedParams);
+						renElement.instanceData = &rendererRenderable->instanceData;
+						renElement.instancingKey = Bitwise::mostSignificantBit(renderable->getLayer()) + 1;
+					}
+				}
 			}
 		}
 
 		// Prepare all parameter bindings
-		for(auto& element : rendererRenderable->elements)
+		auto bindParams = [this, rendererRenderable](const SPtr<GpuParamsSet>& paramsSet, 
+			GpuParamBinding (&perCameraBindings)[GPT_COUNT], ForwardLightingParams& forwardLightingParams, 
+			ImageBasedLightingParams& imageBasedParams, const SPtr<GpuBuffer>& boneMatrixBuffer, bool useForwardRendering)
 		{
-			SPtr<Shader> shader = element.material->getShader();
-			if (shader == nullptr)
-			{
-				LOGWRN("Missing shader on material.");
-				continue;
-			}
-
-			SPtr<GpuParams> gpuParams = element.params->getGpuParams();
+			SPtr<GpuParams> gpuParams = paramsSet->getGpuParams();
 
 			// Note: Perhaps perform buffer validation to ensure expected buffer has the same size and layout as the 
 			// provided buffer, and show a warning otherwise. But this is perhaps better handled on a higher level.
@@ -410,23 +473,53 @@ namespace bs {	namespace ct
 			gpuParams->getParamInfo()->getBindings(
 				GpuPipelineParamInfoBase::ParamType::ParamBlock,
 				"PerCamera",
-				element.perCameraBindings
+				perCameraBindings
 			);
 
 			if (gpuParams->hasBuffer(GPT_VERTEX_PROGRAM, "boneMatrices"))
-				gpuParams->setBuffer(GPT_VERTEX_PROGRAM, "boneMatrices", element.boneMatrixBuffer);
-
-			ShaderFlags shaderFlags = shader->getFlags();
-			const bool useForwardRendering = shaderFlags.isSet(ShaderFlag::Forward) || shaderFlags.isSet(ShaderFlag::Transparent);
+				gpuParams->setBuffer(GPT_VERTEX_PROGRAM, "boneMatrices", boneMatrixBuffer);
 
 			if (useForwardRendering)
 			{
 				const bool supportsClusteredForward = gRenderBeast()->getFeatureSet() == RenderBeastFeatureSet::Desktop;
 
-				element.forwardLightingParams.populate(gpuParams, supportsClusteredForward);
-				element.imageBasedParams.populate(gpuParams, GPT_FRAGMENT_PROGRAM, true, supportsClusteredForward,
+				forwardLightingParams.populate(gpuParams, supportsClusteredForward);
+				imageBasedParams.populate(gpuParams, GPT_FRAGMENT_PROGRAM, true, supportsClusteredForward,
 					supportsClusteredForward);
 			}
+		};
+
+		for(auto& element : rendererRenderable->elements)
+		{
+			SPtr<Shader> shader = element.material->getShader();
+			if (shader == nullptr)
+			{
+				LOGWRN("Missing shader on material.");
+				continue;
+			}
+
+			ShaderFlags shaderFlags = shader->getFlags();
+			const bool useForwardRendering = shaderFlags.isSet(ShaderFlag::Forward) || shaderFlags.isSet(ShaderFlag::Transparent);
+
+			bindParams(element.params, element.perCameraBindings, element.forwardLightingParams, 
+				element.imageBasedParams, element.boneMatrixBuffer, useForwardRendering);
+
+			if (element.instancedParams != nullptr)
+			{
+				bindParams(element.instancedParams, element.instancedPerCameraBindings, 
+					element.instancedForwardLightingParams, element.instancedImageBasedParams, nullptr, 
+					useForwardRendering);
+
+				// Per-instance data buffer changes with every instanced draw, so look up the parameter only once
+				const UINT32 numPasses = element.instancedParams->getNumPasses();
+				element.instancedDataParams.resize(numPasses);
+				for (UINT32 i = 0; i < numPasses; i++)
+				{
+					SPtr<GpuParams> gpuParams = element.instancedParams->getGpuParams(i);
+					if (gpuParams != nullptr && gpuParams->hasBuffer(GPT_VERTEX_PROGRAM, "gPerInstanceData"))
+						gpuParams->getBufferParam(GPT_VERTEX_PROGRAM, "gPerInstanceData", element.instancedDataParams[i]);
+				}
+			}
 		}
 	}
 
@@ -437,6 +530,13 @@ namespace bs {	namespace ct
 		mInfo.renderables[renderableId]->updatePerObjectBuffer();
 		mInfo.renderableCullInfos[renderableId].bounds = renderable->getBounds();
 		mInfo.renderableCullInfos[renderableId].cullDistanceFactor = renderable->getCullDistanceFactor();
+
+		// Re-insert so the renderable ends up in the node matching its new bounds
+		mRenderableOctree.removeElement(mInfo.renderableOctreeIds[renderableId]);
+		mRenderableOctree.addElement(renderableId);
+
+		if (renderable->getMobility() != ObjectMobility::Movable)
+			mInfo.staticRenderablesVersion++;
 	}
 
 	void RendererScene::unregisterRenderable(Renderable* renderable)
@@ -451,20 +551,42 @@ namespace bs {	namespace ct
 		{
 			freeSamplerStateOverrides(element);
 			element.samplerOverrides = nullptr;
+
+			if (element.instancedSamplerOverrides != nullptr)
+			{
+				freeSamplerStateOverrides(element.material, element.instancedTechniqueIdx);
+				element.instancedSamplerOverrides = nullptr;
+			}
 		}
 
+		if (rendererRenderable->numBones > 0)
+			mBoneMatrices.free(rendererRenderable->boneMatrixOffset, rendererRenderable->numBones);
+
+		if (renderable->getMobility() != ObjectMobility::Movable)
+			mInfo.staticRenderablesVersion++;
+
+		mRenderableOctree.removeElement(mInfo.renderableOctreeIds[renderableId]);
+
+		for (auto& view : mInfo.views)
+			view->notifyRenderableRemoved(renderableId, lastRenderableId);
+
 		if (renderableId != lastRenderableId)
 		{
+			// Octree references renderables by index, so the last element needs to be re-inserted with its new index
+			mRenderableOctree.removeElement(mInfo.renderableOctreeIds[lastRenderableId]);
+
 			// Swap current last element with the one we want to erase
 			std::swap(mInfo.renderables[renderableId], mInfo.renderables[lastRenderableId]);
 			std::swap(mInfo.renderableCullInfos[renderableId], mInfo.renderableCullInfos[lastRenderableId]);
 
 			lastRenerable->setRendererId(renderableId);
+			mRenderableOctree.addElement(renderableId);
 		}
 
 		// Last element is the one we want to erase
 		mInfo.renderables.erase(mInfo.renderables.end() - 1);
 		mInfo.renderableCullInfos.erase(mInfo.renderableCullInfos.end() - 1);
+		mInfo.renderableOctreeIds.erase(mInfo.renderableOctreeIds.end() - 1);
 
 		bs_delete(rendererRenderable);
 	}
@@ -618,11 +740,20 @@ namespace bs {	namespace ct
 			localToWorldNoScale = Matrix4::IDENTITY;
 		}
 
+		rendererParticles.boundsDirty = true;
+
+		// Mesh particles decode compressed vertices the same way as renderables do
+		const bool usesMesh = !settings.gpuSimulation && settings.renderMode == ParticleRenderMode::Mesh && 
+			settings.mesh != nullptr;
+
 		if(tfrmOnly)
 		{
 			SPtr<GpuParamBlockBuffer>& paramBuffer = rendererParticles.perObjectParamBuffer;
 			PerObjectBuffer::update(paramBuffer, rendererParticles.localToWorld, localToWorldNoScale, layer);
 
+			if (usesMesh)
+				PerObjectBuffer::updateVertexFormat(paramBuffer, *settings.mesh);
+
 			return;
 		}
 
@@ -630,6 +761,9 @@ namespace bs {	namespace ct
 		SPtr<GpuParamBlockBuffer> particlesParamBuffer = gParticlesParamDef.createBuffer();
 		PerObjectBuffer::update(perObjectParamBuffer, rendererParticles.localToWorld, localToWorldNoScale, layer);
 
+		if (usesMesh)
+			PerObjectBuffer::updateVertexFormat(perObjectParamBuffer, *settings.mesh);
+
 		Vector3 axisForward = settings.orientationPlaneNormal;
 
 		Vector3 axisUp = Vector3::UNIT_Y;
@@ -1228,42 +1362,51 @@ namespace bs {	namespace ct
 		{
 			for(auto& element : mInfo.renderables[i]->elements)
 			{
+				const UINT32 numPasses = element.material->getNumPasses();
+
 				MaterialSamplerOverrides* overrides = element.samplerOverrides;
 				if(overrides != nullptr && overrides->isDirty)
-				{
-					UINT32 numPasses = element.material->getNumPasses();
-					for(UINT32 j = 0; j < numPasses; j++)
-					{
-						SPtr<GpuParams> params = element.params->getGpuParams(j);
+					applySamplerOverrides(overrides, element.params, numPasses);
 
-						const UINT32 numStages = 6;
-						for (UINT32 k = 0; k < numStages; k++)
-						{
-							GpuProgramType type = (GpuProgramType)k;
+				MaterialSamplerOverrides* instancedOverrides = element.instancedSamplerOverrides;
+				if(instancedOverrides != nullptr && instancedOverrides->isDirty)
+					applySamplerOverrides(instancedOverrides, element.instancedParams, numPasses);
+			}
+		}
 
-							SPtr<GpuParamDesc> paramDesc = params->getParamDesc(type);
-							if (paramDesc == nullptr)
-								continue;
+		for (auto& entry : mSamplerOverrides)
+			entry.second->isDirty = false;
+	}
 
-							for (auto& samplerDesc : paramDesc->samplers)
-							{
-								UINT32 set = samplerDesc.second.set;
-								UINT32 slot = samplerDesc.second.slot;
+	void RendererScene::applySamplerOverrides(MaterialSamplerOverrides* overrides, const SPtr<GpuParamsSet>& params,
+		UINT32 numPasses)
+	{
+		for(UINT32 i = 0; i < numPasses; i++)
+		{
+			SPtr<GpuParams> gpuParams = params->getGpuParams(i);
 
-								UINT32 overrideIndex = overrides->passes[j].stateOverrides[set][slot];
-								if (overrideIndex == (UINT32)-1)
-									continue;
+			const UINT32 numStages = 6;
+			for (UINT32 j = 0; j < numStages; j++)
+			{
+				GpuProgramType type = (GpuProgramType)j;
 
-								params->setSamplerState(set, slot, overrides->overrides[overrideIndex].state);
-							}
-						}
-					}
+				SPtr<GpuParamDesc> paramDesc = gpuParams->getParamDesc(type);
+				if (paramDesc == nullptr)
+					continue;
+
+				for (auto& samplerDesc : paramDesc->samplers)
+				{
+					UINT32 set = samplerDesc.second.set;
+					UINT32 slot = samplerDesc.second.slot;
+
+					UINT32 overrideIndex = overrides->passes[i].stateOverrides[set][slot];
+					if (overrideIndex == (UINT32)-1)
+						continue;
+
+					gpuParams->setSamplerState(set, slot, overrides->overrides[overrideIndex].state);
 				}
 			}
 		}
-
-		for (auto& entry : mSamplerOverrides)
-			entry.second->isDirty = false;
 	}
 
 	void RendererScene::setParamFrameParams(float time)
@@ -1276,19 +1419,77 @@ namespace bs {	namespace ct
 		if (mInfo.renderableReady[idx])
 			return;
 		
-		// Note: Before uploading bone matrices perhaps check if they has actually been changed since last frame
+		RendererRenderable* rendererRenderable = mInfo.renderables[idx];
 		if(frameInfo.perFrameData.animation != nullptr)
-			mInfo.renderables[idx]->renderable->updateAnimationBuffers(*frameInfo.perFrameData.animation);
+			rendererRenderable->renderable->updateAnimationBuffers(*frameInfo.perFrameData.animation);
 		
 		// Note: Could this step be moved in notifyRenderableUpdated, so it only triggers when material actually gets
 		// changed? Although it shouldn't matter much because if the internal versions keeping track of dirty params.
 		for (auto& element : mInfo.renderables[idx]->elements)
+		{
 			element.material->updateParamsSet(element.params, element.materialAnimationTime);
+
+			if (element.instancedParams != nullptr)
+				element.material->updateParamsSet(element.instancedParams, element.materialAnimationTime);
+		}
 		
 		mInfo.renderables[idx]->perObjectParamBuffer->flushToGPU();
 		mInfo.renderableReady[idx] = true;
 	}
 
+	void RendererScene::updateBoneMatrices(const FrameInfo& frameInfo)
+	{
+		if(frameInfo.perFrameData.animation != nullptr)
+		{
+			const EvaluatedAnimationData& animData = *frameInfo.perFrameData.animation;
+			for (auto& rendererRenderable : mInfo.renderables)
+			{
+				if (rendererRenderable->numBones == 0)
+					continue;
+
+				auto iterFind = animData.infos.find(rendererRenderable->renderable->getAnimationId());
+				if (iterFind == animData.infos.end())
+					continue;
+
+				// Bone matrices are only copied if the pose changed since they were last written (e.g. not for paused or
+				// culled animations), otherwise the buffer contents from the last upload are still valid
+				const EvaluatedAnimationData::PoseInfo& poseInfo = iterFind->second.poseInfo;
+				if (poseInfo.version != 0 && poseInfo.version != rendererRenderable->boneMatrixVersion)
+				{
+					UINT32 numBones = std::min(poseInfo.numBones, rendererRenderable->numBones);
+					mBoneMatrices.write(rendererRenderable->boneMatrixOffset, &animData.transforms[poseInfo.startIdx],
+						numBones);
+
+					rendererRenderable->boneMatrixVersion = poseInfo.version;
+				}
+			}
+		}
+
+		mBoneMatrices.flush();
+	}
+
+	void RendererScene::rebindBoneMatrices()
+	{
+		const SPtr<GpuBuffer>& buffer = mBoneMatrices.getBuffer();
+		for (auto& rendererRenderable : mInfo.renderables)
+		{
+			if (rendererRenderable->numBones == 0)
+				continue;
+
+			for (auto& element : rendererRenderable->elements)
+			{
+				element.boneMatrixBuffer = buffer;
+
+				if (element.params == nullptr)
+					continue;
+
+				SPtr<GpuParams> gpuParams = element.params->getGpuParams();
+				if (gpuParams->hasBuffer(GPT_VERTEX_PROGRAM, "boneMatrices"))
+					gpuParams->setBuffer(GPT_VERTEX_PROGRAM, "boneMatrices", buffer);
+			}
+		}
+	}
+
 	void RendererScene::prepareParticleSystem(UINT32 idx, const FrameInfo& frameInfo)
 	{
 		ParticlesRenderElement& renElement = mInfo.particleSystems[idx].renderElement;
@@ -1307,32 +1508,45 @@ namespace bs {	namespace ct
 
 	void RendererScene::updateParticleSystemBounds(const ParticlePerFrameData* particleRenderData)
 	{
-		// Note: Avoid updating bounds for deterministic particle systems every frame. Also see if this can be copied
-		// over in a faster way (or ideally just assigned)
-
 		for(auto& entry : mInfo.particleSystems)
 		{
-			const UINT32 rendererId = entry.particleSystem->getRendererId();
+			AABox localAABox = AABox::INF_BOX;
+			if(entry.gpuParticleSystem)
+				localAABox = entry.gpuParticleSystem->getBounds();
+			else
+			{
+				const auto iterFind = particleRenderData->cpuData.find(entry.particleSystem->getId());
+				if(iterFind != particleRenderData->cpuData.end())
+					localAABox = iterFind->second->bounds;
+			}
+
+			// Custom and analytic bounds only change along with settings, in which case the world bounds are still valid
+			if(!entry.boundsDirty && localAABox == entry.localBounds)
+				continue;
 
-			AABox worldAABox = AABox::INF_BOX;
-			const auto iterFind = particleRenderData->cpuData.find(entry.particleSystem->getId());
-			if(iterFind != particleRenderData->cpuData.end())
-				worldAABox = iterFind->second->bounds;
-			else if(entry.gpuParticleSystem)
-				worldAABox = entry.gpuParticleSystem->getBounds();
+			entry.localBounds = localAABox;
+			entry.boundsDirty = false;
 
+			AABox worldAABox = localAABox;
 			const ParticleSystemSettings& settings = entry.particleSystem->getSettings();
 			if (settings.simulationSpace == ParticleSimulationSpace::Local)
 				worldAABox.transformAffine(entry.localToWorld);
 
-			const Sphere worldSphere(worldAABox.getCenter(), worldAABox.getRadius());
-			mInfo.particleSystemCullInfos[rendererId].bounds = Bounds(worldAABox, worldSphere);
+			const UINT32 rendererId = entry.particleSystem->getRendererId();
+			mInfo.particleSystemCullInfos[rendererId].bounds.setBounds(worldAABox, 
+				Sphere(worldAABox.getCenter(), worldAABox.getRadius()));
 		}
 	}
 
 	MaterialSamplerOverrides* RendererScene::allocSamplerStateOverrides(RenderElement& elem)
 	{
-		SamplerOverrideKey samplerKey(elem.material, elem.techniqueIdx);
+		return allocSamplerStateOverrides(elem.material, elem.techniqueIdx, elem.params);
+	}
+
+	MaterialSamplerOverrides* RendererScene::allocSamplerStateOverrides(const SPtr<Material>& material, 
+		UINT32 techniqueIdx, const SPtr<GpuParamsSet>& params)
+	{
+		SamplerOverrideKey samplerKey(material, techniqueIdx);
 		auto iterFind = mSamplerOverrides.find(samplerKey);
 		if (iterFind != mSamplerOverrides.end())
 		{
@@ -1341,9 +1555,9 @@ namespace bs {	namespace ct
 		}
 		else
 		{
-			SPtr<Shader> shader = elem.material->getShader();
+			SPtr<Shader> shader = material->getShader();
 			MaterialSamplerOverrides* samplerOverrides = SamplerOverrideUtility::generateSamplerOverrides(shader,
-				elem.material->_getInternalParams(), elem.params, mOptions);
+				material->_getInternalParams(), params, mOptions);
 
 			mSamplerOverrides[samplerKey] = samplerOverrides;
 
@@ -1354,7 +1568,12 @@ namespace bs {	namespace ct
 
 	void RendererScene::freeSamplerStateOverrides(RenderElement& elem)
 	{
-		SamplerOverrideKey samplerKey(elem.material, elem.techniqueIdx);
+		freeSamplerStateOverrides(elem.material, elem.techniqueIdx);
+	}
+
+	void RendererScene::freeSamplerStateOverrides(const SPtr<Material>& material, UINT32 techniqueIdx)
+	{
+		SamplerOverrideKey samplerKey(material, techniqueIdx);
 
 		auto iterFind = mSamplerOverrides.find(samplerKey);
 		assert(iterFind != mSamplerOverrides.end());
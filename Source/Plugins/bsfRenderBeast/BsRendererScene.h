@@ -8,6 +8,8 @@
 #include "BsRendererParticles.h"
 #include "Shading/BsLightProbes.h"
 #include "Utility/BsSamplerOverrides.h"
+#include "Utility/BsBoneMatrixBuffer.h"
+#include "Utility/BsOctree.h"
 
 namespace bs 
 { 
@@ -38,6 +40,10 @@ namespace bs
 		// Renderables
 		Vector<RendererRenderable*> renderables;
 		Vector<CullInfo> renderableCullInfos;
+		Vector<OctreeElementId> renderableOctreeIds;
+
+		/** Incremented whenever a renderable that isn't movable is added, removed or modified. */
+		UINT64 staticRenderablesVersion = 0;
 
 		// Lights
 		Vector<RendererLight> directionalLights;
@@ -71,6 +77,29 @@ namespace bs
 		mutable Vector<bool> renderableReady;
 	};
 
+	/** Options for the octree used for spatial queries of renderables. Elements are indices into SceneInfo::renderables. */
+	struct RenderableOctreeOptions
+	{
+		enum { LoosePadding = 16 };
+		enum { MinElementsPerNode = 8 };
+		enum { MaxElementsPerNode = 16 };
+		enum { MaxDepth = 12 };
+
+		static simd::AABox getBounds(UINT32 elem, void* context)
+		{
+			const SceneInfo* info = (const SceneInfo*)context;
+			return simd::AABox(info->renderableCullInfos[elem].bounds.getBox());
+		}
+
+		static void setElementId(UINT32 elem, const OctreeElementId& id, void* context)
+		{
+			SceneInfo* info = (SceneInfo*)context;
+			info->renderableOctreeIds[elem] = id;
+		}
+	};
+
+	typedef Octree<UINT32, RenderableOctreeOptions> RenderableOctree;
+
 	/** Contains information about the scene (e.g. renderables, lights, cameras) required by the renderer. */
 	class RendererScene
 	{
@@ -183,6 +212,14 @@ namespace bs
 		 */
 		void prepareRenderable(UINT32 idx, const FrameInfo& frameInfo);
 
+		/** 
+		 * Copies the bone matrices of all skinned renderables whose pose changed and uploads them to the GPU. Must be
+		 * called once per frame, before any renderable is drawn (including shadow casters outside of any view).
+		 *
+		 * @param[in]	frameInfo	Global information describing the current frame.
+		 */
+		void updateBoneMatrices(const FrameInfo& frameInfo);
+
 		/**
 		 * Performs necessary steps to make a particle system ready for rendering. This must be called at least once every 
 		 * frame for every particle system that will be drawn. 
@@ -204,6 +241,12 @@ namespace bs
 		/** Updates the bounds for all the particle systems from the provided object. */
 		void updateParticleSystemBounds(const ParticlePerFrameData* particleRenderData);
 
+		/** 
+		 * Returns an octree containing all renderables in the scene, allowing renderables intersecting a certain volume
+		 * to be found without iterating over all of them.
+		 */
+		const RenderableOctree& getRenderableOctree() const { return mRenderableOctree; }
+
 		/** Returns a modifiable version of SceneInfo. Only to be used by friends who know what they are doing. */
 		SceneInfo& _getSceneInfo() { return mInfo; }
 	private:
@@ -222,12 +265,34 @@ namespace bs
 		 */
 		MaterialSamplerOverrides* allocSamplerStateOverrides(RenderElement& elem);
 
+		/** 
+		 * Allocates (or returns existing) set of sampler state overrides for the provided material technique, using the
+		 * provided parameter set.
+		 */
+		MaterialSamplerOverrides* allocSamplerStateOverrides(const SPtr<Material>& material, UINT32 techniqueIdx,
+			const SPtr<GpuParamsSet>& params);
+
 		/** Frees sampler state overrides previously allocated with allocSamplerStateOverrides(). */
 		void freeSamplerStateOverrides(RenderElement& elem);
 
+		/** Frees sampler state overrides previously allocated with allocSamplerStateOverrides(). */
+		void freeSamplerStateOverrides(const SPtr<Material>& material, UINT32 techniqueIdx);
+
+		/** Assigns the current bone matrix buffer to all skinned renderables. Called whenever the buffer is re-created. */
+		void rebindBoneMatrices();
+
+		/** Applies sampler state overrides to all passes of the provided parameter set. */
+		static void applySamplerOverrides(MaterialSamplerOverrides* overrides, const SPtr<GpuParamsSet>& params,
+			UINT32 numPasses);
+
+		/** Extent of the root node of the renderable octree. Renderables outside of it are kept in the root node. */
+		static constexpr float RENDERABLE_OCTREE_EXTENT = 8192.0f;
+
 		SceneInfo mInfo;
+		RenderableOctree mRenderableOctree;
 		SPtr<GpuParamBlockBuffer> mPerFrameParamBuffer;
 		UnorderedMap<SamplerOverrideKey, MaterialSamplerOverrides*> mSamplerOverrides;
+		BoneMatrixBuffer mBoneMatrices;
 
 		SPtr<RenderBeastOptions> mOptions;
 	};
@@ -4,12 +4,14 @@
 #include "Renderer/BsCamera.h"
 #include "Renderer/BsRenderable.h"
 #include "Renderer/BsRendererUtility.h"
+#include "Mesh/BsMesh.h"
 #include "Material/BsMaterial.h"
 #include "Material/BsShader.h"
 #include "Material/BsGpuParamsSet.h"
 #include "BsRendererLight.h"
 #include "BsRendererScene.h"
 #include "BsRenderBeast.h"
+#include "Threading/BsTaskScheduler.h"
 #include <BsRendererDecal.h>
 
 namespace bs { namespace ct
@@ -80,6 +82,10 @@ namespace bs { namespace ct
 		mDeferredOpaqueQueue = bs_shared_ptr_new<RenderQueue>(reductionMode);
 		mForwardOpaqueQueue = bs_shared_ptr_new<RenderQueue>(reductionMode);
 
+		// Draw order within opaque queues doesn't affect the output, so compatible elements can be grouped
+		mDeferredOpaqueQueue->setInstancing(true);
+		mForwardOpaqueQueue->setInstancing(true);
+
 		StateReduction transparentStateReduction = reductionMode;
 		if (transparentStateReduction == StateReduction::Material)
 			transparentStateReduction = StateReduction::Distance; // Transparent object MUST be sorted by distance
@@ -354,25 +360,37 @@ namespace bs { namespace ct
 			return;
 
 		// Queue renderables
+		mRenderableLODs.resize(sceneInfo.renderables.size(), 0);
 		for(UINT32 i = 0; i < (UINT32)sceneInfo.renderables.size(); i++)
 		{
 			if (!mVisibility.renderables[i])
 				continue;
 
-			const AABox& boundingBox = sceneInfo.renderableCullInfos[i].bounds.getBox();
+			const Bounds& bounds = sceneInfo.renderableCullInfos[i].bounds;
+			const AABox& boundingBox = bounds.getBox();
 			const float distanceToCamera = (mProperties.viewOrigin - boundingBox.getCenter()).length();
 
-			for (auto& renderElem : sceneInfo.renderables[i]->elements)
+			const Vector<RenderableElement>& elements = sceneInfo.renderables[i]->elements;
+			if (elements.empty())
+				continue;
+
+			// All elements share the same mesh
+			const MeshProperties& meshProps = elements[0].mesh->getProperties();
+			const UINT32 lod = selectLOD(i, meshProps, bounds.getSphere());
+
+			for (auto& renderElem : elements)
 			{
+				const SubMesh& subMesh = lod > 0 ? meshProps.getSubMesh(renderElem.subMeshIdx, lod) : renderElem.subMesh;
+
 				// Note: I could keep renderables in multiple separate arrays, so I don't need to do the check here
 				ShaderFlags shaderFlags = renderElem.material->getShader()->getFlags();
 
 				if (shaderFlags.isSet(ShaderFlag::Transparent))
-					mTransparentQueue->add(&renderElem, distanceToCamera, renderElem.techniqueIdx);
+					mTransparentQueue->add(&renderElem, distanceToCamera, renderElem.techniqueIdx, subMesh);
 				else if (shaderFlags.isSet(ShaderFlag::Forward))
-					mForwardOpaqueQueue->add(&renderElem, distanceToCamera, renderElem.techniqueIdx);
+					mForwardOpaqueQueue->add(&renderElem, distanceToCamera, renderElem.techniqueIdx, subMesh);
 				else
-					mDeferredOpaqueQueue->add(&renderElem, distanceToCamera, renderElem.techniqueIdx);
+					mDeferredOpaqueQueue->add(&renderElem, distanceToCamera, renderElem.techniqueIdx, subMesh);
 			}
 		}
 
@@ -441,6 +459,46 @@ namespace bs { namespace ct
 		mDecalQueue->sort();
 	}
 
+	void RendererView::notifyRenderableRemoved(UINT32 renderableIdx, UINT32 lastRenderableIdx)
+	{
+		if (renderableIdx >= (UINT32)mRenderableLODs.size())
+			return;
+
+		mRenderableLODs[renderableIdx] = lastRenderableIdx < (UINT32)mRenderableLODs.size() ? 
+			mRenderableLODs[lastRenderableIdx] : 0;
+
+		mRenderableLODs.resize(std::min((UINT32)mRenderableLODs.size(), lastRenderableIdx));
+	}
+
+	UINT32 RendererView::selectLOD(UINT32 renderableIdx, const MeshProperties& meshProps, const Sphere& bounds)
+	{
+		// Relative distance from the level's threshold the screen size needs to move past, before switching levels
+		static constexpr float LOD_HYSTERESIS = 0.1f;
+
+		const UINT32 numLODs = meshProps.getNumLODs();
+		if (numLODs < 2)
+			return 0;
+
+		// Diameter of the bounds relative to the view height. Projection maps the view height to the [-1, 1] range.
+		float screenSize = bounds.getRadius() * std::abs(mProperties.projTransform[1][1]);
+		if (mProperties.projType == PT_PERSPECTIVE)
+		{
+			const float distance = (bounds.getCenter() - mProperties.viewOrigin).length();
+			screenSize /= std::max(distance, mProperties.nearPlane);
+		}
+
+		UINT32 lod = std::min(mRenderableLODs[renderableIdx], numLODs - 1);
+
+		while ((lod + 1) < numLODs && screenSize < meshProps.getLODScreenSize(lod + 1) * (1.0f - LOD_HYSTERESIS))
+			lod++;
+
+		while (lod > 0 && screenSize > meshProps.getLODScreenSize(lod) * (1.0f + LOD_HYSTERESIS))
+			lod--;
+
+		mRenderableLODs[renderableIdx] = lod;
+		return lod;
+	}
+
 	Vector2 RendererView::getDeviceZToViewZ(const Matrix4& projMatrix)
 	{
 		// Returns a set of values that will transform depth buffer values (in range [0, 1]) to a distance
@@ -708,9 +766,19 @@ namespace bs { namespace ct
 			mViews[i]->determineVisible(sceneInfo.decals, sceneInfo.decalCullInfos, &mVisibility.decals);
 		}
 		
-		// Generate render queues per camera
-		for(UINT32 i = 0; i < numViews; i++)
-			mViews[i]->queueRenderElements(sceneInfo);
+		// Generate render queues per camera. Each view only writes to its own queues, so they can be built in parallel.
+		if(numViews > 1)
+		{
+			SPtr<TaskGroup> queueTask = TaskGroup::create("QueueRenderElements", [this, &sceneInfo](UINT32 idx)
+			{
+				mViews[idx]->queueRenderElements(sceneInfo);
+			}, numViews);
+
+			TaskScheduler::instance().addTaskGroup(queueTask);
+			queueTask->wait();
+		}
+		else if(numViews == 1)
+			mViews[0]->queueRenderElements(sceneInfo);
 
 		// Calculate light visibility for all views
 		const auto numRadialLights = (UINT32)sceneInfo.radialLights.size();
@@ -366,6 +366,15 @@ namespace bs { namespace ct
 		 */
 		void queueRenderElements(const SceneInfo& sceneInfo);
 
+		/** 
+		 * Notifies the view that a renderable was removed from the scene. The last renderable in the scene takes over the
+		 * index of the removed one, so per-renderable state is moved along with it.
+		 *
+		 * @param[in]	renderableIdx		Index of the removed renderable.
+		 * @param[in]	lastRenderableIdx	Index of the last renderable in the scene, before the removal.
+		 */
+		void notifyRenderableRemoved(UINT32 renderableIdx, UINT32 lastRenderableIdx);
+
 		/** Returns the visibility mask calculated with the last call to determineVisible(). */
 		const VisibilityInfo& getVisibilityMasks() const { return mVisibility; }
 
@@ -433,6 +442,18 @@ namespace bs { namespace ct
 		 */
 		static Vector2 getNDCZToDeviceZ();
 	private:
+		/**
+		 * Selects the level of detail to render a renderable's mesh with, depending on the mesh's size on screen. 
+		 * Previously selected level is kept while the size stays close to the level's threshold, in order to avoid
+		 * switching back and forth between levels.
+		 *
+		 * @param[in]	renderableIdx	Index of the renderable in the scene.
+		 * @param[in]	meshProps		Properties of the renderable's mesh.
+		 * @param[in]	bounds			World space bounds of the renderable.
+		 * @return						Index of the level of detail, where 0 represents the original mesh.
+		 */
+		UINT32 selectLOD(UINT32 renderableIdx, const MeshProperties& meshProps, const Sphere& bounds);
+
 		RendererViewProperties mProperties;
 		Camera* mCamera;
 
@@ -449,6 +470,9 @@ namespace bs { namespace ct
 		VisibilityInfo mVisibility;
 		LightGrid mLightGrid;
 		UINT32 mViewIdx;
+
+		/** Level of detail each renderable was last rendered with in this view, indexed by renderable index. */
+		Vector<UINT32> mRenderableLODs;
 	};
 
 	/** Contains one or multiple RendererView%s that are in some way related. */
@@ -55,12 +55,14 @@ set(BS_RENDERBEAST_INC_UTILITY
 	"Utility/BsSamplerOverrides.h"
 	"Utility/BsRendererTextures.h"
 	"Utility/BsTextureRowAllocator.h"
+	"Utility/BsBoneMatrixBuffer.h"
 )
 
 set(BS_RENDERBEAST_SRC_UTILITY
 	"Utility/BsGpuSort.cpp"
 	"Utility/BsSamplerOverrides.cpp"
 	"Utility/BsRendererTextures.cpp"
+	"Utility/BsBoneMatrixBuffer.cpp"
 )
 
 if(WIN32)
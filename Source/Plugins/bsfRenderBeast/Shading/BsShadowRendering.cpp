@@ -12,6 +12,8 @@
 #include "RenderAPI/BsVertexDataDesc.h"
 #include "Renderer/BsRenderer.h"
 #include "BsRendererRenderable.h"
+#include "Renderer/BsRenderable.h"
+#include "Profiling/BsRenderStats.h"
 
 namespace bs { namespace ct
 {
@@ -435,6 +437,27 @@ namespace bs { namespace ct
 		return mTargets[cascadeIdx];
 	}
 
+	/** Determines which shadow casters get rendered, depending on their mobility. */
+	enum class ShadowCasterFilter
+	{
+		/** All casters are rendered. */
+		All,
+		/** Only casters that never move and aren't animated are rendered. */
+		Static,
+		/** Only casters that aren't rendered by the Static filter are rendered. */
+		Dynamic
+	};
+
+	/** 
+	 * Checks if the renderable can be rendered into a cached static shadow map. Such renderables must not move, nor be
+	 * animated. Any other changes cause the renderable to be re-registered with the scene, invalidating the cache.
+	 */
+	bool isStaticShadowCaster(const RendererRenderable& renderable)
+	{
+		const Renderable* internal = renderable.renderable;
+		return internal->getMobility() != ObjectMobility::Movable && internal->getAnimType() == RenderableAnimType::None;
+	}
+
 	/** 
 	 * Provides a common way for all types of shadow depth rendering to render the relevant objects into the depth map. 
 	 * Iterates over all relevant objects in the scene, binds the relevant materials and renders the objects into the depth
@@ -463,8 +486,19 @@ namespace bs { namespace ct
 			UINT32 mask : 6;
 		};
 
+		/**
+		 * Renders all relevant shadow casters into the currently bound render target.
+		 *
+		 * @param[in]	scene			Scene containing the shadow casters.
+		 * @param[in]	frameInfo		Global information describing the current frame.
+		 * @param[in]	opt				Options specific to the shadow type being rendered.
+		 * @param[in]	casterBounds	Optional bounds used for querying the scene for potential shadow casters. If not
+		 *								provided all renderables in the scene are considered.
+		 * @param[in]	filter			Determines which casters to render, depending on their mobility.
+		 */
 		template<class Options>
-		static void execute(RendererScene& scene, const FrameInfo& frameInfo, const Options& opt)
+		static void execute(RendererScene& scene, const FrameInfo& frameInfo, const Options& opt, 
+			const AABox* casterBounds = nullptr, ShadowCasterFilter filter = ShadowCasterFilter::All)
 		{
 			static_assert((UINT32)RenderableAnimType::Count == 4, "RenderableAnimType is expected to have four sequential entries.");
 
@@ -473,10 +507,31 @@ namespace bs { namespace ct
 			bs_frame_mark();
 			{
 				FrameVector<Command> commands[4];
+				FrameVector<UINT32> casters;
+
+				if (casterBounds)
+				{
+					RenderableOctree::BoxIntersectIterator iter(scene.getRenderableOctree(), *casterBounds);
+					while (iter.moveNext())
+						casters.push_back(iter.getElement());
+				}
+				else
+				{
+					casters.resize(sceneInfo.renderables.size());
+					for (UINT32 i = 0; i < (UINT32)casters.size(); i++)
+						casters[i] = i;
+				}
 
 				// Make a list of relevant renderables and prepare them for rendering
-				for (UINT32 i = 0; i < sceneInfo.renderables.size(); i++)
+				for (auto& i : casters)
 				{
+					if (filter != ShadowCasterFilter::All)
+					{
+						const bool isStatic = isStaticShadowCaster(*sceneInfo.renderables[i]);
+						if (isStatic != (filter == ShadowCasterFilter::Static))
+							continue;
+					}
+
 					const Sphere& bounds = sceneInfo.renderableCullInfos[i].bounds.getSphere();
 					if (!opt.intersects(bounds))
 						continue;
@@ -700,6 +755,33 @@ namespace bs { namespace ct
 		mutable ShadowDepthDirectionalMat* material = nullptr;
 	};
 
+	StaticShadowMap& StaticShadowMapCache::get(const Light* light)
+	{
+		StaticShadowMap& staticMap = mMaps[light];
+		staticMap.lastUsedCounter = 0;
+
+		return staticMap;
+	}
+
+	void StaticShadowMapCache::remove(const Light* light)
+	{
+		mMaps.erase(light);
+	}
+
+	void StaticShadowMapCache::releaseUnused(UINT32 maxUnusedFrames)
+	{
+		for(auto iter = mMaps.begin(); iter != mMaps.end();)
+		{
+			if (iter->second.lastUsedCounter >= maxUnusedFrames)
+				iter = mMaps.erase(iter);
+			else
+			{
+				iter->second.lastUsedCounter++;
+				++iter;
+			}
+		}
+	}
+
 	const UINT32 ShadowRendering::MAX_ATLAS_SIZE = 4096;
 	const UINT32 ShadowRendering::MAX_UNUSED_FRAMES = 60;
 	const UINT32 ShadowRendering::MIN_SHADOW_MAP_SIZE = 32;
@@ -770,17 +852,24 @@ namespace bs { namespace ct
 		mCascadedShadowMaps.clear();
 		mDynamicShadowMaps.clear();
 		mShadowCubemaps.clear();
+		mStaticShadowMaps.clear();
 
 		mShadowMapSize = size;
 	}
 
+	void ShadowRendering::notifyLightRemoved(const Light* light)
+	{
+		// A new light could be allocated at the same address, and must not inherit the old light's map
+		mStaticShadowMaps.remove(light);
+	}
+
 	void ShadowRendering::renderShadowMaps(RendererScene& scene, const RendererViewGroup& viewGroup, 
 		const FrameInfo& frameInfo)
 	{
-		// Note: Currently all shadows are dynamic and are rebuilt every frame. I should later added support for static
-		// shadow maps which can be used for immovable lights. Such a light can then maintain a set of shadow maps,
-		// one of which is static and only effects the static geometry, while the rest are per-object shadow maps used
-		// for dynamic objects. Then only a small subset of geometry needs to be redrawn, instead of everything.
+		// Note: Spot and radial lights that aren't movable keep a static shadow map containing only the static geometry,
+		// which is re-rendered only when the light or the static geometry changes. Every frame it gets copied into the
+		// light's shadow map and only the dynamic geometry is rendered on top. Cascaded shadow maps depend on the view
+		// and are always fully re-rendered.
 
 		// Note: Add support for per-object shadows and a way to force a renderable to use per-object shadows. This can be
 		// used for adding high quality shadows on specific objects (e.g. important characters during cinematics).
@@ -895,6 +984,8 @@ namespace bs { namespace ct
 				++iter;
 		}
 
+		mStaticShadowMaps.releaseUnused(MAX_UNUSED_FRAMES);
+
 		// Render shadow maps
 		for (UINT32 i = 0; i < (UINT32)sceneInfo.directionalLights.size(); ++i)
 		{
@@ -1392,9 +1483,6 @@ namespace bs { namespace ct
 		ProfileGPUBlock profileSample("Project spot light shadows");
 
 		RenderAPI& rapi = RenderAPI::instance();
-		rapi.setRenderTarget(atlas.getTarget());
-		rapi.setViewport(mapInfo.normArea);
-		rapi.clearViewport(FBT_DEPTH);
 
 		mapInfo.depthNear = 0.05f;
 		mapInfo.depthFar = light->getAttenuationRadius();
@@ -1432,12 +1520,65 @@ namespace bs { namespace ct
 
 		ConvexVolume worldFrustum(worldPlanes);
 
-		// Render all renderables into the shadow map
+		const Sphere& lightBounds = light->getBounds();
+		AABox casterBounds(lightBounds.getCenter() - lightBounds.getRadius(), 
+			lightBounds.getCenter() + lightBounds.getRadius());
+
 		ShadowRenderQueueSpotOptions spotOptions(
 			worldFrustum,
 			shadowParamsBuffer);
 
-		ShadowRenderQueue::execute(scene, frameInfo, spotOptions);
+		if (light->getMobility() != ObjectMobility::Movable)
+		{
+			// Static casters are rendered at a fixed resolution, so the cached map stays valid when the size of the
+			// light's area in the atlas changes along with its size on screen
+			const UINT32 staticMapSize = getStaticSpotShadowMapSize();
+			const float staticDepthBias = getDepthBias(*light, light->getBounds().getRadius(), mapInfo.depthRange,
+				staticMapSize);
+
+			bool isValid;
+			StaticShadowMap& staticMap = getStaticShadowMap(*light, staticMapSize, false, mapInfo.shadowVPTransform,
+				staticDepthBias, scene, isValid);
+
+			// Render static casters into the static map, if not already cached
+			if (!isValid)
+			{
+				SPtr<GpuParamBlockBuffer> staticParamsBuffer = gShadowParamsDef.createBuffer();
+				gShadowParamsDef.gDepthBias.set(staticParamsBuffer, staticDepthBias);
+				gShadowParamsDef.gInvDepthRange.set(staticParamsBuffer, 1.0f / mapInfo.depthRange);
+				gShadowParamsDef.gMatViewProj.set(staticParamsBuffer, mapInfo.shadowVPTransform);
+				gShadowParamsDef.gNDCZToDeviceZ.set(staticParamsBuffer, RendererView::getNDCZToDeviceZ());
+
+				ShadowRenderQueueSpotOptions staticOptions(
+					worldFrustum,
+					staticParamsBuffer);
+
+				rapi.setRenderTarget(staticMap.texture->renderTexture);
+				rapi.setViewport(Rect2(0.0f, 0.0f, 1.0f, 1.0f));
+				rapi.clearRenderTarget(FBT_DEPTH);
+
+				ShadowRenderQueue::execute(scene, frameInfo, staticOptions, &casterBounds, ShadowCasterFilter::Static);
+			}
+
+			rapi.setRenderTarget(atlas.getTarget());
+			rapi.setViewport(mapInfo.normArea);
+
+			// Depth-stencil textures can't be copied into a region of another texture, so the static casters are
+			// restored by writing the depth of the entire static map into the light's area with a blit
+			gRendererUtility().blit(staticMap.texture->texture, Rect2I::EMPTY, false, true);
+
+			// Render dynamic casters on top of the static ones
+			ShadowRenderQueue::execute(scene, frameInfo, spotOptions, &casterBounds, ShadowCasterFilter::Dynamic);
+		}
+		else
+		{
+			rapi.setRenderTarget(atlas.getTarget());
+			rapi.setViewport(mapInfo.normArea);
+			rapi.clearViewport(FBT_DEPTH);
+
+			// Render all renderables into the shadow map
+			ShadowRenderQueue::execute(scene, frameInfo, spotOptions, &casterBounds);
+		}
 
 		// Restore viewport
 		rapi.setViewport(Rect2(0.0f, 0.0f, 1.0f, 1.0f));
@@ -1536,6 +1677,7 @@ namespace bs { namespace ct
 		gShadowParamsDef.gNDCZToDeviceZ.set(shadowParamsBuffer, RendererView::getNDCZToDeviceZ());
 
 		ConvexVolume frustums[6];
+		Matrix4 faceViewProj[6];
 		Vector<Plane> boundingPlanes;
 		for (UINT32 i = 0; i < 6; i++)
 		{
@@ -1576,7 +1718,7 @@ namespace bs { namespace ct
 			Matrix4 view = Matrix4(viewRotationMat.transpose()) * viewOffsetMat;
 			mapInfo.shadowVPTransforms[i] = proj * view;
 
-			Matrix4 shadowViewProj = adjustedProj * view;
+			faceViewProj[i] = adjustedProj * view;
 
 			// Calculate world frustum for culling
 			const Vector<Plane>& frustumPlanes = localFrustum.getPlanes();
@@ -1591,58 +1733,97 @@ namespace bs { namespace ct
 				j++;
 			}
 
-			ConvexVolume frustum(worldPlanes);
+			frustums[i] = ConvexVolume(worldPlanes);
+
+			// Register far plane of all frustums
+			boundingPlanes.push_back(worldPlanes[FRUSTUM_PLANE_FAR]);
 
+			if(renderAllFacesAtOnce)
+				gShadowCubeMatricesDef.gFaceVPMatrices.set(shadowCubeMatricesBuffer, faceViewProj[i], i);
+		}
+
+		ConvexVolume boundingVolume(boundingPlanes);
+
+		const Sphere& lightBounds = light->getBounds();
+		AABox casterBounds(lightBounds.getCenter() - lightBounds.getRadius(), 
+			lightBounds.getCenter() + lightBounds.getRadius());
+
+		// Renders the casters into the provided cubemap, either all faces at once, or face by face
+		auto renderCasters = [&](const SPtr<Texture>& texture, const SPtr<RenderTarget>& target, bool clear,
+			ShadowCasterFilter filter)
+		{
 			if(renderAllFacesAtOnce)
 			{
-				frustums[i] = frustum;
+				rapi.setRenderTarget(target);
+
+				if (clear)
+					rapi.clearRenderTarget(FBT_DEPTH);
+
+				ShadowRenderQueueCubeOptions cubeOptions(
+						frustums,
+						boundingVolume,
+						shadowParamsBuffer,
+						shadowCubeMatricesBuffer,
+						shadowCubeMasksBuffer
+				);
 
-				// Register far plane of all frustums
-				boundingPlanes.push_back(worldPlanes[FRUSTUM_PLANE_FAR]);
-				gShadowCubeMatricesDef.gFaceVPMatrices.set(shadowCubeMatricesBuffer, shadowViewProj, i);
+				ShadowRenderQueue::execute(scene, frameInfo, cubeOptions, &casterBounds, filter);
 			}
 			else
 			{
-				gShadowParamsDef.gMatViewProj.set(shadowParamsBuffer, shadowViewProj);
+				for (UINT32 i = 0; i < 6; i++)
+				{
+					gShadowParamsDef.gMatViewProj.set(shadowParamsBuffer, faceViewProj[i]);
 
-				RENDER_TEXTURE_DESC rtDesc;
-				rtDesc.depthStencilSurface.texture = cubemap.getTexture();
-				rtDesc.depthStencilSurface.face = i;
-				rtDesc.depthStencilSurface.numFaces = 1;
+					RENDER_TEXTURE_DESC rtDesc;
+					rtDesc.depthStencilSurface.texture = texture;
+					rtDesc.depthStencilSurface.face = i;
+					rtDesc.depthStencilSurface.numFaces = 1;
 
-				SPtr<RenderTarget> faceRt = RenderTexture::create(rtDesc);
+					SPtr<RenderTarget> faceRt = RenderTexture::create(rtDesc);
 
-				rapi.setRenderTarget(faceRt);
-				rapi.clearRenderTarget(FBT_DEPTH);
+					rapi.setRenderTarget(faceRt);
 
-				// Render all renderables into the shadow map
-				ConvexVolume boundingVolume(boundingPlanes);
-				ShadowRenderQueueCubeSingleOptions cubeOptions(
-						frustum,
-						shadowParamsBuffer
-				);
+					if (clear)
+						rapi.clearRenderTarget(FBT_DEPTH);
+
+					ShadowRenderQueueCubeSingleOptions cubeOptions(
+							frustums[i],
+							shadowParamsBuffer
+					);
 
-				ShadowRenderQueue::execute(scene, frameInfo, cubeOptions);
+					ShadowRenderQueue::execute(scene, frameInfo, cubeOptions, &casterBounds, filter);
+				}
 			}
-		}
+		};
 
-		if(renderAllFacesAtOnce)
+		if (light->getMobility() != ObjectMobility::Movable)
 		{
-			rapi.setRenderTarget(cubemap.getTarget());
-			rapi.clearRenderTarget(FBT_DEPTH);
+			bool isValid;
+			StaticShadowMap& staticMap = getStaticShadowMap(*light, options.mapSize, true, 
+				mapInfo.shadowVPTransforms[0], mapInfo.depthBias, scene, isValid);
 
-			// Render all renderables into the shadow map
-			ConvexVolume boundingVolume(boundingPlanes);
-			ShadowRenderQueueCubeOptions cubeOptions(
-					frustums,
-					boundingVolume,
-					shadowParamsBuffer,
-					shadowCubeMatricesBuffer,
-					shadowCubeMasksBuffer
-			);
+			// Render static casters into the static map, if not already cached
+			if (!isValid)
+			{
+				renderCasters(staticMap.texture->texture, staticMap.texture->renderTexture, true, 
+					ShadowCasterFilter::Static);
+			}
+
+			for (UINT32 i = 0; i < 6; i++)
+			{
+				TEXTURE_COPY_DESC copyDesc;
+				copyDesc.srcFace = i;
+				copyDesc.dstFace = i;
+
+				staticMap.texture->texture->copy(cubemap.getTexture(), copyDesc);
+			}
 
-			ShadowRenderQueue::execute(scene, frameInfo, cubeOptions);
+			// Render dynamic casters on top of the static ones
+			renderCasters(cubemap.getTexture(), cubemap.getTarget(), false, ShadowCasterFilter::Dynamic);
 		}
+		else
+			renderCasters(cubemap.getTexture(), cubemap.getTarget(), true, ShadowCasterFilter::All);
 
 		LightShadows& lightShadows = mRadialLightShadows[options.lightIdx];
 
@@ -1650,6 +1831,58 @@ namespace bs { namespace ct
 		lightShadows.numShadows++;
 	}
 
+	StaticShadowMap& ShadowRendering::getStaticShadowMap(const Light& light, UINT32 mapSize, bool cube,
+		const Matrix4& shadowVPTransform, float depthBias, const RendererScene& scene, bool& isValid)
+	{
+		const SceneInfo& sceneInfo = scene.getSceneInfo();
+
+		StaticShadowMap& staticMap = mStaticShadowMaps.get(&light);
+
+		// Light type can change while the light keeps its map, switching between a 2D and a cube map
+		const bool needsTexture = staticMap.texture == nullptr || !staticMap.isCompatible(mapSize, cube);
+		if (needsTexture)
+		{
+			staticMap.mapSize = mapSize;
+			staticMap.cube = cube;
+
+			if (cube)
+			{
+				staticMap.texture = GpuResourcePool::instance().get(
+					POOLED_RENDER_TEXTURE_DESC::createCube(SHADOW_MAP_FORMAT, mapSize, mapSize, TU_DEPTHSTENCIL));
+			}
+			else
+			{
+				staticMap.texture = GpuResourcePool::instance().get(
+					POOLED_RENDER_TEXTURE_DESC::create2D(SHADOW_MAP_FORMAT, mapSize, mapSize, TU_DEPTHSTENCIL));
+			}
+		}
+
+		isValid = !needsTexture && 
+			staticMap.shadowVPTransform == shadowVPTransform &&
+			staticMap.depthBias == depthBias &&
+			staticMap.staticRenderablesVersion == sceneInfo.staticRenderablesVersion;
+
+		if (isValid)
+			BS_INC_RENDER_STAT(NumShadowCacheHits);
+		else
+		{
+			BS_INC_RENDER_STAT(NumShadowCacheMisses);
+
+			staticMap.shadowVPTransform = shadowVPTransform;
+			staticMap.depthBias = depthBias;
+			staticMap.staticRenderablesVersion = sceneInfo.staticRenderablesVersion;
+		}
+
+		return staticMap;
+	}
+
+	UINT32 ShadowRendering::getStaticSpotShadowMapSize() const
+	{
+		// Largest size calcShadowMapProperties() can return
+		const UINT32 mapSize = std::max(mShadowMapSize, MIN_SHADOW_MAP_SIZE);
+		return std::max(mapSize - 2 * SHADOW_MAP_BORDER, 1u);
+	}
+
 	void ShadowRendering::calcShadowMapProperties(const RendererLight& light, const RendererViewGroup& viewGroup, 
 		UINT32 border, UINT32& size, SmallVector<float, 6>& fadePercents, float& maxFadePercent) const
 	{
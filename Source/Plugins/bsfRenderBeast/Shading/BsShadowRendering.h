@@ -509,6 +509,50 @@ namespace bs { namespace ct
 		Vector<ShadowInfo> mShadowInfos;
 	};
 
+	/** 
+	 * Shadow map containing only the static shadow casters of a single light that isn't movable. Kept across frames
+	 * and restored into the light's shadow map every frame, after which only the dynamic casters need to be rendered.
+	 */
+	struct StaticShadowMap
+	{
+		/** Checks if the map's texture was allocated for a shadow map of the specified size and type. */
+		bool isCompatible(UINT32 size, bool isCube) const { return mapSize == size && cube == isCube; }
+
+		SPtr<PooledRenderTexture> texture;
+		UINT32 mapSize = 0;
+		bool cube = false;
+		Matrix4 shadowVPTransform;
+		float depthBias = 0.0f;
+		UINT64 staticRenderablesVersion = 0;
+		UINT32 lastUsedCounter = 0;
+	};
+
+	/** 
+	 * Keeps track of static shadow maps of lights that aren't movable. A map is released when its light is removed, or
+	 * after it goes unused for a number of frames.
+	 */
+	class StaticShadowMapCache
+	{
+	public:
+		/** Returns the static shadow map of the provided light, creating an empty one if needed. Marks the map as used. */
+		StaticShadowMap& get(const Light* light);
+
+		/** Releases the static shadow map of the provided light, if it has one. */
+		void remove(const Light* light);
+
+		/** Ages all maps by one frame, and releases the ones that were unused for @p maxUnusedFrames frames or more. */
+		void releaseUnused(UINT32 maxUnusedFrames);
+
+		/** Releases all the maps. */
+		void clear() { mMaps.clear(); }
+
+		/** Returns the number of maps currently stored in the cache. */
+		UINT32 getNumMaps() const { return (UINT32)mMaps.size(); }
+
+	private:
+		UnorderedMap<const Light*, StaticShadowMap> mMaps;
+	};
+
 	/** Provides functionality for rendering shadow maps. */
 	class ShadowRendering
 	{
@@ -532,6 +576,7 @@ namespace bs { namespace ct
 		{
 			SmallVector<LightShadows, 6> viewShadows;
 		};
+
 	public:
 		ShadowRendering(UINT32 shadowMapSize);
 
@@ -546,6 +591,9 @@ namespace bs { namespace ct
 
 		/** Changes the default shadow map size. Will cause all shadow maps to be rebuilt. */
 		void setShadowMapSize(UINT32 size);
+
+		/** Releases any shadow maps kept for the provided light. Must be called when a light is removed from the scene. */
+		void notifyLightRemoved(const Light* light);
 	private:
 		/** Renders cascaded shadow maps for the provided directional light viewed from the provided view. */
 		void renderCascadedShadowMaps(const RendererView& view, UINT32 lightIdx, RendererScene& scene, 
@@ -559,6 +607,29 @@ namespace bs { namespace ct
 		void renderRadialShadowMap(const RendererLight& light, const ShadowMapOptions& options, RendererScene& scene, 
 			const FrameInfo& frameInfo);
 
+		/**
+		 * Returns the static shadow map for the provided light, allocating or resizing its texture if needed.
+		 *
+		 * @param[in]	light				Light casting the shadow.
+		 * @param[in]	mapSize				Size of the shadow map (a single face for cube maps), in pixels.
+		 * @param[in]	cube				True if the shadow map is a cubemap used for an omnidirectional shadow.
+		 * @param[in]	shadowVPTransform	View-projection matrix the static casters are to be rendered with (the first
+		 *									face for cube maps).
+		 * @param[in]	depthBias			Depth bias the static casters are to be rendered with.
+		 * @param[in]	scene				Scene the light is part of.
+		 * @param[out]	isValid				True if the existing contents of the map can be used as is. If false the 
+		 *									caller must render the static casters into the map.
+		 * @return							Static shadow map for the light.
+		 */
+		StaticShadowMap& getStaticShadowMap(const Light& light, UINT32 mapSize, bool cube, 
+			const Matrix4& shadowVPTransform, float depthBias, const RendererScene& scene, bool& isValid);
+
+		/** 
+		 * Returns the size of static shadow maps of spot lights, in pixels. Unlike the size of the light's area in the
+		 * atlas, it doesn't depend on the views, so the cached static casters remain valid as the views move.
+		 */
+		UINT32 getStaticSpotShadowMapSize() const;
+
 		/** 
 		 * Calculates optimal shadow map size, taking into account all views in the scene. Also calculates a fade value
 		 * that can be used for fading out small shadow maps.
@@ -675,6 +746,8 @@ namespace bs { namespace ct
 		Vector<LightShadows> mRadialLightShadows;
 		Vector<PerViewLightShadows> mDirectionalLightShadows;
 
+		StaticShadowMapCache mStaticShadowMaps;
+
 		SPtr<VertexDeclaration> mPositionOnlyVD;
 
 		// Mesh information used for drawing near & far planes
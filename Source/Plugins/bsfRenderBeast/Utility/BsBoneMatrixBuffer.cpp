@@ -0,0 +1,189 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Utility/BsBoneMatrixBuffer.h"
+#include "RenderAPI/BsGpuBuffer.h"
+#include "Math/BsMatrix4.h"
+#include "Utility/BsBitwise.h"
+
+namespace bs { namespace ct
+{
+	UINT32 BoneMatrixBuffer::alloc(UINT32 numBones)
+	{
+		UINT32 offset = (UINT32)-1;
+		for (auto iter = mFreeRanges.begin(); iter != mFreeRanges.end(); ++iter)
+		{
+			if (iter->numBones < numBones)
+				continue;
+
+			offset = iter->offset;
+			iter->offset += numBones;
+			iter->numBones -= numBones;
+
+			if (iter->numBones == 0)
+				mFreeRanges.erase(iter);
+
+			break;
+		}
+
+		bool resized = false;
+		if (offset == (UINT32)-1)
+		{
+			offset = mNumBones;
+			mNumBones += numBones;
+
+			if (mNumBones > mCapacity)
+			{
+				mCapacity = std::max(MIN_CAPACITY, Bitwise::nextPow2(mNumBones));
+				mStaging.resize(mCapacity * 3);
+
+				GPU_BUFFER_DESC desc;
+				desc.elementCount = mCapacity * 3;
+				desc.elementSize = 0;
+				desc.type = GBT_STANDARD;
+				desc.format = BF_32X4F;
+				desc.usage = GBU_STATIC;
+
+				mBuffer = GpuBuffer::create(desc);
+				resized = true;
+			}
+		}
+
+		// Initialize bone transforms to identity, so the object renders properly even if no animation is animating it
+		for (UINT32 i = 0; i < numBones; i++)
+			memcpy(&mStaging[(offset + i) * 3], &Matrix4::IDENTITY, 3 * sizeof(Vector4)); // Assuming row-major format
+
+		// A new buffer must not be bound before it has valid contents
+		if (resized)
+		{
+			mFullyDirty = true;
+			flush();
+		}
+		else
+			markDirty(offset, numBones);
+
+		return offset;
+	}
+
+	void BoneMatrixBuffer::free(UINT32 offset, UINT32 numBones)
+	{
+		if (numBones == 0)
+			return;
+
+		auto iter = std::lower_bound(mFreeRanges.begin(), mFreeRanges.end(), offset,
+			[](const BoneRange& range, UINT32 offset) { return range.offset < offset; });
+
+		iter = mFreeRanges.insert(iter, { offset, numBones });
+
+		// Merge with the following range
+		auto next = iter + 1;
+		if (next != mFreeRanges.end() && (iter->offset + iter->numBones) == next->offset)
+		{
+			iter->numBones += next->numBones;
+			iter = mFreeRanges.erase(next) - 1;
+		}
+
+		// Merge with the preceding range
+		if (iter != mFreeRanges.begin())
+		{
+			auto prev = iter - 1;
+			if ((prev->offset + prev->numBones) == iter->offset)
+			{
+				prev->numBones += iter->numBones;
+				iter = mFreeRanges.erase(iter) - 1;
+			}
+		}
+
+		// Return trailing free space so it doesn't need to be uploaded
+		if ((iter->offset + iter->numBones) == mNumBones)
+		{
+			mNumBones = iter->offset;
+			mFreeRanges.erase(iter);
+		}
+	}
+
+	void BoneMatrixBuffer::write(UINT32 offset, const Matrix4* transforms, UINT32 numBones)
+	{
+		Vector4* dest = &mStaging[offset * 3];
+		for (UINT32 i = 0; i < numBones; i++)
+		{
+			memcpy(dest, &transforms[i], 3 * sizeof(Vector4)); // Assuming row-major format
+			dest += 3;
+		}
+
+		markDirty(offset, numBones);
+	}
+
+	void BoneMatrixBuffer::markDirty(UINT32 offset, UINT32 numBones)
+	{
+		if (mFullyDirty || numBones == 0)
+			return;
+
+		// Renderables are usually written in the same order every frame, so try to extend the last range first
+		if (!mDirtyRanges.empty())
+		{
+			BoneRange& last = mDirtyRanges.back();
+			if (offset >= last.offset && offset <= (last.offset + last.numBones + MERGE_GAP))
+			{
+				last.numBones = std::max(last.numBones, offset + numBones - last.offset);
+				return;
+			}
+		}
+
+		mDirtyRanges.push_back({ offset, numBones });
+	}
+
+	void BoneMatrixBuffer::flush()
+	{
+		if (mBuffer == nullptr)
+			return;
+
+		constexpr UINT32 BONE_SIZE = 3 * sizeof(Vector4);
+
+		if (mFullyDirty)
+		{
+			if (mNumBones > 0)
+				mBuffer->writeData(0, mNumBones * BONE_SIZE, mStaging.data(), BWT_NORMAL);
+
+			mFullyDirty = false;
+			mDirtyRanges.clear();
+			return;
+		}
+
+		if (mDirtyRanges.empty())
+			return;
+
+		std::sort(mDirtyRanges.begin(), mDirtyRanges.end(),
+			[](const BoneRange& a, const BoneRange& b) { return a.offset < b.offset; });
+
+		// Merge overlapping and nearby ranges
+		UINT32 numRanges = 0;
+		for (auto& range : mDirtyRanges)
+		{
+			if (numRanges > 0)
+			{
+				BoneRange& prev = mDirtyRanges[numRanges - 1];
+				if (range.offset <= (prev.offset + prev.numBones + MERGE_GAP))
+				{
+					prev.numBones = std::max(prev.numBones, range.offset + range.numBones - prev.offset);
+					continue;
+				}
+			}
+
+			mDirtyRanges[numRanges++] = range;
+		}
+
+		for (UINT32 i = 0; i < numRanges; i++)
+		{
+			// Ranges freed since they were written don't need to be uploaded
+			const BoneRange& range = mDirtyRanges[i];
+			if (range.offset >= mNumBones)
+				break;
+
+			UINT32 numBones = std::min(range.numBones, mNumBones - range.offset);
+			mBuffer->writeData(range.offset * BONE_SIZE, numBones * BONE_SIZE, &mStaging[range.offset * 3],
+				BWT_NORMAL);
+		}
+
+		mDirtyRanges.clear();
+	}
+}}
@@ -0,0 +1,78 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsRenderBeastPrerequisites.h"
+#include "Math/BsVector4.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup RenderBeast
+	 *  @{
+	 */
+
+	/**
+	 * Stores bone matrices of all skinned renderables in a single GPU buffer. Each renderable is assigned a range of bones
+	 * within the buffer, which it references through an offset. Matrices are staged on the CPU and only the ranges that
+	 * were modified since the last flush are written to the GPU buffer. The buffer is created with static usage so ranges
+	 * can be updated in place, meaning flush() should be called once per frame before any draws that reference it.
+	 *
+	 * Each bone is stored as three float4 rows of a row-major 3x4 matrix.
+	 */
+	class BoneMatrixBuffer : public INonCopyable
+	{
+	public:
+		BoneMatrixBuffer() = default;
+
+		/**
+		 * Allocates a range of @p numBones bones, initialized to identity transforms. Might re-create the GPU buffer if
+		 * more space is needed, in which case any existing bindings of getBuffer() need to be updated.
+		 *
+		 * @return	Offset of the first allocated bone, in number of bones.
+		 */
+		UINT32 alloc(UINT32 numBones);
+
+		/** Frees a range previously allocated with alloc(). */
+		void free(UINT32 offset, UINT32 numBones);
+
+		/** Copies @p numBones transforms into the range starting at @p offset. */
+		void write(UINT32 offset, const Matrix4* transforms, UINT32 numBones);
+
+		/** Uploads the staged matrices modified since the last call to the GPU buffer. */
+		void flush();
+
+		/** Returns the GPU buffer containing the matrices. Null if nothing was allocated yet. */
+		const SPtr<GpuBuffer>& getBuffer() const { return mBuffer; }
+
+	private:
+		/** Contiguous range of bones. */
+		struct BoneRange
+		{
+			UINT32 offset;
+			UINT32 numBones;
+		};
+
+		/** Marks a range of bones as requiring an upload on the next flush(). */
+		void markDirty(UINT32 offset, UINT32 numBones);
+
+		/** Minimum number of bones the GPU buffer is created with. */
+		static constexpr UINT32 MIN_CAPACITY = 1024;
+
+		/** 
+		 * Dirty ranges separated by less than this many bones are uploaded as a single range, as uploading a few unmodified
+		 * bones is cheaper than issuing an additional write.
+		 */
+		static constexpr UINT32 MERGE_GAP = 16;
+
+		Vector<Vector4> mStaging;
+		Vector<BoneRange> mFreeRanges;
+		Vector<BoneRange> mDirtyRanges;
+		UINT32 mNumBones = 0;
+		UINT32 mCapacity = 0;
+		bool mFullyDirty = false;
+
+		SPtr<GpuBuffer> mBuffer;
+	};
+
+	/** @} */
+}}
@@ -283,6 +283,9 @@ namespace bs { namespace ct
 			lookup[VET_COLOR_ABGR] = VK_FORMAT_R8G8B8A8_UNORM;
 			lookup[VET_COLOR_ARGB] = VK_FORMAT_R8G8B8A8_UNORM;
 			lookup[VET_UBYTE4_NORM] = VK_FORMAT_R8G8B8A8_UNORM;
+			lookup[VET_SHORT2_NORM] = VK_FORMAT_R16G16_SNORM;
+			lookup[VET_SHORT4_NORM] = VK_FORMAT_R16G16B16A16_SNORM;
+			lookup[VET_HALF2] = VK_FORMAT_R16G16_SFLOAT;
 			lookup[VET_FLOAT1] = VK_FORMAT_R32_SFLOAT;
 			lookup[VET_FLOAT2] = VK_FORMAT_R32G32_SFLOAT;
 			lookup[VET_FLOAT3] = VK_FORMAT_R32G32B32_SFLOAT;